@@ -76,6 +76,27 @@ if(OTBR_DBUS)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_DBUS_SERVER=1)
 endif()
 
+option(OTBR_EPOLL "Use epoll instead of select() in the mainloop" OFF)
+if (OTBR_EPOLL)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_EPOLL=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_EPOLL=0)
+endif()
+
+option(OTBR_TIMER_WHEEL "Use a hashed timing wheel for the delayed tasks of the Task Runner" OFF)
+if (OTBR_TIMER_WHEEL)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_TIMER_WHEEL=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_TIMER_WHEEL=0)
+endif()
+
+option(OTBR_ASYNC_LOG "Emit logs from a dedicated thread instead of the logging thread" OFF)
+if (OTBR_ASYNC_LOG)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_ASYNC_LOG=1)
+else()
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_ASYNC_LOG=0)
+endif()
+
 option(OTBR_FEATURE_FLAGS "Enable feature flags support" OFF)
 if (OTBR_FEATURE_FLAGS)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_FEATURE_FLAGS=1)
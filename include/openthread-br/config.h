@@ -68,4 +68,190 @@
 #define OTBR_CONFIG_CLI_MAX_LINE_LENGTH 640
 #endif
 
+/**
+ * @def OTBR_CONFIG_CLI_MAX_SESSIONS
+ *
+ * Defines the maximum number of concurrent sessions accepted by the CLI daemon.
+ */
+#ifndef OTBR_CONFIG_CLI_MAX_SESSIONS
+#define OTBR_CONFIG_CLI_MAX_SESSIONS 4
+#endif
+
+/**
+ * @def OTBR_CONFIG_CLI_SESSION_MAX_BACKLOG
+ *
+ * Defines the maximum number of output bytes buffered for a CLI session which is not reading fast enough.
+ *
+ * Output beyond this limit is dropped for that session only.
+ */
+#ifndef OTBR_CONFIG_CLI_SESSION_MAX_BACKLOG
+#define OTBR_CONFIG_CLI_SESSION_MAX_BACKLOG (16 * 1024)
+#endif
+
+/**
+ * @def OTBR_CONFIG_CLI_SESSION_MAX_PENDING_COMMANDS
+ *
+ * Defines the maximum number of commands queued for a CLI session while another command is executing.
+ */
+#ifndef OTBR_CONFIG_CLI_SESSION_MAX_PENDING_COMMANDS
+#define OTBR_CONFIG_CLI_SESSION_MAX_PENDING_COMMANDS 8
+#endif
+
+/**
+ * @def OTBR_CONFIG_INLINE_FUNCTION_SIZE
+ *
+ * Defines the size in bytes of the inline buffer of `InlineFunction`, which backs the tasks of the
+ * Task Runner and `OnceCallback`. Callables larger than this are allocated on the heap.
+ */
+#ifndef OTBR_CONFIG_INLINE_FUNCTION_SIZE
+#define OTBR_CONFIG_INLINE_FUNCTION_SIZE 96
+#endif
+
+/**
+ * @def OTBR_CONFIG_TASK_RUNNER_NODE_POOL_SIZE
+ *
+ * Defines the number of preallocated nodes for the tasks posted to the Task Runner without delay.
+ * Tasks posted while all nodes are in use are allocated on the heap.
+ */
+#ifndef OTBR_CONFIG_TASK_RUNNER_NODE_POOL_SIZE
+#define OTBR_CONFIG_TASK_RUNNER_NODE_POOL_SIZE 64
+#endif
+
+/**
+ * @def OTBR_CONFIG_NETIF_MAX_PACKETS_PER_WAKEUP
+ *
+ * Defines the maximum number of IPv6 packets drained from the TUN device each time it becomes readable.
+ */
+#ifndef OTBR_CONFIG_NETIF_MAX_PACKETS_PER_WAKEUP
+#define OTBR_CONFIG_NETIF_MAX_PACKETS_PER_WAKEUP 16
+#endif
+
+/**
+ * @def OTBR_CONFIG_UDP_PROXY_BATCH_SIZE
+ *
+ * Defines the number of UDP datagrams the UDP Proxy receives or sends with a single system call.
+ */
+#ifndef OTBR_CONFIG_UDP_PROXY_BATCH_SIZE
+#define OTBR_CONFIG_UDP_PROXY_BATCH_SIZE 8
+#endif
+
+/**
+ * @def OTBR_CONFIG_UDP_PROXY_MAX_PACKETS_PER_WAKEUP
+ *
+ * Defines the maximum number of UDP datagrams the UDP Proxy receives each time its socket becomes readable.
+ */
+#ifndef OTBR_CONFIG_UDP_PROXY_MAX_PACKETS_PER_WAKEUP
+#define OTBR_CONFIG_UDP_PROXY_MAX_PACKETS_PER_WAKEUP 32
+#endif
+
+/**
+ * @def OTBR_CONFIG_REST_DIAG_REFRESH_INTERVAL
+ *
+ * Defines the interval in milliseconds at which the REST server refreshes its network diagnostics cache.
+ * Cached nodes which have not answered for three intervals are dropped.
+ */
+#ifndef OTBR_CONFIG_REST_DIAG_REFRESH_INTERVAL
+#define OTBR_CONFIG_REST_DIAG_REFRESH_INTERVAL 30000
+#endif
+
+/**
+ * @def OTBR_CONFIG_SRP_REPUBLISH_BATCH_SIZE
+ *
+ * Defines the number of mDNS registrations the Advertising Proxy issues per main loop iteration when it republishes
+ * all SRP hosts and services, for example after the mDNS daemon restarted.
+ */
+#ifndef OTBR_CONFIG_SRP_REPUBLISH_BATCH_SIZE
+#define OTBR_CONFIG_SRP_REPUBLISH_BATCH_SIZE 32
+#endif
+
+/**
+ * @def OTBR_CONFIG_SRP_REPUBLISH_MAX_IN_FLIGHT
+ *
+ * Defines the maximum number of mDNS registrations issued by a republish which may wait for their result. Further
+ * batches are deferred until the mDNS publisher catches up.
+ */
+#ifndef OTBR_CONFIG_SRP_REPUBLISH_MAX_IN_FLIGHT
+#define OTBR_CONFIG_SRP_REPUBLISH_MAX_IN_FLIGHT 128
+#endif
+
+/**
+ * @def OTBR_CONFIG_MDNS_UPDATE_DEBOUNCE_INTERVAL
+ *
+ * Defines the interval in milliseconds during which a changed mDNS host or service registration is not re-published
+ * again. Further updates of the same name arriving within the interval are coalesced into a single update which is
+ * published when it ends. Setting it to zero disables the debouncing.
+ */
+#ifndef OTBR_CONFIG_MDNS_UPDATE_DEBOUNCE_INTERVAL
+#define OTBR_CONFIG_MDNS_UPDATE_DEBOUNCE_INTERVAL 250
+#endif
+
+/**
+ * @def OTBR_CONFIG_TREL_PEER_TABLE_SIZE
+ *
+ * Defines the maximum number of TREL service instances tracked by the TREL DNS-SD module. The least recently
+ * discovered instance is evicted when the table is full.
+ */
+#ifndef OTBR_CONFIG_TREL_PEER_TABLE_SIZE
+#define OTBR_CONFIG_TREL_PEER_TABLE_SIZE 512
+#endif
+
+/**
+ * @def OTBR_CONFIG_LOG_ASYNC_RING_CAPACITY
+ *
+ * Defines the number of log records buffered per logging thread when asynchronous logging is enabled. Records
+ * logged while the buffer is full are dropped and counted. Must be a power of two.
+ */
+#ifndef OTBR_CONFIG_LOG_ASYNC_RING_CAPACITY
+#define OTBR_CONFIG_LOG_ASYNC_RING_CAPACITY 256
+#endif
+
+/**
+ * @def OTBR_CONFIG_LOG_ASYNC_RECORD_SIZE
+ *
+ * Defines the maximum length in bytes of a log line, including its level and tag prefix, when asynchronous logging
+ * is enabled. Longer lines are truncated.
+ */
+#ifndef OTBR_CONFIG_LOG_ASYNC_RECORD_SIZE
+#define OTBR_CONFIG_LOG_ASYNC_RECORD_SIZE 256
+#endif
+
+/**
+ * @def OTBR_CONFIG_LOG_ASYNC_DRAIN_INTERVAL
+ *
+ * Defines the interval in milliseconds at which the log drain thread emits the buffered log records when
+ * asynchronous logging is enabled.
+ */
+#ifndef OTBR_CONFIG_LOG_ASYNC_DRAIN_INTERVAL
+#define OTBR_CONFIG_LOG_ASYNC_DRAIN_INTERVAL 10
+#endif
+
+/**
+ * @def OTBR_CONFIG_LOG_MAX_COMPILED_LEVEL
+ *
+ * Defines the most verbose log level compiled in, as a numeric otbrLogLevel (0 for OTBR_LOG_EMERG to 7 for
+ * OTBR_LOG_DEBUG). More verbose otbrLogXxx() calls are compiled out.
+ */
+#ifndef OTBR_CONFIG_LOG_MAX_COMPILED_LEVEL
+#define OTBR_CONFIG_LOG_MAX_COMPILED_LEVEL 7
+#endif
+
+/**
+ * @def OTBR_CONFIG_LOG_MAX_TAG_LEVELS
+ *
+ * Defines the maximum number of log tags whose log level can be set apart from the global log level.
+ */
+#ifndef OTBR_CONFIG_LOG_MAX_TAG_LEVELS
+#define OTBR_CONFIG_LOG_MAX_TAG_LEVELS 16
+#endif
+
+/**
+ * @def OTBR_CONFIG_LOG_BINARY_FILE_SIZE
+ *
+ * Defines the size in bytes of the memory-mapped file of the binary log. The oldest records are overwritten when it
+ * is full.
+ */
+#ifndef OTBR_CONFIG_LOG_BINARY_FILE_SIZE
+#define OTBR_CONFIG_LOG_BINARY_FILE_SIZE (4 * 1024 * 1024)
+#endif
+
 #endif // OTBR_CONFIG_H_
@@ -165,8 +165,12 @@ otbrError Application::Run(void)
 
     while (!sShouldTerminate)
     {
+        int rval;
+
+#if OTBR_ENABLE_EPOLL
+        rval = MainloopManager::GetInstance().Poll(kPollTimeout);
+#else
         otbr::MainloopContext mainloop;
-        int                   rval;
 
         mainloop.mMaxFd   = -1;
         mainloop.mTimeout = kPollTimeout;
@@ -183,7 +187,11 @@ otbrError Application::Run(void)
         if (rval >= 0)
         {
             MainloopManager::GetInstance().Process(mainloop);
+        }
+#endif
 
+        if (rval >= 0)
+        {
             if (mErrorCondition)
             {
                 error = mErrorCondition();
@@ -196,7 +204,11 @@ otbrError Application::Run(void)
         else if (errno != EINTR)
         {
             error = OTBR_ERROR_ERRNO;
+#if OTBR_ENABLE_EPOLL
+            otbrLogErr("epoll_wait() failed: %s", strerror(errno));
+#else
             otbrLogErr("select() failed: %s", strerror(errno));
+#endif
             break;
         }
     }
@@ -83,6 +83,9 @@ enum
     OTBR_OPT_AUTO_ATTACH,
     OTBR_OPT_REST_LISTEN_ADDR,
     OTBR_OPT_REST_LISTEN_PORT,
+    OTBR_OPT_LOG_TAG_LEVEL,
+    OTBR_OPT_BINARY_LOG,
+    OTBR_OPT_DECODE_BINARY_LOG,
 };
 
 #ifndef OTBR_ENABLE_PLATFORM_ANDROID
@@ -103,6 +106,9 @@ static const struct option kOptions[] = {
     {"auto-attach", optional_argument, nullptr, OTBR_OPT_AUTO_ATTACH},
     {"rest-listen-address", required_argument, nullptr, OTBR_OPT_REST_LISTEN_ADDR},
     {"rest-listen-port", required_argument, nullptr, OTBR_OPT_REST_LISTEN_PORT},
+    {"log-tag-level", required_argument, nullptr, OTBR_OPT_LOG_TAG_LEVEL},
+    {"binary-log", required_argument, nullptr, OTBR_OPT_BINARY_LOG},
+    {"decode-binary-log", required_argument, nullptr, OTBR_OPT_DECODE_BINARY_LOG},
     {0, 0, 0, 0}};
 
 static bool ParseInteger(const char *aStr, long &aOutResult)
@@ -161,11 +167,31 @@ static void PrintHelp(const char *aProgramName)
             "     --rest-listen-address  Network address to listen on for the REST API (default: 127.0.0.1).\n"
             "     --rest-listen-port     Network port to listen on for the REST API "
             "(default: " HELP_DEFAULT_REST_PORT_NUMBER ").\n"
+            "     --log-tag-level        The log level of a log tag as TAG=LEVEL (can be specified multiple times).\n"
+            "     --binary-log           Record all logs unformatted to the given memory-mapped file.\n"
+            "     --decode-binary-log    Print the logs recorded in the given binary log file and exit.\n"
             "\n",
             aProgramName);
     fprintf(stderr, "%s", otSysGetRadioUrlHelpString());
 }
 
+static bool ParseLogTagLevel(char *aArg)
+{
+    bool  successful = false;
+    char *separator  = strchr(aArg, '=');
+    long  level;
+
+    VerifyOrExit(separator != nullptr);
+    *separator = '\0';
+    VerifyOrExit(ParseInteger(separator + 1, level));
+    VerifyOrExit(OTBR_LOG_EMERG <= level && level <= OTBR_LOG_DEBUG);
+    VerifyOrExit(otbrLogSetTagLevel(aArg, static_cast<otbrLogLevel>(level)) == OTBR_ERROR_NONE);
+    successful = true;
+
+exit:
+    return successful;
+}
+
 static void PrintVersion(void)
 {
     printf("%s\n", OTBR_PACKAGE_VERSION);
@@ -229,6 +255,7 @@ static int realmain(int argc, char *argv[])
     bool                      enableAutoAttach  = true;
     const char               *restListenAddress = "127.0.0.1";
     int                       restListenPort    = kPortNumber;
+    const char               *binaryLogPath     = nullptr;
     std::vector<const char *> radioUrls;
     std::vector<const char *> backboneInterfaceNames;
     long                      parseResult;
@@ -296,6 +323,18 @@ static int realmain(int argc, char *argv[])
             restListenPort = parseResult;
             break;
 
+        case OTBR_OPT_LOG_TAG_LEVEL:
+            VerifyOrExit(ParseLogTagLevel(optarg), ret = EXIT_FAILURE);
+            break;
+
+        case OTBR_OPT_BINARY_LOG:
+            binaryLogPath = optarg;
+            break;
+
+        case OTBR_OPT_DECODE_BINARY_LOG:
+            ExitNow(ret = (otbrLogBinaryDecode(optarg, stdout) == OTBR_ERROR_NONE) ? EXIT_SUCCESS : EXIT_FAILURE);
+            break;
+
         default:
             PrintHelp(argv[0]);
             ExitNow(ret = EXIT_FAILURE);
@@ -304,6 +343,12 @@ static int realmain(int argc, char *argv[])
     }
 
     otbrLogInit(argv[0], logLevel, verbose, syslogDisable);
+
+    if (binaryLogPath != nullptr && otbrLogBinaryInit(binaryLogPath, OTBR_LOG_DEBUG) != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to create the binary log %s: %s", binaryLogPath, strerror(errno));
+    }
+
     otbrLogNotice("Running %s", OTBR_PACKAGE_VERSION);
     otbrLogNotice("Thread version: %s", otbr::Host::RcpHost::GetThreadVersion());
     otbrLogNotice("Thread interface: %s", interfaceName);
@@ -302,23 +302,19 @@ void BorderAgent::HandleBorderAgentMeshCoPServiceChanged(bool aIsActive, uint16_
     // Parse extended address from the encoded data for the first time
     if (!mIsInitialized)
     {
-        Mdns::Publisher::TxtList txtList;
-        otbrError                error = Mdns::Publisher::DecodeTxtData(txtList, mOtTxtData.data(), mOtTxtData.size());
+        Mdns::Publisher::TxtEntryView entry;
+        otbrError                     error;
+
+        error = Mdns::Publisher::FindTxtEntry(mOtTxtData.data(), mOtTxtData.size(), "xa", entry);
 
         otbrLogResult(error, "Result of decoding MeshCoP TXT data from OT");
         SuccessOrExit(error);
+        VerifyOrExit(!entry.mIsBooleanAttribute && entry.mValueLength >= sizeof(mExtAddress.m8));
 
-        for (auto &entry : txtList)
-        {
-            if (entry.mKey == "xa")
-            {
-                memcpy(mExtAddress.m8, entry.mValue.data(), sizeof(mExtAddress.m8));
+        memcpy(mExtAddress.m8, entry.mValue, sizeof(mExtAddress.m8));
 
-                mServiceInstanceName = GetServiceInstanceName();
-                mIsInitialized       = true;
-                break;
-            }
-        }
+        mServiceInstanceName = GetServiceInstanceName();
+        mIsInitialized       = true;
     }
 
 exit:
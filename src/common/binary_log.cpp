@@ -0,0 +1,810 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the binary log.
+ */
+
+#include "common/binary_log.hpp"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <link.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "common/time.hpp"
+
+namespace otbr {
+
+namespace {
+
+constexpr char     kFileMagic[8]    = {'O', 'T', 'B', 'R', 'B', 'L', 'O', 'G'};
+constexpr uint32_t kFileVersion     = 1;
+constexpr uint16_t kRecordMagic     = 0xb10c;
+constexpr size_t   kMaxRecordSize   = 1024;
+constexpr size_t   kMaxStringSize   = 255;
+constexpr size_t   kMaxLogTagSize   = 8;
+constexpr size_t   kMinFileSize     = 4096;
+constexpr size_t   kMaxFileSize     = 1u << 30;
+constexpr char     kStringMissing[] = "(unsupported)";
+
+/**
+ * The format strings are recorded as offsets from this anchor, which does not move relative to them when the
+ * executable is loaded at a different address.
+ */
+const char kFormatAnchor[] = "otbr-binary-log";
+
+/**
+ * A record in the data area. The header is followed by the raw arguments, each taking 8 bytes. A string argument
+ * takes 8 bytes for its length followed by its characters padded to a multiple of 8 bytes.
+ *
+ * A record with a zero length marks the end of the data written before wrapping to the start of the data area.
+ */
+struct RecordHeader
+{
+    uint16_t mMagic;
+    uint16_t mLength; ///< The length in bytes of the record including this header, a multiple of 8.
+    uint8_t  mLevel;
+    uint8_t  mReserved[3];
+    uint32_t mSequence;
+    uint32_t mReserved2;
+    uint64_t mTimestamp;
+    int64_t  mFormatOffset;
+    char     mLogTag[kMaxLogTagSize]; ///< Not null-terminated if the tag takes all the bytes.
+};
+
+static_assert(sizeof(RecordHeader) % sizeof(uint64_t) == 0, "RecordHeader must keep the records 8-byte aligned");
+
+/**
+ * The read-only segment of the executable holding the format strings.
+ */
+struct FormatSegment
+{
+    const char *mBegin;
+    const char *mEnd;
+};
+
+/**
+ * A conversion specification of a printf format string.
+ */
+struct Conversion
+{
+    const char *mBegin;      ///< The '%' character.
+    const char *mEnd;        ///< The character following the conversion specifier.
+    const char *mLength;     ///< The length modifier, if any.
+    uint8_t     mLengthSize; ///< The number of characters of the length modifier.
+    char        mSpecifier;  ///< The conversion specifier, or '\0' if the format string ended.
+
+    bool IsSigned(void) const { return mSpecifier == 'd' || mSpecifier == 'i'; }
+    bool IsUnsigned(void) const { return strchr("uoxXc", mSpecifier) != nullptr; }
+    bool IsFloatingPoint(void) const { return strchr("eEfFgGaA", mSpecifier) != nullptr; }
+    bool HasLength(const char *aLength) const
+    {
+        return mLengthSize == strlen(aLength) && strncmp(mLength, aLength, mLengthSize) == 0;
+    }
+};
+
+const char *ParseConversion(const char *aPercent, Conversion &aConversion)
+{
+    const char *cur = aPercent + 1;
+
+    aConversion.mBegin = aPercent;
+
+    while (*cur != '\0' && strchr("-+ #0'", *cur) != nullptr)
+    {
+        cur++;
+    }
+
+    while (*cur == '*' || (*cur >= '0' && *cur <= '9') || *cur == '.')
+    {
+        cur++;
+    }
+
+    aConversion.mLength = cur;
+
+    while (*cur != '\0' && strchr("hljztLq", *cur) != nullptr)
+    {
+        cur++;
+    }
+
+    aConversion.mLengthSize = static_cast<uint8_t>(cur - aConversion.mLength);
+    aConversion.mSpecifier  = *cur;
+    aConversion.mEnd        = (*cur != '\0') ? cur + 1 : cur;
+
+    return aConversion.mEnd;
+}
+
+/**
+ * Writes the raw arguments of a log call into a record buffer.
+ */
+class ArgWriter
+{
+public:
+    ArgWriter(uint8_t *aBuffer, size_t aOffset)
+        : mBuffer(aBuffer)
+        , mOffset(aOffset)
+    {
+    }
+
+    bool WriteSlot(uint64_t aValue)
+    {
+        bool written = false;
+
+        VerifyOrExit(mOffset + sizeof(aValue) <= kMaxRecordSize);
+        memcpy(&mBuffer[mOffset], &aValue, sizeof(aValue));
+        mOffset += sizeof(aValue);
+        written = true;
+
+    exit:
+        return written;
+    }
+
+    bool WriteString(const char *aString)
+    {
+        size_t length  = strnlen(aString, kMaxStringSize);
+        size_t padded  = (length + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1);
+        bool   written = false;
+
+        VerifyOrExit(mOffset + sizeof(uint64_t) + padded <= kMaxRecordSize);
+        VerifyOrExit(WriteSlot(length));
+        memcpy(&mBuffer[mOffset], aString, length);
+        memset(&mBuffer[mOffset + length], 0, padded - length);
+        mOffset += padded;
+        written = true;
+
+    exit:
+        return written;
+    }
+
+    size_t GetOffset(void) const { return mOffset; }
+
+private:
+    uint8_t *mBuffer;
+    size_t   mOffset;
+};
+
+/**
+ * Reads the raw arguments of a record.
+ */
+class ArgReader
+{
+public:
+    ArgReader(const uint8_t *aBegin, const uint8_t *aEnd)
+        : mCur(aBegin)
+        , mEnd(aEnd)
+    {
+    }
+
+    bool ReadSlot(uint64_t &aValue)
+    {
+        bool read = false;
+
+        VerifyOrExit(mEnd - mCur >= static_cast<ptrdiff_t>(sizeof(aValue)));
+        memcpy(&aValue, mCur, sizeof(aValue));
+        mCur += sizeof(aValue);
+        read = true;
+
+    exit:
+        return read;
+    }
+
+    bool ReadString(std::string &aString)
+    {
+        uint64_t length;
+        size_t   padded;
+        bool     read = false;
+
+        VerifyOrExit(ReadSlot(length) && length <= kMaxStringSize);
+        padded = (length + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1);
+        VerifyOrExit(mEnd - mCur >= static_cast<ptrdiff_t>(padded));
+        aString.assign(reinterpret_cast<const char *>(mCur), length);
+        mCur += padded;
+        read = true;
+
+    exit:
+        return read;
+    }
+
+private:
+    const uint8_t *mCur;
+    const uint8_t *mEnd;
+};
+
+bool WriteArgs(ArgWriter &aWriter, const char *aFormat, va_list aArgList)
+{
+    bool written = true;
+
+    for (const char *cur = strchr(aFormat, '%'); cur != nullptr; cur = strchr(cur, '%'))
+    {
+        Conversion conversion;
+
+        cur = ParseConversion(cur, conversion);
+
+        for (const char *star = conversion.mBegin; star < conversion.mLength; star++)
+        {
+            if (*star == '*')
+            {
+                VerifyOrExit(aWriter.WriteSlot(static_cast<uint64_t>(va_arg(aArgList, int))), written = false);
+            }
+        }
+
+        if (conversion.IsSigned())
+        {
+            int64_t value;
+
+            if (conversion.HasLength("l"))
+            {
+                value = va_arg(aArgList, long);
+            }
+            else if (conversion.HasLength("ll") || conversion.HasLength("q"))
+            {
+                value = va_arg(aArgList, long long);
+            }
+            else if (conversion.HasLength("j"))
+            {
+                value = va_arg(aArgList, intmax_t);
+            }
+            else if (conversion.HasLength("z"))
+            {
+                value = static_cast<int64_t>(va_arg(aArgList, size_t));
+            }
+            else if (conversion.HasLength("t"))
+            {
+                value = va_arg(aArgList, ptrdiff_t);
+            }
+            else
+            {
+                value = va_arg(aArgList, int);
+            }
+
+            VerifyOrExit(aWriter.WriteSlot(static_cast<uint64_t>(value)), written = false);
+        }
+        else if (conversion.IsUnsigned())
+        {
+            uint64_t value;
+
+            if (conversion.HasLength("l"))
+            {
+                value = va_arg(aArgList, unsigned long);
+            }
+            else if (conversion.HasLength("ll") || conversion.HasLength("q"))
+            {
+                value = va_arg(aArgList, unsigned long long);
+            }
+            else if (conversion.HasLength("j"))
+            {
+                value = va_arg(aArgList, uintmax_t);
+            }
+            else if (conversion.HasLength("z"))
+            {
+                value = va_arg(aArgList, size_t);
+            }
+            else if (conversion.HasLength("t"))
+            {
+                value = static_cast<uint64_t>(va_arg(aArgList, ptrdiff_t));
+            }
+            else
+            {
+                value = va_arg(aArgList, unsigned int);
+            }
+
+            VerifyOrExit(aWriter.WriteSlot(value), written = false);
+        }
+        else if (conversion.IsFloatingPoint())
+        {
+            double   value = conversion.HasLength("L") ? static_cast<double>(va_arg(aArgList, long double))
+                                                       : va_arg(aArgList, double);
+            uint64_t bits;
+
+            memcpy(&bits, &value, sizeof(bits));
+            VerifyOrExit(aWriter.WriteSlot(bits), written = false);
+        }
+        else if (conversion.mSpecifier == 'p')
+        {
+            VerifyOrExit(aWriter.WriteSlot(reinterpret_cast<uintptr_t>(va_arg(aArgList, void *))), written = false);
+        }
+        else if (conversion.mSpecifier == 's')
+        {
+            const char *value;
+
+            if (conversion.HasLength("l"))
+            {
+                va_arg(aArgList, void *);
+                value = kStringMissing;
+            }
+            else
+            {
+                value = va_arg(aArgList, const char *);
+            }
+
+            VerifyOrExit(aWriter.WriteString(value != nullptr ? value : "(null)"), written = false);
+        }
+        else if (conversion.mSpecifier == 'n')
+        {
+            va_arg(aArgList, void *);
+        }
+        else
+        {
+            // "%%", or an unknown conversion whose argument type is unknown.
+            VerifyOrExit(conversion.mSpecifier == '%', written = false);
+        }
+    }
+
+exit:
+    return written;
+}
+
+void AppendFormatted(std::string &aMessage, const std::string &aSpec, ...)
+{
+    char    buffer[kMaxRecordSize];
+    va_list args;
+
+    va_start(args, aSpec);
+    vsnprintf(buffer, sizeof(buffer), aSpec.c_str(), args);
+    va_end(args);
+
+    aMessage += buffer;
+}
+
+/**
+ * Formats a record the way printf() would have formatted the log call.
+ */
+void FormatArgs(std::string &aMessage, const char *aFormat, ArgReader &aReader)
+{
+    const char *cur = aFormat;
+
+    while (*cur != '\0')
+    {
+        const char *percent = strchr(cur, '%');
+        Conversion  conversion;
+        std::string spec;
+        uint64_t    value;
+        std::string string;
+
+        if (percent == nullptr)
+        {
+            aMessage += cur;
+            break;
+        }
+
+        aMessage.append(cur, percent);
+        cur = ParseConversion(percent, conversion);
+
+        if (conversion.mSpecifier == '%')
+        {
+            aMessage += '%';
+            continue;
+        }
+
+        // Rebuild the conversion with the recorded widths and precisions, and the length modifier of the slots.
+        for (const char *ch = conversion.mBegin; ch < conversion.mLength; ch++)
+        {
+            if (*ch == '*')
+            {
+                VerifyOrExit(aReader.ReadSlot(value));
+                spec += std::to_string(static_cast<int>(value));
+            }
+            else
+            {
+                spec += *ch;
+            }
+        }
+
+        if (conversion.IsSigned() || (conversion.IsUnsigned() && conversion.mSpecifier != 'c'))
+        {
+            VerifyOrExit(aReader.ReadSlot(value));
+            AppendFormatted(aMessage, spec + "ll" + conversion.mSpecifier, value);
+        }
+        else if (conversion.mSpecifier == 'c')
+        {
+            VerifyOrExit(aReader.ReadSlot(value));
+            AppendFormatted(aMessage, spec + 'c', static_cast<int>(value));
+        }
+        else if (conversion.IsFloatingPoint())
+        {
+            double floatValue;
+
+            VerifyOrExit(aReader.ReadSlot(value));
+            memcpy(&floatValue, &value, sizeof(floatValue));
+            AppendFormatted(aMessage, spec + conversion.mSpecifier, floatValue);
+        }
+        else if (conversion.mSpecifier == 'p')
+        {
+            VerifyOrExit(aReader.ReadSlot(value));
+            AppendFormatted(aMessage, spec + 'p', reinterpret_cast<void *>(static_cast<uintptr_t>(value)));
+        }
+        else if (conversion.mSpecifier == 's')
+        {
+            VerifyOrExit(aReader.ReadString(string));
+            AppendFormatted(aMessage, spec + 's', string.c_str());
+        }
+        else if (conversion.mSpecifier != 'n')
+        {
+            ExitNow();
+        }
+    }
+
+    return;
+
+exit:
+    aMessage += " <truncated>";
+}
+
+void LayoutProbe(void)
+{
+}
+
+int64_t GetLayoutCheck(void)
+{
+    return reinterpret_cast<intptr_t>(&LayoutProbe) - reinterpret_cast<intptr_t>(kFormatAnchor);
+}
+
+int FindFormatSegment(struct dl_phdr_info *aInfo, size_t aSize, void *aContext)
+{
+    FormatSegment &segment = *static_cast<FormatSegment *>(aContext);
+    uintptr_t      anchor  = reinterpret_cast<uintptr_t>(kFormatAnchor);
+    int            found   = 0;
+
+    OTBR_UNUSED_VARIABLE(aSize);
+
+    for (ElfW(Half) i = 0; i < aInfo->dlpi_phnum; i++)
+    {
+        const ElfW(Phdr) &header = aInfo->dlpi_phdr[i];
+        uintptr_t         begin  = aInfo->dlpi_addr + header.p_vaddr;
+
+        if (header.p_type != PT_LOAD || anchor < begin || anchor >= begin + header.p_memsz)
+        {
+            continue;
+        }
+
+        // A writable segment may hold anything, the format strings are string literals.
+        if ((header.p_flags & PF_W) == 0)
+        {
+            segment.mBegin = reinterpret_cast<const char *>(begin);
+            segment.mEnd   = reinterpret_cast<const char *>(begin + header.p_memsz);
+        }
+
+        ExitNow(found = 1);
+    }
+
+exit:
+    return found;
+}
+
+/**
+ * Returns the format string of a record, or nullptr if its offset does not point to a string in the read-only
+ * segment holding the format strings.
+ */
+const char *GetFormat(int64_t aFormatOffset, const FormatSegment &aSegment)
+{
+    intptr_t    anchor = reinterpret_cast<intptr_t>(kFormatAnchor);
+    const char *format = nullptr;
+
+    VerifyOrExit(aFormatOffset >= reinterpret_cast<intptr_t>(aSegment.mBegin) - anchor &&
+                 aFormatOffset < reinterpret_cast<intptr_t>(aSegment.mEnd) - anchor);
+
+    format = aSegment.mBegin + (anchor + aFormatOffset - reinterpret_cast<intptr_t>(aSegment.mBegin));
+    VerifyOrExit(memchr(format, '\0', static_cast<size_t>(aSegment.mEnd - format)) != nullptr, format = nullptr);
+
+exit:
+    return format;
+}
+
+bool IsEndMarker(const RecordHeader &aRecord)
+{
+    return aRecord.mMagic == kRecordMagic && aRecord.mLength == 0;
+}
+
+bool IsValidRecord(const uint8_t *aData, uint32_t aOffset, uint32_t aEnd, const FormatSegment &aSegment)
+{
+    const RecordHeader &record = *reinterpret_cast<const RecordHeader *>(&aData[aOffset]);
+
+    return record.mMagic == kRecordMagic && record.mLength >= sizeof(RecordHeader) &&
+           record.mLength % sizeof(uint64_t) == 0 && aOffset + record.mLength <= aEnd &&
+           GetFormat(record.mFormatOffset, aSegment) != nullptr;
+}
+
+/**
+ * Indicates whether the records from @p aOffset up to the end of the data written before wrapping have consecutive
+ * sequence numbers, the last one being followed by @p aNextSequence.
+ */
+bool IsRecordChain(const uint8_t       *aData,
+                   uint32_t             aOffset,
+                   uint32_t             aEnd,
+                   uint32_t             aNextSequence,
+                   const FormatSegment &aSegment)
+{
+    uint32_t sequence = reinterpret_cast<const RecordHeader *>(&aData[aOffset])->mSequence;
+    bool     isChain  = false;
+
+    while (aOffset + sizeof(RecordHeader) <= aEnd)
+    {
+        const RecordHeader &record = *reinterpret_cast<const RecordHeader *>(&aData[aOffset]);
+
+        if (IsEndMarker(record))
+        {
+            break;
+        }
+
+        VerifyOrExit(IsValidRecord(aData, aOffset, aEnd, aSegment) && record.mSequence == sequence);
+        sequence++;
+        aOffset += record.mLength;
+    }
+
+    isChain = (sequence == aNextSequence);
+
+exit:
+    return isChain;
+}
+
+} // namespace
+
+struct BinaryLog::FileHeader
+{
+    char     mMagic[sizeof(kFileMagic)];
+    uint32_t mVersion;
+    uint32_t mDataSize;
+    int64_t  mLayoutCheck; ///< Identifies the executable which wrote the file.
+    uint32_t mWriteOffset; ///< The offset in the data area of the next record.
+    uint32_t mSequence;    ///< The sequence number of the next record.
+    uint8_t  mWrapped;     ///< Whether records were written past the end of the data area.
+    uint8_t  mReserved[31];
+};
+
+otbrError BinaryLog::Open(const char *aPath, size_t aSize)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    int       fd    = -1;
+    void     *map;
+
+    static_assert(sizeof(FileHeader) == 64, "FileHeader must keep the records 8-byte aligned");
+
+    VerifyOrExit(aSize >= kMinFileSize && aSize <= kMaxFileSize, error = OTBR_ERROR_INVALID_ARGS);
+
+    Close();
+
+    fd = open(aPath, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    VerifyOrExit(fd >= 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(ftruncate(fd, static_cast<off_t>(aSize)) == 0, error = OTBR_ERROR_ERRNO);
+
+    map = mmap(nullptr, aSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    VerifyOrExit(map != MAP_FAILED, error = OTBR_ERROR_ERRNO);
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mFileSize = aSize;
+        mHeader   = static_cast<FileHeader *>(map);
+        mData     = static_cast<uint8_t *>(map) + sizeof(FileHeader);
+
+        memcpy(mHeader->mMagic, kFileMagic, sizeof(kFileMagic));
+        mHeader->mVersion     = kFileVersion;
+        mHeader->mDataSize    = static_cast<uint32_t>((aSize - sizeof(FileHeader)) & ~(sizeof(uint64_t) - 1));
+        mHeader->mLayoutCheck = GetLayoutCheck();
+        mHeader->mWriteOffset = 0;
+        mHeader->mSequence    = 0;
+        mHeader->mWrapped     = 0;
+    }
+
+exit:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    return error;
+}
+
+void BinaryLog::Close(void)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    VerifyOrExit(mHeader != nullptr);
+
+    munmap(mHeader, mFileSize);
+    mHeader   = nullptr;
+    mData     = nullptr;
+    mFileSize = 0;
+
+exit:
+    return;
+}
+
+void BinaryLog::Write(uint8_t aLevel, const char *aLogTag, const char *aFormat, va_list aArgList)
+{
+    uint8_t      buffer[kMaxRecordSize];
+    RecordHeader header;
+    ArgWriter    writer(buffer, sizeof(RecordHeader));
+    va_list      args;
+
+    VerifyOrExit(IsOpen());
+
+    memset(&header, 0, sizeof(header));
+    header.mMagic        = kRecordMagic;
+    header.mLevel        = aLevel;
+    header.mTimestamp    = static_cast<uint64_t>(
+        std::chrono::duration_cast<Microseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+    header.mFormatOffset = reinterpret_cast<intptr_t>(aFormat) - reinterpret_cast<intptr_t>(kFormatAnchor);
+
+    if (aLogTag != nullptr)
+    {
+        memcpy(header.mLogTag, aLogTag, strnlen(aLogTag, sizeof(header.mLogTag)));
+    }
+
+    // The arguments which do not fit are dropped, the decoder marks the message as truncated.
+    va_copy(args, aArgList);
+    WriteArgs(writer, aFormat, args);
+    va_end(args);
+
+    header.mLength = static_cast<uint16_t>(writer.GetOffset());
+    memcpy(buffer, &header, sizeof(header));
+    Append(buffer, writer.GetOffset());
+
+exit:
+    return;
+}
+
+void BinaryLog::Append(const void *aData, size_t aLength)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    uint32_t                    offset;
+    RecordHeader                endMarker;
+
+    VerifyOrExit(mHeader != nullptr && aLength <= mHeader->mDataSize);
+
+    offset = mHeader->mWriteOffset;
+
+    if (offset + aLength > mHeader->mDataSize)
+    {
+        if (offset + sizeof(endMarker.mMagic) + sizeof(endMarker.mLength) <= mHeader->mDataSize)
+        {
+            endMarker.mMagic  = kRecordMagic;
+            endMarker.mLength = 0;
+            memcpy(&mData[offset], &endMarker, sizeof(endMarker.mMagic) + sizeof(endMarker.mLength));
+        }
+
+        offset            = 0;
+        mHeader->mWrapped = 1;
+    }
+
+    memcpy(&mData[offset], aData, aLength);
+    reinterpret_cast<RecordHeader *>(&mData[offset])->mSequence = mHeader->mSequence++;
+
+    // Publish the record only once it is complete, so that a crash leaves a decodable file.
+    mHeader->mWriteOffset = static_cast<uint32_t>(offset + aLength);
+
+exit:
+    return;
+}
+
+otbrError BinaryLog::Decode(const char *aPath, const DecodeCallback &aCallback)
+{
+    otbrError             error = OTBR_ERROR_NONE;
+    FILE                 *file  = fopen(aPath, "rb");
+    FileHeader            header;
+    std::vector<uint64_t> data;
+    const uint8_t        *bytes;
+    uint32_t              segments[2][2];
+    uint8_t               numSegments = 0;
+    uint32_t              nextSequence;
+    FormatSegment         formats = {nullptr, nullptr};
+
+    VerifyOrExit(file != nullptr, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(fread(&header, sizeof(header), 1, file) == 1, error = OTBR_ERROR_PARSE);
+    VerifyOrExit(memcmp(header.mMagic, kFileMagic, sizeof(kFileMagic)) == 0 && header.mVersion == kFileVersion,
+                 error = OTBR_ERROR_PARSE);
+    VerifyOrExit(header.mLayoutCheck == GetLayoutCheck(), error = OTBR_ERROR_PARSE);
+    VerifyOrExit(header.mDataSize <= kMaxFileSize && header.mWriteOffset <= header.mDataSize,
+                 error = OTBR_ERROR_PARSE);
+
+    data.resize(header.mDataSize / sizeof(uint64_t));
+    VerifyOrExit(fread(data.data(), 1, header.mDataSize, file) == header.mDataSize, error = OTBR_ERROR_PARSE);
+    bytes = reinterpret_cast<const uint8_t *>(data.data());
+
+    dl_iterate_phdr(FindFormatSegment, &formats);
+    VerifyOrExit(formats.mBegin != nullptr, error = OTBR_ERROR_PARSE);
+
+    // The sequence number following the records written before wrapping.
+    nextSequence = (header.mWriteOffset >= sizeof(RecordHeader))
+                       ? reinterpret_cast<const RecordHeader *>(bytes)->mSequence
+                       : header.mSequence;
+
+    if (header.mWrapped)
+    {
+        // The oldest records follow the write offset, after the partly overwritten record.
+        segments[numSegments][0]   = header.mWriteOffset;
+        segments[numSegments++][1] = header.mDataSize;
+    }
+
+    segments[numSegments][0]   = 0;
+    segments[numSegments++][1] = header.mWriteOffset;
+
+    for (uint8_t i = 0; i < numSegments; i++)
+    {
+        uint32_t offset = segments[i][0];
+        bool     synced = (i == numSegments - 1);
+
+        while (offset + sizeof(RecordHeader) <= segments[i][1])
+        {
+            const RecordHeader &record = *reinterpret_cast<const RecordHeader *>(&bytes[offset]);
+            char                logTag[kMaxLogTagSize + 1];
+            std::string         message;
+            Entry               entry;
+
+            if (IsEndMarker(record))
+            {
+                break;
+            }
+
+            // Resynchronize on the next record after the partly overwritten one. Arguments may look like a record,
+            // so the record must start a chain of records with consecutive sequence numbers up to the newest ones.
+            if (!synced && !IsRecordChain(bytes, offset, segments[i][1], nextSequence, formats))
+            {
+                offset += sizeof(uint64_t);
+                continue;
+            }
+
+            synced = true;
+            VerifyOrExit(IsValidRecord(bytes, offset, segments[i][1], formats), error = OTBR_ERROR_PARSE);
+
+            ArgReader reader(&bytes[offset + sizeof(RecordHeader)], &bytes[offset + record.mLength]);
+
+            memcpy(logTag, record.mLogTag, kMaxLogTagSize);
+            logTag[kMaxLogTagSize] = '\0';
+            FormatArgs(message, GetFormat(record.mFormatOffset, formats), reader);
+
+            entry.mTimestamp = record.mTimestamp;
+            entry.mLevel     = record.mLevel;
+            entry.mLogTag    = (logTag[0] != '\0') ? logTag : nullptr;
+            entry.mMessage   = message.c_str();
+            aCallback(entry);
+
+            offset += record.mLength;
+        }
+    }
+
+exit:
+    if (file != nullptr)
+    {
+        fclose(file);
+    }
+
+    return error;
+}
+
+} // namespace otbr
@@ -0,0 +1,143 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the binary log, which records log calls without formatting them.
+ */
+
+#ifndef OTBR_COMMON_BINARY_LOG_HPP_
+#define OTBR_COMMON_BINARY_LOG_HPP_
+
+#include <openthread-br/config.h>
+
+#include <functional>
+#include <mutex>
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a binary log kept in a memory-mapped file.
+ *
+ * A record holds the offset of the format string within the executable and the raw arguments, so writing it costs a
+ * scan of the format string and a copy instead of a full formatting. String arguments are copied as they may not
+ * outlive the call. The file is a ring: when it is full the oldest records are overwritten.
+ *
+ * The records are formatted offline by decoding the file with the same executable which wrote it.
+ */
+class BinaryLog : private NonCopyable
+{
+public:
+    /**
+     * This type represents a decoded log record.
+     */
+    struct Entry
+    {
+        uint64_t    mTimestamp; ///< The time of the log call in microseconds since the epoch.
+        uint8_t     mLevel;     ///< The log level.
+        const char *mLogTag;    ///< The log tag, or nullptr if the log call had none.
+        const char *mMessage;   ///< The formatted message.
+    };
+
+    /**
+     * This type represents the callback receiving decoded log records, oldest first.
+     */
+    using DecodeCallback = std::function<void(const Entry &aEntry)>;
+
+    /**
+     * This constructor initializes a closed binary log.
+     */
+    BinaryLog(void) = default;
+
+    /**
+     * This method opens the binary log, creating or truncating the file.
+     *
+     * @param[in] aPath  The path of the file.
+     * @param[in] aSize  The size in bytes of the file.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully opened the binary log.
+     * @retval OTBR_ERROR_INVALID_ARGS  @p aSize is too small or too large.
+     * @retval OTBR_ERROR_ERRNO         Failed to create or map the file.
+     */
+    otbrError Open(const char *aPath, size_t aSize);
+
+    /**
+     * This method closes the binary log.
+     */
+    void Close(void);
+
+    /**
+     * This method indicates whether the binary log is open.
+     *
+     * @returns Whether the binary log is open.
+     */
+    bool IsOpen(void) const { return mHeader != nullptr; }
+
+    /**
+     * This method records a log call.
+     *
+     * @param[in] aLevel    The log level.
+     * @param[in] aLogTag   The log tag, or nullptr if none.
+     * @param[in] aFormat   The format string, which must be a string literal of this executable.
+     * @param[in] aArgList  The arguments of @p aFormat.
+     */
+    void Write(uint8_t aLevel, const char *aLogTag, const char *aFormat, va_list aArgList);
+
+    /**
+     * This method decodes a binary log file written by this executable.
+     *
+     * @param[in] aPath      The path of the file.
+     * @param[in] aCallback  The callback receiving the decoded records.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully decoded the file.
+     * @retval OTBR_ERROR_ERRNO  Failed to read the file.
+     * @retval OTBR_ERROR_PARSE  The file is not a binary log of this executable, or a record is corrupted.
+     */
+    static otbrError Decode(const char *aPath, const DecodeCallback &aCallback);
+
+private:
+    struct FileHeader;
+
+    void Append(const void *aData, size_t aLength);
+
+    std::mutex  mMutex;
+    FileHeader *mHeader   = nullptr;
+    uint8_t    *mData     = nullptr;
+    size_t      mFileSize = 0;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_BINARY_LOG_HPP_
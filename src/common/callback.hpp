@@ -31,9 +31,10 @@
 
 #include "openthread-br/config.h"
 
-#include <functional>
 #include <type_traits>
 
+#include "common/inline_function.hpp"
+
 namespace otbr {
 
 template <class T> class OnceCallback;
@@ -102,7 +103,7 @@ public:
     bool IsNull() const { return mFunc == nullptr; }
 
 private:
-    std::function<R(Args...)> mFunc;
+    InlineFunction<R(Args...)> mFunc;
 };
 
 } // namespace otbr
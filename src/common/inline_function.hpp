@@ -0,0 +1,238 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a move-only callable wrapper with an inline buffer.
+ */
+
+#ifndef OTBR_COMMON_INLINE_FUNCTION_HPP_
+#define OTBR_COMMON_INLINE_FUNCTION_HPP_
+
+#include "openthread-br/config.h"
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace otbr {
+
+template <typename Signature, size_t kInlineSize = OTBR_CONFIG_INLINE_FUNCTION_SIZE> class InlineFunction;
+
+/**
+ * A move-only callable wrapper which stores small callables in an inline buffer.
+ *
+ * Unlike std::function, the callable is stored in a buffer of @p kInlineSize bytes inside the object
+ * whenever it fits, so wrapping a lambda with typical captures never allocates. Larger callables
+ * fall back to the heap. As the wrapper is move-only, it can also hold move-only callables.
+ *
+ * Example usage:
+ *  InlineFunction<int(int)> square([](int x) { return x * x; });
+ *  square(5); // Returns 25.
+ */
+template <typename R, typename... Args, size_t kInlineSize> class InlineFunction<R(Args...), kInlineSize>
+{
+public:
+    /**
+     * This constructor creates an empty function.
+     */
+    InlineFunction(void)
+        : mOps(nullptr)
+    {
+    }
+
+    /**
+     * This constructor creates an empty function.
+     */
+    InlineFunction(std::nullptr_t)
+        : mOps(nullptr)
+    {
+    }
+
+    /**
+     * This constructor creates a function from a callable.
+     *
+     * A null function pointer or an empty std::function results in an empty function.
+     *
+     * @param[in] aFunc  The callable to wrap.
+     */
+    template <typename T,
+              typename = typename std::enable_if<!std::is_same<typename std::decay<T>::type, InlineFunction>::value>::type>
+    InlineFunction(T &&aFunc)
+        : mOps(nullptr)
+    {
+        typedef typename std::decay<T>::type Func;
+
+        if (!IsNullCallable(aFunc))
+        {
+            Construct<Func>(std::forward<T>(aFunc), std::integral_constant<bool, IsStoredInline<Func>()>());
+        }
+    }
+
+    InlineFunction(InlineFunction &&aOther)
+        : mOps(nullptr)
+    {
+        MoveFrom(aOther);
+    }
+
+    InlineFunction &operator=(InlineFunction &&aOther)
+    {
+        if (this != &aOther)
+        {
+            Reset();
+            MoveFrom(aOther);
+        }
+
+        return *this;
+    }
+
+    InlineFunction &operator=(std::nullptr_t)
+    {
+        Reset();
+
+        return *this;
+    }
+
+    InlineFunction(const InlineFunction &)            = delete;
+    InlineFunction &operator=(const InlineFunction &) = delete;
+
+    ~InlineFunction(void) { Reset(); }
+
+    /**
+     * This method invokes the wrapped callable.
+     *
+     * The function must not be empty.
+     */
+    R operator()(Args... aArgs) const
+    {
+        return mOps->mInvoke(const_cast<void *>(static_cast<const void *>(&mStorage)), std::forward<Args>(aArgs)...);
+    }
+
+    /**
+     * This method indicates whether the function is not empty.
+     */
+    explicit operator bool(void) const { return mOps != nullptr; }
+
+    bool operator==(std::nullptr_t) const { return mOps == nullptr; }
+    bool operator!=(std::nullptr_t) const { return mOps != nullptr; }
+
+    /**
+     * This method indicates whether a callable of type @p Func is stored without heap allocation.
+     */
+    template <typename Func> static constexpr bool IsStoredInline(void)
+    {
+        return sizeof(Func) <= kInlineSize && alignof(Func) <= alignof(Storage) &&
+               std::is_nothrow_move_constructible<Func>::value;
+    }
+
+private:
+    typedef typename std::aligned_storage<kInlineSize, alignof(std::max_align_t)>::type Storage;
+
+    struct Ops
+    {
+        R (*mInvoke)(void *aStorage, Args &&...aArgs);
+        void (*mMove)(void *aDst, void *aSrc);
+        void (*mDestroy)(void *aStorage);
+    };
+
+    template <typename Func> static Func *GetInline(void *aStorage) { return static_cast<Func *>(aStorage); }
+    template <typename Func> static Func *GetHeap(void *aStorage) { return *static_cast<Func **>(aStorage); }
+
+    template <typename Func> static R InvokeInline(void *aStorage, Args &&...aArgs)
+    {
+        return (*GetInline<Func>(aStorage))(std::forward<Args>(aArgs)...);
+    }
+
+    template <typename Func> static void MoveInline(void *aDst, void *aSrc)
+    {
+        new (aDst) Func(std::move(*GetInline<Func>(aSrc)));
+        GetInline<Func>(aSrc)->~Func();
+    }
+
+    template <typename Func> static void DestroyInline(void *aStorage) { GetInline<Func>(aStorage)->~Func(); }
+
+    template <typename Func> static R InvokeHeap(void *aStorage, Args &&...aArgs)
+    {
+        return (*GetHeap<Func>(aStorage))(std::forward<Args>(aArgs)...);
+    }
+
+    template <typename Func> static void MoveHeap(void *aDst, void *aSrc)
+    {
+        *static_cast<Func **>(aDst) = GetHeap<Func>(aSrc);
+    }
+
+    template <typename Func> static void DestroyHeap(void *aStorage) { delete GetHeap<Func>(aStorage); }
+
+    template <typename Func, typename T> void Construct(T &&aFunc, std::true_type)
+    {
+        static const Ops kOps = {&InvokeInline<Func>, &MoveInline<Func>, &DestroyInline<Func>};
+
+        new (&mStorage) Func(std::forward<T>(aFunc));
+        mOps = &kOps;
+    }
+
+    template <typename Func, typename T> void Construct(T &&aFunc, std::false_type)
+    {
+        static const Ops kOps = {&InvokeHeap<Func>, &MoveHeap<Func>, &DestroyHeap<Func>};
+
+        *reinterpret_cast<Func **>(&mStorage) = new Func(std::forward<T>(aFunc));
+        mOps                                  = &kOps;
+    }
+
+    void MoveFrom(InlineFunction &aOther)
+    {
+        if (aOther.mOps != nullptr)
+        {
+            aOther.mOps->mMove(&mStorage, &aOther.mStorage);
+            mOps        = aOther.mOps;
+            aOther.mOps = nullptr;
+        }
+    }
+
+    void Reset(void)
+    {
+        if (mOps != nullptr)
+        {
+            mOps->mDestroy(&mStorage);
+            mOps = nullptr;
+        }
+    }
+
+    template <typename T> static bool IsNullCallable(const T &) { return false; }
+    template <typename T> static bool IsNullCallable(T *aFunc) { return aFunc == nullptr; }
+    template <typename S> static bool IsNullCallable(const std::function<S> &aFunc) { return !aFunc; }
+
+    const Ops *mOps;
+    Storage    mStorage;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_INLINE_FUNCTION_HPP_
@@ -43,13 +43,23 @@
 #include <string.h>
 #include <sys/time.h>
 #include <syslog.h>
+#include <time.h>
 
 #if OTBR_ENABLE_PLATFORM_ANDROID
 #include <log/log.h>
 #endif
 
+#include <algorithm>
 #include <sstream>
 
+#if OTBR_ENABLE_ASYNC_LOG
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+#include "common/binary_log.hpp"
 #include "common/code_utils.hpp"
 #include "common/time.hpp"
 
@@ -61,6 +71,30 @@ static bool sSyslogDisabled = false;
 
 static otbrLogLevel sDefaultLevel = OTBR_LOG_INFO;
 
+/**
+ * A log level set for a single log tag.
+ */
+struct LogTagLevel
+{
+    static constexpr size_t kMaxLogTagLength = 15;
+
+    char         mLogTag[kMaxLogTagLength + 1];
+    otbrLogLevel mLevel;
+};
+
+static LogTagLevel     sTagLevels[OTBR_CONFIG_LOG_MAX_TAG_LEVELS];
+static uint8_t         sNumTagLevels = 0;
+static otbr::BinaryLog sBinaryLog;
+static otbrLogLevel    sBinaryLevel = OTBR_LOG_EMERG;
+
+// The most verbose of the global, tag and binary log levels, so that most filtered logs cost a single comparison.
+static otbrLogLevel sMaxLevel = OTBR_LOG_INFO;
+
+#if OTBR_ENABLE_ASYNC_LOG
+static void StartLogDrain(void);
+static void StopLogDrain(void);
+#endif
+
 /** Get the current debug log level */
 otbrLogLevel otbrLogGetLevel(void)
 {
@@ -76,10 +110,77 @@ otbrLogLevel otbrLogGetDefaultLevel(void)
 /**
  * Set current log level.
  */
+static void UpdateMaxLevel(void)
+{
+    sMaxLevel = sLevel;
+
+    for (uint8_t i = 0; i < sNumTagLevels; i++)
+    {
+        sMaxLevel = std::max(sMaxLevel, sTagLevels[i].mLevel);
+    }
+
+    if (sBinaryLog.IsOpen())
+    {
+        sMaxLevel = std::max(sMaxLevel, sBinaryLevel);
+    }
+}
+
 void otbrLogSetLevel(otbrLogLevel aLevel)
 {
     assert(aLevel >= OTBR_LOG_EMERG && aLevel <= OTBR_LOG_DEBUG);
     sLevel = aLevel;
+    UpdateMaxLevel();
+}
+
+static LogTagLevel *FindTagLevel(const char *aLogTag)
+{
+    LogTagLevel *tagLevel = nullptr;
+
+    for (uint8_t i = 0; i < sNumTagLevels; i++)
+    {
+        if (strncmp(sTagLevels[i].mLogTag, aLogTag, LogTagLevel::kMaxLogTagLength + 1) == 0)
+        {
+            tagLevel = &sTagLevels[i];
+            break;
+        }
+    }
+
+    return tagLevel;
+}
+
+otbrError otbrLogSetTagLevel(const char *aLogTag, otbrLogLevel aLevel)
+{
+    otbrError    error    = OTBR_ERROR_NONE;
+    LogTagLevel *tagLevel = FindTagLevel(aLogTag);
+
+    VerifyOrExit(aLevel >= OTBR_LOG_EMERG && aLevel <= OTBR_LOG_DEBUG, error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(strlen(aLogTag) <= LogTagLevel::kMaxLogTagLength, error = OTBR_ERROR_INVALID_ARGS);
+
+    if (tagLevel == nullptr)
+    {
+        VerifyOrExit(sNumTagLevels < OTBR_CONFIG_LOG_MAX_TAG_LEVELS, error = OTBR_ERROR_INVALID_STATE);
+        tagLevel = &sTagLevels[sNumTagLevels++];
+        strcpy(tagLevel->mLogTag, aLogTag);
+    }
+
+    tagLevel->mLevel = aLevel;
+    UpdateMaxLevel();
+
+exit:
+    return error;
+}
+
+void otbrLogClearTagLevels(void)
+{
+    sNumTagLevels = 0;
+    UpdateMaxLevel();
+}
+
+otbrLogLevel otbrLogGetTagLevel(const char *aLogTag)
+{
+    const LogTagLevel *tagLevel = (sNumTagLevels > 0) ? FindTagLevel(aLogTag) : nullptr;
+
+    return (tagLevel != nullptr) ? tagLevel->mLevel : sLevel;
 }
 
 /** Enable/disable logging with syslog */
@@ -112,16 +213,21 @@ void otbrLogInit(const char *aProgramName, otbrLogLevel aLevel, bool aPrintStder
 
     sLevel        = aLevel;
     sDefaultLevel = sLevel;
+    UpdateMaxLevel();
+
+#if OTBR_ENABLE_ASYNC_LOG
+    StartLogDrain();
+#endif
 }
 
 static const char *GetPrefix(const char *aLogTag)
 {
     // Log prefix format : -xxx-----
-    const uint8_t kMaxTagSize = 7;
-    const uint8_t kBufferSize = kMaxTagSize + 3;
-    static char   prefix[kBufferSize];
-    uint8_t       tagLength = strlen(aLogTag) > kMaxTagSize ? kMaxTagSize : strlen(aLogTag);
-    int           index     = 0;
+    const uint8_t            kMaxTagSize = 7;
+    const uint8_t            kBufferSize = kMaxTagSize + 3;
+    static thread_local char prefix[kBufferSize];
+    uint8_t                  tagLength = strlen(aLogTag) > kMaxTagSize ? kMaxTagSize : strlen(aLogTag);
+    int                      index     = 0;
 
     if (strlen(aLogTag) > 0)
     {
@@ -171,6 +277,306 @@ static android_LogPriority ConvertToAndroidLogPriority(otbrLogLevel aLevel)
 }
 #endif
 
+#if OTBR_ENABLE_ASYNC_LOG
+
+static_assert((OTBR_CONFIG_LOG_ASYNC_RING_CAPACITY & (OTBR_CONFIG_LOG_ASYNC_RING_CAPACITY - 1)) == 0,
+              "OTBR_CONFIG_LOG_ASYNC_RING_CAPACITY must be a power of two");
+
+/**
+ * A formatted log line waiting to be emitted by the drain thread.
+ */
+struct LogRecord
+{
+    otbrLogLevel mLevel;
+    char         mText[OTBR_CONFIG_LOG_ASYNC_RECORD_SIZE];
+};
+
+/**
+ * A single-producer single-consumer ring of log records, written by one logging thread without locking.
+ *
+ * Rings are never freed: the ring of an exiting thread is handed over to the next thread which starts logging.
+ */
+struct LogRing
+{
+    static constexpr uint32_t kCapacity = OTBR_CONFIG_LOG_ASYNC_RING_CAPACITY;
+
+    LogRecord             mRecords[kCapacity];
+    std::atomic<uint32_t> mHead{0};    ///< The index of the next record to emit, advanced by the consumer.
+    std::atomic<uint32_t> mTail{0};    ///< The index of the next record to fill, advanced by the producer.
+    std::atomic<uint32_t> mDropped{0}; ///< The number of records dropped because the ring was full.
+    std::atomic<bool>     mInUse{true};
+    LogRing              *mNext = nullptr;
+};
+
+/**
+ * Returns the ring of a logging thread to the pool when the thread exits.
+ */
+struct LogRingOwner
+{
+    ~LogRingOwner(void)
+    {
+        if (mRing != nullptr)
+        {
+            mRing->mInUse.store(false, std::memory_order_release);
+        }
+    }
+
+    LogRing *mRing = nullptr;
+};
+
+/**
+ * The drain thread and its synchronization, allocated once and never freed so that exit() does not destroy them
+ * under a running drain thread.
+ */
+struct LogDrain
+{
+    std::thread             mThread;
+    std::mutex              mMutex; ///< Serializes the consumer side of all rings.
+    std::condition_variable mCondition;
+    bool                    mStopping = false;
+};
+
+static std::atomic<LogRing *> sLogRings{nullptr};
+static std::atomic<bool>      sLogAsyncRunning{false};
+static LogDrain              *sLogDrain          = nullptr;
+static uint32_t               sReportedDropCount = 0;
+
+static LogRing *AcquireLogRing(void)
+{
+    LogRing *ring;
+
+    for (ring = sLogRings.load(std::memory_order_acquire); ring != nullptr; ring = ring->mNext)
+    {
+        bool inUse = false;
+
+        if (ring->mInUse.compare_exchange_strong(inUse, true, std::memory_order_acquire))
+        {
+            ExitNow();
+        }
+    }
+
+    ring        = new LogRing();
+    ring->mNext = sLogRings.load(std::memory_order_relaxed);
+
+    while (!sLogRings.compare_exchange_weak(ring->mNext, ring, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+
+exit:
+    return ring;
+}
+
+static LogRing &GetThreadLogRing(void)
+{
+    static thread_local LogRingOwner sOwner;
+
+    if (sOwner.mRing == nullptr)
+    {
+        sOwner.mRing = AcquireLogRing();
+    }
+
+    return *sOwner.mRing;
+}
+
+static void EmitLogLine(otbrLogLevel aLevel, const char *aLine)
+{
+#if OTBR_ENABLE_PLATFORM_ANDROID
+    __android_log_print(ConvertToAndroidLogPriority(aLevel), LOG_TAG, "%s", aLine);
+#else
+    syslog(static_cast<int>(aLevel), "%s", aLine);
+#endif
+}
+
+/**
+ * Emits all buffered records. Must be called with the drain mutex held.
+ */
+static void DrainLogRings(void)
+{
+    const size_t kBatchSize = 4096;
+    static char  sBatch[kBatchSize];
+    size_t       batchLength = 0;
+    uint32_t     dropCount   = 0;
+
+    for (LogRing *ring = sLogRings.load(std::memory_order_acquire); ring != nullptr; ring = ring->mNext)
+    {
+        uint32_t head = ring->mHead.load(std::memory_order_relaxed);
+        uint32_t tail = ring->mTail.load(std::memory_order_acquire);
+
+        for (; head != tail; head++)
+        {
+            const LogRecord &record = ring->mRecords[head & (LogRing::kCapacity - 1)];
+
+            if (sSyslogDisabled)
+            {
+                size_t length = strlen(record.mText);
+
+                if (batchLength + length + 1 > kBatchSize)
+                {
+                    fwrite(sBatch, 1, batchLength, stdout);
+                    batchLength = 0;
+                }
+
+                memcpy(&sBatch[batchLength], record.mText, length);
+                batchLength += length;
+                sBatch[batchLength++] = '\n';
+            }
+            else
+            {
+                EmitLogLine(record.mLevel, record.mText);
+            }
+        }
+
+        ring->mHead.store(head, std::memory_order_release);
+        dropCount += ring->mDropped.load(std::memory_order_relaxed);
+    }
+
+    if (batchLength > 0)
+    {
+        fwrite(sBatch, 1, batchLength, stdout);
+    }
+
+    if (dropCount != sReportedDropCount)
+    {
+        char line[64];
+
+        snprintf(line, sizeof(line), "%s%s: Dropped %u log messages", sLevelString[OTBR_LOG_WARNING],
+                 GetPrefix(OTBR_LOG_TAG), dropCount - sReportedDropCount);
+
+        if (sSyslogDisabled)
+        {
+            printf("%s\n", line);
+        }
+        else
+        {
+            EmitLogLine(OTBR_LOG_WARNING, line);
+        }
+
+        sReportedDropCount = dropCount;
+    }
+
+    if (sSyslogDisabled)
+    {
+        fflush(stdout);
+    }
+}
+
+static void RunLogDrain(void)
+{
+    std::unique_lock<std::mutex> lock(sLogDrain->mMutex);
+
+    while (!sLogDrain->mStopping)
+    {
+        sLogDrain->mCondition.wait_for(lock, std::chrono::milliseconds(OTBR_CONFIG_LOG_ASYNC_DRAIN_INTERVAL));
+        DrainLogRings();
+    }
+}
+
+static void StartLogDrain(void)
+{
+    if (sLogDrain == nullptr)
+    {
+        sLogDrain = new LogDrain();
+    }
+
+    VerifyOrExit(!sLogAsyncRunning.load(std::memory_order_relaxed));
+
+    sLogDrain->mStopping = false;
+    sLogDrain->mThread   = std::thread(RunLogDrain);
+    sLogAsyncRunning.store(true, std::memory_order_release);
+
+exit:
+    return;
+}
+
+static void StopLogDrain(void)
+{
+    VerifyOrExit(sLogAsyncRunning.load(std::memory_order_relaxed));
+
+    sLogAsyncRunning.store(false, std::memory_order_release);
+
+    {
+        std::lock_guard<std::mutex> lock(sLogDrain->mMutex);
+
+        sLogDrain->mStopping = true;
+    }
+
+    sLogDrain->mCondition.notify_one();
+    sLogDrain->mThread.join();
+
+    // Records logged while the drain thread was stopping.
+    otbrLogFlush();
+
+exit:
+    return;
+}
+
+/**
+ * Queues a log line for the drain thread.
+ *
+ * @param[in] aLevel     The log level.
+ * @param[in] aLogTag    The log tag, or nullptr to log the line without a level and tag prefix.
+ * @param[in] aFormat    Format string as in printf.
+ * @param[in] aArgList   The variable-length arguments list.
+ *
+ * @retval TRUE   The line was queued or dropped.
+ * @retval FALSE  The line must be emitted synchronously by the caller, @p aArgList is left untouched.
+ */
+static bool QueueLog(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, va_list aArgList)
+{
+    bool       queued = false;
+    LogRing   *ring;
+    LogRecord *record;
+    uint32_t   head;
+    uint32_t   tail;
+    int        length = 0;
+
+    VerifyOrExit(sLogAsyncRunning.load(std::memory_order_acquire));
+
+    if (aLevel <= OTBR_LOG_CRIT)
+    {
+        // Fatal errors usually precede an exit, emit everything logged so far and this line synchronously.
+        otbrLogFlush();
+        ExitNow();
+    }
+
+    ring   = &GetThreadLogRing();
+    queued = true;
+    tail   = ring->mTail.load(std::memory_order_relaxed);
+    head   = ring->mHead.load(std::memory_order_acquire);
+
+    if (tail - head >= LogRing::kCapacity)
+    {
+        ring->mDropped.fetch_add(1, std::memory_order_relaxed);
+        ExitNow();
+    }
+
+    record         = &ring->mRecords[tail & (LogRing::kCapacity - 1)];
+    record->mLevel = aLevel;
+
+    if (aLogTag != nullptr)
+    {
+        length = snprintf(record->mText, sizeof(record->mText), "%s%s: ", sLevelString[aLevel], GetPrefix(aLogTag));
+    }
+
+    if (length >= 0 && static_cast<size_t>(length) < sizeof(record->mText))
+    {
+        vsnprintf(&record->mText[length], sizeof(record->mText) - length, aFormat, aArgList);
+    }
+
+    ring->mTail.store(tail + 1, std::memory_order_release);
+
+    if (tail - head + 1 == LogRing::kCapacity / 2)
+    {
+        // Wake the drain thread early rather than dropping records under a burst.
+        sLogDrain->mCondition.notify_one();
+    }
+
+exit:
+    return queued;
+}
+
+#endif // OTBR_ENABLE_ASYNC_LOG
+
 /** log to the syslog or standard out */
 void otbrLog(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, ...)
 {
@@ -180,7 +586,19 @@ void otbrLog(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, ...)
 
     va_start(ap, aFormat);
 
-    if ((aLevel <= sLevel) && (vsnprintf(buffer, sizeof(buffer), aFormat, ap) > 0))
+    VerifyOrExit(aLevel <= sMaxLevel);
+
+    if (aLevel <= sBinaryLevel)
+    {
+        sBinaryLog.Write(aLevel, aLogTag, aFormat, ap);
+    }
+
+    VerifyOrExit(aLevel <= otbrLogGetTagLevel(aLogTag));
+#if OTBR_ENABLE_ASYNC_LOG
+    VerifyOrExit(!QueueLog(aLevel, aLogTag, aFormat, ap));
+#endif
+
+    if (vsnprintf(buffer, sizeof(buffer), aFormat, ap) > 0)
     {
         if (sSyslogDisabled)
         {
@@ -197,6 +615,7 @@ void otbrLog(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, ...)
         }
     }
 
+exit:
     va_end(ap);
 
     return;
@@ -216,6 +635,15 @@ void otbrLogv(otbrLogLevel aLevel, const char *aFormat, va_list aArgList)
 /** log to the syslog or standard out */
 void otbrLogvNoFilter(otbrLogLevel aLevel, const char *aFormat, va_list aArgList)
 {
+    if (aLevel <= sBinaryLevel)
+    {
+        sBinaryLog.Write(aLevel, nullptr, aFormat, aArgList);
+    }
+
+#if OTBR_ENABLE_ASYNC_LOG
+    VerifyOrExit(!QueueLog(aLevel, nullptr, aFormat, aArgList));
+#endif
+
     if (sSyslogDisabled)
     {
         vprintf(aFormat, aArgList);
@@ -229,6 +657,11 @@ void otbrLogvNoFilter(otbrLogLevel aLevel, const char *aFormat, va_list aArgList
         vsyslog(static_cast<int>(aLevel), aFormat, aArgList);
 #endif
     }
+
+#if OTBR_ENABLE_ASYNC_LOG
+exit:
+#endif
+    return;
 }
 
 /** Hex dump data to the log */
@@ -240,7 +673,7 @@ void otbrDump(otbrLogLevel aLevel, const char *aLogTag, const char *aPrefix, con
     const uint8_t *p8;
     int            addr;
 
-    if (aLevel >= sLevel)
+    if (aLevel > sMaxLevel)
     {
         return;
     }
@@ -343,8 +776,86 @@ const char *otbrErrorString(otbrError aError)
     return error;
 }
 
+void otbrLogFlush(void)
+{
+#if OTBR_ENABLE_ASYNC_LOG
+    VerifyOrExit(sLogDrain != nullptr);
+
+    {
+        std::lock_guard<std::mutex> lock(sLogDrain->mMutex);
+
+        DrainLogRings();
+    }
+
+exit:
+#endif
+    return;
+}
+
+uint32_t otbrLogGetDroppedCount(void)
+{
+    uint32_t count = 0;
+
+#if OTBR_ENABLE_ASYNC_LOG
+    for (LogRing *ring = sLogRings.load(std::memory_order_acquire); ring != nullptr; ring = ring->mNext)
+    {
+        count += ring->mDropped.load(std::memory_order_relaxed);
+    }
+#endif
+
+    return count;
+}
+
+otbrError otbrLogBinaryInit(const char *aPath, otbrLogLevel aLevel)
+{
+    otbrError error;
+
+    assert(aLevel >= OTBR_LOG_EMERG && aLevel <= OTBR_LOG_DEBUG);
+
+    SuccessOrExit(error = sBinaryLog.Open(aPath, OTBR_CONFIG_LOG_BINARY_FILE_SIZE));
+    sBinaryLevel = aLevel;
+    UpdateMaxLevel();
+
+exit:
+    return error;
+}
+
+void otbrLogBinaryDeinit(void)
+{
+    sBinaryLog.Close();
+    sBinaryLevel = OTBR_LOG_EMERG;
+    UpdateMaxLevel();
+}
+
+otbrError otbrLogBinaryDecode(const char *aPath, FILE *aOutput)
+{
+    return otbr::BinaryLog::Decode(aPath, [aOutput](const otbr::BinaryLog::Entry &aEntry) {
+        time_t    seconds = static_cast<time_t>(aEntry.mTimestamp / 1000000);
+        struct tm localTime;
+        char      timeString[32];
+
+        localtime_r(&seconds, &localTime);
+        strftime(timeString, sizeof(timeString), "%Y-%m-%d %H:%M:%S", &localTime);
+
+        if (aEntry.mLogTag != nullptr)
+        {
+            fprintf(aOutput, "%s.%06u %s%s: %s\n", timeString, static_cast<unsigned>(aEntry.mTimestamp % 1000000),
+                    sLevelString[aEntry.mLevel & 0x07], GetPrefix(aEntry.mLogTag), aEntry.mMessage);
+        }
+        else
+        {
+            fprintf(aOutput, "%s.%06u %s\n", timeString, static_cast<unsigned>(aEntry.mTimestamp % 1000000),
+                    aEntry.mMessage);
+        }
+    });
+}
+
 void otbrLogDeinit(void)
 {
+#if OTBR_ENABLE_ASYNC_LOG
+    StopLogDrain();
+#endif
+    otbrLogBinaryDeinit();
     closelog();
 }
 
@@ -37,6 +37,8 @@
 
 #include <stdarg.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
 
 #include <openthread/platform/logging.h>
 
@@ -93,6 +95,66 @@ void otbrLogSyslogSetEnabled(bool aEnabled);
  */
 void otbrLogInit(const char *aProgramName, otbrLogLevel aLevel, bool aPrintStderr, bool aSyslogDisable);
 
+/**
+ * This function sets the log level of the logs with tag @p aLogTag, overriding the global log level for them.
+ *
+ * The tag levels are checked before any formatting, so raising the level of one tag does not slow down the others.
+ *
+ * @param[in] aLogTag  The log tag.
+ * @param[in] aLevel   The log level of the tag.
+ *
+ * @retval OTBR_ERROR_NONE           Successfully set the log level of the tag.
+ * @retval OTBR_ERROR_INVALID_ARGS   @p aLevel is not a valid log level.
+ * @retval OTBR_ERROR_INVALID_STATE  OTBR_CONFIG_LOG_MAX_TAG_LEVELS tags already have their own log level.
+ */
+otbrError otbrLogSetTagLevel(const char *aLogTag, otbrLogLevel aLevel);
+
+/**
+ * This function makes all log tags follow the global log level again.
+ */
+void otbrLogClearTagLevels(void);
+
+/**
+ * This function returns the log level applied to the logs with tag @p aLogTag.
+ *
+ * @param[in] aLogTag  The log tag.
+ *
+ * @returns The log level of the tag if set, or the global log level.
+ */
+otbrLogLevel otbrLogGetTagLevel(const char *aLogTag);
+
+/**
+ * This function starts recording the logs to a binary log file.
+ *
+ * The logs up to @p aLevel are recorded regardless of the global and tag log levels, without being formatted.
+ * The file holds the last OTBR_CONFIG_LOG_BINARY_FILE_SIZE bytes of records and is decoded with
+ * otbrLogBinaryDecode() by the same executable.
+ *
+ * @param[in] aPath   The path of the binary log file, which is created or truncated.
+ * @param[in] aLevel  The most verbose log level recorded.
+ *
+ * @retval OTBR_ERROR_NONE   Successfully started the binary log.
+ * @retval OTBR_ERROR_ERRNO  Failed to create the binary log file.
+ */
+otbrError otbrLogBinaryInit(const char *aPath, otbrLogLevel aLevel);
+
+/**
+ * This function stops recording the logs to the binary log file.
+ */
+void otbrLogBinaryDeinit(void);
+
+/**
+ * This function formats the records of a binary log file.
+ *
+ * @param[in] aPath    The path of the binary log file.
+ * @param[in] aOutput  The stream to write the formatted logs to.
+ *
+ * @retval OTBR_ERROR_NONE   Successfully decoded the binary log file.
+ * @retval OTBR_ERROR_ERRNO  Failed to read the binary log file.
+ * @retval OTBR_ERROR_PARSE  The file is not a binary log written by this executable.
+ */
+otbrError otbrLogBinaryDecode(const char *aPath, FILE *aOutput);
+
 /**
  * This function log at level @p aLevel.
  *
@@ -140,6 +202,20 @@ void otbrDump(otbrLogLevel aLevel, const char *aLogTag, const char *aPrefix, con
  */
 const char *otbrErrorString(otbrError aError);
 
+/**
+ * This function synchronously emits all log records buffered by the asynchronous logging backend.
+ *
+ * It does nothing when asynchronous logging is disabled.
+ */
+void otbrLogFlush(void);
+
+/**
+ * This function returns the number of log records dropped because the asynchronous logging buffer was full.
+ *
+ * @returns The number of dropped log records, always zero when asynchronous logging is disabled.
+ */
+uint32_t otbrLogGetDroppedCount(void);
+
 /**
  * This function deinitializes the logging service.
  */
@@ -226,14 +302,26 @@ void otbrLogDeinit(void);
  *
  * @param[in] ...  Arguments for the format specification.
  */
-#define otbrLogEmerg(...) otbrLog(OTBR_LOG_EMERG, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogAlert(...) otbrLog(OTBR_LOG_ALERT, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogCrit(...) otbrLog(OTBR_LOG_CRIT, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogErr(...) otbrLog(OTBR_LOG_ERR, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogWarning(...) otbrLog(OTBR_LOG_WARNING, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogNotice(...) otbrLog(OTBR_LOG_NOTICE, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogInfo(...) otbrLog(OTBR_LOG_INFO, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogDebug(...) otbrLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG, __VA_ARGS__)
+#define otbrLogEmerg(...) otbrLogCompiled(OTBR_LOG_EMERG, __VA_ARGS__)
+#define otbrLogAlert(...) otbrLogCompiled(OTBR_LOG_ALERT, __VA_ARGS__)
+#define otbrLogCrit(...) otbrLogCompiled(OTBR_LOG_CRIT, __VA_ARGS__)
+#define otbrLogErr(...) otbrLogCompiled(OTBR_LOG_ERR, __VA_ARGS__)
+#define otbrLogWarning(...) otbrLogCompiled(OTBR_LOG_WARNING, __VA_ARGS__)
+#define otbrLogNotice(...) otbrLogCompiled(OTBR_LOG_NOTICE, __VA_ARGS__)
+#define otbrLogInfo(...) otbrLogCompiled(OTBR_LOG_INFO, __VA_ARGS__)
+#define otbrLogDebug(...) otbrLogCompiled(OTBR_LOG_DEBUG, __VA_ARGS__)
+
+/**
+ * @def otbrLogCompiled
+ *
+ * Log at level @p aLevel with the log tag of the file, unless @p aLevel is more verbose than
+ * OTBR_CONFIG_LOG_MAX_COMPILED_LEVEL, in which case the call is compiled out.
+ *
+ * @param[in] aLevel  Log level of the logger.
+ * @param[in] ...     Arguments for the format specification.
+ */
+#define otbrLogCompiled(aLevel, ...) \
+    (((aLevel) <= OTBR_CONFIG_LOG_MAX_COMPILED_LEVEL) ? otbrLog((aLevel), OTBR_LOG_TAG, __VA_ARGS__) : (void)0)
 
 /**
  * Convert otbrLogLevel to otLogLevel.
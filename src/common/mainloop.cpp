@@ -26,12 +26,25 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <assert.h>
+
+#include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
 #include "common/mainloop_manager.hpp"
 
 namespace otbr {
 
+constexpr uint8_t MainloopProcessor::kEventReadable;
+constexpr uint8_t MainloopProcessor::kEventWritable;
+constexpr uint8_t MainloopProcessor::kEventError;
+
 MainloopProcessor::MainloopProcessor(void)
+    : MainloopProcessor(Registration::kLegacy)
+{
+}
+
+MainloopProcessor::MainloopProcessor(Registration aRegistration)
+    : mRegistration(aRegistration)
 {
     MainloopManager::GetInstance().AddMainloopProcessor(this);
 }
@@ -41,6 +54,48 @@ MainloopProcessor::~MainloopProcessor(void)
     MainloopManager::GetInstance().RemoveMainloopProcessor(this);
 }
 
+void MainloopProcessor::Update(MainloopContext &aMainloop)
+{
+    OTBR_UNUSED_VARIABLE(aMainloop);
+}
+
+void MainloopProcessor::Process(const MainloopContext &aMainloop)
+{
+    OTBR_UNUSED_VARIABLE(aMainloop);
+}
+
+Timepoint MainloopProcessor::GetDeadline(void) const
+{
+    return Timepoint::max();
+}
+
+void MainloopProcessor::HandleFdEvent(int aFd, uint8_t aEvents)
+{
+    OTBR_UNUSED_VARIABLE(aFd);
+    OTBR_UNUSED_VARIABLE(aEvents);
+}
+
+void MainloopProcessor::HandleTimeout(void)
+{
+}
+
+void MainloopProcessor::RegisterFd(int aFd, uint8_t aEvents)
+{
+    assert(mRegistration == Registration::kPersistent);
+    MainloopManager::GetInstance().RegisterFd(*this, aFd, aEvents);
+}
+
+void MainloopProcessor::ModifyFd(int aFd, uint8_t aEvents)
+{
+    assert(mRegistration == Registration::kPersistent);
+    MainloopManager::GetInstance().ModifyFd(*this, aFd, aEvents);
+}
+
+void MainloopProcessor::UnregisterFd(int aFd)
+{
+    MainloopManager::GetInstance().UnregisterFd(*this, aFd);
+}
+
 void MainloopContext::AddFdToReadSet(int aFd)
 {
     AddFdToSet(aFd, kReadFdSet);
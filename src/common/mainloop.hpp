@@ -38,6 +38,8 @@
 
 #include <openthread/openthread-system.h>
 
+#include "common/time.hpp"
+
 namespace otbr {
 
 /**
@@ -66,30 +68,124 @@ public:
     void AddFdToSet(int aFd, uint8_t aFdSetsMask);
 };
 
+class MainloopManager;
+
 /**
  * This abstract class defines the interface of a mainloop processor
  * which adds fds to the mainloop context and handles fds events.
+ *
+ * A mainloop processor either follows the legacy path, where `Update()` is called on every iteration to add its
+ * fds to the fd sets of the mainloop context and `Process()` is called after every wait, or registers its fds once
+ * with `RegisterFd()`, in which case `HandleFdEvent()` is only called for its ready fds and `HandleTimeout()` once
+ * the deadline returned by `GetDeadline()` has expired.
  */
 class MainloopProcessor
 {
+    friend class MainloopManager;
+
 public:
+    /**
+     * This enumeration defines how a mainloop processor reports its fds to the mainloop manager.
+     */
+    enum class Registration : uint8_t
+    {
+        kLegacy,     ///< The fds are added to the mainloop context by `Update()` on every iteration.
+        kPersistent, ///< The fds are registered once with `RegisterFd()` until `UnregisterFd()`.
+    };
+
+    static constexpr uint8_t kEventReadable = 1 << 0; ///< The fd is readable.
+    static constexpr uint8_t kEventWritable = 1 << 1; ///< The fd is writable.
+    static constexpr uint8_t kEventError    = 1 << 2; ///< The fd has an exceptional condition.
+
+    /**
+     * This constructor adds a mainloop processor following the legacy path to the mainloop manager.
+     */
     MainloopProcessor(void);
 
+    /**
+     * This constructor adds a mainloop processor to the mainloop manager.
+     *
+     * @param[in] aRegistration  How the mainloop processor reports its fds.
+     */
+    explicit MainloopProcessor(Registration aRegistration);
+
     virtual ~MainloopProcessor(void);
 
+    /**
+     * This method returns how the mainloop processor reports its fds.
+     *
+     * @returns The registration of the mainloop processor.
+     */
+    Registration GetRegistration(void) const { return mRegistration; }
+
+protected:
     /**
      * This method updates the mainloop context.
      *
+     * This method is only called for mainloop processors following the legacy path.
+     *
      * @param[in,out] aMainloop  A reference to the mainloop to be updated.
      */
-    virtual void Update(MainloopContext &aMainloop) = 0;
+    virtual void Update(MainloopContext &aMainloop);
 
     /**
      * This method processes mainloop events.
      *
+     * This method is only called for mainloop processors following the legacy path.
+     *
      * @param[in] aMainloop  A reference to the mainloop context.
      */
-    virtual void Process(const MainloopContext &aMainloop) = 0;
+    virtual void Process(const MainloopContext &aMainloop);
+
+    /**
+     * This method returns the time when this mainloop processor needs `HandleTimeout()` to be called.
+     *
+     * This method is queried before every wait for mainloop processors registering their fds persistently.
+     *
+     * @returns The deadline of this mainloop processor, or `Timepoint::max()` if there is none.
+     */
+    virtual Timepoint GetDeadline(void) const;
+
+    /**
+     * This method handles the events of a registered fd.
+     *
+     * @param[in] aFd      The ready fd.
+     * @param[in] aEvents  A bitmask of `kEvent*` indicating the events which happened on @p aFd.
+     */
+    virtual void HandleFdEvent(int aFd, uint8_t aEvents);
+
+    /**
+     * This method handles the expiry of the deadline returned by `GetDeadline()`.
+     */
+    virtual void HandleTimeout(void);
+
+    /**
+     * This method registers a fd with the mainloop manager.
+     *
+     * The fd stays registered until `UnregisterFd()` is called, which must be done before the fd is closed.
+     *
+     * @param[in] aFd      The fd to register.
+     * @param[in] aEvents  A bitmask of `kEvent*` indicating the events to wait for.
+     */
+    void RegisterFd(int aFd, uint8_t aEvents);
+
+    /**
+     * This method modifies the events to wait for on a registered fd.
+     *
+     * @param[in] aFd      The registered fd.
+     * @param[in] aEvents  A bitmask of `kEvent*` indicating the events to wait for.
+     */
+    void ModifyFd(int aFd, uint8_t aEvents);
+
+    /**
+     * This method unregisters a fd from the mainloop manager.
+     *
+     * @param[in] aFd  The registered fd.
+     */
+    void UnregisterFd(int aFd);
+
+private:
+    Registration mRegistration;
 };
 
 } // namespace otbr
@@ -25,36 +25,627 @@
  *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
  *    POSSIBILITY OF SUCH DAMAGE.
  */
+
+#define OTBR_LOG_TAG "LOOP"
+
+#include <algorithm>
+
 #include <assert.h>
+#include <errno.h>
+#include <limits.h>
+#include <string.h>
+#include <unistd.h>
+
+#if OTBR_ENABLE_EPOLL
+#include <sys/epoll.h>
+#endif
 
 #include "common/mainloop_manager.hpp"
 
 namespace otbr {
 
+#if OTBR_ENABLE_EPOLL
+
+constexpr Milliseconds MainloopManager::kResyncInterval;
+
+MainloopManager::MainloopManager(void)
+    : mEpollFd(epoll_create1(EPOLL_CLOEXEC))
+{
+    // We do not handle failures when creating the epoll instance, simply die.
+    VerifyOrDie(mEpollFd != -1, strerror(errno));
+}
+
+MainloopManager::~MainloopManager(void)
+{
+    if (mEpollFd != -1)
+    {
+        close(mEpollFd);
+        mEpollFd = -1;
+    }
+}
+
+#endif // OTBR_ENABLE_EPOLL
+
 void MainloopManager::AddMainloopProcessor(MainloopProcessor *aMainloopProcessor)
 {
     assert(aMainloopProcessor != nullptr);
     mMainloopProcessorList.emplace_back(aMainloopProcessor);
+#if OTBR_ENABLE_EPOLL
+    if (aMainloopProcessor->GetRegistration() == MainloopProcessor::Registration::kLegacy)
+    {
+        mEpollProcessorList.emplace_back(aMainloopProcessor);
+    }
+#endif
 }
 
 void MainloopManager::RemoveMainloopProcessor(MainloopProcessor *aMainloopProcessor)
 {
     mMainloopProcessorList.remove(aMainloopProcessor);
+    UnregisterFds(*aMainloopProcessor);
+#if OTBR_ENABLE_EPOLL
+    mEpollProcessorList.remove_if(
+        [aMainloopProcessor](const EpollProcessor &aEntry) { return aEntry.mProcessor == aMainloopProcessor; });
+    mNeedResync = true;
+#endif
 }
 
 void MainloopManager::Update(MainloopContext &aMainloop)
 {
+    Timepoint now = Clock::now();
+    size_t    numFds;
+
     for (auto &mainloopProcessor : mMainloopProcessorList)
     {
-        mainloopProcessor->Update(aMainloop);
+        Timepoint deadline;
+
+        if (mainloopProcessor->GetRegistration() == MainloopProcessor::Registration::kLegacy)
+        {
+            mainloopProcessor->Update(aMainloop);
+            continue;
+        }
+
+        deadline = mainloopProcessor->GetDeadline();
+
+        if (deadline != Timepoint::max())
+        {
+            Microseconds delay = (deadline <= now) ? Microseconds::zero()
+                                                   : std::chrono::duration_cast<Microseconds>(deadline - now);
+
+            if (delay < FromTimeval<Microseconds>(aMainloop.mTimeout))
+            {
+                aMainloop.mTimeout = ToTimeval(delay);
+            }
+        }
+    }
+
+    // The fds beyond `FD_SETSIZE` can only be registered with the epoll backend, which does not use the fd sets.
+    numFds = std::min(mFdRegistrations.size(), static_cast<size_t>(FD_SETSIZE));
+
+    for (size_t fd = 0; fd < numFds; fd++)
+    {
+        const FdRegistration &registration = mFdRegistrations[fd];
+        uint8_t               fdSets       = 0;
+
+        if (registration.mProcessor == nullptr)
+        {
+            continue;
+        }
+
+        if (registration.mEvents & MainloopProcessor::kEventReadable)
+        {
+            fdSets |= MainloopContext::kReadFdSet;
+        }
+        if (registration.mEvents & MainloopProcessor::kEventWritable)
+        {
+            fdSets |= MainloopContext::kWriteFdSet;
+        }
+        if (registration.mEvents & MainloopProcessor::kEventError)
+        {
+            fdSets |= MainloopContext::kErrorFdSet;
+        }
+
+        aMainloop.AddFdToSet(static_cast<int>(fd), fdSets);
     }
 }
 
 void MainloopManager::Process(const MainloopContext &aMainloop)
 {
+    size_t numFds = std::min(mFdRegistrations.size(), static_cast<size_t>(FD_SETSIZE));
+
     for (auto &mainloopProcessor : mMainloopProcessorList)
     {
-        mainloopProcessor->Process(aMainloop);
+        if (mainloopProcessor->GetRegistration() == MainloopProcessor::Registration::kLegacy)
+        {
+            mainloopProcessor->Process(aMainloop);
+        }
+    }
+
+    for (size_t fd = 0; fd < numFds; fd++)
+    {
+        uint8_t events = 0;
+
+        if (FD_ISSET(fd, &aMainloop.mReadFdSet))
+        {
+            events |= MainloopProcessor::kEventReadable;
+        }
+        if (FD_ISSET(fd, &aMainloop.mWriteFdSet))
+        {
+            events |= MainloopProcessor::kEventWritable;
+        }
+        if (FD_ISSET(fd, &aMainloop.mErrorFdSet))
+        {
+            events |= MainloopProcessor::kEventError;
+        }
+
+        HandleFdEvent(static_cast<int>(fd), events);
+    }
+
+    HandleTimeouts(Clock::now());
+}
+
+void MainloopManager::RegisterFd(MainloopProcessor &aProcessor, int aFd, uint8_t aEvents)
+{
+    size_t index = static_cast<size_t>(aFd);
+
+    assert(aFd >= 0);
+
+#if OTBR_ENABLE_EPOLL
+    {
+        struct epoll_event event;
+
+        memset(&event, 0, sizeof(event));
+        event.events  = ToEpollEvents(aEvents);
+        event.data.fd = aFd;
+
+        if (epoll_ctl(mEpollFd, EPOLL_CTL_ADD, aFd, &event) == -1 &&
+            (errno != EEXIST || epoll_ctl(mEpollFd, EPOLL_CTL_MOD, aFd, &event) == -1))
+        {
+            otbrLogWarning("Failed to add fd %d to epoll: %s", aFd, strerror(errno));
+            ExitNow();
+        }
+    }
+#else
+    // We do not handle fds which select() cannot wait for, simply die.
+    VerifyOrDie(aFd < FD_SETSIZE, "Cannot register fd beyond FD_SETSIZE");
+#endif
+
+    if (index >= mFdRegistrations.size())
+    {
+        mFdRegistrations.resize(index + 1, FdRegistration{nullptr, 0});
+    }
+
+    mFdRegistrations[index] = FdRegistration{&aProcessor, aEvents};
+
+#if OTBR_ENABLE_EPOLL
+exit:
+#endif
+    return;
+}
+
+void MainloopManager::ModifyFd(MainloopProcessor &aProcessor, int aFd, uint8_t aEvents)
+{
+    size_t index = static_cast<size_t>(aFd);
+
+    VerifyOrExit(index < mFdRegistrations.size() && mFdRegistrations[index].mProcessor == &aProcessor);
+    VerifyOrExit(mFdRegistrations[index].mEvents != aEvents);
+
+#if OTBR_ENABLE_EPOLL
+    {
+        struct epoll_event event;
+
+        memset(&event, 0, sizeof(event));
+        event.events  = ToEpollEvents(aEvents);
+        event.data.fd = aFd;
+
+        if (epoll_ctl(mEpollFd, EPOLL_CTL_MOD, aFd, &event) == -1)
+        {
+            otbrLogWarning("Failed to modify fd %d in epoll: %s", aFd, strerror(errno));
+        }
+    }
+#endif
+
+    mFdRegistrations[index].mEvents = aEvents;
+
+exit:
+    return;
+}
+
+void MainloopManager::UnregisterFd(MainloopProcessor &aProcessor, int aFd)
+{
+    size_t index = static_cast<size_t>(aFd);
+
+    VerifyOrExit(index < mFdRegistrations.size() && mFdRegistrations[index].mProcessor == &aProcessor);
+
+#if OTBR_ENABLE_EPOLL
+    {
+        struct epoll_event event;
+
+        // The fd may have already been closed, in which case the kernel has
+        // removed it from the interest list and the failure is harmless.
+        memset(&event, 0, sizeof(event));
+        epoll_ctl(mEpollFd, EPOLL_CTL_DEL, aFd, &event);
+    }
+#endif
+
+    mFdRegistrations[index] = FdRegistration{nullptr, 0};
+
+exit:
+    return;
+}
+
+void MainloopManager::UnregisterFds(MainloopProcessor &aProcessor)
+{
+    for (size_t fd = 0; fd < mFdRegistrations.size(); fd++)
+    {
+        UnregisterFd(aProcessor, static_cast<int>(fd));
+    }
+}
+
+bool MainloopManager::IsFdRegistered(int aFd) const
+{
+    size_t index = static_cast<size_t>(aFd);
+
+    return index < mFdRegistrations.size() && mFdRegistrations[index].mProcessor != nullptr;
+}
+
+void MainloopManager::HandleFdEvent(int aFd, uint8_t aEvents)
+{
+    size_t index = static_cast<size_t>(aFd);
+
+    // The fd may have been unregistered by a handler called earlier in this iteration.
+    VerifyOrExit(IsFdRegistered(aFd));
+
+    aEvents &= mFdRegistrations[index].mEvents;
+    VerifyOrExit(aEvents != 0);
+
+    mFdRegistrations[index].mProcessor->HandleFdEvent(aFd, aEvents);
+
+exit:
+    return;
+}
+
+void MainloopManager::HandleTimeouts(Timepoint aNow)
+{
+    for (auto it = mMainloopProcessorList.begin(); it != mMainloopProcessorList.end();)
+    {
+        MainloopProcessor *processor = *it++;
+
+        if (processor->GetRegistration() == MainloopProcessor::Registration::kPersistent &&
+            processor->GetDeadline() <= aNow)
+        {
+            processor->HandleTimeout();
+        }
+    }
+}
+
+#if OTBR_ENABLE_EPOLL
+
+int MainloopManager::Poll(const timeval &aTimeout)
+{
+    struct epoll_event events[kMaxEpollEvents];
+    Timepoint          now     = Clock::now();
+    Microseconds       timeout = FromTimeval<Microseconds>(aTimeout);
+    int                rval;
+
+    for (int fd : mWantedFds)
+    {
+        mWantedEvents[static_cast<size_t>(fd)] = 0;
+    }
+    mWantedFds.clear();
+
+    for (EpollProcessor &entry : mEpollProcessorList)
+    {
+        UpdateProcessor(entry, aTimeout, now);
+        timeout = std::min(timeout, std::chrono::duration_cast<Microseconds>(entry.mDeadline - now));
+    }
+
+    for (MainloopProcessor *processor : mMainloopProcessorList)
+    {
+        Timepoint deadline;
+
+        if (processor->GetRegistration() != MainloopProcessor::Registration::kPersistent)
+        {
+            continue;
+        }
+
+        deadline = processor->GetDeadline();
+
+        if (deadline < now + timeout)
+        {
+            timeout = std::chrono::duration_cast<Microseconds>(deadline - now);
+        }
+    }
+
+    SyncInterests(now);
+
+    // Round up to milliseconds so that we never wake up before the earliest deadline.
+    timeout = std::max(timeout, Microseconds::zero());
+    rval    = epoll_wait(mEpollFd, events, kMaxEpollEvents, static_cast<int>((timeout.count() + 999) / 1000));
+    VerifyOrExit(rval >= 0);
+
+    for (int fd : mReadyFds)
+    {
+        mReadyEvents[static_cast<size_t>(fd)] = 0;
+    }
+    mReadyFds.clear();
+
+    for (int i = 0; i < rval; i++)
+    {
+        size_t fd = static_cast<size_t>(events[i].data.fd);
+
+        if (fd >= mReadyEvents.size())
+        {
+            mReadyEvents.resize(fd + 1, 0);
+        }
+
+        mReadyEvents[fd] |= events[i].events;
+        mReadyFds.push_back(events[i].data.fd);
+    }
+
+    now = Clock::now();
+
+    for (auto it = mEpollProcessorList.begin(); it != mEpollProcessorList.end();)
+    {
+        EpollProcessor &entry = *it++;
+
+        if (PrepareProcess(entry, now))
+        {
+            entry.mProcessor->Process(entry.mContext);
+        }
+    }
+
+    for (int fd : mReadyFds)
+    {
+        HandleFdEvent(fd, FromEpollEvents(mReadyEvents[static_cast<size_t>(fd)]));
+    }
+
+    HandleTimeouts(now);
+
+exit:
+    return rval;
+}
+
+uint32_t MainloopManager::ToEpollEvents(uint8_t aEvents)
+{
+    uint32_t events = 0;
+
+    if (aEvents & MainloopProcessor::kEventReadable)
+    {
+        events |= EPOLLIN;
+    }
+    if (aEvents & MainloopProcessor::kEventWritable)
+    {
+        events |= EPOLLOUT;
+    }
+    if (aEvents & MainloopProcessor::kEventError)
+    {
+        events |= EPOLLPRI;
+    }
+
+    return events;
+}
+
+uint8_t MainloopManager::FromEpollEvents(uint32_t aEpollEvents)
+{
+    uint8_t events = 0;
+
+    // Follow the select() semantics: errors and hang-ups make an fd both readable and writable.
+    if (aEpollEvents & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
+    {
+        events |= MainloopProcessor::kEventReadable;
+    }
+    if (aEpollEvents & (EPOLLOUT | EPOLLERR))
+    {
+        events |= MainloopProcessor::kEventWritable;
+    }
+    if (aEpollEvents & EPOLLPRI)
+    {
+        events |= MainloopProcessor::kEventError;
+    }
+
+    return events;
+}
+
+void MainloopManager::UpdateProcessor(EpollProcessor &aEntry, const timeval &aTimeout, Timepoint aNow)
+{
+    MainloopContext &context = aEntry.mContext;
+
+    context.mMaxFd   = -1;
+    context.mTimeout = aTimeout;
+    FD_ZERO(&context.mReadFdSet);
+    FD_ZERO(&context.mWriteFdSet);
+    FD_ZERO(&context.mErrorFdSet);
+
+    aEntry.mProcessor->Update(context);
+    aEntry.mDeadline = aNow + FromTimeval<Microseconds>(context.mTimeout);
+    aEntry.mInterests.clear();
+
+    VerifyOrExit(context.mMaxFd >= 0);
+
+    {
+        // Walk the fd sets one word at a time so that only the fds which are
+        // actually set are visited, instead of every fd up to `mMaxFd`.
+        constexpr size_t kBitsPerWord = sizeof(unsigned long) * CHAR_BIT;
+        constexpr size_t kNumWords    = sizeof(fd_set) / sizeof(unsigned long);
+
+        unsigned long readWords[kNumWords];
+        unsigned long writeWords[kNumWords];
+        unsigned long errorWords[kNumWords];
+        size_t        numWords = std::min(static_cast<size_t>(context.mMaxFd) / kBitsPerWord + 1, kNumWords);
+
+        memcpy(readWords, &context.mReadFdSet, sizeof(readWords));
+        memcpy(writeWords, &context.mWriteFdSet, sizeof(writeWords));
+        memcpy(errorWords, &context.mErrorFdSet, sizeof(errorWords));
+
+        for (size_t word = 0; word < numWords; word++)
+        {
+            unsigned long bits = readWords[word] | writeWords[word] | errorWords[word];
+
+            while (bits != 0)
+            {
+                size_t        bit    = static_cast<size_t>(__builtin_ctzl(bits));
+                unsigned long mask   = 1UL << bit;
+                int           fd     = static_cast<int>(word * kBitsPerWord + bit);
+                uint32_t      events = 0;
+
+                bits &= ~mask;
+
+                if (readWords[word] & mask)
+                {
+                    events |= EPOLLIN;
+                }
+                if (writeWords[word] & mask)
+                {
+                    events |= EPOLLOUT;
+                }
+                if (errorWords[word] & mask)
+                {
+                    events |= EPOLLPRI;
+                }
+
+                AddWantedEvents(fd, events);
+                aEntry.mInterests.push_back({fd, events});
+            }
+        }
+    }
+
+exit:
+    return;
+}
+
+void MainloopManager::AddWantedEvents(int aFd, uint32_t aEvents)
+{
+    size_t index = static_cast<size_t>(aFd);
+
+    if (index >= mWantedEvents.size())
+    {
+        mWantedEvents.resize(index + 1, 0);
     }
+
+    if (mWantedEvents[index] == 0)
+    {
+        mWantedFds.push_back(aFd);
+    }
+
+    mWantedEvents[index] |= aEvents;
 }
+
+void MainloopManager::SyncInterests(Timepoint aNow)
+{
+    bool resync = mNeedResync || (aNow - mLastResync >= kResyncInterval);
+
+    if (mRegisteredEvents.size() < mWantedEvents.size())
+    {
+        mRegisteredEvents.resize(mWantedEvents.size(), 0);
+    }
+
+    // Only the fds registered by the previous iteration and the fds wanted by
+    // this iteration can differ, all other fds are known to be unregistered.
+    for (int fd : mRegisteredFds)
+    {
+        size_t index = static_cast<size_t>(fd);
+
+        if (index >= mWantedEvents.size() || mWantedEvents[index] == 0)
+        {
+            SetInterest(fd, 0);
+        }
+    }
+
+    for (int fd : mWantedFds)
+    {
+        size_t index = static_cast<size_t>(fd);
+
+        if (resync || mWantedEvents[index] != mRegisteredEvents[index])
+        {
+            SetInterest(fd, mWantedEvents[index]);
+        }
+    }
+
+    mRegisteredFds = mWantedFds;
+
+    if (resync)
+    {
+        mNeedResync = false;
+        mLastResync = aNow;
+    }
+}
+
+void MainloopManager::SetInterest(int aFd, uint32_t aEvents)
+{
+    struct epoll_event event;
+    uint32_t          &registered = mRegisteredEvents[static_cast<size_t>(aFd)];
+
+    // The number of a closed fd may have been reused by a fd registered with
+    // `RegisterFd()`, whose registration must be left untouched.
+    if (IsFdRegistered(aFd))
+    {
+        registered = 0;
+        ExitNow();
+    }
+
+    memset(&event, 0, sizeof(event));
+    event.events  = aEvents;
+    event.data.fd = aFd;
+
+    if (aEvents == 0)
+    {
+        // The fd may have already been closed, in which case the kernel has
+        // removed it from the interest list and the failure is harmless.
+        if (registered != 0)
+        {
+            epoll_ctl(mEpollFd, EPOLL_CTL_DEL, aFd, &event);
+        }
+    }
+    else if (registered == 0 || epoll_ctl(mEpollFd, EPOLL_CTL_MOD, aFd, &event) == -1)
+    {
+        // Modifying fails if the fd was closed and its number reused since
+        // the last iteration, add it back to the interest list in that case.
+        if (epoll_ctl(mEpollFd, EPOLL_CTL_ADD, aFd, &event) == -1)
+        {
+            otbrLogWarning("Failed to add fd %d to epoll: %s", aFd, strerror(errno));
+            aEvents = 0;
+        }
+    }
+
+    registered = aEvents;
+
+exit:
+    return;
+}
+
+bool MainloopManager::PrepareProcess(EpollProcessor &aEntry, Timepoint aNow)
+{
+    MainloopContext &context = aEntry.mContext;
+    bool             ready   = false;
+
+    FD_ZERO(&context.mReadFdSet);
+    FD_ZERO(&context.mWriteFdSet);
+    FD_ZERO(&context.mErrorFdSet);
+
+    for (const FdInterest &interest : aEntry.mInterests)
+    {
+        size_t  index  = static_cast<size_t>(interest.mFd);
+        uint8_t events = (index < mReadyEvents.size()) ? FromEpollEvents(mReadyEvents[index]) : 0;
+
+        if ((interest.mEvents & EPOLLIN) && (events & MainloopProcessor::kEventReadable))
+        {
+            FD_SET(interest.mFd, &context.mReadFdSet);
+            ready = true;
+        }
+        if ((interest.mEvents & EPOLLOUT) && (events & MainloopProcessor::kEventWritable))
+        {
+            FD_SET(interest.mFd, &context.mWriteFdSet);
+            ready = true;
+        }
+        if ((interest.mEvents & EPOLLPRI) && (events & MainloopProcessor::kEventError))
+        {
+            FD_SET(interest.mFd, &context.mErrorFdSet);
+            ready = true;
+        }
+    }
+
+    return ready || aEntry.mDeadline <= aNow;
+}
+
+#endif // OTBR_ENABLE_EPOLL
 } // namespace otbr
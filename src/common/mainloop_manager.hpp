@@ -39,9 +39,11 @@
 #include <openthread/openthread-system.h>
 
 #include <list>
+#include <vector>
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/time.hpp"
 
 namespace otbr {
 
@@ -54,7 +56,18 @@ public:
     /**
      * The constructor to initialize the mainloop manager.
      */
+#if OTBR_ENABLE_EPOLL
+    MainloopManager(void);
+#else
     MainloopManager() = default;
+#endif
+
+#if OTBR_ENABLE_EPOLL
+    /**
+     * The destructor to release the epoll instance.
+     */
+    ~MainloopManager(void);
+#endif
 
     /**
      * This method returns the singleton instance of the mainloop manager.
@@ -82,6 +95,9 @@ public:
     /**
      * This method updates the mainloop context of all mainloop processors.
      *
+     * Mainloop processors following the legacy path update the mainloop context themselves, the fds registered by
+     * the other mainloop processors are added to the fd sets and their deadlines bound the timeout.
+     *
      * @param[in,out] aMainloop  A reference to the mainloop to be updated.
      */
     void Update(MainloopContext &aMainloop);
@@ -93,7 +109,98 @@ public:
      */
     void Process(const MainloopContext &aMainloop);
 
+#if OTBR_ENABLE_EPOLL
+    /**
+     * This method runs one iteration of the mainloop with the epoll backend.
+     *
+     * The fds registered with `MainloopProcessor::RegisterFd()` stay in the epoll interest list until they are
+     * unregistered, so they cost nothing per iteration and are not bound by `FD_SETSIZE`. Only their deadlines
+     * are queried before waiting, and after waiting only the handlers of the ready fds and of the expired
+     * deadlines are called.
+     *
+     * Mainloop processors following the legacy path are still updated with their own mainloop context on every
+     * iteration. Their fds are kept in the same epoll interest list and `epoll_ctl()` is only issued for the fds
+     * whose interest changed since the previous iteration. Only the ones which have ready fds or whose timeout
+     * has expired are processed.
+     *
+     * @param[in] aTimeout  The maximum time to wait for events.
+     *
+     * @returns The number of ready fds, or -1 on failure with `errno` set.
+     */
+    int Poll(const timeval &aTimeout);
+#endif
+
 private:
+    friend class MainloopProcessor;
+
+    struct FdRegistration
+    {
+        MainloopProcessor *mProcessor;
+        uint8_t            mEvents;
+    };
+
+    void RegisterFd(MainloopProcessor &aProcessor, int aFd, uint8_t aEvents);
+    void ModifyFd(MainloopProcessor &aProcessor, int aFd, uint8_t aEvents);
+    void UnregisterFd(MainloopProcessor &aProcessor, int aFd);
+    void UnregisterFds(MainloopProcessor &aProcessor);
+    bool IsFdRegistered(int aFd) const;
+    void HandleFdEvent(int aFd, uint8_t aEvents);
+    void HandleTimeouts(Timepoint aNow);
+
+#if OTBR_ENABLE_EPOLL
+    // The maximum number of events retrieved by one `epoll_wait()`, the
+    // remaining ready fds are reported by the next call.
+    static constexpr int kMaxEpollEvents = 64;
+
+    // The interval to re-validate the whole epoll interest list of the legacy
+    // mainloop processors. This bounds the time that an fd number which was
+    // closed and reused between two iterations can be missed, as the kernel
+    // silently drops the registration of a closed fd.
+    static constexpr Milliseconds kResyncInterval = Milliseconds(1000);
+
+    struct FdInterest
+    {
+        int      mFd;
+        uint32_t mEvents;
+    };
+
+    struct EpollProcessor
+    {
+        explicit EpollProcessor(MainloopProcessor *aProcessor)
+            : mProcessor(aProcessor)
+        {
+        }
+
+        MainloopProcessor      *mProcessor;
+        MainloopContext         mContext;
+        std::vector<FdInterest> mInterests;
+        Timepoint               mDeadline;
+    };
+
+    static uint32_t ToEpollEvents(uint8_t aEvents);
+    static uint8_t  FromEpollEvents(uint32_t aEpollEvents);
+
+    void UpdateProcessor(EpollProcessor &aEntry, const timeval &aTimeout, Timepoint aNow);
+    void AddWantedEvents(int aFd, uint32_t aEvents);
+    void SyncInterests(Timepoint aNow);
+    void SetInterest(int aFd, uint32_t aEvents);
+    bool PrepareProcess(EpollProcessor &aEntry, Timepoint aNow);
+
+    int                       mEpollFd;
+    std::list<EpollProcessor> mEpollProcessorList;
+    std::vector<uint32_t>     mWantedEvents;
+    std::vector<int>          mWantedFds;
+    std::vector<uint32_t>     mRegisteredEvents;
+    std::vector<int>          mRegisteredFds;
+    std::vector<uint32_t>     mReadyEvents;
+    std::vector<int>          mReadyFds;
+    Timepoint                 mLastResync;
+    bool                      mNeedResync = true;
+#endif
+
+    // The fds registered by the mainloop processors, indexed by fd.
+    std::vector<FdRegistration> mFdRegistrations;
+
     std::list<MainloopProcessor *> mMainloopProcessorList;
 };
 } // namespace otbr
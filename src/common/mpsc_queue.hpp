@@ -0,0 +1,135 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines a lock-free multi-producer single-consumer intrusive queue.
+ */
+
+#ifndef OTBR_COMMON_MPSC_QUEUE_HPP_
+#define OTBR_COMMON_MPSC_QUEUE_HPP_
+
+#include <openthread-br/config.h>
+
+#include <atomic>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+/**
+ * This class template implements a lock-free multi-producer single-consumer intrusive queue.
+ *
+ * The node type @p NodeType must be default constructible and have a `std::atomic<NodeType *> mNext`
+ * member. `Push()` is wait-free and can be called from any thread concurrently, `Pop()` must only be
+ * called from a single consumer thread. The queue does not own the nodes.
+ *
+ * `Pop()` may return `nullptr` while a producer is in the middle of a `Push()`, the node becomes
+ * available once that `Push()` returns.
+ */
+template <typename NodeType> class MpscQueue : private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes an empty queue.
+     */
+    MpscQueue(void)
+        : mHead(&mStub)
+        , mTail(&mStub)
+    {
+        mStub.mNext.store(nullptr, std::memory_order_relaxed);
+    }
+
+    /**
+     * This method pushes a node to the tail of the queue.
+     *
+     * It is safe to call this method in different threads concurrently.
+     *
+     * @param[in] aNode  A reference to the node to push.
+     */
+    void Push(NodeType &aNode)
+    {
+        NodeType *prev;
+
+        aNode.mNext.store(nullptr, std::memory_order_relaxed);
+        prev = mHead.exchange(&aNode, std::memory_order_acq_rel);
+        prev->mNext.store(&aNode, std::memory_order_release);
+    }
+
+    /**
+     * This method pops a node from the head of the queue.
+     *
+     * This method must only be called by the consumer thread.
+     *
+     * @returns A pointer to the popped node, or `nullptr` if no node is available.
+     */
+    NodeType *Pop(void)
+    {
+        NodeType *tail = mTail;
+        NodeType *next = tail->mNext.load(std::memory_order_acquire);
+        NodeType *node = nullptr;
+
+        if (tail == &mStub)
+        {
+            VerifyOrExit(next != nullptr);
+            mTail = next;
+            tail  = next;
+            next  = next->mNext.load(std::memory_order_acquire);
+        }
+
+        if (next != nullptr)
+        {
+            mTail = next;
+            ExitNow(node = tail);
+        }
+
+        // A producer has swapped the head but not linked its node yet.
+        VerifyOrExit(tail == mHead.load(std::memory_order_acquire));
+
+        Push(mStub);
+        next = tail->mNext.load(std::memory_order_acquire);
+
+        if (next != nullptr)
+        {
+            mTail = next;
+            node  = tail;
+        }
+
+    exit:
+        return node;
+    }
+
+private:
+    std::atomic<NodeType *> mHead;
+    NodeType               *mTail;
+    NodeType                mStub;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MPSC_QUEUE_HPP_
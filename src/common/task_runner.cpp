@@ -34,17 +34,37 @@
 #include "common/task_runner.hpp"
 
 #include <algorithm>
+#include <functional>
 
 #include <fcntl.h>
 #include <unistd.h>
+#if __linux__
+#include <sys/eventfd.h>
+#endif
 
 #include "common/code_utils.hpp"
 
 namespace otbr {
 
+constexpr uint32_t TaskRunner::kNodePoolSize;
+
 TaskRunner::TaskRunner(void)
-    : mTaskQueue(DelayedTask::Comparator{})
+    : MainloopProcessor(Registration::kPersistent)
+    , mWakeUpPending(false)
+    , mFreeNodes(0)
+    , mNextSequence(1)
 {
+    for (uint32_t i = 0; i < kNodePoolSize; i++)
+    {
+        FreeNode(mNodePool[i]);
+    }
+
+#if __linux__
+    // We do not handle failures when creating an eventfd, simply die.
+    mEventFd[kRead] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    VerifyOrDie(mEventFd[kRead] != -1, strerror(errno));
+    mEventFd[kWrite] = mEventFd[kRead];
+#else
     int flags;
 
     // We do not handle failures when creating a pipe, simply die.
@@ -54,25 +74,44 @@ TaskRunner::TaskRunner(void)
     VerifyOrDie(fcntl(mEventFd[kRead], F_SETFL, flags | O_NONBLOCK) != -1, strerror(errno));
     flags = fcntl(mEventFd[kWrite], F_GETFL, 0);
     VerifyOrDie(fcntl(mEventFd[kWrite], F_SETFL, flags | O_NONBLOCK) != -1, strerror(errno));
+#endif
+
+    RegisterFd(mEventFd[kRead], kEventReadable);
 }
 
 TaskRunner::~TaskRunner(void)
 {
-    if (mEventFd[kRead] != -1)
+    TaskNode *node;
+
+    while ((node = mPostedTasks.Pop()) != nullptr)
     {
-        close(mEventFd[kRead]);
-        mEventFd[kRead] = -1;
+        FreeNode(*node);
     }
-    if (mEventFd[kWrite] != -1)
+
+    UnregisterFd(mEventFd[kRead]);
+
+    if (mEventFd[kWrite] != -1 && mEventFd[kWrite] != mEventFd[kRead])
     {
         close(mEventFd[kWrite]);
-        mEventFd[kWrite] = -1;
+    }
+    mEventFd[kWrite] = -1;
+
+    if (mEventFd[kRead] != -1)
+    {
+        close(mEventFd[kRead]);
+        mEventFd[kRead] = -1;
     }
 }
 
 void TaskRunner::Post(Task<void> aTask)
 {
-    Post(Milliseconds::zero(), std::move(aTask));
+    TaskNode *node = AllocateNode();
+
+    node->mSequence = mNextSequence.fetch_add(1, std::memory_order_relaxed);
+    node->mTask     = std::move(aTask);
+    mPostedTasks.Push(*node);
+
+    WakeUp();
 }
 
 TaskRunner::TaskId TaskRunner::Post(Milliseconds aDelay, Task<void> aTask)
@@ -80,126 +119,218 @@ TaskRunner::TaskId TaskRunner::Post(Milliseconds aDelay, Task<void> aTask)
     return PushTask(aDelay, std::move(aTask));
 }
 
-void TaskRunner::Update(MainloopContext &aMainloop)
+Timepoint TaskRunner::GetDeadline(void) const
 {
-    aMainloop.AddFdToReadSet(mEventFd[kRead]);
+    std::lock_guard<std::mutex> _(mTaskQueueMutex);
+
+    return mTaskQueue.IsEmpty() ? Timepoint::max() : mTaskQueue.GetNextDeadline();
+}
 
+void TaskRunner::HandleFdEvent(int aFd, uint8_t aEvents)
+{
+    OTBR_UNUSED_VARIABLE(aFd);
+    OTBR_UNUSED_VARIABLE(aEvents);
+
+#if __linux__
     {
-        std::lock_guard<std::mutex> _(mTaskQueueMutex);
+        uint64_t count;
+        ssize_t  rval;
 
-        if (!mTaskQueue.empty())
+        do
         {
-            auto  now     = Clock::now();
-            auto &task    = mTaskQueue.top();
-            auto  delay   = std::chrono::duration_cast<Microseconds>(task.GetTimeExecute() - now);
-            auto  timeout = FromTimeval<Microseconds>(aMainloop.mTimeout);
+            rval = read(mEventFd[kRead], &count, sizeof(count));
+        } while (rval == -1 && errno == EINTR);
 
-            if (task.GetTimeExecute() < now)
-            {
-                delay = Microseconds::zero();
-            }
+        // Critical error happens, simply die.
+        VerifyOrDie(rval == sizeof(count) || errno == EAGAIN || errno == EWOULDBLOCK, strerror(errno));
+    }
+#else
+    {
+        ssize_t rval;
 
-            if (delay <= timeout)
-            {
-                aMainloop.mTimeout.tv_sec  = delay.count() / 1000000;
-                aMainloop.mTimeout.tv_usec = delay.count() % 1000000;
-            }
-        }
+        // Read any data in the pipe.
+        do
+        {
+            uint8_t n;
+
+            rval = read(mEventFd[kRead], &n, sizeof(n));
+        } while (rval > 0 || (rval == -1 && errno == EINTR));
+
+        // Critical error happens, simply die.
+        VerifyOrDie(errno == EAGAIN || errno == EWOULDBLOCK, strerror(errno));
     }
+#endif
+
+    PopTasks();
 }
 
-void TaskRunner::Process(const MainloopContext &aMainloop)
+void TaskRunner::HandleTimeout(void)
 {
-    ssize_t rval;
+    PopTasks();
+}
 
-    VerifyOrExit(FD_ISSET(mEventFd[kRead], &aMainloop.mReadFdSet));
+TaskRunner::TaskId TaskRunner::PushTask(Milliseconds aDelay, Task<void> aTask)
+{
+    TaskId taskId;
 
-    // Read any data in the pipe.
-    do
     {
-        uint8_t n;
+        std::lock_guard<std::mutex> _(mTaskQueueMutex);
 
-        rval = read(mEventFd[kRead], &n, sizeof(n));
-    } while (rval > 0 || (rval == -1 && errno == EINTR));
+        taskId = mTaskQueue.Add(Clock::now() + aDelay, std::move(aTask),
+                                mNextSequence.fetch_add(1, std::memory_order_relaxed));
+    }
 
-    // Critical error happens, simply die.
-    VerifyOrDie(errno == EAGAIN || errno == EWOULDBLOCK, strerror(errno));
+    WakeUp();
 
-exit:
-    PopTasks();
+    return taskId;
 }
 
-TaskRunner::TaskId TaskRunner::PushTask(Milliseconds aDelay, Task<void> aTask)
+void TaskRunner::WakeUp(void)
 {
-    ssize_t       rval;
-    const uint8_t kOne = 1;
-    TaskId        taskId;
+    ssize_t rval;
 
-    {
-        std::lock_guard<std::mutex> _(mTaskQueueMutex);
+    // Only the first caller after the mainloop has processed the queues needs to
+    // issue the syscall, the mainloop is guaranteed to see all tasks pushed before
+    // it clears `mWakeUpPending`.
+    VerifyOrExit(!mWakeUpPending.exchange(true));
 
-        taskId = mNextTaskId++;
+#if __linux__
+    {
+        const uint64_t kOne = 1;
 
-        mActiveTaskIds.insert(taskId);
-        mTaskQueue.emplace(taskId, aDelay, std::move(aTask));
+        do
+        {
+            rval = write(mEventFd[kWrite], &kOne, sizeof(kOne));
+        } while (rval == -1 && errno == EINTR);
     }
-
-    do
+#else
     {
-        rval = write(mEventFd[kWrite], &kOne, sizeof(kOne));
-    } while (rval == -1 && errno == EINTR);
+        const uint8_t kOne = 1;
+
+        do
+        {
+            rval = write(mEventFd[kWrite], &kOne, sizeof(kOne));
+        } while (rval == -1 && errno == EINTR);
+    }
+#endif
 
     VerifyOrExit(rval == -1);
 
     // Critical error happens, simply die.
     VerifyOrDie(errno == EAGAIN || errno == EWOULDBLOCK, strerror(errno));
 
-    // We are blocked because there are already data (written by other concurrent callers in
-    // different threads) in the pipe, and the mEventFd[kRead] should be readable now.
+    // We are blocked because the event fd is already readable.
     otbrLogWarning("Failed to write fd %d: %s", mEventFd[kWrite], strerror(errno));
 
 exit:
-    return taskId;
+    return;
 }
 
 void TaskRunner::Cancel(TaskRunner::TaskId aTaskId)
 {
     std::lock_guard<std::mutex> _(mTaskQueueMutex);
 
-    mActiveTaskIds.erase(aTaskId);
+    mTaskQueue.Remove(aTaskId);
 }
 
 void TaskRunner::PopTasks(void)
 {
+    TaskNode *node = nullptr;
+
+    // A producer skips the wakeup when it finds `mWakeUpPending` set, so its task must be seen by the
+    // drain below. Clearing the flag with a read-modify-write synchronizes with the last producer which
+    // set or found it set, so that every task pushed before is visible to `Pop()`. With a plain store,
+    // the loads in `Pop()` could be ordered before it and miss such a task until an unrelated wakeup.
+    mWakeUpPending.exchange(false);
+
     while (true)
     {
         Task<void> task;
-        bool       canceled;
+        uint64_t   sequence;
+
+        if (node == nullptr)
+        {
+            node = mPostedTasks.Pop();
+        }
 
         // The braces here are necessary for auto-releasing of the mutex.
         {
             std::lock_guard<std::mutex> _(mTaskQueueMutex);
+            Timepoint                   now = Clock::now();
 
-            if (!mTaskQueue.empty() && mTaskQueue.top().GetTimeExecute() <= Clock::now())
-            {
-                const DelayedTask &top    = mTaskQueue.top();
-                TaskId             taskId = top.mTaskId;
-
-                task = std::move(top.mTask);
-                mTaskQueue.pop();
-                canceled = (mActiveTaskIds.erase(taskId) == 0);
-            }
-            else
+            // An expired delayed task runs first if it was posted before the next
+            // task posted without delay, so that tasks run in the order they were posted.
+            if (mTaskQueue.PeekExpired(now, sequence) && (node == nullptr || sequence < node->mSequence))
             {
-                break;
+                mTaskQueue.PopExpired(now, task);
             }
         }
 
-        if (!canceled)
+        if (task == nullptr)
+        {
+            VerifyOrExit(node != nullptr);
+
+            task = std::move(node->mTask);
+            FreeNode(*node);
+            node = nullptr;
+        }
+
+        task();
+    }
+
+exit:
+    return;
+}
+
+TaskRunner::TaskNode *TaskRunner::AllocateNode(void)
+{
+    uint64_t  head = mFreeNodes.load(std::memory_order_acquire);
+    TaskNode *node = nullptr;
+
+    while (static_cast<uint32_t>(head) != 0)
+    {
+        TaskNode &candidate = mNodePool[static_cast<uint32_t>(head) - 1];
+        uint64_t  next = ((head >> 32) + 1) << 32 | candidate.mNextFree.load(std::memory_order_relaxed);
+
+        if (mFreeNodes.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_acquire))
         {
-            task();
+            node = &candidate;
+            break;
         }
     }
+
+    if (node == nullptr)
+    {
+        // All preallocated nodes are in use.
+        node = new TaskNode();
+    }
+
+    return node;
+}
+
+void TaskRunner::FreeNode(TaskNode &aNode)
+{
+    uint64_t head;
+    uint64_t next;
+
+    aNode.mTask = nullptr;
+
+    if (std::less<TaskNode *>()(&aNode, mNodePool) || !std::less<TaskNode *>()(&aNode, mNodePool + kNodePoolSize))
+    {
+        delete &aNode;
+        ExitNow();
+    }
+
+    head = mFreeNodes.load(std::memory_order_relaxed);
+
+    do
+    {
+        aNode.mNextFree.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+        next = ((head >> 32) + 1) << 32 | static_cast<uint64_t>(&aNode - mNodePool + 1);
+    } while (!mFreeNodes.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+
+exit:
+    return;
 }
 
 } // namespace otbr
@@ -36,16 +36,17 @@
 
 #include <openthread-br/config.h>
 
+#include <atomic>
 #include <chrono>
-#include <functional>
 #include <future>
 #include <mutex>
-#include <queue>
-#include <set>
 
 #include "common/code_utils.hpp"
+#include "common/inline_function.hpp"
 #include "common/mainloop.hpp"
+#include "common/mpsc_queue.hpp"
 #include "common/time.hpp"
+#include "common/timer_queue.hpp"
 
 namespace otbr {
 
@@ -58,15 +59,18 @@ class TaskRunner : public MainloopProcessor, private NonCopyable
 public:
     /**
      * This type represents the generic executable task.
+     *
+     * Tasks are move-only and a task whose captures fit in `OTBR_CONFIG_INLINE_FUNCTION_SIZE`
+     * bytes is posted without heap allocation for the callable.
      */
-    template <class T> using Task = std::function<T(void)>;
+    template <class T> using Task = InlineFunction<T(void)>;
 
     /**
      * This type represents a unique task ID to an delayed task.
      *
      * Note: A valid task ID is never zero.
      */
-    typedef uint64_t TaskId;
+    typedef TimerId TaskId;
 
     /**
      * This constructor initializes the Task Runner instance.
@@ -82,7 +86,9 @@ public:
      * This method posts a task to the task runner and returns immediately.
      *
      * Tasks are executed sequentially and follow the First-Come-First-Serve rule.
-     * It is safe to call this method in different threads concurrently.
+     * It is safe to call this method in different threads concurrently. The task is
+     * submitted through a lock-free queue and only the first task posted into an empty
+     * queue wakes up the mainloop.
      *
      * @param[in] aTask  The task to be executed.
      */
@@ -122,14 +128,18 @@ public:
     {
         std::promise<T> pro;
 
-        Post(aDelay, [&pro, &aTask]() { pro.set_value(aTask()); });
+        if (aDelay == Milliseconds::zero())
+        {
+            Post([&pro, &aTask]() { pro.set_value(aTask()); });
+        }
+        else
+        {
+            Post(aDelay, [&pro, &aTask]() { pro.set_value(aTask()); });
+        }
 
         return pro.get_future().get();
     }
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
-
 private:
     enum
     {
@@ -137,49 +147,52 @@ private:
         kWrite = 1,
     };
 
-    struct DelayedTask
+    struct TaskNode
     {
-        friend class Comparator;
+        std::atomic<TaskNode *> mNext;
+        std::atomic<uint32_t>   mNextFree;
+        uint64_t                mSequence;
+        Task<void>              mTask;
+    };
 
-        struct Comparator
-        {
-            bool operator()(const DelayedTask &aLhs, const DelayedTask &aRhs) const { return aRhs < aLhs; }
-        };
+    static constexpr uint32_t kNodePoolSize = OTBR_CONFIG_TASK_RUNNER_NODE_POOL_SIZE;
 
-        DelayedTask(TaskId aTaskId, Milliseconds aDelay, Task<void> aTask)
-            : mTaskId(aTaskId)
-            , mDeadline(Clock::now() + aDelay)
-            , mTask(std::move(aTask))
-        {
-        }
+    // MainloopProcessor methods
+    Timepoint GetDeadline(void) const override;
+    void      HandleFdEvent(int aFd, uint8_t aEvents) override;
+    void      HandleTimeout(void) override;
 
-        bool operator<(const DelayedTask &aOther) const
-        {
-            return mDeadline <= aOther.mDeadline || (mDeadline == aOther.mDeadline && mTaskId < aOther.mTaskId);
-        }
+    TaskId    PushTask(Milliseconds aDelay, Task<void> aTask);
+    void      PopTasks(void);
+    void      WakeUp(void);
+    TaskNode *AllocateNode(void);
+    void      FreeNode(TaskNode &aNode);
 
-        Timepoint GetTimeExecute(void) const { return mDeadline; }
+    // The event fds which are used to wakeup the mainloop when there are pending
+    // tasks in the task queues. Both refer to the same eventfd on Linux.
+    int mEventFd[2];
 
-        TaskId     mTaskId;
-        Timepoint  mDeadline;
-        Task<void> mTask;
-    };
+    // Whether the mainloop has been woken up and not yet processed the queues.
+    std::atomic<bool> mWakeUpPending;
 
-    TaskId PushTask(Milliseconds aDelay, Task<void> aTask);
-    void   PopTasks(void);
+    // The tasks posted without delay, which are submitted without locking.
+    MpscQueue<TaskNode> mPostedTasks;
 
-    // The event fds which are used to wakeup the mainloop
-    // when there are pending tasks in the task queue.
-    int mEventFd[2];
+    // The preallocated nodes for `mPostedTasks`. The free list is a lock-free
+    // stack whose head packs a tag in the upper 32 bits and the index plus one
+    // of the first free node in the lower 32 bits, the tag avoids the ABA problem.
+    TaskNode              mNodePool[kNodePoolSize];
+    std::atomic<uint64_t> mFreeNodes;
 
-    std::priority_queue<DelayedTask, std::vector<DelayedTask>, DelayedTask::Comparator> mTaskQueue;
+    // The sequence of every posted task, which keeps the tasks posted without
+    // delay and the expired delayed tasks in the order they were posted.
+    std::atomic<uint64_t> mNextSequence;
 
-    std::set<TaskId> mActiveTaskIds;
-    TaskId           mNextTaskId = 1;
+    TimerQueue mTaskQueue;
 
     // The mutex which protects the `mTaskQueue` from being
     // simultaneously accessed by multiple threads.
-    std::mutex mTaskQueueMutex;
+    mutable std::mutex mTaskQueueMutex;
 };
 
 } // namespace otbr
@@ -0,0 +1,384 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the timer queues which keep the delayed tasks of the Task Runner.
+ */
+
+#include "common/timer_queue.hpp"
+
+#include <algorithm>
+
+#include <assert.h>
+
+namespace otbr {
+
+TimerHeap::TimerHeap(void)
+    : mHeap(Comparator{})
+    , mNextTimerId(1)
+{
+}
+
+TimerId TimerHeap::Add(Timepoint aDeadline, TimerTask aTask, uint64_t aSequence)
+{
+    TimerId timerId = mNextTimerId++;
+
+    mActiveTimerIds.insert(timerId);
+    mHeap.emplace(timerId, aDeadline, std::move(aTask), aSequence);
+
+    return timerId;
+}
+
+void TimerHeap::Remove(TimerId aTimerId)
+{
+    mActiveTimerIds.erase(aTimerId);
+}
+
+bool TimerHeap::PopExpired(Timepoint aNow, TimerTask &aTask)
+{
+    bool popped = false;
+
+    DropRemoved();
+
+    if (!mHeap.empty() && mHeap.top().mDeadline <= aNow)
+    {
+        aTask = std::move(const_cast<Entry &>(mHeap.top()).mTask);
+        mActiveTimerIds.erase(mHeap.top().mTimerId);
+        mHeap.pop();
+        popped = true;
+    }
+
+    return popped;
+}
+
+bool TimerHeap::PeekExpired(Timepoint aNow, uint64_t &aSequence)
+{
+    bool expired = false;
+
+    DropRemoved();
+
+    if (!mHeap.empty() && mHeap.top().mDeadline <= aNow)
+    {
+        aSequence = mHeap.top().mSequence;
+        expired   = true;
+    }
+
+    return expired;
+}
+
+void TimerHeap::DropRemoved(void)
+{
+    while (!mHeap.empty() && mActiveTimerIds.count(mHeap.top().mTimerId) == 0)
+    {
+        mHeap.pop();
+    }
+}
+
+constexpr Milliseconds TimerWheel::kTickDuration;
+constexpr uint32_t     TimerWheel::kNumSlots;
+constexpr uint32_t     TimerWheel::kInvalidIndex;
+
+TimerWheel::TimerWheel(void)
+    : mEpoch(Clock::now())
+    , mCurrentTick(0)
+    , mFreeList(kInvalidIndex)
+    , mNumTimers(0)
+    , mEarliestDeadlineValid(false)
+{
+    for (Slot &slot : mSlots)
+    {
+        slot.mHead = kInvalidIndex;
+        slot.mTail = kInvalidIndex;
+    }
+}
+
+TimerId TimerWheel::Add(Timepoint aDeadline, TimerTask aTask, uint64_t aSequence)
+{
+    uint32_t index = AllocateEntry();
+    Entry   &entry = mEntries[index];
+
+    entry.mDeadline = aDeadline;
+    entry.mTask     = std::move(aTask);
+    entry.mSequence = aSequence;
+
+    Link(GetSlotIndex(std::max(ToTick(aDeadline), mCurrentTick)), index);
+    mNumTimers++;
+
+    if (mNumTimers == 1 || (mEarliestDeadlineValid && aDeadline < mEarliestDeadline))
+    {
+        mEarliestDeadline      = aDeadline;
+        mEarliestDeadlineValid = true;
+    }
+
+    return ToTimerId(index);
+}
+
+void TimerWheel::Remove(TimerId aTimerId)
+{
+    uint32_t index = FindEntry(aTimerId);
+
+    VerifyOrExit(index != kInvalidIndex);
+
+    Unlink(index);
+    FreeEntry(index);
+
+exit:
+    return;
+}
+
+Timepoint TimerWheel::GetNextDeadline(void) const
+{
+    const Entry *earliest = nullptr;
+
+    VerifyOrExit(!mEarliestDeadlineValid);
+
+    for (uint32_t i = 0; i < kNumSlots; i++)
+    {
+        uint32_t head = mSlots[GetSlotIndex(mCurrentTick + i)].mHead;
+
+        if (head == kInvalidIndex)
+        {
+            continue;
+        }
+
+        // Slots keep their timers sorted by deadline, so the first head which belongs
+        // to the current round of the wheel is the earliest timer.
+        if (ToTick(mEntries[head].mDeadline) <= mCurrentTick + i)
+        {
+            earliest = &mEntries[head];
+            break;
+        }
+
+        if (earliest == nullptr || mEntries[head].mDeadline < earliest->mDeadline)
+        {
+            earliest = &mEntries[head];
+        }
+    }
+
+    assert(earliest != nullptr);
+
+    mEarliestDeadline      = earliest->mDeadline;
+    mEarliestDeadlineValid = true;
+
+exit:
+    return mEarliestDeadline;
+}
+
+bool TimerWheel::PopExpired(Timepoint aNow, TimerTask &aTask)
+{
+    uint32_t index = FindExpired(aNow);
+
+    VerifyOrExit(index != kInvalidIndex);
+
+    aTask = std::move(mEntries[index].mTask);
+    Unlink(index);
+    FreeEntry(index);
+
+exit:
+    return index != kInvalidIndex;
+}
+
+bool TimerWheel::PeekExpired(Timepoint aNow, uint64_t &aSequence)
+{
+    uint32_t index = FindExpired(aNow);
+
+    VerifyOrExit(index != kInvalidIndex);
+    aSequence = mEntries[index].mSequence;
+
+exit:
+    return index != kInvalidIndex;
+}
+
+uint32_t TimerWheel::FindExpired(Timepoint aNow)
+{
+    uint64_t nowTick = ToTick(aNow);
+    uint32_t index   = kInvalidIndex;
+
+    while (true)
+    {
+        uint32_t head;
+
+        if (mNumTimers == 0)
+        {
+            mCurrentTick = std::max(mCurrentTick, nowTick);
+            break;
+        }
+
+        head = mSlots[GetSlotIndex(mCurrentTick)].mHead;
+
+        if (head != kInvalidIndex && mEntries[head].mDeadline <= aNow)
+        {
+            index = head;
+            break;
+        }
+
+        if (mCurrentTick >= nowTick)
+        {
+            break;
+        }
+
+        // The remaining timers of this slot belong to later rounds of the wheel.
+        mCurrentTick++;
+    }
+
+    return index;
+}
+
+uint64_t TimerWheel::ToTick(Timepoint aTime) const
+{
+    uint64_t tick = 0;
+
+    if (aTime > mEpoch)
+    {
+        tick = static_cast<uint64_t>(std::chrono::duration_cast<Milliseconds>(aTime - mEpoch) / kTickDuration);
+    }
+
+    return tick;
+}
+
+TimerId TimerWheel::ToTimerId(uint32_t aIndex) const
+{
+    // The index is offset by one so that a valid timer ID is never zero.
+    return (static_cast<TimerId>(mEntries[aIndex].mGeneration) << 32) | (static_cast<TimerId>(aIndex) + 1);
+}
+
+uint32_t TimerWheel::FindEntry(TimerId aTimerId) const
+{
+    uint32_t index = static_cast<uint32_t>(aTimerId & UINT32_MAX) - 1;
+
+    // A stale ID refers to an entry which has been freed or recycled by a later timer.
+    VerifyOrExit(index < mEntries.size(), index = kInvalidIndex);
+    VerifyOrExit(mEntries[index].mSlot != kInvalidIndex && ToTimerId(index) == aTimerId, index = kInvalidIndex);
+
+exit:
+    return index;
+}
+
+void TimerWheel::Link(uint32_t aSlot, uint32_t aIndex)
+{
+    Slot    &slot  = mSlots[aSlot];
+    Entry   &entry = mEntries[aIndex];
+    uint32_t prev  = slot.mTail;
+
+    // Timers are mostly added in the order of their deadlines, so search
+    // for the insertion point backwards from the tail.
+    while (prev != kInvalidIndex && entry.mDeadline < mEntries[prev].mDeadline)
+    {
+        prev = mEntries[prev].mPrev;
+    }
+
+    entry.mSlot = aSlot;
+    entry.mPrev = prev;
+    entry.mNext = (prev != kInvalidIndex) ? mEntries[prev].mNext : slot.mHead;
+
+    if (entry.mNext != kInvalidIndex)
+    {
+        mEntries[entry.mNext].mPrev = aIndex;
+    }
+    else
+    {
+        slot.mTail = aIndex;
+    }
+
+    if (prev != kInvalidIndex)
+    {
+        mEntries[prev].mNext = aIndex;
+    }
+    else
+    {
+        slot.mHead = aIndex;
+    }
+}
+
+void TimerWheel::Unlink(uint32_t aIndex)
+{
+    Entry &entry = mEntries[aIndex];
+    Slot  &slot  = mSlots[entry.mSlot];
+
+    if (entry.mPrev != kInvalidIndex)
+    {
+        mEntries[entry.mPrev].mNext = entry.mNext;
+    }
+    else
+    {
+        slot.mHead = entry.mNext;
+    }
+
+    if (entry.mNext != kInvalidIndex)
+    {
+        mEntries[entry.mNext].mPrev = entry.mPrev;
+    }
+    else
+    {
+        slot.mTail = entry.mPrev;
+    }
+
+    entry.mSlot = kInvalidIndex;
+    entry.mPrev = kInvalidIndex;
+    entry.mNext = kInvalidIndex;
+
+    mNumTimers--;
+
+    if (mEarliestDeadlineValid && entry.mDeadline <= mEarliestDeadline)
+    {
+        mEarliestDeadlineValid = false;
+    }
+}
+
+uint32_t TimerWheel::AllocateEntry(void)
+{
+    uint32_t index = mFreeList;
+
+    if (index != kInvalidIndex)
+    {
+        mFreeList = mEntries[index].mNext;
+    }
+    else
+    {
+        // `std::deque` grows without moving the existing entries.
+        index = static_cast<uint32_t>(mEntries.size());
+        mEntries.emplace_back();
+    }
+
+    mEntries[index].mNext = kInvalidIndex;
+
+    return index;
+}
+
+void TimerWheel::FreeEntry(uint32_t aIndex)
+{
+    Entry &entry = mEntries[aIndex];
+
+    entry.mTask = nullptr;
+    entry.mGeneration++;
+    entry.mNext = mFreeList;
+    mFreeList   = aIndex;
+}
+
+} // namespace otbr
@@ -0,0 +1,306 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file defines the timer queues which keep the delayed tasks of the Task Runner.
+ */
+
+#ifndef OTBR_COMMON_TIMER_QUEUE_HPP_
+#define OTBR_COMMON_TIMER_QUEUE_HPP_
+
+#include <openthread-br/config.h>
+
+#include <deque>
+#include <queue>
+#include <set>
+#include <vector>
+
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+#include "common/inline_function.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This type represents a task kept in a timer queue.
+ */
+using TimerTask = InlineFunction<void(void)>;
+
+/**
+ * This type represents a unique ID of a timer queue entry.
+ *
+ * Note: A valid timer ID is never zero.
+ */
+typedef uint64_t TimerId;
+
+/**
+ * This class implements a timer queue based on a binary heap.
+ *
+ * Adding and popping a timer costs O(log n). A removed timer is only marked as
+ * cancelled and is dropped from the heap when its deadline is reached.
+ */
+class TimerHeap : private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes an empty timer heap.
+     */
+    TimerHeap(void);
+
+    /**
+     * This method adds a timer to the queue.
+     *
+     * Timers with the same deadline expire in the order they were added.
+     *
+     * @param[in] aDeadline  The time point when the timer expires.
+     * @param[in] aTask      The task to be executed when the timer expires.
+     * @param[in] aSequence  An opaque value reported back by `PeekExpired()`.
+     *
+     * @returns The unique ID of the timer.
+     */
+    TimerId Add(Timepoint aDeadline, TimerTask aTask, uint64_t aSequence = 0);
+
+    /**
+     * This method removes a timer from the queue.
+     *
+     * It is safe to remove a timer which has already expired.
+     *
+     * @param[in] aTimerId  The unique ID of the timer.
+     */
+    void Remove(TimerId aTimerId);
+
+    /**
+     * This method indicates whether there are no timers in the queue.
+     *
+     * @returns Whether the queue is empty.
+     */
+    bool IsEmpty(void) const { return mHeap.empty(); }
+
+    /**
+     * This method returns the earliest time point when a timer may expire.
+     *
+     * This method must not be called when the queue is empty.
+     *
+     * @returns The earliest deadline of the timers in the queue.
+     */
+    Timepoint GetNextDeadline(void) const { return mHeap.top().mDeadline; }
+
+    /**
+     * This method pops the earliest expired timer from the queue.
+     *
+     * @param[in]  aNow   The current time point.
+     * @param[out] aTask  The task of the expired timer.
+     *
+     * @retval TRUE   An expired timer was popped and @p aTask is set.
+     * @retval FALSE  There is no expired timer.
+     */
+    bool PopExpired(Timepoint aNow, TimerTask &aTask);
+
+    /**
+     * This method returns the sequence of the timer which `PopExpired()` would pop next.
+     *
+     * @param[in]  aNow       The current time point.
+     * @param[out] aSequence  The sequence the expired timer was added with.
+     *
+     * @retval TRUE   There is an expired timer and @p aSequence is set.
+     * @retval FALSE  There is no expired timer.
+     */
+    bool PeekExpired(Timepoint aNow, uint64_t &aSequence);
+
+private:
+    struct Entry
+    {
+        Entry(TimerId aTimerId, Timepoint aDeadline, TimerTask aTask, uint64_t aSequence)
+            : mTimerId(aTimerId)
+            , mSequence(aSequence)
+            , mDeadline(aDeadline)
+            , mTask(std::move(aTask))
+        {
+        }
+
+        bool operator<(const Entry &aOther) const
+        {
+            return mDeadline < aOther.mDeadline || (mDeadline == aOther.mDeadline && mTimerId < aOther.mTimerId);
+        }
+
+        TimerId   mTimerId;
+        uint64_t  mSequence;
+        Timepoint mDeadline;
+        TimerTask mTask;
+    };
+
+    struct Comparator
+    {
+        bool operator()(const Entry &aLhs, const Entry &aRhs) const { return aRhs < aLhs; }
+    };
+
+    std::priority_queue<Entry, std::vector<Entry>, Comparator> mHeap;
+    std::set<TimerId>                                          mActiveTimerIds;
+    TimerId                                                    mNextTimerId;
+
+    void DropRemoved(void);
+};
+
+/**
+ * This class implements a hashed timing wheel.
+ *
+ * Timers are hashed into `kNumSlots` slots of `kTickDuration` by their deadlines and each slot keeps
+ * its timers in a doubly-linked list sorted by deadline. Adding a timer with a deadline in the near
+ * future and removing a timer are O(1), and a removed timer is released right away.
+ *
+ * Entries are kept in an indexed pool and linked by index. A timer ID encodes the index of its entry
+ * together with a generation which is bumped whenever the entry is recycled, so removing a timer needs
+ * no lookup table and adding a timer does not allocate once the wheel is warmed up. The earliest
+ * deadline is cached and only recomputed after the earliest timer is removed or expires.
+ */
+class TimerWheel : private NonCopyable
+{
+public:
+    static constexpr Milliseconds kTickDuration = Milliseconds(1); ///< The time covered by one slot.
+    static constexpr uint32_t     kNumSlots     = 256;             ///< The number of slots (power of 2).
+
+    /**
+     * This constructor initializes an empty timer wheel.
+     */
+    TimerWheel(void);
+
+    /**
+     * This method adds a timer to the queue.
+     *
+     * Timers with the same deadline expire in the order they were added.
+     *
+     * @param[in] aDeadline  The time point when the timer expires.
+     * @param[in] aTask      The task to be executed when the timer expires.
+     * @param[in] aSequence  An opaque value reported back by `PeekExpired()`.
+     *
+     * @returns The unique ID of the timer.
+     */
+    TimerId Add(Timepoint aDeadline, TimerTask aTask, uint64_t aSequence = 0);
+
+    /**
+     * This method removes a timer from the queue.
+     *
+     * It is safe to remove a timer which has already expired.
+     *
+     * @param[in] aTimerId  The unique ID of the timer.
+     */
+    void Remove(TimerId aTimerId);
+
+    /**
+     * This method indicates whether there are no timers in the queue.
+     *
+     * @returns Whether the queue is empty.
+     */
+    bool IsEmpty(void) const { return mNumTimers == 0; }
+
+    /**
+     * This method returns the earliest time point when a timer may expire.
+     *
+     * This method must not be called when the queue is empty.
+     *
+     * @returns The earliest deadline of the timers in the queue.
+     */
+    Timepoint GetNextDeadline(void) const;
+
+    /**
+     * This method pops the earliest expired timer from the queue.
+     *
+     * @param[in]  aNow   The current time point.
+     * @param[out] aTask  The task of the expired timer.
+     *
+     * @retval TRUE   An expired timer was popped and @p aTask is set.
+     * @retval FALSE  There is no expired timer.
+     */
+    bool PopExpired(Timepoint aNow, TimerTask &aTask);
+
+    /**
+     * This method returns the sequence of the timer which `PopExpired()` would pop next.
+     *
+     * @param[in]  aNow       The current time point.
+     * @param[out] aSequence  The sequence the expired timer was added with.
+     *
+     * @retval TRUE   There is an expired timer and @p aSequence is set.
+     * @retval FALSE  There is no expired timer.
+     */
+    bool PeekExpired(Timepoint aNow, uint64_t &aSequence);
+
+private:
+    static constexpr uint32_t kInvalidIndex = UINT32_MAX;
+
+    struct Entry
+    {
+        Timepoint mDeadline;
+        TimerTask mTask;
+        uint64_t  mSequence   = 0;
+        uint32_t  mGeneration = 0;
+        uint32_t  mSlot       = kInvalidIndex;
+        uint32_t  mPrev       = kInvalidIndex;
+        uint32_t  mNext       = kInvalidIndex;
+    };
+
+    struct Slot
+    {
+        uint32_t mHead;
+        uint32_t mTail;
+    };
+
+    uint64_t ToTick(Timepoint aTime) const;
+    uint32_t GetSlotIndex(uint64_t aTick) const { return static_cast<uint32_t>(aTick & (kNumSlots - 1)); }
+    TimerId  ToTimerId(uint32_t aIndex) const;
+    uint32_t FindEntry(TimerId aTimerId) const;
+    uint32_t FindExpired(Timepoint aNow);
+    void     Link(uint32_t aSlot, uint32_t aIndex);
+    void     Unlink(uint32_t aIndex);
+    uint32_t AllocateEntry(void);
+    void     FreeEntry(uint32_t aIndex);
+
+    Timepoint         mEpoch;
+    uint64_t          mCurrentTick;
+    Slot              mSlots[kNumSlots];
+    std::deque<Entry> mEntries;
+    uint32_t          mFreeList;
+    size_t            mNumTimers;
+    mutable Timepoint mEarliestDeadline;
+    mutable bool      mEarliestDeadlineValid;
+};
+
+/**
+ * The timer queue used by the Task Runner, selected at build time.
+ */
+#if OTBR_ENABLE_TIMER_WHEEL
+typedef TimerWheel TimerQueue;
+#else
+typedef TimerHeap TimerQueue;
+#endif
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_TIMER_QUEUE_HPP_
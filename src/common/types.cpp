@@ -26,7 +26,9 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
 #include <arpa/inet.h>
+#include <iterator>
 #include <sstream>
 #include <sys/socket.h>
 
@@ -209,6 +211,55 @@ std::string MacAddress::ToString(void) const
     return std::string(strbuf);
 }
 
+constexpr uint8_t  LatencyHistogram::kNumBuckets;
+constexpr uint32_t LatencyHistogram::kOverflowLatency;
+
+const uint32_t LatencyHistogram::kBucketUpperBounds[kNumBuckets - 1] = {
+    1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000, 60000,
+};
+
+void LatencyHistogram::Record(uint32_t aLatency)
+{
+    const uint32_t *bound = std::lower_bound(std::begin(kBucketUpperBounds), std::end(kBucketUpperBounds), aLatency);
+
+    mBucketCounts[static_cast<size_t>(bound - std::begin(kBucketUpperBounds))]++;
+}
+
+uint32_t LatencyHistogram::GetCount(void) const
+{
+    uint32_t count = 0;
+
+    for (uint32_t bucketCount : mBucketCounts)
+    {
+        count += bucketCount;
+    }
+
+    return count;
+}
+
+uint32_t LatencyHistogram::GetPercentile(uint8_t aPercentile) const
+{
+    uint32_t latency = 0;
+    uint64_t rank    = (static_cast<uint64_t>(GetCount()) * aPercentile + 99) / 100;
+    uint64_t count   = 0;
+
+    VerifyOrExit(rank > 0);
+
+    for (uint8_t i = 0; i < kNumBuckets; i++)
+    {
+        count += mBucketCounts[i];
+
+        if (count >= rank)
+        {
+            latency = (i < kNumBuckets - 1) ? kBucketUpperBounds[i] : kOverflowLatency;
+            break;
+        }
+    }
+
+exit:
+    return latency;
+}
+
 otError OtbrErrorToOtError(otbrError aError)
 {
     otError error;
@@ -39,6 +39,7 @@
 #include <netinet/in.h>
 #include <stdint.h>
 #include <string.h>
+#include <array>
 #include <string>
 #include <vector>
 
@@ -493,6 +494,61 @@ struct MdnsResponseCounters
     uint32_t mInvalidState;   ///< The number of 'invalid state' responses
 };
 
+/**
+ * This structure represents a histogram of latencies with fixed, roughly logarithmic buckets.
+ *
+ * Recording a latency does not allocate, and a value-initialized histogram is empty.
+ */
+struct LatencyHistogram
+{
+    static constexpr uint8_t kNumBuckets = 16; ///< The number of buckets.
+
+    /**
+     * The inclusive upper bounds in milliseconds of all buckets but the last one, which counts all larger latencies.
+     */
+    static const uint32_t kBucketUpperBounds[kNumBuckets - 1];
+
+    static constexpr uint32_t kOverflowLatency = UINT32_MAX; ///< The percentile reported in the last bucket.
+
+    std::array<uint32_t, kNumBuckets> mBucketCounts; ///< The number of latencies in each bucket.
+
+    /**
+     * This method records a latency.
+     *
+     * @param[in] aLatency  The latency in milliseconds.
+     */
+    void Record(uint32_t aLatency);
+
+    /**
+     * This method returns the number of recorded latencies.
+     *
+     * @returns The number of recorded latencies.
+     */
+    uint32_t GetCount(void) const;
+
+    /**
+     * This method returns an upper estimate of a percentile of the recorded latencies.
+     *
+     * @param[in] aPercentile  The percentile, between 1 and 100.
+     *
+     * @returns The upper bound in milliseconds of the bucket holding @p aPercentile, `kOverflowLatency` if that
+     *          is the last bucket, or zero if no latency has been recorded.
+     */
+    uint32_t GetPercentile(uint8_t aPercentile) const;
+};
+
+/**
+ * This structure represents the latency histograms of the mDNS operations.
+ */
+struct MdnsLatencyHistograms
+{
+    LatencyHistogram mHostRegistration;    ///< The latency histogram of host registrations
+    LatencyHistogram mKeyRegistration;     ///< The latency histogram of key registrations
+    LatencyHistogram mServiceRegistration; ///< The latency histogram of service registrations
+    LatencyHistogram mHostResolution;      ///< The latency histogram of host resolutions
+    LatencyHistogram mServiceResolution;   ///< The latency histogram of service resolutions
+};
+
 struct MdnsTelemetryInfo
 {
     static constexpr uint32_t kEmaFactorNumerator   = 1;
@@ -513,6 +569,11 @@ struct MdnsTelemetryInfo
     uint32_t mServiceRegistrationEmaLatency; ///< The EMA latency of service registrations in milliseconds
     uint32_t mHostResolutionEmaLatency;      ///< The EMA latency of host resolutions in milliseconds
     uint32_t mServiceResolutionEmaLatency;   ///< The EMA latency of service resolutions in milliseconds
+
+    MdnsLatencyHistograms mLatencyHistograms; ///< The latency histograms of all operations
+
+    uint32_t mDiscoveryProxyCacheHits;   ///< The number of Discovery Proxy queries answered from the cache
+    uint32_t mDiscoveryProxyCacheMisses; ///< The number of Discovery Proxy queries that required an mDNS lookup
 };
 
 static constexpr size_t kVendorOuiLength      = 3;
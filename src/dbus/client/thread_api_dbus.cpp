@@ -681,6 +681,11 @@ ClientError ThreadApiDBus::GetMdnsTelemetryInfo(MdnsTelemetryInfo &aMdnsTelemetr
     return GetProperty(OTBR_DBUS_PROPERTY_MDNS_TELEMETRY_INFO, aMdnsTelemetryInfo);
 }
 
+ClientError ThreadApiDBus::GetMdnsLatencyHistograms(MdnsLatencyHistograms &aMdnsLatencyHistograms)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_MDNS_LATENCY_HISTOGRAMS, aMdnsLatencyHistograms);
+}
+
 ClientError ThreadApiDBus::GetNat64State(Nat64ComponentState &aState)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_NAT64_STATE, aState);
@@ -758,6 +758,17 @@ public:
      */
     ClientError GetMdnsTelemetryInfo(MdnsTelemetryInfo &aMdnsTelemetryInfo);
 
+    /**
+     * This method gets the latency histograms of the MDNS operations.
+     *
+     * @param[out] aMdnsLatencyHistograms  The MDNS latency histograms.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     */
+    ClientError GetMdnsLatencyHistograms(MdnsLatencyHistograms &aMdnsLatencyHistograms);
+
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
     /**
      * This method gets the DNS-SD counters.
@@ -87,8 +87,12 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const SrpServerInfo &aSrpSer
 otbrError DBusMessageExtract(DBusMessageIter *aIter, SrpServerInfo &aSrpServerInfo);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsResponseCounters &aMdnsResponseCounters);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsResponseCounters &aMdnsResponseCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const LatencyHistogram &aLatencyHistogram);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, LatencyHistogram &aLatencyHistogram);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsTelemetryInfo &aMdnsTelemetryInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsTelemetryInfo &aMdnsTelemetryInfo);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsLatencyHistograms &aMdnsLatencyHistograms);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsLatencyHistograms &aMdnsLatencyHistograms);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const DnssdCounters &aDnssdCounters);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, DnssdCounters &aDnssdCounters);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const RadioSpinelMetrics &aRadioSpinelMetrics);
@@ -284,6 +288,16 @@ template <> struct DBusTypeTrait<MdnsTelemetryInfo>
     static constexpr const char *TYPE_AS_STRING = "((uuuuuuuu)(uuuuuuuu)(uuuuuuuu)(uuuuuuuu)uuuu)";
 };
 
+template <> struct DBusTypeTrait<MdnsLatencyHistograms>
+{
+    // struct of { struct of { array of uint32, uint32, uint32, uint32 },
+    //              struct of { array of uint32, uint32, uint32, uint32 },
+    //              struct of { array of uint32, uint32, uint32, uint32 },
+    //              struct of { array of uint32, uint32, uint32, uint32 },
+    //              struct of { array of uint32, uint32, uint32, uint32 } }
+    static constexpr const char *TYPE_AS_STRING = "((auuuu)(auuuu)(auuuu)(auuuu)(auuuu))";
+};
+
 template <> struct DBusTypeTrait<DnssdCounters>
 {
     // struct of { uint32, uint32, uint32, uint32, uint32, uint32, uint32 }
@@ -692,6 +692,43 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const LatencyHistogram &aLatencyHistogram)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aLatencyHistogram.mBucketCounts));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aLatencyHistogram.GetPercentile(50)));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aLatencyHistogram.GetPercentile(90)));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aLatencyHistogram.GetPercentile(99)));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, LatencyHistogram &aLatencyHistogram)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+    uint32_t        percentile;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aLatencyHistogram.mBucketCounts));
+
+    // The percentiles are derived from the bucket counts.
+    SuccessOrExit(error = DBusMessageExtract(&sub, percentile));
+    SuccessOrExit(error = DBusMessageExtract(&sub, percentile));
+    SuccessOrExit(error = DBusMessageExtract(&sub, percentile));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsTelemetryInfo &aMdnsTelemetryInfo)
 {
     DBusMessageIter sub;
@@ -736,6 +773,42 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsLatencyHistograms &aMdnsLatencyHistograms)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyHistograms.mHostRegistration));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyHistograms.mKeyRegistration));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyHistograms.mServiceRegistration));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyHistograms.mHostResolution));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsLatencyHistograms.mServiceResolution));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsLatencyHistograms &aMdnsLatencyHistograms)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = DbusMessageIterRecurse(aIter, &sub, DBUS_TYPE_STRUCT));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsLatencyHistograms.mHostRegistration));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsLatencyHistograms.mKeyRegistration));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsLatencyHistograms.mServiceRegistration));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsLatencyHistograms.mHostResolution));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsLatencyHistograms.mServiceResolution));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const RadioSpinelMetrics &aRadioSpinelMetrics)
 {
     DBusMessageIter sub;
@@ -28,6 +28,8 @@
 
 #define OTBR_LOG_TAG "DBUS"
 
+#include <algorithm>
+
 #include <assert.h>
 #include <stdio.h>
 #include <string.h>
@@ -43,6 +45,71 @@ using std::placeholders::_1;
 namespace otbr {
 namespace DBus {
 
+static otbrError CopyDBusValue(DBusMessageIter &aFrom, DBusMessageIter &aTo)
+{
+    otbrError       error = OTBR_ERROR_NONE;
+    int             type  = dbus_message_iter_get_arg_type(&aFrom);
+    DBusMessageIter fromSubIter;
+    DBusMessageIter toSubIter;
+    char           *signature = nullptr;
+
+    if (dbus_type_is_basic(type))
+    {
+        DBusBasicValue value;
+
+        dbus_message_iter_get_basic(&aFrom, &value);
+        VerifyOrExit(dbus_message_iter_append_basic(&aTo, type, &value), error = OTBR_ERROR_DBUS);
+        ExitNow();
+    }
+
+    dbus_message_iter_recurse(&aFrom, &fromSubIter);
+
+    if (type == DBUS_TYPE_VARIANT)
+    {
+        signature = dbus_message_iter_get_signature(&fromSubIter);
+        VerifyOrExit(signature != nullptr, error = OTBR_ERROR_DBUS);
+    }
+    else if (type == DBUS_TYPE_ARRAY)
+    {
+        // The signature of an array is "a" followed by the signature of its elements.
+        signature = dbus_message_iter_get_signature(&aFrom);
+        VerifyOrExit(signature != nullptr, error = OTBR_ERROR_DBUS);
+    }
+
+    VerifyOrExit(dbus_message_iter_open_container(&aTo, type, type == DBUS_TYPE_ARRAY ? signature + 1 : signature,
+                                                  &toSubIter),
+                 error = OTBR_ERROR_DBUS);
+
+    if (type == DBUS_TYPE_ARRAY && dbus_type_is_fixed(dbus_message_iter_get_element_type(&aFrom)))
+    {
+        // Arrays of fixed types (e.g. dataset TLVs or network data) are copied at once.
+        const void *elements;
+        int         count;
+
+        dbus_message_iter_get_fixed_array(&fromSubIter, &elements, &count);
+        VerifyOrExit(dbus_message_iter_append_fixed_array(&toSubIter, dbus_message_iter_get_element_type(&aFrom),
+                                                          &elements, count),
+                     error = OTBR_ERROR_DBUS);
+    }
+    else
+    {
+        for (; dbus_message_iter_get_arg_type(&fromSubIter) != DBUS_TYPE_INVALID; dbus_message_iter_next(&fromSubIter))
+        {
+            SuccessOrExit(error = CopyDBusValue(fromSubIter, toSubIter));
+        }
+    }
+
+    VerifyOrExit(dbus_message_iter_close_container(&aTo, &toSubIter), error = OTBR_ERROR_DBUS);
+
+exit:
+    if (signature != nullptr)
+    {
+        dbus_free(signature);
+    }
+
+    return error;
+}
+
 DBusObject::DBusObject(DBusConnection *aConnection, const std::string &aObjectPath)
     : mConnection(aConnection)
     , mObjectPath(aObjectPath)
@@ -102,6 +169,202 @@ void DBusObject::RegisterGetPropertyHandler(const std::string         &aInterfac
     mGetPropertyHandlers[aInterfaceName].emplace(aPropertyName, aHandler);
 }
 
+void DBusObject::RegisterCachedGetPropertyHandler(const std::string         &aInterfaceName,
+                                                  const std::string         &aPropertyName,
+                                                  const PropertyHandlerType &aHandler,
+                                                  otChangedFlags             aInvalidatingFlags)
+{
+    CachedProperty &cachedProperty = mPropertyCache[aInterfaceName][aPropertyName];
+
+    RegisterGetPropertyHandler(aInterfaceName, aPropertyName, aHandler);
+    cachedProperty.mInvalidatingFlags = aInvalidatingFlags;
+    cachedProperty.mValue.reset();
+}
+
+void DBusObject::InvalidateProperties(otChangedFlags aFlags)
+{
+    for (auto &interfaceCache : mPropertyCache)
+    {
+        for (auto &p : interfaceCache.second)
+        {
+            if (p.second.mInvalidatingFlags & aFlags)
+            {
+                p.second.mValue.reset();
+            }
+        }
+    }
+}
+
+void DBusObject::InvalidateProperty(const std::string &aInterfaceName, const std::string &aPropertyName)
+{
+    auto interfaceIter = mPropertyCache.find(aInterfaceName);
+
+    VerifyOrExit(interfaceIter != mPropertyCache.end());
+
+    {
+        auto propertyIter = interfaceIter->second.find(aPropertyName);
+
+        VerifyOrExit(propertyIter != interfaceIter->second.end());
+        propertyIter->second.mValue.reset();
+    }
+
+exit:
+    return;
+}
+
+void DBusObject::InvalidateAllProperties(void)
+{
+    for (auto &interfaceCache : mPropertyCache)
+    {
+        for (auto &p : interfaceCache.second)
+        {
+            p.second.mValue.reset();
+        }
+    }
+}
+
+otError DBusObject::EncodeProperty(const std::string         &aInterfaceName,
+                                   const std::string         &aPropertyName,
+                                   const PropertyHandlerType &aHandler,
+                                   DBusMessageIter           &aIter)
+{
+    otError         error          = OT_ERROR_NONE;
+    CachedProperty *cachedProperty = nullptr;
+    auto            interfaceIter  = mPropertyCache.find(aInterfaceName);
+    DBusMessageIter valueIter;
+
+    if (interfaceIter != mPropertyCache.end())
+    {
+        auto propertyIter = interfaceIter->second.find(aPropertyName);
+
+        if (propertyIter != interfaceIter->second.end())
+        {
+            cachedProperty = &propertyIter->second;
+        }
+    }
+
+    if (cachedProperty == nullptr)
+    {
+        ExitNow(error = aHandler(aIter));
+    }
+
+    if (cachedProperty->mValue == nullptr)
+    {
+        UniqueDBusMessage value{dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN)};
+        DBusMessageIter   appendIter;
+
+        VerifyOrExit(value != nullptr, error = OT_ERROR_NO_BUFS);
+        dbus_message_iter_init_append(value.get(), &appendIter);
+        SuccessOrExit(error = aHandler(appendIter));
+        cachedProperty->mValue = std::move(value);
+    }
+
+    VerifyOrExit(dbus_message_iter_init(cachedProperty->mValue.get(), &valueIter), error = OT_ERROR_FAILED);
+    VerifyOrExit(CopyDBusValue(valueIter, aIter) == OTBR_ERROR_NONE, error = OT_ERROR_FAILED);
+
+exit:
+    return error;
+}
+
+void DBusObject::QueuePropertyChanged(const std::string &aInterfaceName, const std::string &aPropertyName)
+{
+    std::vector<std::string> &propertyNames = mPendingChangedProperties[aInterfaceName];
+
+    if (std::find(propertyNames.begin(), propertyNames.end(), aPropertyName) == propertyNames.end())
+    {
+        propertyNames.push_back(aPropertyName);
+    }
+}
+
+void DBusObject::FlushPropertiesChanged(void)
+{
+    std::unordered_map<std::string, std::vector<std::string>> pendingChangedProperties;
+
+    // Properties queued while sending the signals are left for the next flush.
+    pendingChangedProperties.swap(mPendingChangedProperties);
+
+    for (const auto &pending : pendingChangedProperties)
+    {
+        otbrError error = SignalPropertiesChanged(pending.first, pending.second);
+
+        if (error != OTBR_ERROR_NONE)
+        {
+            otbrLogWarning("Failed to signal changed properties of %s: %s", pending.first.c_str(),
+                           otbrErrorString(error));
+        }
+    }
+}
+
+otbrError DBusObject::SignalPropertiesChanged(const std::string              &aInterfaceName,
+                                              const std::vector<std::string> &aPropertyNames)
+{
+    UniqueDBusMessage signalMsg = NewSignalMessage(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL);
+    DBusMessageIter   iter, subIter, dictEntryIter;
+    auto              handlersIter = mGetPropertyHandlers.find(aInterfaceName);
+    size_t            changedCount = 0;
+    otbrError         error        = OTBR_ERROR_NONE;
+
+    VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
+    VerifyOrExit(handlersIter != mGetPropertyHandlers.end(), error = OTBR_ERROR_NOT_FOUND);
+    dbus_message_iter_init_append(signalMsg.get(), &iter);
+
+    // interface_name
+    SuccessOrExit(error = DBusMessageEncode(&iter, aInterfaceName));
+
+    // changed_properties
+    VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
+                                                  "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
+                                                  &subIter),
+                 error = OTBR_ERROR_DBUS);
+
+    for (const std::string &propertyName : aPropertyNames)
+    {
+        auto              handlerIter = handlersIter->second.find(propertyName);
+        UniqueDBusMessage value{dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN)};
+        DBusMessageIter   valueIter;
+        otError           getError;
+
+        VerifyOrExit(handlerIter != handlersIter->second.end(), error = OTBR_ERROR_NOT_FOUND);
+        VerifyOrExit(value != nullptr, error = OTBR_ERROR_DBUS);
+
+        // Encode separately first so that a failing property is left out instead of corrupting the signal.
+        dbus_message_iter_init_append(value.get(), &valueIter);
+        getError = EncodeProperty(aInterfaceName, propertyName, handlerIter->second, valueIter);
+
+        if (getError != OT_ERROR_NONE)
+        {
+            otbrLogWarning("GetProperty %s.%s error:%s", aInterfaceName.c_str(), propertyName.c_str(),
+                           ConvertToDBusErrorName(getError));
+            continue;
+        }
+
+        VerifyOrExit(dbus_message_iter_init(value.get(), &valueIter), error = OTBR_ERROR_DBUS);
+        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
+                     error = OTBR_ERROR_DBUS);
+        SuccessOrExit(error = DBusMessageEncode(&dictEntryIter, propertyName));
+        SuccessOrExit(error = CopyDBusValue(valueIter, dictEntryIter));
+        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OTBR_ERROR_DBUS);
+        changedCount++;
+    }
+
+    VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OTBR_ERROR_DBUS);
+    VerifyOrExit(changedCount > 0);
+
+    // invalidated_properties
+    SuccessOrExit(error = DBusMessageEncode(&iter, std::vector<std::string>()));
+
+    if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+    {
+        otbrLogDebug("Signal %s properties changed", aInterfaceName.c_str());
+        DumpDBusMessage(*signalMsg);
+    }
+
+    VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
+
+exit:
+    return error;
+}
+
 void DBusObject::RegisterSetPropertyHandler(const std::string         &aInterfaceName,
                                             const std::string         &aPropertyName,
                                             const PropertyHandlerType &aHandler)
@@ -174,7 +437,7 @@ void DBusObject::GetPropertyMethodHandler(DBusRequest &aRequest)
 
             VerifyOrExit(interfaceIter != interfaceHandlers.end(), error = OT_ERROR_NOT_FOUND);
             dbus_message_iter_init_append(reply.get(), &replyIter);
-            SuccessOrExit(replyError = interfaceIter->second(replyIter));
+            SuccessOrExit(replyError = EncodeProperty(interfaceName, propertyName, interfaceIter->second, replyIter));
         }
     }
 exit:
@@ -214,23 +477,24 @@ void DBusObject::GetAllPropertiesMethodHandler(DBusRequest &aRequest)
     VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
     VerifyOrExit(mGetPropertyHandlers.find(interfaceName) != mGetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
     dbus_message_iter_init_append(reply.get(), &iter);
+    VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
+                                                  "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
+                                                  &subIter),
+                 error = OT_ERROR_FAILED);
 
     for (auto &p : mGetPropertyHandlers.at(interfaceName))
     {
-        VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
-                                                      "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
-                                                      &subIter),
-                     error = OT_ERROR_FAILED);
         VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
                      error = OT_ERROR_FAILED);
         VerifyOrExit(DBusMessageEncode(&dictEntryIter, p.first) == OTBR_ERROR_NONE, error = OT_ERROR_FAILED);
 
-        SuccessOrExit(error = p.second(dictEntryIter));
+        SuccessOrExit(error = EncodeProperty(interfaceName, p.first, p.second, dictEntryIter));
 
         VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OT_ERROR_FAILED);
-        VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter));
     }
 
+    VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OT_ERROR_FAILED);
+
 exit:
     if (error == OT_ERROR_NONE)
     {
@@ -263,6 +527,11 @@ void DBusObject::SetPropertyMethodHandler(DBusRequest &aRequest)
         error = handlerIter->second(iter);
     }
 
+    if (error == OT_ERROR_NONE)
+    {
+        InvalidateProperty(interfaceName, propertyName);
+    }
+
 exit:
     if (error != OT_ERROR_NONE)
     {
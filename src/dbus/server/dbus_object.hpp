@@ -44,8 +44,10 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <dbus/dbus.h>
+#include <openthread/instance.h>
 
 #include "border_agent/border_agent.hpp"
 #include "common/code_utils.hpp"
@@ -121,6 +123,68 @@ public:
                                             const std::string         &aPropertyName,
                                             const PropertyHandlerType &aHandler);
 
+    /**
+     * This method registers the get handler for a property whose value is cached.
+     *
+     * The value is encoded by @p aHandler on first use and served from the cache by Get, GetAll and batched
+     * PropertiesChanged signals until it is invalidated by `InvalidateProperties()` with any of
+     * @p aInvalidatingFlags, by `InvalidateProperty()`, by `InvalidateAllProperties()` or by a successful Set of the
+     * property. Only properties whose value is fully determined by those events may be cached.
+     *
+     * @param[in] aInterfaceName      The interface name.
+     * @param[in] aPropertyName       The property name.
+     * @param[in] aHandler            The method handler.
+     * @param[in] aInvalidatingFlags  The OpenThread state changes which invalidate the cached value.
+     */
+    void RegisterCachedGetPropertyHandler(const std::string         &aInterfaceName,
+                                          const std::string         &aPropertyName,
+                                          const PropertyHandlerType &aHandler,
+                                          otChangedFlags             aInvalidatingFlags);
+
+    /**
+     * This method invalidates the cached properties which depend on any of the given OpenThread state changes.
+     *
+     * @param[in] aFlags  The OpenThread state changes.
+     */
+    void InvalidateProperties(otChangedFlags aFlags);
+
+    /**
+     * This method invalidates the cached value of a property.
+     *
+     * @param[in] aInterfaceName  The interface name.
+     * @param[in] aPropertyName   The property name.
+     */
+    void InvalidateProperty(const std::string &aInterfaceName, const std::string &aPropertyName);
+
+    /**
+     * This method invalidates the cached values of all properties.
+     */
+    void InvalidateAllProperties(void);
+
+    /**
+     * This method queues a property for the next batched property changed signal.
+     *
+     * The new value is read when the signal is sent by `FlushPropertiesChanged()`, so a property changing several
+     * times before that is signaled once with its latest value.
+     *
+     * @param[in] aInterfaceName  The interface name.
+     * @param[in] aPropertyName   The property name, which must have a get handler.
+     */
+    void QueuePropertyChanged(const std::string &aInterfaceName, const std::string &aPropertyName);
+
+    /**
+     * This method indicates whether there are queued property changes.
+     *
+     * @retval TRUE   There are queued property changes.
+     * @retval FALSE  There are no queued property changes.
+     */
+    bool HasPendingPropertiesChanged(void) const { return !mPendingChangedProperties.empty(); }
+
+    /**
+     * This method sends one property changed signal per interface for all queued property changes.
+     */
+    void FlushPropertiesChanged(void);
+
     /**
      * This method registers the set handler for a property.
      *
@@ -237,7 +301,31 @@ public:
 protected:
     otbrError Initialize(bool aIsAsyncPropertyHandler);
 
+    /**
+     * This method encodes the value of a property, from the cache if the property is cached.
+     *
+     * @param[in] aInterfaceName  The interface name.
+     * @param[in] aPropertyName   The property name.
+     * @param[in] aHandler        The get handler of the property.
+     * @param[in] aIter           The iterator to append the value (a variant) to.
+     *
+     * @returns The error of @p aHandler, or OT_ERROR_FAILED if the cached value could not be copied.
+     */
+    otError EncodeProperty(const std::string         &aInterfaceName,
+                           const std::string         &aPropertyName,
+                           const PropertyHandlerType &aHandler,
+                           DBusMessageIter           &aIter);
+
 private:
+    struct CachedProperty
+    {
+        otChangedFlags    mInvalidatingFlags;
+        UniqueDBusMessage mValue; ///< The encoded variant, `nullptr` if invalidated.
+    };
+
+    otbrError SignalPropertiesChanged(const std::string              &aInterfaceName,
+                                      const std::vector<std::string> &aPropertyNames);
+
     void GetAllPropertiesMethodHandler(DBusRequest &aRequest);
     void GetPropertyMethodHandler(DBusRequest &aRequest);
     void SetPropertyMethodHandler(DBusRequest &aRequest);
@@ -252,9 +340,11 @@ private:
     std::unordered_map<std::string, std::unordered_map<std::string, PropertyHandlerType>> mGetPropertyHandlers;
     std::unordered_map<std::string, std::unordered_map<std::string, AsyncPropertyHandlerType>>
                                                          mAsyncGetPropertyHandlers;
-    std::unordered_map<std::string, PropertyHandlerType> mSetPropertyHandlers;
-    DBusConnection                                      *mConnection;
-    std::string                                          mObjectPath;
+    std::unordered_map<std::string, PropertyHandlerType>                              mSetPropertyHandlers;
+    std::unordered_map<std::string, std::unordered_map<std::string, CachedProperty>> mPropertyCache;
+    std::unordered_map<std::string, std::vector<std::string>>                         mPendingChangedProperties;
+    DBusConnection                                                                   *mConnection;
+    std::string                                                                       mObjectPath;
 };
 
 } // namespace DBus
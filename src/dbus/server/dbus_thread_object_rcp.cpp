@@ -73,6 +73,12 @@
 using std::placeholders::_1;
 using std::placeholders::_2;
 
+// The state changes which invalidate the cached properties derived from the RLOC16 or the leader data.
+static constexpr otChangedFlags kRlocChangedFlags =
+    OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_RLOC_ADDED | OT_CHANGED_THREAD_RLOC_REMOVED;
+static constexpr otChangedFlags kLeaderDataChangedFlags =
+    OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA;
+
 #if OTBR_ENABLE_NAT64
 static std::string GetNat64StateName(otNat64State aState)
 {
@@ -129,6 +135,7 @@ otbrError DBusThreadObjectRcp::Init(void)
 #endif
     threadHelper->AddActiveDatasetChangeHandler(std::bind(&DBusThreadObjectRcp::ActiveDatasetChangeHandler, this, _1));
     mHost.RegisterResetHandler(std::bind(&DBusThreadObjectRcp::NcpResetHandler, this));
+    mHost.AddThreadStateChangedCallback([this](otChangedFlags aFlags) { InvalidateProperties(aFlags); });
 
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_METHOD,
                    std::bind(&DBusThreadObjectRcp::ScanHandler, this, _1));
@@ -202,43 +209,54 @@ otbrError DBusThreadObjectRcp::Init(void)
 
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_LINK_MODE,
                                std::bind(&DBusThreadObjectRcp::GetLinkModeHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE,
-                               std::bind(&DBusThreadObjectRcp::GetDeviceRoleHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NETWORK_NAME,
-                               std::bind(&DBusThreadObjectRcp::GetNetworkNameHandler, this, _1));
-
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_PANID,
-                               std::bind(&DBusThreadObjectRcp::GetPanIdHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_EXTPANID,
-                               std::bind(&DBusThreadObjectRcp::GetExtPanIdHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_EUI64,
-                               std::bind(&DBusThreadObjectRcp::GetEui64Handler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHANNEL,
-                               std::bind(&DBusThreadObjectRcp::GetChannelHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NETWORK_KEY,
-                               std::bind(&DBusThreadObjectRcp::GetNetworkKeyHandler, this, _1));
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE,
+                                     std::bind(&DBusThreadObjectRcp::GetDeviceRoleHandler, this, _1),
+                                     OT_CHANGED_THREAD_ROLE);
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NETWORK_NAME,
+                                     std::bind(&DBusThreadObjectRcp::GetNetworkNameHandler, this, _1),
+                                     OT_CHANGED_THREAD_NETWORK_NAME);
+
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_PANID,
+                                     std::bind(&DBusThreadObjectRcp::GetPanIdHandler, this, _1),
+                                     OT_CHANGED_THREAD_PANID);
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_EXTPANID,
+                                     std::bind(&DBusThreadObjectRcp::GetExtPanIdHandler, this, _1),
+                                     OT_CHANGED_THREAD_EXT_PANID);
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_EUI64,
+                                     std::bind(&DBusThreadObjectRcp::GetEui64Handler, this, _1), 0);
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHANNEL,
+                                     std::bind(&DBusThreadObjectRcp::GetChannelHandler, this, _1),
+                                     OT_CHANGED_THREAD_CHANNEL);
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NETWORK_KEY,
+                                     std::bind(&DBusThreadObjectRcp::GetNetworkKeyHandler, this, _1),
+                                     OT_CHANGED_NETWORK_KEY);
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CCA_FAILURE_RATE,
                                std::bind(&DBusThreadObjectRcp::GetCcaFailureRateHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_LINK_COUNTERS,
                                std::bind(&DBusThreadObjectRcp::GetLinkCountersHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_IP6_COUNTERS,
                                std::bind(&DBusThreadObjectRcp::GetIp6CountersHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_SUPPORTED_CHANNEL_MASK,
-                               std::bind(&DBusThreadObjectRcp::GetSupportedChannelMaskHandler, this, _1));
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_SUPPORTED_CHANNEL_MASK,
+                                     std::bind(&DBusThreadObjectRcp::GetSupportedChannelMaskHandler, this, _1),
+                                     OT_CHANGED_SUPPORTED_CHANNEL_MASK);
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_PREFERRED_CHANNEL_MASK,
                                std::bind(&DBusThreadObjectRcp::GetPreferredChannelMaskHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RLOC16,
-                               std::bind(&DBusThreadObjectRcp::GetRloc16Handler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_EXTENDED_ADDRESS,
-                               std::bind(&DBusThreadObjectRcp::GetExtendedAddressHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_ROUTER_ID,
-                               std::bind(&DBusThreadObjectRcp::GetRouterIdHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_LEADER_DATA,
-                               std::bind(&DBusThreadObjectRcp::GetLeaderDataHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NETWORK_DATA_PRPOERTY,
-                               std::bind(&DBusThreadObjectRcp::GetNetworkDataHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_STABLE_NETWORK_DATA_PRPOERTY,
-                               std::bind(&DBusThreadObjectRcp::GetStableNetworkDataHandler, this, _1));
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RLOC16,
+                                     std::bind(&DBusThreadObjectRcp::GetRloc16Handler, this, _1), kRlocChangedFlags);
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_EXTENDED_ADDRESS,
+                                     std::bind(&DBusThreadObjectRcp::GetExtendedAddressHandler, this, _1),
+                                     OT_CHANGED_THREAD_LL_ADDR);
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_ROUTER_ID,
+                                     std::bind(&DBusThreadObjectRcp::GetRouterIdHandler, this, _1), kRlocChangedFlags);
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_LEADER_DATA,
+                                     std::bind(&DBusThreadObjectRcp::GetLeaderDataHandler, this, _1),
+                                     kLeaderDataChangedFlags);
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NETWORK_DATA_PRPOERTY,
+                                     std::bind(&DBusThreadObjectRcp::GetNetworkDataHandler, this, _1),
+                                     OT_CHANGED_THREAD_NETDATA);
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_STABLE_NETWORK_DATA_PRPOERTY,
+                                     std::bind(&DBusThreadObjectRcp::GetStableNetworkDataHandler, this, _1),
+                                     OT_CHANGED_THREAD_NETDATA);
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_LOCAL_LEADER_WEIGHT,
                                std::bind(&DBusThreadObjectRcp::GetLocalLeaderWeightHandler, this, _1));
 #if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
@@ -251,38 +269,44 @@ otbrError DBusThreadObjectRcp::Init(void)
                                std::bind(&DBusThreadObjectRcp::GetChildTableHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY,
                                std::bind(&DBusThreadObjectRcp::GetNeighborTableHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY,
-                               std::bind(&DBusThreadObjectRcp::GetPartitionIDHandler, this, _1));
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY,
+                                     std::bind(&DBusThreadObjectRcp::GetPartitionIDHandler, this, _1),
+                                     OT_CHANGED_THREAD_PARTITION_ID);
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_INSTANT_RSSI,
                                std::bind(&DBusThreadObjectRcp::GetInstantRssiHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RADIO_TX_POWER,
                                std::bind(&DBusThreadObjectRcp::GetRadioTxPowerHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_EXTERNAL_ROUTES,
-                               std::bind(&DBusThreadObjectRcp::GetExternalRoutesHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_ON_MESH_PREFIXES,
-                               std::bind(&DBusThreadObjectRcp::GetOnMeshPrefixesHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS,
-                               std::bind(&DBusThreadObjectRcp::GetActiveDatasetTlvsHandler, this, _1));
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_EXTERNAL_ROUTES,
+                                     std::bind(&DBusThreadObjectRcp::GetExternalRoutesHandler, this, _1),
+                                     OT_CHANGED_THREAD_NETDATA);
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_ON_MESH_PREFIXES,
+                                     std::bind(&DBusThreadObjectRcp::GetOnMeshPrefixesHandler, this, _1),
+                                     OT_CHANGED_THREAD_NETDATA);
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS,
+                                     std::bind(&DBusThreadObjectRcp::GetActiveDatasetTlvsHandler, this, _1),
+                                     OT_CHANGED_ACTIVE_DATASET);
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_PENDING_DATASET_TLVS,
                                std::bind(&DBusThreadObjectRcp::GetPendingDatasetTlvsHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_FEATURE_FLAG_LIST_DATA,
-                               std::bind(&DBusThreadObjectRcp::GetFeatureFlagListDataHandler, this, _1));
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_FEATURE_FLAG_LIST_DATA,
+                                     std::bind(&DBusThreadObjectRcp::GetFeatureFlagListDataHandler, this, _1), 0);
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RADIO_REGION,
                                std::bind(&DBusThreadObjectRcp::GetRadioRegionHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_SRP_SERVER_INFO,
                                std::bind(&DBusThreadObjectRcp::GetSrpServerInfoHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MDNS_TELEMETRY_INFO,
                                std::bind(&DBusThreadObjectRcp::GetMdnsTelemetryInfoHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MDNS_LATENCY_HISTOGRAMS,
+                               std::bind(&DBusThreadObjectRcp::GetMdnsLatencyHistogramsHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DNSSD_COUNTERS,
                                std::bind(&DBusThreadObjectRcp::GetDnssdCountersHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_OTBR_VERSION,
-                               std::bind(&DBusThreadObjectRcp::GetOtbrVersionHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_OT_HOST_VERSION,
-                               std::bind(&DBusThreadObjectRcp::GetOtHostVersionHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_OT_RCP_VERSION,
-                               std::bind(&DBusThreadObjectRcp::GetOtRcpVersionHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_THREAD_VERSION,
-                               std::bind(&DBusThreadObjectRcp::GetThreadVersionHandler, this, _1));
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_OTBR_VERSION,
+                                     std::bind(&DBusThreadObjectRcp::GetOtbrVersionHandler, this, _1), 0);
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_OT_HOST_VERSION,
+                                     std::bind(&DBusThreadObjectRcp::GetOtHostVersionHandler, this, _1), 0);
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_OT_RCP_VERSION,
+                                     std::bind(&DBusThreadObjectRcp::GetOtRcpVersionHandler, this, _1), 0);
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_THREAD_VERSION,
+                                     std::bind(&DBusThreadObjectRcp::GetThreadVersionHandler, this, _1), 0);
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RADIO_SPINEL_METRICS,
                                std::bind(&DBusThreadObjectRcp::GetRadioSpinelMetricsHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RCP_INTERFACE_METRICS,
@@ -317,8 +341,8 @@ otbrError DBusThreadObjectRcp::Init(void)
                                std::bind(&DBusThreadObjectRcp::GetDnsUpstreamQueryState, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_TELEMETRY_DATA,
                                std::bind(&DBusThreadObjectRcp::GetTelemetryDataHandler, this, _1));
-    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CAPABILITIES,
-                               std::bind(&DBusThreadObjectRcp::GetCapabilitiesHandler, this, _1));
+    RegisterCachedGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CAPABILITIES,
+                                     std::bind(&DBusThreadObjectRcp::GetCapabilitiesHandler, this, _1), 0);
 
     SuccessOrExit(error = Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SIGNAL_READY, std::make_tuple()));
 
@@ -328,7 +352,20 @@ exit:
 
 void DBusThreadObjectRcp::DeviceRoleHandler(otDeviceRole aDeviceRole)
 {
-    SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE, GetDeviceRoleName(aDeviceRole));
+    OTBR_UNUSED_VARIABLE(aDeviceRole);
+
+    QueueThreadPropertyChanged(OTBR_DBUS_PROPERTY_DEVICE_ROLE);
+}
+
+void DBusThreadObjectRcp::QueueThreadPropertyChanged(const char *aPropertyName)
+{
+    // Changes within one main loop turn are coalesced into a single signal.
+    if (!HasPendingPropertiesChanged())
+    {
+        mHost.GetTaskRunner().Post([this]() { FlushPropertiesChanged(); });
+    }
+
+    QueuePropertyChanged(OTBR_DBUS_THREAD_INTERFACE, aPropertyName);
 }
 
 #if OTBR_ENABLE_DHCP6_PD
@@ -341,6 +378,8 @@ void DBusThreadObjectRcp::Dhcp6PdStateHandler(otBorderRoutingDhcp6PdState aDhcp6
 
 void DBusThreadObjectRcp::NcpResetHandler(void)
 {
+    InvalidateAllProperties();
+
     mHost.GetThreadHelper()->AddDeviceRoleHandler(std::bind(&DBusThreadObjectRcp::DeviceRoleHandler, this, _1));
     mHost.GetThreadHelper()->AddActiveDatasetChangeHandler(
         std::bind(&DBusThreadObjectRcp::ActiveDatasetChangeHandler, this, _1));
@@ -1435,6 +1474,16 @@ exit:
     return error;
 }
 
+otError DBusThreadObjectRcp::GetMdnsLatencyHistogramsHandler(DBusMessageIter &aIter)
+{
+    const MdnsLatencyHistograms &histograms = mPublisher->GetMdnsTelemetryInfo().mLatencyHistograms;
+    otError                      error      = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, histograms) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+exit:
+    return error;
+}
+
 otError DBusThreadObjectRcp::GetDnssdCountersHandler(DBusMessageIter &aIter)
 {
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
@@ -1577,7 +1626,8 @@ void DBusThreadObjectRcp::GetPropertiesHandler(DBusRequest &aRequest)
         otbrLogInfo("GetPropertiesHandler getting property: %s", propertyName.c_str());
         VerifyOrExit(handlerIter != mGetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
 
-        SuccessOrExit(error = handlerIter->second(replySubIter));
+        error = EncodeProperty(OTBR_DBUS_THREAD_INTERFACE, propertyName, handlerIter->second, replySubIter);
+        SuccessOrExit(error);
     }
 
     VerifyOrExit(dbus_message_iter_close_container(&replyIter, &replySubIter), error = OT_ERROR_NO_BUFS);
@@ -1786,9 +1836,9 @@ exit:
 
 void DBusThreadObjectRcp::ActiveDatasetChangeHandler(const otOperationalDatasetTlvs &aDatasetTlvs)
 {
-    std::vector<uint8_t> value(aDatasetTlvs.mLength);
-    std::copy(aDatasetTlvs.mTlvs, aDatasetTlvs.mTlvs + aDatasetTlvs.mLength, value.begin());
-    SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS, value);
+    OTBR_UNUSED_VARIABLE(aDatasetTlvs);
+
+    QueueThreadPropertyChanged(OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS);
 }
 
 void DBusThreadObjectRcp::SetThreadEnabledHandler(DBusRequest &aRequest)
@@ -83,6 +83,7 @@ private:
     void Dhcp6PdStateHandler(otBorderRoutingDhcp6PdState aDhcp6PdState);
     void ActiveDatasetChangeHandler(const otOperationalDatasetTlvs &aDatasetTlvs);
     void NcpResetHandler(void);
+    void QueueThreadPropertyChanged(const char *aPropertyName);
 
     void ScanHandler(DBusRequest &aRequest);
     void EnergyScanHandler(DBusRequest &aRequest);
@@ -161,6 +162,7 @@ private:
     otError GetRadioRegionHandler(DBusMessageIter &aIter);
     otError GetSrpServerInfoHandler(DBusMessageIter &aIter);
     otError GetMdnsTelemetryInfoHandler(DBusMessageIter &aIter);
+    otError GetMdnsLatencyHistogramsHandler(DBusMessageIter &aIter);
     otError GetDnssdCountersHandler(DBusMessageIter &aIter);
     otError GetOtbrVersionHandler(DBusMessageIter &aIter);
     otError GetOtHostVersionHandler(DBusMessageIter &aIter);
@@ -78,19 +78,20 @@ void AsyncTask::SetResult(otError aError, const std::string &aErrorInfo)
     }
 }
 
-AsyncTaskPtr &AsyncTask::First(const ThenHandler &aFirst)
+AsyncTaskPtr &AsyncTask::First(ThenHandler aFirst)
 {
     assert(mNext == nullptr);
 
-    return Then(aFirst);
+    return Then(std::move(aFirst));
 }
 
-AsyncTaskPtr &AsyncTask::Then(const ThenHandler &aThen)
+AsyncTaskPtr &AsyncTask::Then(ThenHandler aThen)
 {
     assert(mNext == nullptr);
 
-    mNext = std::make_shared<AsyncTask>(mResultHandler);
-    mThen = aThen;
+    mNext          = std::make_shared<AsyncTask>(mResultHandler);
+    mThen          = std::move(aThen);
+    mResultHandler = nullptr;
 
     return mNext;
 }
@@ -40,6 +40,8 @@
 
 #include <openthread/error.h>
 
+#include "common/inline_function.hpp"
+
 namespace otbr {
 namespace Host {
 
@@ -49,7 +51,7 @@ using AsyncTaskPtr = std::shared_ptr<AsyncTask>;
 class AsyncTask
 {
 public:
-    using ThenHandler   = std::function<void(AsyncTaskPtr)>;
+    using ThenHandler   = InlineFunction<void(AsyncTaskPtr)>;
     using ResultHandler = std::function<void(otError, const std::string &)>;
 
     /**
@@ -84,28 +86,25 @@ public:
     /**
      * Set the initial operation of the chained async operations.
      *
-     * @param[in] aFirst  A reference to a function object for the initial action.
+     * @param[in] aFirst  The function object for the initial action.
      *
      * @returns  A shared pointer to a AsyncTask object created in this method.
      */
-    AsyncTaskPtr &First(const ThenHandler &aFirst);
+    AsyncTaskPtr &First(ThenHandler aFirst);
 
     /**
      * Set the next operation of the chained async operations.
      *
-     * @param[in] aThen  A reference to a function object for the next action.
+     * @param[in] aThen  The function object for the next action.
      *
      * @returns A shared pointer to a AsyncTask object created in this method.
      */
-    AsyncTaskPtr &Then(const ThenHandler &aThen);
+    AsyncTaskPtr &Then(ThenHandler aThen);
 
 private:
-    union
-    {
-        ThenHandler   mThen;          // Only valid when `mNext` is not nullptr
-        ResultHandler mResultHandler; // Only valid when `mNext` is nullptr
-    };
-    AsyncTaskPtr mNext;
+    ThenHandler   mThen;          // Only set when `mNext` is not nullptr
+    ResultHandler mResultHandler; // Only set when `mNext` is nullptr
+    AsyncTaskPtr  mNext;
 };
 
 } // namespace Host
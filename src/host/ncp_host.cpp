@@ -369,6 +369,11 @@ void NcpHost::InitInfraIfCallbacks(InfraIf &aInfraIf)
         });
 }
 
+uint8_t *NcpHost::Ip6GetSendBuffer(uint16_t &aCapacity)
+{
+    return mNcpSpinel.Ip6GetSendBuffer(aCapacity);
+}
+
 otbrError NcpHost::Ip6Send(const uint8_t *aData, uint16_t aLength)
 {
     return mNcpSpinel.Ip6Send(aData, aLength);
@@ -158,6 +158,7 @@ private:
                          uint16_t            aRemotePort,
                          const UdpProxy     &aUdpProxy) override;
 
+    uint8_t  *Ip6GetSendBuffer(uint16_t &aCapacity) override;
     otbrError Ip6Send(const uint8_t *aData, uint16_t aLength) override;
     otbrError Ip6MulAddrUpdateSubscription(const otIp6Address &aAddress, bool aIsAdded) override;
     otbrError SetInfraIf(uint32_t                       aInfraIfIndex,
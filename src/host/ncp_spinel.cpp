@@ -55,8 +55,6 @@ static constexpr char kSpinelDataUnpackFormat[] = "CiiD";
 
 NcpSpinel::NcpSpinel(void)
     : mSpinelDriver(nullptr)
-    , mCmdTidsInUse(0)
-    , mCmdNextTid(1)
     , mNcpBuffer(mTxBuffer, kTxBufferSize)
     , mEncoder(mNcpBuffer)
     , mIid(SPINEL_HEADER_INVALID_IID)
@@ -65,8 +63,9 @@ NcpSpinel::NcpSpinel(void)
     , mPublisher(nullptr)
 #endif
 {
-    std::fill_n(mWaitingKeyTable, SPINEL_PROP_LAST_STATUS, sizeof(mWaitingKeyTable));
-    memset(mCmdTable, 0, sizeof(mCmdTable));
+    mTransactions.SetFailureHandler([this](spinel_command_t aCmd, spinel_prop_key_t aKey, otError aError) {
+        HandleQueuedCommandFailure(aCmd, aKey, aError);
+    });
 }
 
 void NcpSpinel::Init(ot::Spinel::SpinelDriver &aSpinelDriver, PropsObserver &aObserver)
@@ -75,6 +74,9 @@ void NcpSpinel::Init(ot::Spinel::SpinelDriver &aSpinelDriver, PropsObserver &aOb
     mPropsObserver = &aObserver;
     mIid           = mSpinelDriver->GetIid();
     mSpinelDriver->SetFrameHandler(&HandleReceivedFrame, &HandleSavedFrame, this);
+    mTransactions.SetSendFrameHandler([this](const uint8_t *aFrame, uint16_t aLength) {
+        return mSpinelDriver->GetSpinelInterface()->SendFrame(aFrame, aLength);
+    });
 }
 
 void NcpSpinel::Deinit(void)
@@ -86,6 +88,8 @@ void NcpSpinel::Deinit(void)
     mPublisher = nullptr;
 #endif
     mUdpForwardSendCallback = nullptr;
+    mTransactions.SetSendFrameHandler(nullptr);
+    mTransactions.Clear();
 }
 
 otbrError NcpSpinel::SpinelDataUnpack(const uint8_t *aDataIn, spinel_size_t aDataLen, const char *aPackFormat, ...)
@@ -164,12 +168,10 @@ exit:
 
 otbrError NcpSpinel::Ip6Send(const uint8_t *aData, uint16_t aLength)
 {
-    otbrError    error        = OTBR_ERROR_NONE;
-    EncodingFunc encodingFunc = [aData, aLength](ot::Spinel::Encoder &aEncoder) {
-        return aEncoder.WriteDataWithLen(aData, aLength);
-    };
+    otbrError error = OTBR_ERROR_NONE;
 
-    SuccessOrExit(SetProperty(SPINEL_PROP_STREAM_NET, encodingFunc), error = OTBR_ERROR_OPENTHREAD);
+    SuccessOrExit(mIp6TxFrame.SetPayload(aData, aLength), error = OTBR_ERROR_INVALID_ARGS);
+    SuccessOrExit(SendIp6Frame(aLength), error = OTBR_ERROR_OPENTHREAD);
 
 exit:
     return error;
@@ -226,20 +228,21 @@ exit:
 void NcpSpinel::ThreadErasePersistentInfo(AsyncTaskPtr aAsyncTask)
 {
     otError      error = OT_ERROR_NONE;
-    spinel_tid_t tid   = GetNextTid();
+    spinel_tid_t tid   = 0;
 
     VerifyOrExit(mThreadErasePersistentInfoTask == nullptr, error = OT_ERROR_BUSY);
 
+    tid = mTransactions.AllocateTid();
+    VerifyOrExit(tid != 0, error = OT_ERROR_BUSY);
     SuccessOrExit(error = mSpinelDriver->SendCommand(SPINEL_CMD_NET_CLEAR, SPINEL_PROP_LAST_STATUS, tid));
 
-    mWaitingKeyTable[tid]          = SPINEL_PROP_LAST_STATUS;
-    mCmdTable[tid]                 = SPINEL_CMD_NET_CLEAR;
+    mTransactions.HandleSent(tid, SPINEL_CMD_NET_CLEAR, SPINEL_PROP_LAST_STATUS);
     mThreadErasePersistentInfoTask = aAsyncTask;
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        FreeTidTableItem(tid);
+        mTransactions.Release(tid);
         mTaskRunner.Post(
             [aAsyncTask, error](void) { aAsyncTask->SetResult(error, "Failed to erase persistent info!"); });
     }
@@ -309,7 +312,7 @@ void NcpSpinel::HandleReceivedFrame(const uint8_t *aFrame, uint16_t aLength, uin
     {
         HandleNotification(aFrame, aLength);
     }
-    else if (tid < kMaxTids)
+    else if (tid < SpinelTransactions::kMaxTids)
     {
         HandleResponse(tid, aFrame, aLength);
     }
@@ -370,7 +373,7 @@ void NcpSpinel::HandleResponse(spinel_tid_t aTid, const uint8_t *aFrame, uint16_
 
     SuccessOrExit(error = SpinelDataUnpack(aFrame, aLength, kSpinelDataUnpackFormat, &header, &cmd, &key, &data, &len));
 
-    switch (mCmdTable[aTid])
+    switch (mTransactions.GetCommand(aTid))
     {
     case SPINEL_CMD_PROP_VALUE_GET:
     {
@@ -408,13 +411,13 @@ exit:
     if (error == OTBR_ERROR_INVALID_STATE)
     {
         otbrLogCrit("Received unexpected response with (cmd:%u, key:%u), waiting (cmd:%u, key:%u) for tid:%u", cmd, key,
-                    mCmdTable[aTid], mWaitingKeyTable[aTid], aTid);
+                    mTransactions.GetCommand(aTid), mTransactions.GetKey(aTid), aTid);
     }
     else if (error == OTBR_ERROR_PARSE)
     {
         otbrLogCrit("Error parsing response with tid:%u", aTid);
     }
-    FreeTidTableItem(aTid);
+    mTransactions.HandleResponse(aTid);
 }
 
 void NcpSpinel::HandleValueIs(spinel_prop_key_t aKey, const uint8_t *aBuffer, uint16_t aLength)
@@ -795,7 +798,7 @@ otbrError NcpSpinel::HandleResponseForPropGet(spinel_tid_t      aTid,
 {
     otbrError error = OTBR_ERROR_NONE;
 
-    switch (mWaitingKeyTable[aTid])
+    switch (mTransactions.GetKey(aTid))
     {
     case SPINEL_PROP_BORDER_AGENT_MESHCOP_SERVICE_STATE:
     {
@@ -815,7 +818,7 @@ otbrError NcpSpinel::HandleResponseForPropGet(spinel_tid_t      aTid,
     }
 
     default:
-        VerifyOrExit(aKey == mWaitingKeyTable[aTid], error = OTBR_ERROR_INVALID_STATE);
+        VerifyOrExit(aKey == mTransactions.GetKey(aTid), error = OTBR_ERROR_INVALID_STATE);
         break;
     }
 
@@ -834,7 +837,7 @@ otbrError NcpSpinel::HandleResponseForPropSet(spinel_tid_t      aTid,
     otbrError       error  = OTBR_ERROR_NONE;
     spinel_status_t status = SPINEL_STATUS_OK;
 
-    switch (mWaitingKeyTable[aTid])
+    switch (mTransactions.GetKey(aTid))
     {
     case SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS:
         VerifyOrExit(aKey == SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS, error = OTBR_ERROR_INVALID_STATE);
@@ -904,7 +907,7 @@ otbrError NcpSpinel::HandleResponseForPropSet(spinel_tid_t      aTid,
         break;
 
     default:
-        VerifyOrExit(aKey == mWaitingKeyTable[aTid], error = OTBR_ERROR_INVALID_STATE);
+        VerifyOrExit(aKey == mTransactions.GetKey(aTid), error = OTBR_ERROR_INVALID_STATE);
         break;
     }
 
@@ -920,7 +923,7 @@ otbrError NcpSpinel::HandleResponseForPropInsert(spinel_tid_t      aTid,
 {
     otbrError error = OTBR_ERROR_NONE;
 
-    switch (mWaitingKeyTable[aTid])
+    switch (mTransactions.GetKey(aTid))
     {
     case SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE:
         if (aCmd == SPINEL_CMD_PROP_VALUE_IS)
@@ -941,7 +944,7 @@ otbrError NcpSpinel::HandleResponseForPropInsert(spinel_tid_t      aTid,
     }
 
 exit:
-    otbrLogResult(error, "HandleResponseForPropInsert, key:%u", mWaitingKeyTable[aTid]);
+    otbrLogResult(error, "HandleResponseForPropInsert, key:%u", mTransactions.GetKey(aTid));
     return error;
 }
 
@@ -953,7 +956,7 @@ otbrError NcpSpinel::HandleResponseForPropRemove(spinel_tid_t      aTid,
 {
     otbrError error = OTBR_ERROR_NONE;
 
-    switch (mWaitingKeyTable[aTid])
+    switch (mTransactions.GetKey(aTid))
     {
     case SPINEL_PROP_IPV6_MULTICAST_ADDRESS_TABLE:
         if (aCmd == SPINEL_CMD_PROP_VALUE_IS)
@@ -974,7 +977,7 @@ otbrError NcpSpinel::HandleResponseForPropRemove(spinel_tid_t      aTid,
     }
 
 exit:
-    otbrLogResult(error, "HandleResponseForPropRemove, key:%u", mWaitingKeyTable[aTid]);
+    otbrLogResult(error, "HandleResponseForPropRemove, key:%u", mTransactions.GetKey(aTid));
     return error;
 }
 
@@ -1000,56 +1003,33 @@ exit:
     return error;
 }
 
-spinel_tid_t NcpSpinel::GetNextTid(void)
-{
-    spinel_tid_t tid = mCmdNextTid;
-
-    while (((1 << tid) & mCmdTidsInUse) != 0)
-    {
-        tid = SPINEL_GET_NEXT_TID(tid);
-
-        if (tid == mCmdNextTid)
-        {
-            // We looped back to `mCmdNextTid` indicating that all
-            // TIDs are in-use.
-
-            ExitNow(tid = 0);
-        }
-    }
-
-    mCmdTidsInUse |= (1 << tid);
-    mCmdNextTid = SPINEL_GET_NEXT_TID(tid);
-
-exit:
-    return tid;
-}
-
-void NcpSpinel::FreeTidTableItem(spinel_tid_t aTid)
-{
-    mCmdTidsInUse &= ~(1 << aTid);
-
-    mCmdTable[aTid]        = SPINEL_CMD_NOOP;
-    mWaitingKeyTable[aTid] = SPINEL_PROP_LAST_STATUS;
-}
-
 otError NcpSpinel::SendCommand(spinel_command_t aCmd, spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc)
 {
-    otError      error  = OT_ERROR_NONE;
-    spinel_tid_t tid    = GetNextTid();
-    uint8_t      header = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(mIid) | tid;
+    otError      error = OT_ERROR_NONE;
+    spinel_tid_t tid   = 0;
+    uint8_t      header;
+
+    // Keep the request order: once a command is queued, later ones are queued behind it.
+    tid    = mTransactions.AllocateTidInOrder();
+    header = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(mIid) | tid;
 
-    VerifyOrExit(tid != 0, error = OT_ERROR_BUSY);
     SuccessOrExit(error = mEncoder.BeginFrame(header, aCmd, aKey));
     SuccessOrExit(error = aEncodingFunc(mEncoder));
     SuccessOrExit(error = mEncoder.EndFrame());
+
+    if (tid == 0)
+    {
+        // All TIDs are in use, the frame is sent when a response frees one.
+        ExitNow(error = EnqueueEncodedFrame(aCmd, aKey));
+    }
+
     SuccessOrExit(error = SendEncodedFrame());
+    mTransactions.HandleSent(tid, aCmd, aKey);
 
-    mCmdTable[tid]        = aCmd;
-    mWaitingKeyTable[tid] = aKey;
 exit:
     if (error != OT_ERROR_NONE)
     {
-        FreeTidTableItem(tid);
+        mTransactions.Release(tid);
     }
 
     return error;
@@ -1094,6 +1074,77 @@ exit:
     return error;
 }
 
+otError NcpSpinel::EnqueueEncodedFrame(spinel_command_t aCmd, spinel_prop_key_t aKey)
+{
+    otError  error = OT_ERROR_NONE;
+    uint8_t  frame[kTxBufferSize];
+    uint16_t frameLength;
+
+    SuccessOrExit(error = mNcpBuffer.OutFrameBegin());
+    frameLength = mNcpBuffer.OutFrameGetLength();
+    VerifyOrExit(mNcpBuffer.OutFrameRead(frameLength, frame) == frameLength, error = OT_ERROR_FAILED);
+    error = mTransactions.Enqueue(aCmd, aKey, frame, frameLength);
+
+exit:
+    OTBR_UNUSED_VARIABLE(mNcpBuffer.OutFrameRemove());
+    return error;
+}
+
+void NcpSpinel::HandleQueuedCommandFailure(spinel_command_t aCmd, spinel_prop_key_t aKey, otError aError)
+{
+    // No response will arrive for a command which failed to be sent, so complete its requester here.
+    VerifyOrExit(aCmd == SPINEL_CMD_PROP_VALUE_SET);
+
+    switch (aKey)
+    {
+    case SPINEL_PROP_THREAD_ACTIVE_DATASET_TLVS:
+        CallAndClear(mDatasetSetActiveTask, aError);
+        break;
+    case SPINEL_PROP_THREAD_MGMT_SET_PENDING_DATASET_TLVS:
+        CallAndClear(mDatasetMgmtSetPendingTask, aError);
+        break;
+    case SPINEL_PROP_NET_IF_UP:
+        CallAndClear(mIp6SetEnabledTask, aError);
+        break;
+    case SPINEL_PROP_NET_STACK_UP:
+        CallAndClear(mThreadSetEnabledTask, aError);
+        break;
+    case SPINEL_PROP_NET_LEAVE_GRACEFULLY:
+        CallAndClear(mThreadDetachGracefullyTask, aError);
+        break;
+    case SPINEL_PROP_HOST_POWER_STATE:
+        CallAndClear(mSetHostPowerStateTask, aError);
+        break;
+    default:
+        break;
+    }
+
+exit:
+    return;
+}
+
+otError NcpSpinel::SendIp6Frame(uint16_t aLength)
+{
+    otError        error  = OT_ERROR_NONE;
+    spinel_tid_t   tid    = mTransactions.AllocateTid();
+    uint8_t        header = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(mIid) | tid;
+    const uint8_t *frame;
+    uint16_t       frameLength;
+
+    VerifyOrExit(tid != 0, error = OT_ERROR_BUSY);
+    SuccessOrExit(error = mIp6TxFrame.Finalize(header, aLength, frame, frameLength));
+    SuccessOrExit(error = mSpinelDriver->GetSpinelInterface()->SendFrame(frame, frameLength));
+
+    mTransactions.HandleSent(tid, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_STREAM_NET);
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        mTransactions.Release(tid);
+    }
+
+    return error;
+}
+
 otError NcpSpinel::ParseIp6AddressTable(const uint8_t               *aBuf,
                                         uint16_t                     aLength,
                                         std::vector<Ip6AddressInfo> &aAddressTable)
@@ -52,11 +52,14 @@
 #include "lib/spinel/spinel_encoder.hpp"
 
 #include "common/task_runner.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
 #include "host/async_task.hpp"
 #include "host/posix/cli_daemon.hpp"
 #include "host/posix/infra_if.hpp"
 #include "host/posix/netif.hpp"
+#include "host/spinel_ip6_frame.hpp"
+#include "host/spinel_transactions.hpp"
 #include "mdns/mdns.hpp"
 
 namespace otbr {
@@ -113,6 +116,8 @@ public:
         std::function<void(otBackboneRouterMulticastListenerEvent, Ip6Address)>;
     using BackboneRouterStateChangedCallback = std::function<void(otBackboneRouterState)>;
 
+    using TransactionMetrics = SpinelTransactions::Metrics;
+
     /**
      * Constructor.
      */
@@ -131,6 +136,19 @@ public:
      */
     void Deinit(void);
 
+    /**
+     * Returns the statistics of the spinel transactions.
+     *
+     * The latency of a transaction is measured from the request to the response, including the time
+     * it waited in the queue for a TID.
+     */
+    const TransactionMetrics &GetTransactionMetrics(void) const { return mTransactions.GetMetrics(); }
+
+    /**
+     * Returns the number of transactions waiting for a free TID.
+     */
+    size_t GetPendingTransactionCount(void) const { return mTransactions.GetPendingCount(); }
+
     /**
      * Returns the Co-processor version string.
      */
@@ -202,6 +220,22 @@ public:
      */
     void Ip6SetReceiveCallback(const Ip6ReceiveCallback &aCallback) { mIp6ReceiveCallback = aCallback; }
 
+    /**
+     * This method returns the buffer an IP6 datagram can be written into before calling `Ip6Send()`.
+     *
+     * A datagram passed to `Ip6Send()` from this buffer is sent without being copied. The buffer stays valid
+     * for the lifetime of this object, but its content is overwritten by every `Ip6Send()` call.
+     *
+     * @param[out] aCapacity  The size of the buffer in bytes.
+     *
+     * @returns A pointer to the buffer.
+     */
+    uint8_t *Ip6GetSendBuffer(uint16_t &aCapacity)
+    {
+        aCapacity = SpinelIp6Frame::kMaxPayloadLength;
+        return mIp6TxFrame.GetPayload();
+    }
+
     /**
      * This method sends an IP6 datagram through the NCP.
      *
@@ -416,7 +450,6 @@ public:
 private:
     using FailureHandler = std::function<void(otError)>;
 
-    static constexpr uint8_t  kMaxTids             = 16;
     static constexpr uint16_t kCallbackDataMaxSize = sizeof(uint64_t); // Maximum size of a function pointer.
     static constexpr uint16_t kMaxSubTypes         = 8;                // Maximum number of sub types in a MDNS service.
 
@@ -473,9 +506,6 @@ private:
                                           const uint8_t    *aData,
                                           uint16_t          aLength);
 
-    spinel_tid_t GetNextTid(void);
-    void         FreeTidTableItem(spinel_tid_t aTid);
-
     using EncodingFunc = std::function<otError(ot::Spinel::Encoder &aEncoder)>;
     otError SendCommand(spinel_command_t aCmd, spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc);
     otError GetProperty(spinel_prop_key_t aKey);
@@ -484,6 +514,9 @@ private:
     otError RemoveProperty(spinel_prop_key_t aKey, const EncodingFunc &aEncodingFunc);
 
     otError SendEncodedFrame(void);
+    otError EnqueueEncodedFrame(spinel_command_t aCmd, spinel_prop_key_t aKey);
+    void    HandleQueuedCommandFailure(spinel_command_t aCmd, spinel_prop_key_t aKey, otError aError);
+    otError SendIp6Frame(uint16_t aLength);
 
     otError ParseIp6AddressTable(const uint8_t *aBuf, uint16_t aLength, std::vector<Ip6AddressInfo> &aAddressTable);
     otError ParseIp6MulticastAddresses(const uint8_t *aBuf, uint16_t aLen, std::vector<Ip6Address> &aAddressList);
@@ -506,17 +539,13 @@ private:
     otError SendDnssdResult(otPlatDnssdRequestId aRequestId, const std::vector<uint8_t> &aCallbackData, otError aError);
 
     ot::Spinel::SpinelDriver *mSpinelDriver;
-    uint16_t                  mCmdTidsInUse; ///< Used transaction ids.
-    spinel_tid_t              mCmdNextTid;   ///< Next available transaction id.
-
-    spinel_prop_key_t mWaitingKeyTable[kMaxTids]; ///< The property keys of ongoing transactions.
-    spinel_command_t  mCmdTable[kMaxTids];        ///< The mapping of spinel command and tids when the response
-                                                  ///< is LAST_STATUS.
+    SpinelTransactions        mTransactions; ///< The ongoing and queued transactions.
 
     static constexpr uint16_t kTxBufferSize = 2048;
     uint8_t                   mTxBuffer[kTxBufferSize];
     ot::Spinel::Buffer        mNcpBuffer;
     ot::Spinel::Encoder       mEncoder;
+    SpinelIp6Frame            mIp6TxFrame; ///< Dedicated frame so that IPv6 packets skip `mEncoder`.
     spinel_iid_t              mIid; /// < Interface Id used to in Spinel header
 
     TaskRunner mTaskRunner;
@@ -30,6 +30,8 @@
 
 #include "cli_daemon.hpp"
 
+#include <algorithm>
+
 #include <errno.h>
 #include <fcntl.h>
 #include <signal.h>
@@ -74,12 +76,9 @@ std::string CliDaemon::GetSocketFilename(const std::string &aNetIfName, const ch
 
 void CliDaemon::HandleCommandOutput(const char *aOutput)
 {
-    int    ret;
     char   buf[kCliMaxLineLength];
     size_t length = strlen(aOutput);
 
-    VerifyOrExit(mSessionSocket != -1);
-
     static_assert(sizeof(kTruncatedMsg) < kCliMaxLineLength, "OTBR_CONFIG_CLI_MAX_LINE_LENGTH is too short!");
 
     strncpy(buf, aOutput, kCliMaxLineLength);
@@ -90,17 +89,132 @@ void CliDaemon::HandleCommandOutput(const char *aOutput)
         memcpy(buf + kCliMaxLineLength - sizeof(kTruncatedMsg), kTruncatedMsg, sizeof(kTruncatedMsg));
     }
 
-#ifdef __linux__
-    // MSG_NOSIGNAL prevents read() from sending a SIGPIPE in the case of a broken pipe.
-    ret = send(mSessionSocket, buf, length, MSG_NOSIGNAL);
-#else
-    ret = static_cast<int>(write(mSessionSocket, buf, length));
-#endif
+    if (mCommandActive)
+    {
+        // Output of a command goes to the session which issued it only. It is dropped if that session has gone.
+        if (mActiveSession != nullptr)
+        {
+            QueueOutput(*mActiveSession, buf, length);
+        }
+
+        TrackCommandCompletion(aOutput);
+    }
+    else
+    {
+        // Unsolicited output (e.g. state change notifications) is of interest to every session.
+        for (SessionPtr &session : mSessions)
+        {
+            QueueOutput(*session, buf, length);
+        }
+    }
+}
+
+void CliDaemon::QueueOutput(Session &aSession, const char *aOutput, size_t aLength)
+{
+    VerifyOrExit(aSession.mSocket != -1);
 
-    if (ret < 0)
+    if (aSession.mOutput.size() + aLength > kMaxBacklog)
     {
-        otbrLogWarning("Failed to write CLI output: %s", strerror(errno));
-        Clear();
+        if (aSession.mDroppedBytes == 0)
+        {
+            otbrLogWarning("Session %d is not reading its output, dropping output", aSession.mSocket);
+        }
+
+        aSession.mDroppedBytes += aLength;
+        ExitNow();
+    }
+
+    aSession.mOutput.append(aOutput, aLength);
+
+exit:
+    return;
+}
+
+void CliDaemon::TrackCommandCompletion(const char *aOutput)
+{
+    size_t lineStart = 0;
+    size_t lineEnd;
+
+    mOutputLine.append(aOutput);
+
+    // OpenThread CLI ends the output of every command with a "Done" or an "Error ..." line.
+    while ((lineEnd = mOutputLine.find('\n', lineStart)) != std::string::npos)
+    {
+        std::string line = mOutputLine.substr(lineStart, lineEnd - lineStart);
+
+        lineStart = lineEnd + 1;
+
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+
+        if (line.compare(0, 2, "> ") == 0)
+        {
+            line.erase(0, 2);
+        }
+
+        if (line == "Done" || line.compare(0, 6, "Error ") == 0)
+        {
+            FinishActiveCommand();
+            ExitNow();
+        }
+    }
+
+    mOutputLine.erase(0, lineStart);
+
+    if (mOutputLine.size() > kCliMaxLineLength)
+    {
+        mOutputLine.erase(0, mOutputLine.size() - kCliMaxLineLength);
+    }
+
+exit:
+    return;
+}
+
+void CliDaemon::FinishActiveCommand(void)
+{
+    mCommandActive = false;
+    mActiveSession = nullptr;
+    mOutputLine.clear();
+}
+
+void CliDaemon::RunNextCommand(void)
+{
+    while (!mCommandActive && !mSessions.empty())
+    {
+        Session  *next = nullptr;
+        otbrError error;
+
+        // Serve the sessions round-robin so that a busy session cannot starve the others.
+        for (size_t i = 0; i < mSessions.size() && next == nullptr; i++)
+        {
+            Session &session = *mSessions[(mNextSessionIndex + i) % mSessions.size()];
+
+            if (session.mSocket != -1 && !session.mPendingCommands.empty())
+            {
+                next              = &session;
+                mNextSessionIndex = (mNextSessionIndex + i + 1) % mSessions.size();
+            }
+        }
+
+        VerifyOrExit(next != nullptr);
+
+        std::string command = std::move(next->mPendingCommands.front());
+
+        next->mPendingCommands.pop_front();
+
+        mActiveSession   = next;
+        mCommandActive   = true;
+        mCommandDeadline = Clock::now() + Milliseconds(kCommandTimeoutMs);
+
+        error = mDeps.InputCommandLine(command.c_str());
+
+        if (error != OTBR_ERROR_NONE)
+        {
+            otbrLogWarning("Failed to input command line, error:%s", otbrErrorString(error));
+            FinishActiveCommand();
+        }
     }
 
 exit:
@@ -110,7 +224,9 @@ exit:
 CliDaemon::CliDaemon(Dependencies &aDependencies)
     : mListenSocket(-1)
     , mDaemonLock(-1)
-    , mSessionSocket(-1)
+    , mActiveSession(nullptr)
+    , mCommandActive(false)
+    , mNextSessionIndex(0)
     , mDeps(aDependencies)
 {
 }
@@ -155,17 +271,30 @@ void CliDaemon::InitializeSessionSocket(void)
     // The `accept()` call uses `nullptr` for `addr` and `addrlen` arguments as we don't need the client address
     // information.
     VerifyOrExit((newSessionSocket = accept(mListenSocket, nullptr, nullptr)) != -1);
+
+    if (mSessions.size() >= kMaxSessions)
+    {
+        otbrLogWarning("Too many sessions, rejecting the new one");
+        close(newSessionSocket);
+        ExitNow(flag = 0);
+    }
+
     VerifyOrExit((flag = fcntl(newSessionSocket, F_GETFD, 0)) != -1, close(newSessionSocket));
 
     flag |= FD_CLOEXEC;
     VerifyOrExit((flag = fcntl(newSessionSocket, F_SETFD, flag)) != -1, close(newSessionSocket));
 
+    // Output is written only when the session socket is writable, never blocking the main loop.
+    VerifyOrExit((flag = fcntl(newSessionSocket, F_GETFL, 0)) != -1, close(newSessionSocket));
+    VerifyOrExit((flag = fcntl(newSessionSocket, F_SETFL, flag | O_NONBLOCK)) != -1, close(newSessionSocket));
+
 #ifndef __linux__
     // some platforms (macOS, Solaris) don't have MSG_NOSIGNAL
     // SOME of those (macOS, but NOT Solaris) support SO_NOSIGPIPE
     // if we have SO_NOSIGPIPE, then set it. Otherwise, we're going
     // to simply ignore it.
 #if defined(SO_NOSIGPIPE)
+    flag = 1;
     VerifyOrExit((flag = setsockopt(newSessionSocket, SOL_SOCKET, SO_NOSIGPIPE, &flag, sizeof(flag))) != -1,
                  close(newSessionSocket));
 #else
@@ -173,16 +302,13 @@ void CliDaemon::InitializeSessionSocket(void)
 #endif
 #endif // __linux__
 
-    Clear();
-
-    mSessionSocket = newSessionSocket;
-    otbrLogInfo("Session socket is ready");
+    mSessions.emplace_back(new Session(newSessionSocket));
+    otbrLogInfo("Session socket %d is ready, %zu session(s) connected", newSessionSocket, mSessions.size());
 
 exit:
     if (flag == -1)
     {
         otbrLogWarning("Failed to initialize session socket: %s", strerror(errno));
-        Clear();
     }
 }
 
@@ -195,22 +321,41 @@ otbrError CliDaemon::Init(const std::string &aNetIfName)
 
     SuccessOrExit(error = CreateListenSocket(aNetIfName));
 
-    //
-    // only accept 1 connection.
-    //
-    VerifyOrExit(listen(mListenSocket, 1) != -1, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(listen(mListenSocket, static_cast<int>(kMaxSessions)) != -1, error = OTBR_ERROR_ERRNO);
 
 exit:
     return error;
 }
 
+void CliDaemon::CloseSession(Session &aSession)
+{
+    VerifyOrExit(aSession.mSocket != -1);
+
+    close(aSession.mSocket);
+    aSession.mSocket = -1;
+    aSession.mOutput.clear();
+    aSession.mPendingCommands.clear();
+
+    if (mActiveSession == &aSession)
+    {
+        // The command keeps the CLI busy until it completes, but its output is dropped.
+        mActiveSession = nullptr;
+    }
+
+exit:
+    return;
+}
+
 void CliDaemon::Clear(void)
 {
-    if (mSessionSocket != -1)
+    for (SessionPtr &session : mSessions)
     {
-        close(mSessionSocket);
-        mSessionSocket = -1;
+        CloseSession(*session);
     }
+
+    mSessions.clear();
+    FinishActiveCommand();
+    mNextSessionIndex = 0;
 }
 
 void CliDaemon::Deinit(void)
@@ -220,68 +365,149 @@ void CliDaemon::Deinit(void)
 
 void CliDaemon::UpdateFdSet(MainloopContext &aContext)
 {
+    bool hasPendingCommand = false;
+
     if (mListenSocket != -1)
     {
         aContext.AddFdToSet(mListenSocket, MainloopContext::kErrorFdSet | MainloopContext::kReadFdSet);
     }
 
-    if (mSessionSocket != -1)
+    for (const SessionPtr &session : mSessions)
     {
-        aContext.AddFdToSet(mSessionSocket, MainloopContext::kErrorFdSet | MainloopContext::kReadFdSet);
+        uint8_t fdSetMask = MainloopContext::kErrorFdSet | MainloopContext::kReadFdSet;
+
+        if (!session->mOutput.empty())
+        {
+            fdSetMask |= MainloopContext::kWriteFdSet;
+        }
+
+        aContext.AddFdToSet(session->mSocket, fdSetMask);
+        hasPendingCommand = hasPendingCommand || !session->mPendingCommands.empty();
+    }
+
+    if (mCommandActive)
+    {
+        Microseconds timeout = std::chrono::duration_cast<Microseconds>(mCommandDeadline - Clock::now());
+
+        if (timeout < FromTimeval<Microseconds>(aContext.mTimeout))
+        {
+            aContext.mTimeout = ToTimeval(std::max(timeout, Microseconds::zero()));
+        }
+    }
+    else if (hasPendingCommand)
+    {
+        aContext.mTimeout = ToTimeval(Microseconds::zero());
     }
 }
 
-void CliDaemon::Process(const MainloopContext &aContext)
+void CliDaemon::ReadSession(Session &aSession)
 {
-    VerifyOrExit(mListenSocket != -1);
+    char    buffer[kCliMaxLineLength];
+    ssize_t received;
 
-    if (FD_ISSET(mListenSocket, &aContext.mErrorFdSet))
+    // leave 1 byte for the null terminator
+    received = read(aSession.mSocket, buffer, sizeof(buffer) - 1);
+
+    if (received > 0)
     {
-        DieNow("daemon socket error");
+        if (aSession.mPendingCommands.size() >= kMaxPendingCommands)
+        {
+            otbrLogWarning("Session %d has too many pending commands, dropping one", aSession.mSocket);
+        }
+        else
+        {
+            aSession.mPendingCommands.emplace_back(buffer, static_cast<size_t>(received));
+        }
     }
-
-    if (FD_ISSET(mListenSocket, &aContext.mReadFdSet))
+    else if (received == 0)
     {
-        InitializeSessionSocket();
+        otbrLogInfo("Session socket %d closed by peer", aSession.mSocket);
+        CloseSession(aSession);
+    }
+    else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+    {
+        otbrLogWarning("CLI Daemon read: %s", strerror(errno));
+        CloseSession(aSession);
     }
+}
+
+void CliDaemon::WriteSession(Session &aSession)
+{
+    ssize_t sent;
 
-    VerifyOrExit(mSessionSocket != -1);
+#ifdef __linux__
+    // MSG_NOSIGNAL prevents read() from sending a SIGPIPE in the case of a broken pipe.
+    sent = send(aSession.mSocket, aSession.mOutput.data(), aSession.mOutput.size(), MSG_NOSIGNAL);
+#else
+    sent = write(aSession.mSocket, aSession.mOutput.data(), aSession.mOutput.size());
+#endif
 
-    if (FD_ISSET(mSessionSocket, &aContext.mErrorFdSet))
+    if (sent >= 0)
     {
-        Clear();
+        aSession.mOutput.erase(0, static_cast<size_t>(sent));
+
+        if (aSession.mOutput.empty() && aSession.mDroppedBytes != 0)
+        {
+            otbrLogWarning("Session %d caught up, %zu output bytes were dropped", aSession.mSocket,
+                           aSession.mDroppedBytes);
+            aSession.mDroppedBytes = 0;
+        }
     }
-    else if (FD_ISSET(mSessionSocket, &aContext.mReadFdSet))
+    else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
     {
-        uint8_t   buffer[kCliMaxLineLength];
-        otbrError error = OTBR_ERROR_NONE;
-        ssize_t   received;
+        otbrLogWarning("Failed to write CLI output: %s", strerror(errno));
+        CloseSession(aSession);
+    }
+}
 
-        // leave 1 byte for the null terminator
-        received = read(mSessionSocket, buffer, sizeof(buffer) - 1);
+void CliDaemon::Process(const MainloopContext &aContext)
+{
+    VerifyOrExit(mListenSocket != -1);
 
-        if (received > 0)
-        {
-            buffer[received] = '\0';
-            error            = mDeps.InputCommandLine(reinterpret_cast<char *>(buffer));
+    if (FD_ISSET(mListenSocket, &aContext.mErrorFdSet))
+    {
+        DieNow("daemon socket error");
+    }
 
-            if (error != OTBR_ERROR_NONE)
-            {
-                otbrLogWarning("Failed to input command line, error:%s", otbrErrorString(error));
-            }
+    // Sessions accepted below are not in the fd sets of this round yet.
+    for (size_t i = 0, count = mSessions.size(); i < count; i++)
+    {
+        Session &session = *mSessions[i];
+
+        if (FD_ISSET(session.mSocket, &aContext.mErrorFdSet))
+        {
+            CloseSession(session);
+            continue;
         }
-        else if (received == 0)
+
+        if (FD_ISSET(session.mSocket, &aContext.mReadFdSet))
         {
-            otbrLogInfo("Session socket closed by peer");
-            Clear();
+            ReadSession(session);
         }
-        else
+
+        if (session.mSocket != -1 && !session.mOutput.empty() && FD_ISSET(session.mSocket, &aContext.mWriteFdSet))
         {
-            otbrLogWarning("CLI Daemon read: %s", strerror(errno));
-            Clear();
+            WriteSession(session);
         }
     }
 
+    if (FD_ISSET(mListenSocket, &aContext.mReadFdSet))
+    {
+        InitializeSessionSocket();
+    }
+
+    if (mCommandActive && Clock::now() >= mCommandDeadline)
+    {
+        otbrLogWarning("CLI command did not complete in %ums", kCommandTimeoutMs);
+        FinishActiveCommand();
+    }
+
+    RunNextCommand();
+
+    mSessions.erase(std::remove_if(mSessions.begin(), mSessions.end(),
+                                   [](const SessionPtr &aSession) { return aSession->mSocket == -1; }),
+                    mSessions.end());
+
 exit:
     return;
 }
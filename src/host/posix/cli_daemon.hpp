@@ -34,13 +34,25 @@
 #ifndef OTBR_AGENT_POSIX_DAEMON_HPP_
 #define OTBR_AGENT_POSIX_DAEMON_HPP_
 
+#include <deque>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "common/mainloop.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
 
 namespace otbr {
 
+/**
+ * This class implements the CLI daemon which serves the OpenThread CLI over a Unix socket.
+ *
+ * Multiple sessions may be connected at the same time. Command lines are executed one at a time; the command of a
+ * session is queued while a command of another session is executing, and the output is routed to the session which
+ * issued the command being executed. Output is buffered per session and written when the session socket is writable,
+ * so a slow session never blocks the main loop.
+ */
 class CliDaemon
 {
 public:
@@ -61,8 +73,35 @@ public:
     void Process(const MainloopContext &aContext);
     void UpdateFdSet(MainloopContext &aContext);
 
+    /**
+     * Returns the number of connected sessions.
+     *
+     * @returns The number of connected sessions.
+     */
+    size_t GetSessionCount(void) const { return mSessions.size(); }
+
 private:
-    static constexpr size_t kCliMaxLineLength = OTBR_CONFIG_CLI_MAX_LINE_LENGTH;
+    static constexpr size_t   kCliMaxLineLength   = OTBR_CONFIG_CLI_MAX_LINE_LENGTH;
+    static constexpr size_t   kMaxSessions        = OTBR_CONFIG_CLI_MAX_SESSIONS;
+    static constexpr size_t   kMaxBacklog         = OTBR_CONFIG_CLI_SESSION_MAX_BACKLOG;
+    static constexpr size_t   kMaxPendingCommands = OTBR_CONFIG_CLI_SESSION_MAX_PENDING_COMMANDS;
+    static constexpr uint32_t kCommandTimeoutMs   = 10000; ///< Releases the CLI if a command never completes.
+
+    struct Session
+    {
+        explicit Session(int aSocket)
+            : mSocket(aSocket)
+            , mDroppedBytes(0)
+        {
+        }
+
+        int                     mSocket;
+        std::string             mOutput;
+        std::deque<std::string> mPendingCommands;
+        size_t                  mDroppedBytes;
+    };
+
+    using SessionPtr = std::unique_ptr<Session>;
 
     void Clear(void);
 
@@ -70,10 +109,23 @@ private:
 
     otbrError CreateListenSocket(const std::string &aNetIfName);
     void      InitializeSessionSocket(void);
+    void      CloseSession(Session &aSession);
+    void      ReadSession(Session &aSession);
+    void      WriteSession(Session &aSession);
+    void      QueueOutput(Session &aSession, const char *aOutput, size_t aLength);
+    void      TrackCommandCompletion(const char *aOutput);
+    void      FinishActiveCommand(void);
+    void      RunNextCommand(void);
 
     int mListenSocket;
     int mDaemonLock;
-    int mSessionSocket;
+
+    std::vector<SessionPtr> mSessions;
+    Session                *mActiveSession;
+    bool                    mCommandActive;
+    Clock::time_point       mCommandDeadline;
+    std::string             mOutputLine;
+    size_t                  mNextSessionIndex;
 
     Dependencies &mDeps;
 };
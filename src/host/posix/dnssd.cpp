@@ -36,6 +36,7 @@
 #include "host/posix/dnssd.hpp"
 
 #if OTBR_ENABLE_DNSSD_PLAT
+#include <ctype.h>
 #include <string>
 #include <vector>
 
@@ -337,9 +338,8 @@ void DnssdPlatform::UnregisterKey(const Key &aKey, RequestId aRequestId, Registe
 
 void DnssdPlatform::StartServiceBrowser(const Browser &aBrowser, BrowseCallbackPtr aCallbackPtr)
 {
-    DnsServiceType fullServiceType(aBrowser.mServiceType, aBrowser.mSubTypeLabel);
-    auto          &entryList         = mServiceBrowsersMap[fullServiceType];
-    bool           needsSubscription = !entryList.HasSubscribedOnInfraIf(aBrowser.mInfraIfIndex);
+    auto &entryList         = mServiceBrowsersMap[BrowserNameKey(aBrowser)];
+    bool  needsSubscription = !entryList.HasSubscribedOnInfraIf(aBrowser.mInfraIfIndex);
 
     VerifyOrExit(!mInvokingCallbacks);
 
@@ -347,7 +347,7 @@ void DnssdPlatform::StartServiceBrowser(const Browser &aBrowser, BrowseCallbackP
 
     if (needsSubscription)
     {
-        mPublisher.SubscribeService(fullServiceType.ToString(), "");
+        mPublisher.SubscribeService(FullServiceTypeFor(aBrowser.mServiceType, aBrowser.mSubTypeLabel), "");
     }
 
 exit:
@@ -356,18 +356,17 @@ exit:
 
 void DnssdPlatform::StopServiceBrowser(const Browser &aBrowser, const BrowseCallback &aCallback)
 {
-    DnsServiceType fullServiceType(aBrowser.mServiceType, aBrowser.mSubTypeLabel);
-    auto           iter = mServiceBrowsersMap.find(fullServiceType);
+    auto iter = mServiceBrowsersMap.find(BrowserNameKey(aBrowser));
 
     if (iter != mServiceBrowsersMap.end())
     {
         auto &entryList = iter->second;
 
-        entryList.MarkAsDeleted(aBrowser.mInfraIfIndex, aCallback);
+        entryList.Remove(aBrowser.mInfraIfIndex, aCallback, mInvokingCallbacks);
 
         if (!entryList.HasAnyValidCallbacks())
         {
-            mPublisher.UnsubscribeService(fullServiceType.ToString(), "");
+            mPublisher.UnsubscribeService(FullServiceTypeFor(aBrowser.mServiceType, aBrowser.mSubTypeLabel), "");
         }
 
         if (!mInvokingCallbacks)
@@ -383,7 +382,7 @@ void DnssdPlatform::StopServiceBrowser(const Browser &aBrowser, const BrowseCall
 
 void DnssdPlatform::StartServiceResolver(const SrvResolver &aSrvResolver, SrvCallbackPtr aCallbackPtr)
 {
-    auto &entryList = mServiceResolversMap[DnsServiceName(aSrvResolver.mServiceInstance, aSrvResolver.mServiceType)];
+    auto &entryList = mServiceResolversMap[MakeNameKey(aSrvResolver.mServiceInstance, aSrvResolver.mServiceType)];
     bool  needsSubscription = !entryList.HasSubscribedOnInfraIf(aSrvResolver.mInfraIfIndex);
 
     VerifyOrExit(!mInvokingCallbacks);
@@ -401,13 +400,13 @@ exit:
 
 void DnssdPlatform::StopServiceResolver(const SrvResolver &aSrvResolver, const SrvCallback &aCallback)
 {
-    auto iter = mServiceResolversMap.find(DnsServiceName(aSrvResolver.mServiceInstance, aSrvResolver.mServiceType));
+    auto iter = mServiceResolversMap.find(MakeNameKey(aSrvResolver.mServiceInstance, aSrvResolver.mServiceType));
 
     if (iter != mServiceResolversMap.end())
     {
         auto &entryList = iter->second;
 
-        entryList.MarkAsDeleted(aSrvResolver.mInfraIfIndex, aCallback);
+        entryList.Remove(aSrvResolver.mInfraIfIndex, aCallback, mInvokingCallbacks);
 
         if (!entryList.HasAnyValidCallbacks())
         {
@@ -427,7 +426,7 @@ void DnssdPlatform::StopServiceResolver(const SrvResolver &aSrvResolver, const S
 
 void DnssdPlatform::StartTxtResolver(const TxtResolver &aTxtResolver, TxtCallbackPtr aCallbackPtr)
 {
-    auto &entryList = mTxtResolversMap[DnsServiceName(aTxtResolver.mServiceInstance, aTxtResolver.mServiceType)];
+    auto &entryList         = mTxtResolversMap[MakeNameKey(aTxtResolver.mServiceInstance, aTxtResolver.mServiceType)];
     bool  needsSubscription = !entryList.HasSubscribedOnInfraIf(aTxtResolver.mInfraIfIndex);
 
     VerifyOrExit(!mInvokingCallbacks);
@@ -445,13 +444,13 @@ exit:
 
 void DnssdPlatform::StopTxtResolver(const TxtResolver &aTxtResolver, const TxtCallback &aCallback)
 {
-    auto iter = mTxtResolversMap.find(DnsServiceName(aTxtResolver.mServiceInstance, aTxtResolver.mServiceType));
+    auto iter = mTxtResolversMap.find(MakeNameKey(aTxtResolver.mServiceInstance, aTxtResolver.mServiceType));
 
     if (iter != mTxtResolversMap.end())
     {
         auto &entryList = iter->second;
 
-        entryList.MarkAsDeleted(aTxtResolver.mInfraIfIndex, aCallback);
+        entryList.Remove(aTxtResolver.mInfraIfIndex, aCallback, mInvokingCallbacks);
 
         if (!entryList.HasAnyValidCallbacks())
         {
@@ -525,7 +524,7 @@ void DnssdPlatform::ProcessServiceBrowsers(const std::string
 {
     std::string  instanceName;
     BrowseResult result;
-    auto         it = mServiceBrowsersMap.find(DnsServiceType(aType.c_str(), nullptr));
+    auto         it = mServiceBrowsersMap.find(MakeNameKey(aType.c_str()));
 
     VerifyOrExit(mState == kStateReady);
 
@@ -548,12 +547,11 @@ exit:
 void DnssdPlatform::ProcessServiceResolvers(const std::string                             &aType,
                                             const Mdns::Publisher::DiscoveredInstanceInfo &aInfo)
 {
-    std::string    instanceName = DnsUtils::UnescapeInstanceName(aInfo.mName);
-    DnsServiceName serviceName(instanceName, aType);
-    std::string    hostName;
-    std::string    domain;
-    SrvResult      srvResult;
-    auto           it = mServiceResolversMap.find(serviceName);
+    std::string instanceName = DnsUtils::UnescapeInstanceName(aInfo.mName);
+    std::string hostName;
+    std::string domain;
+    SrvResult   srvResult;
+    auto        it = mServiceResolversMap.find(MakeNameKey(instanceName.c_str(), aType.c_str()));
 
     VerifyOrExit(mState == kStateReady);
     VerifyOrExit(it != mServiceResolversMap.end());
@@ -576,10 +574,9 @@ exit:
 
 void DnssdPlatform::ProcessTxtResolvers(const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfo &aInfo)
 {
-    std::string    instanceName = DnsUtils::UnescapeInstanceName(aInfo.mName);
-    DnsServiceName serviceName(instanceName, aType);
-    TxtResult      txtResult;
-    auto           it = mTxtResolversMap.find(serviceName);
+    std::string instanceName = DnsUtils::UnescapeInstanceName(aInfo.mName);
+    TxtResult   txtResult;
+    auto        it = mTxtResolversMap.find(MakeNameKey(instanceName.c_str(), aType.c_str()));
 
     VerifyOrExit(mState == kStateReady);
 
@@ -598,14 +595,14 @@ exit:
     return;
 }
 
-void DnssdPlatform::ProcessAddrResolvers(const std::string                          &aHostName,
-                                         const Mdns::Publisher::DiscoveredHostInfo  &aInfo,
-                                         std::map<DnsName, EntryList<AddressEntry>> &aResolversMap)
+void DnssdPlatform::ProcessAddrResolvers(const std::string                         &aHostName,
+                                         const Mdns::Publisher::DiscoveredHostInfo &aInfo,
+                                         EntryListMap<AddressEntry>                &aResolversMap)
 {
     std::string                           instanceName;
     AddressResult                         result;
     std::vector<otPlatDnssdAddressAndTtl> addressAndTtls;
-    auto                                  it = aResolversMap.find(aHostName);
+    auto                                  it = aResolversMap.find(MakeNameKey(aHostName.c_str()));
 
     VerifyOrExit(mState == kStateReady);
 
@@ -642,11 +639,11 @@ void DnssdPlatform::ProcessIp4AddrResolvers(const std::string
     ProcessAddrResolvers(aHostName, aInfo, mIp4AddrResolversMap);
 }
 
-void DnssdPlatform::StartAddressResolver(const AddressResolver                      &aAddressResolver,
-                                         AddressCallbackPtr                          aCallbackPtr,
-                                         std::map<DnsName, EntryList<AddressEntry>> &aResolversMap)
+void DnssdPlatform::StartAddressResolver(const AddressResolver      &aAddressResolver,
+                                         AddressCallbackPtr          aCallbackPtr,
+                                         EntryListMap<AddressEntry> &aResolversMap)
 {
-    auto &entryList         = aResolversMap[DnsName(aAddressResolver.mHostName)];
+    auto &entryList         = aResolversMap[MakeNameKey(aAddressResolver.mHostName)];
     bool  needsSubscription = !entryList.HasSubscribedOnInfraIf(aAddressResolver.mInfraIfIndex);
 
     VerifyOrExit(!mInvokingCallbacks);
@@ -662,17 +659,17 @@ exit:
     return;
 }
 
-void DnssdPlatform::StopAddressResolver(const AddressResolver                      &aAddressResolver,
-                                        const AddressCallback                      &aCallback,
-                                        std::map<DnsName, EntryList<AddressEntry>> &aResolversMap)
+void DnssdPlatform::StopAddressResolver(const AddressResolver      &aAddressResolver,
+                                        const AddressCallback      &aCallback,
+                                        EntryListMap<AddressEntry> &aResolversMap)
 {
-    auto iter = aResolversMap.find(DnsName(aAddressResolver.mHostName));
+    auto iter = aResolversMap.find(MakeNameKey(aAddressResolver.mHostName));
 
     if (iter != aResolversMap.end())
     {
         auto &entryList = iter->second;
 
-        entryList.MarkAsDeleted(aAddressResolver.mInfraIfIndex, aCallback);
+        entryList.Remove(aAddressResolver.mInfraIfIndex, aCallback, mInvokingCallbacks);
 
         if (!entryList.HasAnyValidCallbacks())
         {
@@ -690,18 +687,51 @@ void DnssdPlatform::StopAddressResolver(const AddressResolver
     }
 }
 
-const std::string DnssdPlatform::DnsServiceType::ToString(void) const
+const std::string &DnssdPlatform::BrowserNameKey(const Browser &aBrowser)
 {
-    std::string serviceType(mType);
+    bool hasSubType = (aBrowser.mSubTypeLabel != nullptr && aBrowser.mSubTypeLabel[0] != '\0');
 
-    if (!mSubType.empty())
+    return hasSubType ? MakeNameKey(aBrowser.mSubTypeLabel, "_sub", aBrowser.mServiceType)
+                      : MakeNameKey(aBrowser.mServiceType);
+}
+
+std::string DnssdPlatform::FullServiceTypeFor(const char *aType, const char *aSubTypeLabel)
+{
+    std::string serviceType(aType ? aType : "");
+
+    if (aSubTypeLabel != nullptr && aSubTypeLabel[0] != '\0')
     {
-        serviceType = std::string(mSubType) + "._sub." + serviceType;
+        serviceType = std::string(aSubTypeLabel) + "._sub." + serviceType;
     }
 
     return serviceType;
 }
 
+const std::string &DnssdPlatform::MakeNameKey(const char *aLabels, const char *aMoreLabels, const char *aLastLabels)
+{
+    mNameKey.clear();
+
+    for (const char *labels : {aLabels, aMoreLabels, aLastLabels})
+    {
+        if (labels == nullptr || labels[0] == '\0')
+        {
+            continue;
+        }
+
+        if (!mNameKey.empty())
+        {
+            mNameKey.push_back('.');
+        }
+
+        for (const char *c = labels; *c != '\0'; c++)
+        {
+            mNameKey.push_back(static_cast<char>(tolower(static_cast<unsigned char>(*c))));
+        }
+    }
+
+    return mNameKey;
+}
+
 } // namespace otbr
 
 #endif // OTBR_ENABLE_DNSSD_PLAT
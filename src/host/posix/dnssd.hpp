@@ -38,11 +38,14 @@
 
 #if OTBR_ENABLE_DNSSD_PLAT
 
-#include <algorithm>
 #include <functional>
-#include <map>
+#include <list>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <stdint.h>
 
 #include <openthread/instance.h>
 #include <openthread/platform/dnssd.h>
@@ -138,9 +141,12 @@ public:
             return (GetType() == aOther.GetType()) && IsEqualWhenSameType(aOther);
         }
 
+        size_t GetHash(void) const { return std::hash<uint64_t>()(GetId()) ^ static_cast<size_t>(GetType()); }
+
     private:
         virtual CallbackType GetType(void) const                                                     = 0;
         virtual bool         IsEqualWhenSameType(const DnssdCallback<DnssdResultType> &aOther) const = 0;
+        virtual uint64_t     GetId(void) const                                                       = 0;
     };
 
     typedef DnssdCallback<BrowseResult>  BrowseCallback;
@@ -167,6 +173,7 @@ public:
             const OtDnssdCallback &other = static_cast<const OtDnssdCallback &>(aOther);
             return mCallback == other.mCallback;
         }
+        uint64_t GetId(void) const override { return reinterpret_cast<uintptr_t>(mCallback); }
 
         otInstance         *mInstance;
         OtDnssdCallbackType mCallback;
@@ -196,6 +203,7 @@ public:
             const StdDnssdCallback &other = static_cast<const StdDnssdCallback &>(aOther);
             return this->mId == other.mId;
         }
+        uint64_t GetId(void) const override { return mId; }
 
         StdDnssdCallbackType mCallback;
         uint64_t             mId;
@@ -239,78 +247,6 @@ private:
     static constexpr State kStateReady   = OT_PLAT_DNSSD_READY;
     static constexpr State kStateStopped = OT_PLAT_DNSSD_STOPPED;
 
-    class DnsName
-    {
-    public:
-        DnsName(std::string aName)
-            : mName(std::move(aName))
-        {
-        }
-
-        bool operator==(const DnsName &aOther) const
-        {
-            return StringUtils::ToLowercase(mName) == StringUtils::ToLowercase(aOther.mName);
-        }
-
-        bool operator<(const DnsName &aOther) const
-        {
-            return StringUtils::ToLowercase(mName) < StringUtils::ToLowercase(aOther.mName);
-        }
-
-    private:
-        std::string mName;
-    };
-
-    class DnsServiceType
-    {
-    public:
-        DnsServiceType(const char *aType, const char *aSubType)
-            : mType(aType ? aType : "")
-            , mSubType(aSubType ? aSubType : "")
-        {
-        }
-
-        bool operator==(const DnsServiceType &aOther) const
-        {
-            return StringUtils::ToLowercase(ToString()) == StringUtils::ToLowercase(aOther.ToString());
-        }
-
-        bool operator<(const DnsServiceType &aOther) const
-        {
-            return StringUtils::ToLowercase(ToString()) < StringUtils::ToLowercase(aOther.ToString());
-        }
-
-        const std::string ToString(void) const;
-
-    private:
-        std::string mType;
-        std::string mSubType;
-    };
-
-    class DnsServiceName
-    {
-    public:
-        DnsServiceName(std::string aInstance, std::string aType)
-            : mInstance(std::move(aInstance))
-            , mType(std::move(aType))
-        {
-        }
-
-        bool operator==(const DnsServiceName &aOther) const
-        {
-            return (mInstance == aOther.mInstance) && (mType == aOther.mType);
-        }
-
-        bool operator<(const DnsServiceName &aOther) const
-        {
-            return (mInstance == aOther.mInstance) ? (mType < aOther.mType) : (mInstance < aOther.mInstance);
-        }
-
-    private:
-        DnsName mInstance;
-        DnsName mType;
-    };
-
     template <typename T> struct FirstFunctionArg;
 
     template <typename R, typename Arg, typename... Rest> struct FirstFunctionArg<std::function<R(Arg, Rest...)>>
@@ -319,6 +255,9 @@ private:
     };
 
     // RequestType MUST be a std::pair<uint64_t, std::unique_ptr<CallbackType>>
+    //
+    // The entries are kept in the order they were added and indexed by their infra-if index and callback, so that
+    // finding, adding and removing an entry takes O(1).
     template <typename RequestType> class EntryList
     {
     public:
@@ -326,47 +265,65 @@ private:
         using CallbackPtrType    = std::unique_ptr<CallbackType>;
         using CallbackResultType = typename CallbackType::ResultType;
 
-        bool HasSubscribedOnInfraIf(uint64_t aInfraIfIndex)
+        bool HasSubscribedOnInfraIf(uint64_t aInfraIfIndex) const
         {
-            return std::find_if(mEntries.begin(), mEntries.end(), [aInfraIfIndex](const RequestType &entry) {
-                       return entry.first == aInfraIfIndex;
-                   }) != mEntries.end();
+            return mInfraIfRefs.find(aInfraIfIndex) != mInfraIfRefs.end();
         }
 
         void AddIfAbsent(uint64_t aInfraIfIndex, CallbackPtrType &&aCallbackPtr)
         {
-            auto iter = FindEntry(aInfraIfIndex, *aCallbackPtr);
-            if (iter == mEntries.end())
+            EntryKey key{aInfraIfIndex, aCallbackPtr.get()};
+
+            if (mIndex.find(key) == mIndex.end())
             {
                 mEntries.emplace_back(aInfraIfIndex, std::move(aCallbackPtr));
+                mIndex.emplace(key, std::prev(mEntries.end()));
+                mInfraIfRefs[aInfraIfIndex]++;
             }
         }
 
-        void MarkAsDeleted(uint64_t aInfraIfIndex, const CallbackType &aCallback)
+        // While the callbacks are being invoked, the entry is only marked as deleted and is erased later by
+        // `CleanUpDeletedEntries()`.
+        void Remove(uint64_t aInfraIfIndex, const CallbackType &aCallback, bool aIsInvokingCallbacks)
         {
-            auto iter = FindEntry(aInfraIfIndex, aCallback);
-            if (iter != mEntries.end())
+            auto indexIter = mIndex.find(EntryKey{aInfraIfIndex, &aCallback});
+
+            if (indexIter != mIndex.end())
             {
-                iter->second = nullptr;
+                IteratorType iter = indexIter->second;
+                auto         refs = mInfraIfRefs.find(aInfraIfIndex);
+
+                mIndex.erase(indexIter);
+
+                if (--refs->second == 0)
+                {
+                    mInfraIfRefs.erase(refs);
+                }
+
+                if (aIsInvokingCallbacks)
+                {
+                    iter->second = nullptr;
+                    mNumDeletedEntries++;
+                }
+                else
+                {
+                    mEntries.erase(iter);
+                }
             }
         }
 
-        bool IsEmpty(void) { return mEntries.empty(); }
+        bool IsEmpty(void) const { return mEntries.empty(); }
 
-        bool HasAnyValidCallbacks(void)
-        {
-            auto iter = std::find_if(mEntries.begin(), mEntries.end(),
-                                     [](const RequestType &entry) { return entry.second != nullptr; });
-            return iter != mEntries.end();
-        }
+        bool HasAnyValidCallbacks(void) const { return !mIndex.empty(); }
 
         void CleanUpDeletedEntries(void)
         {
-            for (auto iter = mEntries.begin(); iter != mEntries.end();)
+            for (auto iter = mEntries.begin(); mNumDeletedEntries > 0 && iter != mEntries.end();)
             {
                 if (!iter->second)
                 {
                     iter = mEntries.erase(iter);
+                    mNumDeletedEntries--;
                 }
                 else
                 {
@@ -387,24 +344,50 @@ private:
         }
 
     private:
-        using IteratorType = typename std::vector<RequestType>::iterator;
+        using IteratorType = typename std::list<RequestType>::iterator;
 
-        IteratorType FindEntry(uint64_t aInfraIfIndex, const CallbackType &aCallback)
+        struct EntryKey
         {
-            return std::find_if(mEntries.begin(), mEntries.end(),
-                                [aInfraIfIndex, &aCallback](const RequestType &entry) {
-                                    return entry.first == aInfraIfIndex && *entry.second == aCallback;
-                                });
-        }
-        std::vector<RequestType> mEntries;
+            uint64_t            mInfraIfIndex;
+            const CallbackType *mCallback;
+        };
+
+        struct EntryKeyHash
+        {
+            size_t operator()(const EntryKey &aKey) const
+            {
+                return std::hash<uint64_t>()(aKey.mInfraIfIndex) ^ aKey.mCallback->GetHash();
+            }
+        };
+
+        struct EntryKeyEqual
+        {
+            bool operator()(const EntryKey &aKey1, const EntryKey &aKey2) const
+            {
+                return aKey1.mInfraIfIndex == aKey2.mInfraIfIndex && *aKey1.mCallback == *aKey2.mCallback;
+            }
+        };
+
+        std::list<RequestType>                                                  mEntries;
+        std::unordered_map<EntryKey, IteratorType, EntryKeyHash, EntryKeyEqual> mIndex;
+        std::unordered_map<uint64_t, uint32_t>                                  mInfraIfRefs;
+        uint32_t                                                                mNumDeletedEntries = 0;
     };
 
+    // Keyed by the lowercase DNS name, see `MakeNameKey()`.
+    template <typename RequestType> using EntryListMap = std::unordered_map<std::string, EntryList<RequestType>>;
+
     void HandleMdnsState(Mdns::Publisher::State aState) override;
 
     void                            UpdateState(void);
     Mdns::Publisher::ResultCallback MakePublisherCallback(RequestId aRequestId, RegisterCallback aCallback);
 
     static std::string KeyNameFor(const Key &aKey);
+    static std::string FullServiceTypeFor(const char *aType, const char *aSubTypeLabel);
+    const std::string &MakeNameKey(const char *aLabels,
+                                   const char *aMoreLabels = nullptr,
+                                   const char *aLastLabels = nullptr);
+    const std::string &BrowserNameKey(const Browser &aBrowser);
 
     static void HandleDiscoveredService(const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfo &aInfo);
     static void HandleDiscoveredHost(const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aInfo);
@@ -412,33 +395,34 @@ private:
     void ProcessServiceBrowsers(const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfo &aInfo);
     void ProcessServiceResolvers(const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfo &aInfo);
     void ProcessTxtResolvers(const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfo &aInfo);
-    void ProcessAddrResolvers(const std::string                          &aHostName,
-                              const Mdns::Publisher::DiscoveredHostInfo  &aInfo,
-                              std::map<DnsName, EntryList<AddressEntry>> &aResolversMap);
+    void ProcessAddrResolvers(const std::string                         &aHostName,
+                              const Mdns::Publisher::DiscoveredHostInfo &aInfo,
+                              EntryListMap<AddressEntry>                &aResolversMap);
     void ProcessIp6AddrResolvers(const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aInfo);
     void ProcessIp4AddrResolvers(const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aInfo);
 
-    void StartAddressResolver(const AddressResolver                      &aAddressResolver,
-                              AddressCallbackPtr                          aCallbackPtr,
-                              std::map<DnsName, EntryList<AddressEntry>> &aResolversMap);
-    void StopAddressResolver(const AddressResolver                      &aAddressResolver,
-                             const AddressCallback                      &aCallback,
-                             std::map<DnsName, EntryList<AddressEntry>> &aResolversMap);
+    void StartAddressResolver(const AddressResolver      &aAddressResolver,
+                              AddressCallbackPtr          aCallbackPtr,
+                              EntryListMap<AddressEntry> &aResolversMap);
+    void StopAddressResolver(const AddressResolver      &aAddressResolver,
+                             const AddressCallback      &aCallback,
+                             EntryListMap<AddressEntry> &aResolversMap);
 
     static DnssdPlatform *sDnssdPlatform;
 
-    Mdns::Publisher                                 &mPublisher;
-    State                                            mState;
-    bool                                             mRunning;
-    bool                                             mInvokingCallbacks;
-    Mdns::Publisher::State                           mPublisherState;
-    DnssdStateChangeCallback                         mStateChangeCallback;
-    uint64_t                                         mSubscriberId;
-    std::map<DnsServiceType, EntryList<BrowseEntry>> mServiceBrowsersMap;
-    std::map<DnsServiceName, EntryList<SrvEntry>>    mServiceResolversMap;
-    std::map<DnsServiceName, EntryList<TxtEntry>>    mTxtResolversMap;
-    std::map<DnsName, EntryList<AddressEntry>>       mIp6AddrResolversMap;
-    std::map<DnsName, EntryList<AddressEntry>>       mIp4AddrResolversMap;
+    Mdns::Publisher           &mPublisher;
+    State                      mState;
+    bool                       mRunning;
+    bool                       mInvokingCallbacks;
+    Mdns::Publisher::State     mPublisherState;
+    DnssdStateChangeCallback   mStateChangeCallback;
+    uint64_t                   mSubscriberId;
+    EntryListMap<BrowseEntry>  mServiceBrowsersMap;
+    EntryListMap<SrvEntry>     mServiceResolversMap;
+    EntryListMap<TxtEntry>     mTxtResolversMap;
+    EntryListMap<AddressEntry> mIp6AddrResolversMap;
+    EntryListMap<AddressEntry> mIp4AddrResolversMap;
+    std::string                mNameKey; // Reused by `MakeNameKey()` so that lookups do not allocate.
 };
 
 } // namespace otbr
@@ -52,6 +52,13 @@
 
 namespace otbr {
 
+uint8_t *Netif::Dependencies::Ip6GetSendBuffer(uint16_t &aCapacity)
+{
+    aCapacity = 0;
+
+    return nullptr;
+}
+
 otbrError Netif::Dependencies::Ip6Send(const uint8_t *aData, uint16_t aLength)
 {
     OTBR_UNUSED_VARIABLE(aData);
@@ -97,7 +104,8 @@ enum
 };
 
 Netif::Netif(const std::string &aInterfaceName, Dependencies &aDependencies)
-    : mTunFd(-1)
+    : MainloopProcessor(Registration::kPersistent)
+    , mTunFd(-1)
     , mIpFd(-1)
     , mNetlinkFd(-1)
     , mMldFd(-1)
@@ -105,6 +113,8 @@ Netif::Netif(const std::string &aInterfaceName, Dependencies &aDependencies)
     , mNetifIndex(0)
     , mNetifName(aInterfaceName)
     , mDeps(aDependencies)
+    , mPacketRing(kMaxPacketsPerWakeup)
+    , mTunCounters()
 {
 }
 
@@ -125,6 +135,9 @@ otbrError Netif::Init(void)
 
     PlatformSpecificInit();
 
+    RegisterFd(mTunFd, kEventReadable | kEventError);
+    RegisterFd(mMldFd, kEventReadable | kEventError);
+
 exit:
     if (error != OTBR_ERROR_NONE)
     {
@@ -260,32 +273,97 @@ void Netif::Ip6Receive(const uint8_t *aBuf, uint16_t aLen)
     VerifyOrExit(aLen <= kIp6Mtu, error = OTBR_ERROR_DROPPED);
     VerifyOrExit(mTunFd > 0, error = OTBR_ERROR_INVALID_STATE);
 
-    otbrLogInfo("Packet from NCP (%u bytes)", aLen);
+    otbrLogDebug("Packet from NCP (%u bytes)", aLen);
     VerifyOrExit(write(mTunFd, aBuf, aLen) == aLen, error = OTBR_ERROR_ERRNO);
+    mTunCounters.mPacketsWritten++;
 
 exit:
     if (error != OTBR_ERROR_NONE)
     {
+        mTunCounters.mPacketsWriteFailed++;
         otbrLogWarning("Failed to receive, error:%s", otbrErrorString(error));
     }
 }
 
 void Netif::ProcessIp6Send(void)
 {
-    ssize_t   rval;
-    uint8_t   packet[kIp6Mtu];
-    otbrError error = OTBR_ERROR_NONE;
+    uint32_t count     = 0;
+    int      readErrno = 0;
+
+    // Drain up to `kMaxPacketsPerWakeup` packets, the TUN device is non-blocking so the loop ends with EAGAIN
+    // once its queue is empty. When the dependencies provide a send buffer (e.g. the NCP spinel frame), each
+    // packet is read straight into it and sent right away. Otherwise the burst is first pulled out of the
+    // kernel into the packet ring and then handed over.
+    while (count < kMaxPacketsPerWakeup)
+    {
+        uint16_t capacity;
+        uint8_t *buffer = mDeps.Ip6GetSendBuffer(capacity);
+        ssize_t  rval;
 
-    rval = read(mTunFd, packet, sizeof(packet));
-    VerifyOrExit(rval > 0, error = OTBR_ERROR_ERRNO);
+        if (buffer == nullptr)
+        {
+            buffer   = mPacketRing[count].mData;
+            capacity = kIp6Mtu;
+        }
+
+        rval = read(mTunFd, buffer, std::min<size_t>(capacity, kIp6Mtu));
 
-    otbrLogInfo("Send packet (%hu bytes)", static_cast<uint16_t>(rval));
+        if (rval <= 0)
+        {
+            readErrno = (rval < 0) ? errno : 0;
+            break;
+        }
+
+        if (buffer == mPacketRing[count].mData)
+        {
+            mPacketRing[count].mLength = static_cast<uint16_t>(rval);
+        }
+        else
+        {
+            mPacketRing[count].mLength = 0;
+            SendIp6Packet(buffer, static_cast<uint16_t>(rval));
+        }
+
+        count++;
+    }
+
+    if (readErrno != 0 && readErrno != EAGAIN && readErrno != EWOULDBLOCK && readErrno != EINTR)
+    {
+        otbrLogInfo("Error reading from Tun Fd: %s", strerror(readErrno));
+    }
+
+    VerifyOrExit(count > 0);
+
+    mTunCounters.mReadWakeups++;
+    mTunCounters.mPacketsRead += count;
+    mTunCounters.mMaxPacketsPerWakeup = std::max(mTunCounters.mMaxPacketsPerWakeup, count);
+
+    if (count == kMaxPacketsPerWakeup)
+    {
+        mTunCounters.mFullBatches++;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (mPacketRing[i].mLength > 0)
+        {
+            SendIp6Packet(mPacketRing[i].mData, mPacketRing[i].mLength);
+        }
+    }
 
-    error = mDeps.Ip6Send(packet, rval);
 exit:
-    if (error == OTBR_ERROR_ERRNO)
+    return;
+}
+
+void Netif::SendIp6Packet(const uint8_t *aData, uint16_t aLength)
+{
+    otbrError error = mDeps.Ip6Send(aData, aLength);
+
+    otbrLogDebug("Send packet (%hu bytes)", aLength);
+
+    if (error != OTBR_ERROR_NONE)
     {
-        otbrLogInfo("Error reading from Tun Fd: %s", strerror(errno));
+        otbrLogDebug("Failed to send packet: %s", otbrErrorString(error));
     }
 }
 
@@ -293,6 +371,7 @@ void Netif::Clear(void)
 {
     if (mTunFd != -1)
     {
+        UnregisterFd(mTunFd);
         close(mTunFd);
         mTunFd = -1;
     }
@@ -311,6 +390,7 @@ void Netif::Clear(void)
 
     if (mMldFd != -1)
     {
+        UnregisterFd(mMldFd);
         close(mMldFd);
         mMldFd = -1;
     }
@@ -463,38 +543,33 @@ exit:
     }
 }
 
-void Netif::Update(MainloopContext &aContext)
+void Netif::HandleFdEvent(int aFd, uint8_t aEvents)
 {
-    assert(mTunFd >= 0);
-    assert(mIpFd >= 0);
-    assert(mMldFd >= 0);
-
-    aContext.AddFdToSet(mTunFd, MainloopContext::kErrorFdSet | MainloopContext::kReadFdSet);
-    aContext.AddFdToSet(mMldFd, MainloopContext::kErrorFdSet | MainloopContext::kReadFdSet);
-}
-
-void Netif::Process(const MainloopContext &aContext)
-{
-    if (FD_ISSET(mTunFd, &aContext.mErrorFdSet))
+    if (aFd == mTunFd)
     {
-        close(mTunFd);
-        DieNow("Error on Tun Fd!");
-    }
+        if (aEvents & kEventError)
+        {
+            close(mTunFd);
+            DieNow("Error on Tun Fd!");
+        }
 
-    if (FD_ISSET(mMldFd, &aContext.mErrorFdSet))
-    {
-        close(mMldFd);
-        DieNow("Error on MLD Fd!");
+        if (aEvents & kEventReadable)
+        {
+            ProcessIp6Send();
+        }
     }
-
-    if (FD_ISSET(mTunFd, &aContext.mReadFdSet))
+    else if (aFd == mMldFd)
     {
-        ProcessIp6Send();
-    }
+        if (aEvents & kEventError)
+        {
+            close(mMldFd);
+            DieNow("Error on MLD Fd!");
+        }
 
-    if (FD_ISSET(mMldFd, &aContext.mReadFdSet))
-    {
-        ProcessMldEvent();
+        if (aEvents & kEventReadable)
+        {
+            ProcessMldEvent();
+        }
     }
 }
 
@@ -41,6 +41,8 @@
 
 #include <openthread/ip6.h>
 
+#include "openthread-br/config.h"
+
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
 #include "common/types.hpp"
@@ -55,10 +57,36 @@ public:
     public:
         virtual ~Dependencies(void) = default;
 
+        /**
+         * Returns a buffer the next IPv6 packet from the TUN device can be read into.
+         *
+         * A packet read into this buffer is passed to `Ip6Send()` in place, which lets the implementation
+         * skip copying it. The default implementation returns `nullptr`, in which case packets are read into
+         * buffers owned by `Netif`.
+         *
+         * @param[out] aCapacity  The size of the returned buffer in bytes.
+         *
+         * @returns A pointer to the buffer, or `nullptr` if there is none.
+         */
+        virtual uint8_t *Ip6GetSendBuffer(uint16_t &aCapacity);
+
         virtual otbrError Ip6Send(const uint8_t *aData, uint16_t aLength);
         virtual otbrError Ip6MulAddrUpdateSubscription(const otIp6Address &aAddress, bool aIsAdded);
     };
 
+    /**
+     * Counters of the IPv6 packets exchanged through the TUN device.
+     */
+    struct TunCounters
+    {
+        uint64_t mReadWakeups;         ///< Number of times the TUN device was drained after becoming readable.
+        uint64_t mPacketsRead;         ///< Number of packets read from the TUN device.
+        uint32_t mMaxPacketsPerWakeup; ///< Largest number of packets read in a single wakeup.
+        uint64_t mFullBatches;         ///< Number of wakeups that hit the batch limit and left packets queued.
+        uint64_t mPacketsWritten;      ///< Number of packets written to the TUN device.
+        uint64_t mPacketsWriteFailed;  ///< Number of packets that failed to be written to the TUN device.
+    };
+
     Netif(const std::string &aInterfaceName, Dependencies &aDependencies);
 
     otbrError Init(void);
@@ -72,9 +100,27 @@ public:
 
     unsigned int GetIfIndex(void) const { return mNetifIndex; }
 
+    /**
+     * Returns the TUN device packet counters.
+     *
+     * The average number of packets per wakeup is `mPacketsRead / mReadWakeups`.
+     *
+     * @returns A reference to the TUN device packet counters.
+     */
+    const TunCounters &GetTunCounters(void) const { return mTunCounters; }
+
 private:
     // TODO: Retrieve the Maximum Ip6 size from the coprocessor.
-    static constexpr size_t kIp6Mtu = 1280;
+    static constexpr size_t   kIp6Mtu              = 1280;
+    static constexpr uint32_t kMaxPacketsPerWakeup = OTBR_CONFIG_NETIF_MAX_PACKETS_PER_WAKEUP;
+
+    static_assert(kMaxPacketsPerWakeup > 0, "OTBR_CONFIG_NETIF_MAX_PACKETS_PER_WAKEUP must be positive");
+
+    struct PacketSlot
+    {
+        uint16_t mLength;
+        uint8_t  mData[kIp6Mtu];
+    };
 
     void Clear(void);
 
@@ -87,10 +133,10 @@ private:
     void      ProcessUnicastAddressChange(const Ip6AddressInfo &aAddressInfo, bool aIsAdded);
     otbrError ProcessMulticastAddressChange(const Ip6Address &aAddress, bool aIsAdded);
     void      ProcessIp6Send(void);
+    void      SendIp6Packet(const uint8_t *aData, uint16_t aLength);
     void      ProcessMldEvent(void);
 
-    void Update(MainloopContext &aContext) override;
-    void Process(const MainloopContext &aContext) override;
+    void HandleFdEvent(int aFd, uint8_t aEvents) override;
 
     int      mTunFd;           ///< Used to exchange IPv6 packets.
     int      mIpFd;            ///< Used to manage IPv6 stack on the network interface.
@@ -104,6 +150,9 @@ private:
     std::vector<Ip6AddressInfo> mIp6UnicastAddresses;
     std::vector<Ip6Address>     mIp6MulticastAddresses;
     Dependencies               &mDeps;
+
+    std::vector<PacketSlot> mPacketRing; ///< Reused receive buffers, used when `mDeps` has no send buffer.
+    TunCounters             mTunCounters;
 };
 
 } // namespace otbr
@@ -34,10 +34,12 @@
 
 #include "host/posix/udp_proxy.hpp"
 
+#include <algorithm>
+
 #include <assert.h>
 #include <errno.h>
 #include <netinet/in.h>
-#include <sys/select.h>
+#include <string.h>
 #include <unistd.h>
 
 #include "common/code_utils.hpp"
@@ -63,11 +65,36 @@ otbrError UdpProxy::Dependencies::UdpForward(const uint8_t      *aUdpPayload,
 }
 
 UdpProxy::UdpProxy(Dependencies &aDeps)
-    : mFd(-1)
+    : MainloopProcessor(Registration::kPersistent)
+    , mFd(-1)
     , mHostPort(0)
     , mThreadPort(0)
+    , mNumPendingSends(0)
     , mDeps(aDeps)
 {
+    for (uint16_t i = 0; i < kBatchSize; i++)
+    {
+        mReceiveBatch.Reset(i);
+        mSendBatch.Reset(i);
+    }
+}
+
+void UdpProxy::MessageBatch::Reset(uint16_t aIndex)
+{
+    struct msghdr &header = mHeaders[aIndex].msg_hdr;
+
+    mIovs[aIndex].iov_base = mPayloads[aIndex];
+    mIovs[aIndex].iov_len  = sizeof(mPayloads[aIndex]);
+
+    header.msg_name       = &mPeerAddrs[aIndex];
+    header.msg_namelen    = sizeof(mPeerAddrs[aIndex]);
+    header.msg_control    = mControls[aIndex];
+    header.msg_controllen = static_cast<decltype(header.msg_controllen)>(sizeof(mControls[aIndex]));
+    header.msg_iov        = &mIovs[aIndex];
+    header.msg_iovlen     = 1;
+    header.msg_flags      = 0;
+
+    mHeaders[aIndex].msg_len = 0;
 }
 
 void UdpProxy::Start(uint16_t aPort)
@@ -85,10 +112,12 @@ void UdpProxy::Stop(void)
 {
     VerifyOrExit(IsStarted());
 
+    FlushToPeers();
     mHostPort = 0;
 
     if (mFd >= 0)
     {
+        UnregisterFd(mFd);
         close(mFd);
         mFd = -1;
     }
@@ -97,33 +126,74 @@ exit:
     return;
 }
 
-void UdpProxy::Process(const MainloopContext &aContext)
+void UdpProxy::HandleFdEvent(int aFd, uint8_t aEvents)
 {
-    constexpr size_t kMaxUdpSize = 1280;
+    OTBR_UNUSED_VARIABLE(aFd);
 
-    uint8_t      payload[kMaxUdpSize];
-    uint16_t     length = sizeof(payload);
-    otIp6Address remoteAddr;
-    uint16_t     remotePort;
+    if (aEvents & kEventWritable)
+    {
+        FlushToPeers();
+    }
+
+    if (aEvents & kEventReadable)
+    {
+        ReceiveFromPeers();
+    }
+}
+
+void UdpProxy::ReceiveFromPeers(void)
+{
+    uint16_t budget = OTBR_CONFIG_UDP_PROXY_MAX_PACKETS_PER_WAKEUP;
 
     VerifyOrExit(mFd != -1 && IsStarted());
-    VerifyOrExit(FD_ISSET(mFd, &aContext.mReadFdSet));
 
-    SuccessOrExit(ReceivePacket(payload, length, remoteAddr, remotePort));
+    // Bound the datagrams received per wakeup so that a burst cannot starve the other main loop processors.
+    while (budget > 0 && IsStarted())
+    {
+        uint16_t count = std::min(budget, kBatchSize);
+        int      received;
 
-    // UDP Forward to NCPq
-    mDeps.UdpForward(payload, length, remoteAddr, remotePort, *this);
+        for (uint16_t i = 0; i < count; i++)
+        {
+            mReceiveBatch.Reset(i);
+        }
 
-exit:
-    return;
-}
+        received = ReceiveMessages(mReceiveBatch.mHeaders, count);
 
-void UdpProxy::Update(MainloopContext &aContext)
-{
-    VerifyOrExit(mFd != -1);
-    VerifyOrExit(IsStarted());
+        if (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+            otbrLogWarning("Failed to recvmsg: %s", strerror(errno));
+        }
+
+        if (received <= 0)
+        {
+            break;
+        }
+
+        for (int i = 0; i < received; i++)
+        {
+            const struct sockaddr_in6 &peerAddr = mReceiveBatch.mPeerAddrs[i];
+            otIp6Address               remoteAddr;
+            uint16_t                   remotePort = ntohs(peerAddr.sin6_port);
 
-    aContext.AddFdToReadSet(mFd);
+            memcpy(&remoteAddr, &peerAddr.sin6_addr, sizeof(otIp6Address));
+
+            otbrLogDebug("Receive a packet, remote address:%s, remote port:%d",
+                         Ip6Address(remoteAddr).ToString().c_str(), remotePort);
+
+            // UDP Forward to NCP
+            mDeps.UdpForward(mReceiveBatch.mPayloads[i], static_cast<uint16_t>(mReceiveBatch.mHeaders[i].msg_len),
+                             remoteAddr, remotePort, *this);
+        }
+
+        budget -= static_cast<uint16_t>(received);
+
+        if (received < count)
+        {
+            // The socket has no more pending datagrams.
+            break;
+        }
+    }
 
 exit:
     return;
@@ -134,64 +204,151 @@ void UdpProxy::SendToPeer(const uint8_t      *aUdpPayload,
                           const otIp6Address &aPeerAddr,
                           uint16_t            aPeerPort)
 {
-#ifdef __APPLE__
-    // use fixed value for CMSG_SPACE is not a constant expression on macOS
-    constexpr size_t kBufferSize = 128;
-#else
-    constexpr size_t kBufferSize = CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int));
-#endif
-    struct sockaddr_in6 peerAddr;
-    uint8_t             control[kBufferSize];
-    size_t              controlLength = 0;
-    struct iovec        iov;
-    struct msghdr       msg;
-    struct cmsghdr     *cmsg;
-    ssize_t             rval;
-
-    memset(&peerAddr, 0, sizeof(peerAddr));
-    peerAddr.sin6_port   = htons(aPeerPort);
-    peerAddr.sin6_family = AF_INET6;
-    memcpy(&peerAddr.sin6_addr, &aPeerAddr, sizeof(aPeerAddr));
-    memset(control, 0, sizeof(control));
-
-    iov.iov_base = reinterpret_cast<void *>(const_cast<uint8_t *>(aUdpPayload));
-    iov.iov_len  = aLength;
-
-    msg.msg_name       = &peerAddr;
-    msg.msg_namelen    = sizeof(peerAddr);
-    msg.msg_control    = control;
-    msg.msg_controllen = static_cast<decltype(msg.msg_controllen)>(sizeof(control));
-    msg.msg_iov        = &iov;
-    msg.msg_iovlen     = 1;
-    msg.msg_flags      = 0;
+    constexpr int kIp6HopLimit = 64;
+
+    bool                 isOversized = (aLength > kMaxUdpSize);
+    uint16_t             index;
+    struct sockaddr_in6 *peerAddr;
+    struct msghdr       *msg;
+    struct cmsghdr      *cmsg;
+    int                  hopLimit = kIp6HopLimit;
 
+    VerifyOrExit(mFd != -1 && IsStarted(), otbrLogWarning("Failed to sendmsg: UDP Proxy is not started"));
+
+    if (isOversized)
     {
-        constexpr int kIp6HopLimit = 64;
+        // Sent right away from the caller's buffer, after the queued datagrams to keep their order.
+        FlushToPeers();
+    }
 
-        int hopLimit = kIp6HopLimit;
+    if (mNumPendingSends == 0)
+    {
+        // The queued datagrams are sent once the mainloop reports the socket writable, which happens
+        // after the current processing and lets the datagrams queued meanwhile share the same batch.
+        ModifyFd(mFd, kEventReadable | kEventWritable);
+    }
 
-        cmsg             = CMSG_FIRSTHDR(&msg);
-        cmsg->cmsg_level = IPPROTO_IPV6;
-        cmsg->cmsg_type  = IPV6_HOPLIMIT;
-        cmsg->cmsg_len   = CMSG_LEN(sizeof(int));
+    index = mNumPendingSends++;
+    mSendBatch.Reset(index);
 
-        memcpy(CMSG_DATA(cmsg), &hopLimit, sizeof(int));
+    peerAddr = &mSendBatch.mPeerAddrs[index];
+    memset(peerAddr, 0, sizeof(*peerAddr));
+    peerAddr->sin6_port   = htons(aPeerPort);
+    peerAddr->sin6_family = AF_INET6;
+    memcpy(&peerAddr->sin6_addr, &aPeerAddr, sizeof(aPeerAddr));
 
-        controlLength += CMSG_SPACE(sizeof(int));
+    if (isOversized)
+    {
+        mSendBatch.mIovs[index].iov_base = reinterpret_cast<void *>(const_cast<uint8_t *>(aUdpPayload));
+    }
+    else
+    {
+        memcpy(mSendBatch.mPayloads[index], aUdpPayload, aLength);
     }
 
-#ifdef __APPLE__
-    msg.msg_controllen = static_cast<socklen_t>(controlLength);
+    mSendBatch.mIovs[index].iov_len = aLength;
+
+    msg = &mSendBatch.mHeaders[index].msg_hdr;
+    memset(mSendBatch.mControls[index], 0, kControlSize);
+
+    cmsg             = CMSG_FIRSTHDR(msg);
+    cmsg->cmsg_level = IPPROTO_IPV6;
+    cmsg->cmsg_type  = IPV6_HOPLIMIT;
+    cmsg->cmsg_len   = CMSG_LEN(sizeof(int));
+
+    memcpy(CMSG_DATA(cmsg), &hopLimit, sizeof(int));
+
+    msg->msg_controllen = static_cast<decltype(msg->msg_controllen)>(CMSG_SPACE(sizeof(int)));
+
+    if (isOversized || mNumPendingSends == kBatchSize)
+    {
+        FlushToPeers();
+    }
+
+exit:
+    return;
+}
+
+void UdpProxy::FlushToPeers(void)
+{
+    uint16_t sent = 0;
+
+    VerifyOrExit(mNumPendingSends > 0);
+
+    while (sent < mNumPendingSends)
+    {
+        int rval = SendMessages(&mSendBatch.mHeaders[sent], mNumPendingSends - sent);
+
+        if (rval > 0)
+        {
+            sent += static_cast<uint16_t>(rval);
+            continue;
+        }
+
+        otbrLogWarning("Failed to sendmsg: %s", strerror(errno));
+
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            otbrLogWarning("Dropped %u datagrams to peers", mNumPendingSends - sent);
+            break;
+        }
+
+        // Skip the datagram which failed, the following ones may go to other peers.
+        sent++;
+    }
+
+    mNumPendingSends = 0;
+    ModifyFd(mFd, kEventReadable);
+
+exit:
+    return;
+}
+
+int UdpProxy::ReceiveMessages(MessageHeader *aMessages, uint16_t aCount)
+{
+#ifdef __linux__
+    return recvmmsg(mFd, aMessages, aCount, 0, nullptr);
 #else
-    msg.msg_controllen = controlLength;
+    int count = 0;
+
+    // Datagrams are received until the queue is drained, the call which finds it empty must not block.
+    for (; count < aCount; count++)
+    {
+        ssize_t rval = recvmsg(mFd, &aMessages[count].msg_hdr, MSG_DONTWAIT);
+
+        if (rval < 0)
+        {
+            break;
+        }
+
+        aMessages[count].msg_len = static_cast<unsigned int>(rval);
+    }
+
+    return (count > 0) ? count : -1;
 #endif
+}
 
-    rval = sendmsg(mFd, &msg, 0);
+int UdpProxy::SendMessages(MessageHeader *aMessages, uint16_t aCount)
+{
+#ifdef __linux__
+    return sendmmsg(mFd, aMessages, aCount, 0);
+#else
+    int count = 0;
 
-    if (rval == -1)
+    for (; count < aCount; count++)
     {
-        otbrLogWarning("Failed to sendmsg: %s", strerror(errno));
+        ssize_t rval = sendmsg(mFd, &aMessages[count].msg_hdr, MSG_DONTWAIT);
+
+        if (rval < 0)
+        {
+            break;
+        }
+
+        aMessages[count].msg_len = static_cast<unsigned int>(rval);
     }
+
+    return (count > 0) ? count : -1;
+#endif
 }
 
 otbrError UdpProxy::BindToEphemeralPort(void)
@@ -228,6 +385,8 @@ otbrError UdpProxy::BindToEphemeralPort(void)
         otbrLogInfo("Ephemeral port: %u", mHostPort);
     }
 
+    RegisterFd(mFd, kEventReadable);
+
 exit:
     otbrLogResult(error, "Bind to ephemeral port");
     if (error != OTBR_ERROR_NONE)
@@ -237,42 +396,4 @@ exit:
     return error;
 }
 
-otbrError UdpProxy::ReceivePacket(uint8_t      *aPayload,
-                                  uint16_t     &aLength,
-                                  otIp6Address &aRemoteAddr,
-                                  uint16_t     &aRemotePort)
-{
-    constexpr size_t kMaxUdpSize = 1280;
-
-    struct sockaddr_in6 peerAddr;
-    uint8_t             control[kMaxUdpSize];
-    struct iovec        iov;
-    struct msghdr       msg;
-    ssize_t             rval;
-
-    iov.iov_base = aPayload;
-    iov.iov_len  = aLength;
-
-    msg.msg_name       = &peerAddr;
-    msg.msg_namelen    = sizeof(peerAddr);
-    msg.msg_control    = control;
-    msg.msg_controllen = sizeof(control);
-    msg.msg_iov        = &iov;
-    msg.msg_iovlen     = 1;
-    msg.msg_flags      = 0;
-
-    rval = recvmsg(mFd, &msg, 0);
-    VerifyOrExit(rval > 0, perror("recvmsg"));
-    aLength = static_cast<uint16_t>(rval);
-
-    aRemotePort = ntohs(peerAddr.sin6_port);
-    memcpy(&aRemoteAddr, &peerAddr.sin6_addr, sizeof(otIp6Address));
-
-    otbrLogDebug("Receive a packet, remote address:%s, remote port:%d", Ip6Address(aRemoteAddr).ToString().c_str(),
-                 aRemotePort);
-
-exit:
-    return rval > 0 ? OTBR_ERROR_NONE : OTBR_ERROR_ERRNO;
-}
-
 } // namespace otbr
@@ -34,6 +34,12 @@
 #ifndef OTBR_AGENT_POSIX_UDP_PROXY_HPP_
 #define OTBR_AGENT_POSIX_UDP_PROXY_HPP_
 
+#include "openthread-br/config.h"
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
 #include <openthread/error.h>
 #include <openthread/ip6.h>
 
@@ -95,6 +101,8 @@ public:
     /**
      * Sends a UDP packet to the peer.
      *
+     * The packet is queued and sent together with the other packets queued during the same main loop iteration.
+     *
      * @param[in] aUdpPlayload  The UDP payload.
      * @param[in] aLength       Then length of the UDP payload.
      * @param[in] aPeerAddr     The address of the peer.
@@ -103,17 +111,56 @@ public:
     void SendToPeer(const uint8_t *aUdpPayload, uint16_t aLength, const otIp6Address &aPeerAddr, uint16_t aPeerPort);
 
 private:
+    static constexpr size_t   kMaxUdpSize = 1280;
+    static constexpr uint16_t kBatchSize  = OTBR_CONFIG_UDP_PROXY_BATCH_SIZE;
+#ifdef __APPLE__
+    // use fixed value for CMSG_SPACE is not a constant expression on macOS
+    static constexpr size_t kControlSize = 128;
+#else
+    static constexpr size_t kControlSize = CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int));
+#endif
+
+#ifdef __linux__
+    typedef struct mmsghdr MessageHeader;
+#else
+    struct MessageHeader
+    {
+        struct msghdr msg_hdr;
+        unsigned int  msg_len;
+    };
+#endif
+
+    /**
+     * A batch of preallocated messages, each with its own payload, peer address and control buffer.
+     */
+    struct MessageBatch
+    {
+        void Reset(uint16_t aIndex);
+
+        MessageHeader       mHeaders[kBatchSize];
+        struct iovec        mIovs[kBatchSize];
+        struct sockaddr_in6 mPeerAddrs[kBatchSize];
+        uint8_t             mControls[kBatchSize][kControlSize];
+        uint8_t             mPayloads[kBatchSize][kMaxUdpSize];
+    };
+
     // MainloopProcessor methods
-    void Process(const MainloopContext &aMainloop) override;
-    void Update(MainloopContext &aMainloop) override;
+    void HandleFdEvent(int aFd, uint8_t aEvents) override;
 
     bool      IsStarted(void) const { return mHostPort != 0; }
     otbrError BindToEphemeralPort(void);
-    otbrError ReceivePacket(uint8_t *aPayload, uint16_t &aLength, otIp6Address &aRemoteAddr, uint16_t &aRemotePort);
+    int       ReceiveMessages(MessageHeader *aMessages, uint16_t aCount);
+    int       SendMessages(MessageHeader *aMessages, uint16_t aCount);
+    void      ReceiveFromPeers(void);
+    void      FlushToPeers(void);
 
     int      mFd; ///< Used to proxy UDP packets in Thread network.
     uint16_t mHostPort;
     uint16_t mThreadPort;
+    uint16_t mNumPendingSends;
+
+    MessageBatch mReceiveBatch;
+    MessageBatch mSendBatch;
 
     Dependencies &mDeps;
 };
@@ -0,0 +1,77 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "host/spinel_ip6_frame.hpp"
+
+#include <string.h>
+
+#include "lib/spinel/spinel.h"
+
+namespace otbr {
+namespace Host {
+
+static constexpr char kSpinelIp6FramePackFormat[] = "CiiS";
+
+otError SpinelIp6Frame::SetPayload(const uint8_t *aData, uint16_t aLength)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(aLength <= kMaxPayloadLength, error = OT_ERROR_INVALID_ARGS);
+
+    if (!IsPayload(aData))
+    {
+        memcpy(GetPayload(), aData, aLength);
+    }
+
+exit:
+    return error;
+}
+
+otError SpinelIp6Frame::Finalize(uint8_t aHeader, uint16_t aLength, const uint8_t *&aFrame, uint16_t &aFrameLength)
+{
+    otError        error = OT_ERROR_NONE;
+    uint8_t        prefix[kHeadroom];
+    spinel_ssize_t prefixLength;
+
+    VerifyOrExit(aLength <= kMaxPayloadLength, error = OT_ERROR_INVALID_ARGS);
+
+    prefixLength = spinel_datatype_pack(prefix, sizeof(prefix), kSpinelIp6FramePackFormat, aHeader,
+                                        SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_STREAM_NET, aLength);
+    VerifyOrExit(prefixLength > 0 && prefixLength <= static_cast<spinel_ssize_t>(kHeadroom), error = OT_ERROR_NO_BUFS);
+
+    memcpy(&mBuffer[kHeadroom - prefixLength], prefix, static_cast<size_t>(prefixLength));
+
+    aFrame       = &mBuffer[kHeadroom - prefixLength];
+    aFrameLength = static_cast<uint16_t>(prefixLength + aLength);
+
+exit:
+    return error;
+}
+
+} // namespace Host
+} // namespace otbr
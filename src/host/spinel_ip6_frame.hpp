@@ -0,0 +1,112 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the spinel frame used to send IPv6 packets to the NCP.
+ */
+
+#ifndef OTBR_AGENT_SPINEL_IP6_FRAME_HPP_
+#define OTBR_AGENT_SPINEL_IP6_FRAME_HPP_
+
+#include <stdint.h>
+
+#include <openthread/error.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace Host {
+
+/**
+ * This class implements a `SPINEL_PROP_STREAM_NET` frame that an IPv6 packet can be written into in place.
+ *
+ * The packet is stored right after a headroom that is large enough for the spinel header, the command, the
+ * property key and the length prefix. They are filled in by `Finalize()` right before the frame is sent, so a
+ * packet read directly into `GetPayload()` reaches the spinel interface without being copied.
+ */
+class SpinelIp6Frame : private NonCopyable
+{
+public:
+    static constexpr uint16_t kMaxPayloadLength = 1280; ///< The maximum length of an IPv6 packet.
+
+    /**
+     * Returns the buffer the IPv6 packet should be written into.
+     *
+     * @returns A pointer to a buffer of `kMaxPayloadLength` bytes.
+     */
+    uint8_t *GetPayload(void) { return &mBuffer[kHeadroom]; }
+
+    /**
+     * Indicates whether a given pointer is the start of the payload buffer.
+     *
+     * @param[in] aData  A pointer to the data.
+     *
+     * @retval TRUE   @p aData points to the payload buffer, so the packet is already in place.
+     * @retval FALSE  @p aData points to some other buffer.
+     */
+    bool IsPayload(const uint8_t *aData) const { return aData == &mBuffer[kHeadroom]; }
+
+    /**
+     * Sets the IPv6 packet of the frame.
+     *
+     * The packet is copied into the payload buffer unless it was written there in place.
+     *
+     * @param[in] aData    A pointer to the IPv6 packet.
+     * @param[in] aLength  The length of the IPv6 packet.
+     *
+     * @retval OT_ERROR_NONE          Successfully set the packet.
+     * @retval OT_ERROR_INVALID_ARGS  The packet is longer than `kMaxPayloadLength`.
+     */
+    otError SetPayload(const uint8_t *aData, uint16_t aLength);
+
+    /**
+     * Writes the spinel header, command, property key and length in front of the payload.
+     *
+     * @param[in]  aHeader       The spinel header byte.
+     * @param[in]  aLength       The length of the IPv6 packet in the payload buffer.
+     * @param[out] aFrame        A reference to the start of the resulting spinel frame.
+     * @param[out] aFrameLength  A reference to the length of the resulting spinel frame.
+     *
+     * @retval OT_ERROR_NONE          Successfully built the frame.
+     * @retval OT_ERROR_INVALID_ARGS  @p aLength is longer than `kMaxPayloadLength`.
+     * @retval OT_ERROR_NO_BUFS       The spinel prefix does not fit in the headroom.
+     */
+    otError Finalize(uint8_t aHeader, uint16_t aLength, const uint8_t *&aFrame, uint16_t &aFrameLength);
+
+private:
+    // Header (1) + command (up to 3) + property key (up to 3) + length (2), rounded up.
+    static constexpr uint16_t kHeadroom = 12;
+
+    uint8_t mBuffer[kHeadroom + kMaxPayloadLength];
+};
+
+} // namespace Host
+} // namespace otbr
+
+#endif // OTBR_AGENT_SPINEL_IP6_FRAME_HPP_
@@ -0,0 +1,242 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the scheduler of the spinel transactions sent to the NCP.
+ */
+
+#define OTBR_LOG_TAG "NcpSpinel"
+
+#include "host/spinel_transactions.hpp"
+
+#include <algorithm>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace Host {
+
+constexpr uint8_t  SpinelTransactions::kMaxTids;
+constexpr uint16_t SpinelTransactions::kMaxPendingCommands;
+
+SpinelTransactions::SpinelTransactions(void)
+    : mTidsInUse(0)
+    , mNextTid(1)
+    , mDispatching(false)
+    , mMetrics()
+{
+    std::fill_n(mCmdTable, kMaxTids, SPINEL_CMD_NOOP);
+    std::fill_n(mWaitingKeyTable, kMaxTids, SPINEL_PROP_LAST_STATUS);
+}
+
+spinel_tid_t SpinelTransactions::AllocateTid(void)
+{
+    spinel_tid_t tid = mNextTid;
+
+    while (((1 << tid) & mTidsInUse) != 0)
+    {
+        tid = SPINEL_GET_NEXT_TID(tid);
+
+        if (tid == mNextTid)
+        {
+            // We looped back to `mNextTid` indicating that all
+            // TIDs are in-use.
+
+            ExitNow(tid = 0);
+        }
+    }
+
+    mTidsInUse |= (1 << tid);
+    mNextTid = SPINEL_GET_NEXT_TID(tid);
+
+exit:
+    return tid;
+}
+
+void SpinelTransactions::HandleSent(spinel_tid_t      aTid,
+                                    spinel_command_t  aCmd,
+                                    spinel_prop_key_t aKey,
+                                    Timepoint         aRequestTime)
+{
+    mCmdTable[aTid]        = aCmd;
+    mWaitingKeyTable[aTid] = aKey;
+    mRequestTimes[aTid]    = aRequestTime;
+    mMetrics.mSent++;
+}
+
+void SpinelTransactions::HandleResponse(spinel_tid_t aTid)
+{
+    if (mCmdTable[aTid] != SPINEL_CMD_NOOP)
+    {
+        Microseconds latency = std::chrono::duration_cast<Microseconds>(Clock::now() - mRequestTimes[aTid]);
+
+        mMetrics.mCompleted++;
+        mMetrics.mTotalLatency += latency;
+        mMetrics.mMaxLatency = std::max(mMetrics.mMaxLatency, latency);
+    }
+
+    Release(aTid);
+}
+
+void SpinelTransactions::Release(spinel_tid_t aTid)
+{
+    FreeTid(aTid);
+    DispatchPendingCommands();
+}
+
+otError SpinelTransactions::Enqueue(spinel_command_t  aCmd,
+                                    spinel_prop_key_t aKey,
+                                    const uint8_t    *aFrame,
+                                    uint16_t          aLength)
+{
+    otError error = OT_ERROR_NONE;
+
+    if (IsCoalescable(aCmd, aKey))
+    {
+        auto it = std::find_if(
+            mPendingCommands.begin(), mPendingCommands.end(),
+            [aCmd, aKey](const PendingCommand &aPending) { return aPending.mCmd == aCmd && aPending.mKey == aKey; });
+
+        if (it != mPendingCommands.end())
+        {
+            // Only the latest value of a state property matters, so send it in place of the queued one.
+            it->mFrame.assign(aFrame, aFrame + aLength);
+            mMetrics.mCoalesced++;
+            ExitNow();
+        }
+    }
+
+    if (mPendingCommands.size() >= kMaxPendingCommands)
+    {
+        mMetrics.mDropped++;
+        ExitNow(error = OT_ERROR_NO_BUFS);
+    }
+
+    mPendingCommands.push_back({aCmd, aKey, Clock::now(), std::vector<uint8_t>(aFrame, aFrame + aLength)});
+    mMetrics.mQueued++;
+    mMetrics.mMaxQueueDepth = std::max(mMetrics.mMaxQueueDepth, static_cast<uint32_t>(mPendingCommands.size()));
+
+exit:
+    return error;
+}
+
+void SpinelTransactions::Clear(void)
+{
+    mPendingCommands.clear();
+
+    for (spinel_tid_t tid = 0; tid < kMaxTids; tid++)
+    {
+        FreeTid(tid);
+    }
+}
+
+void SpinelTransactions::FreeTid(spinel_tid_t aTid)
+{
+    mTidsInUse &= ~(1 << aTid);
+
+    mCmdTable[aTid]        = SPINEL_CMD_NOOP;
+    mWaitingKeyTable[aTid] = SPINEL_PROP_LAST_STATUS;
+}
+
+void SpinelTransactions::DispatchPendingCommands(void)
+{
+    // The failure handler may release TIDs, the outer loop sends the remaining commands.
+    VerifyOrExit(!mDispatching);
+    mDispatching = true;
+
+    while (!mPendingCommands.empty())
+    {
+        spinel_tid_t   tid = AllocateTid();
+        PendingCommand command;
+        otError        error = OT_ERROR_INVALID_STATE;
+
+        if (tid == 0)
+        {
+            break;
+        }
+
+        // Take the command out of the queue first, the handlers may queue new commands.
+        command = std::move(mPendingCommands.front());
+        mPendingCommands.pop_front();
+
+        command.mFrame[0] = static_cast<uint8_t>((command.mFrame[0] & ~SPINEL_HEADER_TID_MASK) | tid);
+
+        if (mSendFrameHandler)
+        {
+            error = mSendFrameHandler(command.mFrame.data(), static_cast<uint16_t>(command.mFrame.size()));
+        }
+
+        if (error == OT_ERROR_NONE)
+        {
+            HandleSent(tid, command.mCmd, command.mKey, command.mRequestTime);
+            continue;
+        }
+
+        otbrLogWarning("Failed to send queued command (cmd:%u, key:%u): %s", command.mCmd, command.mKey,
+                       otThreadErrorToString(error));
+        FreeTid(tid);
+        mMetrics.mFailed++;
+
+        if (mFailureHandler)
+        {
+            mFailureHandler(command.mCmd, command.mKey, error);
+        }
+    }
+
+    mDispatching = false;
+
+exit:
+    return;
+}
+
+bool SpinelTransactions::IsCoalescable(spinel_command_t aCmd, spinel_prop_key_t aKey)
+{
+    bool coalescable = false;
+
+    VerifyOrExit(aCmd == SPINEL_CMD_PROP_VALUE_SET);
+
+    switch (aKey)
+    {
+    case SPINEL_PROP_BACKBONE_ROUTER_ENABLE:
+    case SPINEL_PROP_DNSSD_STATE:
+    case SPINEL_PROP_INFRA_IF_STATE:
+    case SPINEL_PROP_SRP_SERVER_AUTO_ENABLE_MODE:
+    case SPINEL_PROP_SRP_SERVER_ENABLED:
+        coalescable = true;
+        break;
+    default:
+        break;
+    }
+
+exit:
+    return coalescable;
+}
+
+} // namespace Host
+} // namespace otbr
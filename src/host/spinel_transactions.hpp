@@ -0,0 +1,230 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the scheduler of the spinel transactions sent to the NCP.
+ */
+
+#ifndef OTBR_AGENT_SPINEL_TRANSACTIONS_HPP_
+#define OTBR_AGENT_SPINEL_TRANSACTIONS_HPP_
+
+#include <stdint.h>
+
+#include <deque>
+#include <functional>
+#include <vector>
+
+#include <openthread/error.h>
+
+#include "lib/spinel/spinel.h"
+
+#include "common/code_utils.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+namespace Host {
+
+/**
+ * This class tracks the spinel transactions waiting for a response from the NCP.
+ *
+ * Each outstanding transaction holds one of the spinel TIDs. When all TIDs are in use, new commands are
+ * queued with their encoded frames and sent in request order as soon as a TID is released. Queued sets
+ * of state properties are coalesced so that only the latest value is sent.
+ */
+class SpinelTransactions : private NonCopyable
+{
+public:
+    /**
+     * Statistics of the spinel transactions sent to the NCP.
+     */
+    struct Metrics
+    {
+        uint32_t     mSent;          ///< Number of transactions sent to the NCP.
+        uint32_t     mQueued;        ///< Number of transactions queued because all TIDs were in use.
+        uint32_t     mCoalesced;     ///< Number of queued property sets superseded by a newer value.
+        uint32_t     mDropped;       ///< Number of transactions dropped because the queue was full.
+        uint32_t     mFailed;        ///< Number of queued transactions which failed to be sent.
+        uint32_t     mMaxQueueDepth; ///< Largest number of transactions waiting for a TID at the same time.
+        uint32_t     mCompleted;     ///< Number of transactions completed by a response from the NCP.
+        Microseconds mTotalLatency;  ///< Sum of the request-to-response latencies of completed transactions.
+        Microseconds mMaxLatency;    ///< Largest request-to-response latency of a completed transaction.
+    };
+
+    using SendFrameHandler = std::function<otError(const uint8_t *aFrame, uint16_t aLength)>;
+    using FailureHandler   = std::function<void(spinel_command_t aCmd, spinel_prop_key_t aKey, otError aError)>;
+
+    static constexpr uint8_t  kMaxTids            = 16;  ///< The number of spinel TIDs, TID 0 is never used.
+    static constexpr uint16_t kMaxPendingCommands = 128; ///< Maximum number of queued transactions.
+
+    /**
+     * Constructor.
+     */
+    SpinelTransactions(void);
+
+    /**
+     * Sets the handler which sends a queued frame to the NCP.
+     *
+     * @param[in] aHandler  The handler to send a frame.
+     */
+    void SetSendFrameHandler(SendFrameHandler aHandler) { mSendFrameHandler = std::move(aHandler); }
+
+    /**
+     * Sets the handler which is called when a queued frame failed to be sent.
+     *
+     * The requester of the command should be completed with the error, as no response will arrive.
+     *
+     * @param[in] aHandler  The handler to report a failed command.
+     */
+    void SetFailureHandler(FailureHandler aHandler) { mFailureHandler = std::move(aHandler); }
+
+    /**
+     * Allocates a TID for a transaction.
+     *
+     * @returns The allocated TID, or 0 if all TIDs are in use.
+     */
+    spinel_tid_t AllocateTid(void);
+
+    /**
+     * Allocates a TID for a new command, unless earlier commands are still queued.
+     *
+     * A command which gets no TID must be queued with `Enqueue()` so that commands are sent in request order.
+     *
+     * @returns The allocated TID, or 0 if all TIDs are in use or earlier commands are queued.
+     */
+    spinel_tid_t AllocateTidInOrder(void) { return mPendingCommands.empty() ? AllocateTid() : 0; }
+
+    /**
+     * Records that a transaction has been sent to the NCP.
+     *
+     * @param[in] aTid          The TID of the transaction.
+     * @param[in] aCmd          The spinel command.
+     * @param[in] aKey          The spinel property key.
+     * @param[in] aRequestTime  The time when the transaction was requested.
+     */
+    void HandleSent(spinel_tid_t      aTid,
+                    spinel_command_t  aCmd,
+                    spinel_prop_key_t aKey,
+                    Timepoint         aRequestTime = Clock::now());
+
+    /**
+     * Completes a transaction with the response from the NCP and releases its TID.
+     *
+     * @param[in] aTid  The TID of the transaction.
+     */
+    void HandleResponse(spinel_tid_t aTid);
+
+    /**
+     * Releases a TID without a response, for example when sending the transaction failed.
+     *
+     * Any queued commands are sent with the released TID. It is safe to release TID 0.
+     *
+     * @param[in] aTid  The TID to release.
+     */
+    void Release(spinel_tid_t aTid);
+
+    /**
+     * Queues an encoded command until a TID is available.
+     *
+     * The TID in the spinel header of @p aFrame is filled in when the frame is sent.
+     *
+     * @param[in] aCmd     The spinel command.
+     * @param[in] aKey     The spinel property key.
+     * @param[in] aFrame   A pointer to the encoded frame.
+     * @param[in] aLength  The length of the encoded frame.
+     *
+     * @retval OT_ERROR_NONE     Successfully queued or coalesced the command.
+     * @retval OT_ERROR_NO_BUFS  The queue is full.
+     */
+    otError Enqueue(spinel_command_t aCmd, spinel_prop_key_t aKey, const uint8_t *aFrame, uint16_t aLength);
+
+    /**
+     * Drops all queued commands and releases all TIDs.
+     */
+    void Clear(void);
+
+    /**
+     * Returns the spinel command of an outstanding transaction.
+     *
+     * @param[in] aTid  The TID of the transaction.
+     *
+     * @returns The spinel command, or `SPINEL_CMD_NOOP` if the TID is not in use.
+     */
+    spinel_command_t GetCommand(spinel_tid_t aTid) const { return mCmdTable[aTid & SPINEL_HEADER_TID_MASK]; }
+
+    /**
+     * Returns the spinel property key of an outstanding transaction.
+     *
+     * @param[in] aTid  The TID of the transaction.
+     *
+     * @returns The spinel property key, or `SPINEL_PROP_LAST_STATUS` if the TID is not in use.
+     */
+    spinel_prop_key_t GetKey(spinel_tid_t aTid) const { return mWaitingKeyTable[aTid & SPINEL_HEADER_TID_MASK]; }
+
+    /**
+     * Returns the number of commands waiting for a free TID.
+     */
+    size_t GetPendingCount(void) const { return mPendingCommands.size(); }
+
+    /**
+     * Returns the statistics of the spinel transactions.
+     */
+    const Metrics &GetMetrics(void) const { return mMetrics; }
+
+private:
+    struct PendingCommand
+    {
+        spinel_command_t     mCmd;
+        spinel_prop_key_t    mKey;
+        Timepoint            mRequestTime;
+        std::vector<uint8_t> mFrame;
+    };
+
+    static bool IsCoalescable(spinel_command_t aCmd, spinel_prop_key_t aKey);
+
+    void FreeTid(spinel_tid_t aTid);
+    void DispatchPendingCommands(void);
+
+    SendFrameHandler mSendFrameHandler;
+    FailureHandler   mFailureHandler;
+
+    uint16_t          mTidsInUse;
+    spinel_tid_t      mNextTid;
+    spinel_command_t  mCmdTable[kMaxTids];
+    spinel_prop_key_t mWaitingKeyTable[kMaxTids];
+    Timepoint         mRequestTimes[kMaxTids];
+
+    std::deque<PendingCommand> mPendingCommands;
+    bool                       mDispatching;
+    Metrics                    mMetrics;
+};
+
+} // namespace Host
+} // namespace otbr
+
+#endif // OTBR_AGENT_SPINEL_TRANSACTIONS_HPP_
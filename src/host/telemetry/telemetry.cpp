@@ -196,6 +196,18 @@ void CopyMdnsResponseCounters(const MdnsResponseCounters &from, threadnetwork::T
     to->set_invalid_state_count(from.mInvalidState);
 }
 
+void CopyLatencyHistogram(const LatencyHistogram &from, threadnetwork::TelemetryData_LatencyHistogram *to)
+{
+    for (uint32_t count : from.mBucketCounts)
+    {
+        to->add_bucket_counts(count);
+    }
+
+    to->set_p50_latency_ms(from.GetPercentile(50));
+    to->set_p90_latency_ms(from.GetPercentile(90));
+    to->set_p99_latency_ms(from.GetPercentile(99));
+}
+
 TelemetryRetriever::TelemetryRetriever(otInstance *aInstance)
     : mInstance(aInstance)
 #if OTBR_ENABLE_BORDER_AGENT
@@ -682,6 +694,19 @@ otError TelemetryRetriever::RetrieveTelemetryData(Mdns::Publisher              *
             mdns->set_service_registration_ema_latency_ms(mdnsInfo.mServiceRegistrationEmaLatency);
             mdns->set_host_resolution_ema_latency_ms(mdnsInfo.mHostResolutionEmaLatency);
             mdns->set_service_resolution_ema_latency_ms(mdnsInfo.mServiceResolutionEmaLatency);
+
+            mdns->set_discovery_proxy_cache_hits(mdnsInfo.mDiscoveryProxyCacheHits);
+            mdns->set_discovery_proxy_cache_misses(mdnsInfo.mDiscoveryProxyCacheMisses);
+
+            CopyLatencyHistogram(mdnsInfo.mLatencyHistograms.mHostRegistration,
+                                 mdns->mutable_host_registration_latency());
+            CopyLatencyHistogram(mdnsInfo.mLatencyHistograms.mKeyRegistration,
+                                 mdns->mutable_key_registration_latency());
+            CopyLatencyHistogram(mdnsInfo.mLatencyHistograms.mServiceRegistration,
+                                 mdns->mutable_service_registration_latency());
+            CopyLatencyHistogram(mdnsInfo.mLatencyHistograms.mHostResolution, mdns->mutable_host_resolution_latency());
+            CopyLatencyHistogram(mdnsInfo.mLatencyHistograms.mServiceResolution,
+                                 mdns->mutable_service_resolution_latency());
         }
         // End of MdnsInfo section.
 
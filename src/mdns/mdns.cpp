@@ -38,22 +38,130 @@
 #if OTBR_ENABLE_MDNS
 
 #include <assert.h>
+#include <ctype.h>
+#include <string.h>
 
 #include <algorithm>
 #include <functional>
+#include <iterator>
 
 #include "common/code_utils.hpp"
 #include "utils/dns_utils.hpp"
+#include "utils/string_utils.hpp"
 
 namespace otbr {
 
 namespace Mdns {
 
+uint8_t Publisher::TxtEntryView::GetEntryLength(void) const
+{
+    return mIsBooleanAttribute ? mKeyLength : static_cast<uint8_t>(mKeyLength + sizeof(uint8_t) + mValueLength);
+}
+
+bool Publisher::TxtEntryView::KeyMatches(const char *aKey) const
+{
+    bool matches = (strlen(aKey) == mKeyLength);
+
+    for (uint8_t i = 0; matches && i < mKeyLength; i++)
+    {
+        matches = (tolower(static_cast<unsigned char>(aKey[i])) == tolower(static_cast<unsigned char>(mKey[i])));
+    }
+
+    return matches;
+}
+
+Publisher::TxtEntry Publisher::TxtEntryView::ToTxtEntry(void) const
+{
+    return mIsBooleanAttribute ? TxtEntry(mKey, mKeyLength) : TxtEntry(mKey, mKeyLength, mValue, mValueLength);
+}
+
+otbrError Publisher::TxtIterator::GetNextEntry(TxtEntryView &aEntry)
+{
+    otbrError      error = OTBR_ERROR_NOT_FOUND;
+    uint8_t        entryLength;
+    const uint8_t *entry;
+    const uint8_t *separator;
+
+    while (mCurrent < mEnd)
+    {
+        entryLength = *mCurrent;
+        entry       = mCurrent + 1;
+
+        if (entryLength > mEnd - entry)
+        {
+            mCurrent = mEnd;
+            ExitNow(error = OTBR_ERROR_PARSE);
+        }
+
+        mCurrent  = entry + entryLength;
+        separator = static_cast<const uint8_t *>(memchr(entry, '=', entryLength));
+
+        aEntry.mKey = reinterpret_cast<const char *>(entry);
+
+        if (separator == nullptr)
+        {
+            if (entryLength == 0)
+            {
+                continue;
+            }
+
+            aEntry.mKeyLength          = entryLength;
+            aEntry.mValue              = nullptr;
+            aEntry.mValueLength        = 0;
+            aEntry.mIsBooleanAttribute = true;
+        }
+        else
+        {
+            aEntry.mKeyLength          = static_cast<uint8_t>(separator - entry);
+            aEntry.mValue              = separator + 1;
+            aEntry.mValueLength        = static_cast<uint8_t>(mCurrent - aEntry.mValue);
+            aEntry.mIsBooleanAttribute = false;
+        }
+
+        ExitNow(error = OTBR_ERROR_NONE);
+    }
+
+exit:
+    return error;
+}
+
 otbrError Publisher::EncodeTxtData(const TxtList &aTxtList, std::vector<uint8_t> &aTxtData)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError error     = OTBR_ERROR_NONE;
+    size_t    txtLength = 0;
+
+    // Computes the exact encoded size first so that the buffer is allocated once.
+    for (const TxtEntry &txtEntry : aTxtList)
+    {
+        txtLength += sizeof(uint8_t) + txtEntry.mKey.length();
+
+        if (!txtEntry.mIsBooleanAttribute)
+        {
+            txtLength += sizeof(uint8_t) + txtEntry.mValue.size(); // for `=` char.
+        }
+    }
+
+    aTxtData.resize(std::max(txtLength, sizeof(uint8_t)));
+    SuccessOrExit(error = EncodeTxtData(aTxtList, aTxtData.data(), aTxtData.size(), txtLength));
+    aTxtData.resize(txtLength);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        aTxtData.clear();
+    }
 
-    aTxtData.clear();
+    return error;
+}
+
+otbrError Publisher::EncodeTxtData(const TxtList &aTxtList,
+                                   uint8_t       *aBuffer,
+                                   size_t         aBufferSize,
+                                   size_t        &aTxtLength)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint8_t  *cur   = aBuffer;
+    uint8_t  *end   = aBuffer + aBufferSize;
 
     for (const TxtEntry &txtEntry : aTxtList)
     {
@@ -65,63 +173,61 @@ otbrError Publisher::EncodeTxtData(const TxtList &aTxtList, std::vector<uint8_t>
         }
 
         VerifyOrExit(entryLength <= kMaxTextEntrySize, error = OTBR_ERROR_INVALID_ARGS);
+        VerifyOrExit(sizeof(uint8_t) + entryLength <= static_cast<size_t>(end - cur), error = OTBR_ERROR_INVALID_ARGS);
 
-        aTxtData.push_back(static_cast<uint8_t>(entryLength));
-        aTxtData.insert(aTxtData.end(), txtEntry.mKey.begin(), txtEntry.mKey.end());
+        *cur++ = static_cast<uint8_t>(entryLength);
+        memcpy(cur, txtEntry.mKey.data(), txtEntry.mKey.length());
+        cur += txtEntry.mKey.length();
 
         if (!txtEntry.mIsBooleanAttribute)
         {
-            aTxtData.push_back('=');
-            aTxtData.insert(aTxtData.end(), txtEntry.mValue.begin(), txtEntry.mValue.end());
+            *cur++ = '=';
+            memcpy(cur, txtEntry.mValue.data(), txtEntry.mValue.size());
+            cur += txtEntry.mValue.size();
         }
     }
 
-    if (aTxtData.empty())
+    if (cur == aBuffer)
     {
-        aTxtData.push_back(0);
+        VerifyOrExit(cur < end, error = OTBR_ERROR_INVALID_ARGS);
+        *cur++ = 0;
     }
 
+    aTxtLength = static_cast<size_t>(cur - aBuffer);
+
 exit:
     return error;
 }
 
 otbrError Publisher::DecodeTxtData(Publisher::TxtList &aTxtList, const uint8_t *aTxtData, uint16_t aTxtLength)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError    error;
+    TxtIterator  iterator(aTxtData, aTxtLength);
+    TxtEntryView entry;
 
     aTxtList.clear();
 
-    for (uint16_t r = 0; r < aTxtLength;)
+    while ((error = iterator.GetNextEntry(entry)) == OTBR_ERROR_NONE)
     {
-        uint16_t entrySize = aTxtData[r];
-        uint16_t keyStart  = r + 1;
-        uint16_t entryEnd  = keyStart + entrySize;
-        uint16_t keyEnd    = keyStart;
-
-        VerifyOrExit(entryEnd <= aTxtLength, error = OTBR_ERROR_PARSE);
+        aTxtList.push_back(entry.ToTxtEntry());
+    }
 
-        while (keyEnd < entryEnd && aTxtData[keyEnd] != '=')
-        {
-            keyEnd++;
-        }
+    if (error == OTBR_ERROR_NOT_FOUND)
+    {
+        error = OTBR_ERROR_NONE;
+    }
 
-        if (keyEnd == entryEnd)
-        {
-            if (keyEnd > keyStart)
-            {
-                // No `=`, treat as a boolean attribute.
-                aTxtList.emplace_back(reinterpret_cast<const char *>(&aTxtData[keyStart]), keyEnd - keyStart);
-            }
-        }
-        else
-        {
-            uint16_t valStart = keyEnd + 1; // To skip over `=`
+    return error;
+}
 
-            aTxtList.emplace_back(reinterpret_cast<const char *>(&aTxtData[keyStart]), keyEnd - keyStart,
-                                  &aTxtData[valStart], entryEnd - valStart);
-        }
+otbrError Publisher::FindTxtEntry(const uint8_t *aTxtData, size_t aTxtLength, const char *aKey, TxtEntryView &aEntry)
+{
+    otbrError   error;
+    TxtIterator iterator(aTxtData, aTxtLength);
 
-        r += entrySize + 1;
+    while ((error = iterator.GetNextEntry(aEntry)) == OTBR_ERROR_NONE)
+    {
+        VerifyOrExit(!aEntry.KeyMatches(aKey));
     }
 
 exit:
@@ -130,6 +236,8 @@ exit:
 
 #if !OTBR_ENABLE_MDNS_OPENTHREAD
 
+const Milliseconds Publisher::kUpdateDebounceInterval(OTBR_CONFIG_MDNS_UPDATE_DEBOUNCE_INTERVAL);
+
 void Publisher::PublishService(const std::string &aHostName,
                                const std::string &aName,
                                const std::string &aType,
@@ -138,9 +246,23 @@ void Publisher::PublishService(const std::string &aHostName,
                                const TxtData     &aTxtData,
                                ResultCallback   &&aCallback)
 {
-    otbrError error;
+    VerifyOrExit(!DebounceServiceUpdate(aHostName, aName, aType, aSubTypeList, aPort, aTxtData, aCallback));
 
-    mServiceRegistrationBeginTime[std::make_pair(aName, aType)] = Clock::now();
+    PublishServiceNow(aHostName, aName, aType, aSubTypeList, aPort, aTxtData, std::move(aCallback));
+
+exit:
+    return;
+}
+
+void Publisher::PublishServiceNow(const std::string &aHostName,
+                                  const std::string &aName,
+                                  const std::string &aType,
+                                  const SubTypeList &aSubTypeList,
+                                  uint16_t           aPort,
+                                  const TxtData     &aTxtData,
+                                  ResultCallback   &&aCallback)
+{
+    otbrError error;
 
     error = PublishServiceImpl(aHostName, aName, aType, aSubTypeList, aPort, aTxtData, std::move(aCallback));
     if (error != OTBR_ERROR_NONE)
@@ -151,9 +273,17 @@ void Publisher::PublishService(const std::string &aHostName,
 
 void Publisher::PublishHost(const std::string &aName, const AddressList &aAddresses, ResultCallback &&aCallback)
 {
-    otbrError error;
+    VerifyOrExit(!DebounceHostUpdate(aName, aAddresses, aCallback));
 
-    mHostRegistrationBeginTime[aName] = Clock::now();
+    PublishHostNow(aName, aAddresses, std::move(aCallback));
+
+exit:
+    return;
+}
+
+void Publisher::PublishHostNow(const std::string &aName, const AddressList &aAddresses, ResultCallback &&aCallback)
+{
+    otbrError error;
 
     error = PublishHostImpl(aName, aAddresses, std::move(aCallback));
     if (error != OTBR_ERROR_NONE)
@@ -162,12 +292,185 @@ void Publisher::PublishHost(const std::string &aName, const AddressList &aAddres
     }
 }
 
+bool Publisher::DebounceServiceUpdate(const std::string &aHostName,
+                                      const std::string &aName,
+                                      const std::string &aType,
+                                      const SubTypeList &aSubTypeList,
+                                      uint16_t           aPort,
+                                      const TxtData     &aTxtData,
+                                      ResultCallback    &aCallback)
+{
+    std::string          fullName = MakeFullServiceName(aName, aType);
+    auto                 it       = mPendingServiceUpdates.find(fullName);
+    bool                 deferred = false;
+    ServiceRegistration *serviceReg;
+    Timepoint            now;
+    Milliseconds         delay;
+    TaskRunner::TaskId   taskId;
+
+    if (it != mPendingServiceUpdates.end())
+    {
+        PendingServiceUpdate &pending = it->second;
+
+        otbrLogInfo("Coalescing update of service %s.%s", aName.c_str(), aType.c_str());
+
+        pending.mHostName    = aHostName;
+        pending.mSubTypeList = aSubTypeList;
+        pending.mPort        = aPort;
+        pending.mTxtData     = aTxtData;
+        pending.mCallback    = MergeResultCallbacks(std::move(pending.mCallback), std::move(aCallback));
+        ExitNow(deferred = true);
+    }
+
+    serviceReg = FindServiceRegistration(aName, aType);
+    VerifyOrExit(serviceReg != nullptr);
+    VerifyOrExit(serviceReg->IsOutdated(aHostName, aName, aType, SortSubTypeList(aSubTypeList), aPort, aTxtData));
+
+    now = Clock::now();
+    VerifyOrExit(now < serviceReg->mUpdateTime + kUpdateDebounceInterval);
+
+    otbrLogInfo("Deferring update of service %s.%s", aName.c_str(), aType.c_str());
+
+    delay  = std::chrono::duration_cast<Milliseconds>(serviceReg->mUpdateTime + kUpdateDebounceInterval - now);
+    taskId = mTaskRunner.Post(delay, [this, fullName]() { FlushServiceUpdate(fullName); });
+    mPendingServiceUpdates.emplace(fullName, PendingServiceUpdate{aHostName, aName, aType, aSubTypeList, aPort,
+                                                                  aTxtData, std::move(aCallback), taskId});
+    deferred = true;
+
+exit:
+    return deferred;
+}
+
+bool Publisher::DebounceHostUpdate(const std::string &aName, const AddressList &aAddresses, ResultCallback &aCallback)
+{
+    std::string        fullName = MakeFullHostName(aName);
+    auto               it       = mPendingHostUpdates.find(fullName);
+    bool               deferred = false;
+    HostRegistration  *hostReg;
+    Timepoint          now;
+    Milliseconds       delay;
+    TaskRunner::TaskId taskId;
+
+    if (it != mPendingHostUpdates.end())
+    {
+        PendingHostUpdate &pending = it->second;
+
+        otbrLogInfo("Coalescing update of host %s", aName.c_str());
+
+        pending.mAddresses = aAddresses;
+        pending.mCallback  = MergeResultCallbacks(std::move(pending.mCallback), std::move(aCallback));
+        ExitNow(deferred = true);
+    }
+
+    hostReg = FindHostRegistration(aName);
+    VerifyOrExit(hostReg != nullptr);
+    VerifyOrExit(hostReg->IsOutdated(aName, SortAddressList(aAddresses)));
+
+    now = Clock::now();
+    VerifyOrExit(now < hostReg->mUpdateTime + kUpdateDebounceInterval);
+
+    otbrLogInfo("Deferring update of host %s", aName.c_str());
+
+    delay  = std::chrono::duration_cast<Milliseconds>(hostReg->mUpdateTime + kUpdateDebounceInterval - now);
+    taskId = mTaskRunner.Post(delay, [this, fullName]() { FlushHostUpdate(fullName); });
+    mPendingHostUpdates.emplace(fullName, PendingHostUpdate{aName, aAddresses, std::move(aCallback), taskId});
+    deferred = true;
+
+exit:
+    return deferred;
+}
+
+void Publisher::FlushServiceUpdate(const std::string &aFullName)
+{
+    auto it = mPendingServiceUpdates.find(aFullName);
+
+    if (it != mPendingServiceUpdates.end())
+    {
+        PendingServiceUpdate pending = std::move(it->second);
+
+        mPendingServiceUpdates.erase(it);
+
+        otbrLogInfo("Publishing deferred update of service %s.%s", pending.mName.c_str(), pending.mType.c_str());
+        PublishServiceNow(pending.mHostName, pending.mName, pending.mType, pending.mSubTypeList, pending.mPort,
+                          pending.mTxtData, std::move(pending.mCallback));
+    }
+}
+
+void Publisher::FlushHostUpdate(const std::string &aFullName)
+{
+    auto it = mPendingHostUpdates.find(aFullName);
+
+    if (it != mPendingHostUpdates.end())
+    {
+        PendingHostUpdate pending = std::move(it->second);
+
+        mPendingHostUpdates.erase(it);
+
+        otbrLogInfo("Publishing deferred update of host %s", pending.mName.c_str());
+        PublishHostNow(pending.mName, pending.mAddresses, std::move(pending.mCallback));
+    }
+}
+
+void Publisher::CancelPendingServiceUpdate(const std::string &aName, const std::string &aType)
+{
+    auto it = mPendingServiceUpdates.find(MakeFullServiceName(aName, aType));
+
+    if (it != mPendingServiceUpdates.end())
+    {
+        ResultCallback callback = std::move(it->second.mCallback);
+
+        mTaskRunner.Cancel(it->second.mTaskId);
+        mPendingServiceUpdates.erase(it);
+        std::move(callback)(OTBR_ERROR_ABORTED);
+    }
+}
+
+void Publisher::CancelPendingHostUpdate(const std::string &aName)
+{
+    auto it = mPendingHostUpdates.find(MakeFullHostName(aName));
+
+    if (it != mPendingHostUpdates.end())
+    {
+        ResultCallback callback = std::move(it->second.mCallback);
+
+        mTaskRunner.Cancel(it->second.mTaskId);
+        mPendingHostUpdates.erase(it);
+        std::move(callback)(OTBR_ERROR_ABORTED);
+    }
+}
+
+void Publisher::CancelPendingUpdates(void)
+{
+    // The callbacks may publish or unpublish again, so the maps are not iterated directly.
+    while (!mPendingServiceUpdates.empty())
+    {
+        const PendingServiceUpdate &pending = mPendingServiceUpdates.begin()->second;
+
+        CancelPendingServiceUpdate(std::string(pending.mName), std::string(pending.mType));
+    }
+
+    while (!mPendingHostUpdates.empty())
+    {
+        CancelPendingHostUpdate(std::string(mPendingHostUpdates.begin()->second.mName));
+    }
+}
+
+Publisher::ResultCallback Publisher::MergeResultCallbacks(ResultCallback &&aFirst, ResultCallback &&aSecond)
+{
+    return std::bind(
+        [](std::shared_ptr<ResultCallback> aFirstCallback, std::shared_ptr<ResultCallback> aSecondCallback,
+           otbrError aError) {
+            std::move (*aFirstCallback)(aError);
+            std::move (*aSecondCallback)(aError);
+        },
+        std::make_shared<ResultCallback>(std::move(aFirst)), std::make_shared<ResultCallback>(std::move(aSecond)),
+        std::placeholders::_1);
+}
+
 void Publisher::PublishKey(const std::string &aName, const KeyData &aKeyData, ResultCallback &&aCallback)
 {
     otbrError error;
 
-    mKeyRegistrationBeginTime[aName] = Clock::now();
-
     error = PublishKeyImpl(aName, aKeyData, std::move(aCallback));
     if (error != OTBR_ERROR_NONE)
     {
@@ -175,41 +478,135 @@ void Publisher::PublishKey(const std::string &aName, const KeyData &aKeyData, Re
     }
 }
 
-void Publisher::OnServiceResolveFailed(std::string aType, std::string aInstanceName, int32_t aErrorCode)
+void Publisher::OnServiceResolveFailed(std::string aType,
+                                       std::string aInstanceName,
+                                       int32_t     aErrorCode,
+                                       Timepoint   aBeginTime)
 {
     UpdateMdnsResponseCounters(mTelemetryInfo.mServiceResolutions, DnsErrorToOtbrError(aErrorCode));
-    UpdateServiceInstanceResolutionEmaLatency(aInstanceName, aType, DnsErrorToOtbrError(aErrorCode));
+    UpdateLatency(mTelemetryInfo.mServiceResolutionEmaLatency, mTelemetryInfo.mLatencyHistograms.mServiceResolution,
+                  aBeginTime, DnsErrorToOtbrError(aErrorCode));
     OnServiceResolveFailedImpl(aType, aInstanceName, aErrorCode);
 }
 
-void Publisher::OnHostResolveFailed(std::string aHostName, int32_t aErrorCode)
+void Publisher::OnHostResolveFailed(std::string aHostName, int32_t aErrorCode, Timepoint aBeginTime)
 {
     UpdateMdnsResponseCounters(mTelemetryInfo.mHostResolutions, DnsErrorToOtbrError(aErrorCode));
-    UpdateHostResolutionEmaLatency(aHostName, DnsErrorToOtbrError(aErrorCode));
+    UpdateLatency(mTelemetryInfo.mHostResolutionEmaLatency, mTelemetryInfo.mLatencyHistograms.mHostResolution,
+                  aBeginTime, DnsErrorToOtbrError(aErrorCode));
     OnHostResolveFailedImpl(aHostName, aErrorCode);
 }
 
 void Publisher::RemoveSubscriptionCallbacks(uint64_t aSubscriberId)
 {
-    mDiscoverCallbacks.remove_if(
-        [aSubscriberId](const DiscoverCallback &aCallback) { return (aCallback.mId == aSubscriberId); });
+    auto it = mDiscoverCallbacks.find(aSubscriberId);
+
+    VerifyOrExit(it != mDiscoverCallbacks.end());
+
+    if (it->second.mServiceCallback != nullptr)
+    {
+        RemoveSubscriber(mServiceSubscribers, it->second.mKey, aSubscriberId);
+    }
+    if (it->second.mHostCallback != nullptr)
+    {
+        RemoveSubscriber(mHostSubscribers, it->second.mKey, aSubscriberId);
+    }
+    mDiscoverCallbacks.erase(it);
+
+exit:
+    return;
 }
 
 uint64_t Publisher::AddSubscriptionCallbacks(Publisher::DiscoveredServiceInstanceCallback aInstanceCallback,
                                              Publisher::DiscoveredHostCallback            aHostCallback)
+{
+    return AddDiscoverCallback(DiscoverCallback(std::move(aInstanceCallback), std::move(aHostCallback), ""));
+}
+
+uint64_t Publisher::AddServiceSubscriptionCallback(const std::string                           &aType,
+                                                   Publisher::DiscoveredServiceInstanceCallback aInstanceCallback)
+{
+    assert(!aType.empty());
+
+    return AddDiscoverCallback(
+        DiscoverCallback(std::move(aInstanceCallback), /* aHostCallback */ nullptr, StringUtils::ToLowercase(aType)));
+}
+
+uint64_t Publisher::AddHostSubscriptionCallback(const std::string                &aHostName,
+                                                Publisher::DiscoveredHostCallback aHostCallback)
+{
+    assert(!aHostName.empty());
+
+    return AddDiscoverCallback(DiscoverCallback(/* aServiceCallback */ nullptr, std::move(aHostCallback),
+                                                StringUtils::ToLowercase(aHostName)));
+}
+
+uint64_t Publisher::AddDiscoverCallback(DiscoverCallback aCallback)
 {
     uint64_t id = mNextSubscriberId++;
 
     assert(id > 0);
-    mDiscoverCallbacks.emplace_back(id, aInstanceCallback, aHostCallback);
+
+    // IDs are increasing, so appending keeps the lists sorted.
+    if (aCallback.mServiceCallback != nullptr)
+    {
+        mServiceSubscribers[aCallback.mKey].push_back(id);
+    }
+    if (aCallback.mHostCallback != nullptr)
+    {
+        mHostSubscribers[aCallback.mKey].push_back(id);
+    }
+    mDiscoverCallbacks.emplace(id, std::move(aCallback));
 
     return id;
 }
 
-void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aInstanceInfo)
+void Publisher::RemoveSubscriber(SubscriberIndex &aIndex, const std::string &aKey, uint64_t aSubscriberId)
 {
-    bool checkToInvoke = false;
+    auto              it = aIndex.find(aKey);
+    SubscriberIdList *ids;
+
+    VerifyOrExit(it != aIndex.end());
+
+    ids = &it->second;
+    ids->erase(std::lower_bound(ids->begin(), ids->end(), aSubscriberId));
+
+    if (ids->empty())
+    {
+        aIndex.erase(it);
+    }
+
+exit:
+    return;
+}
+
+Publisher::SubscriberIdList Publisher::FindSubscribers(const SubscriberIndex &aIndex, const std::string &aName)
+{
+    SubscriberIdList ids;
+    auto             all   = aIndex.find("");
+    auto             named = aIndex.find(StringUtils::ToLowercase(aName));
+
+    if (all != aIndex.end() && named != aIndex.end())
+    {
+        // Keep invoking the subscribers in the order they subscribed in.
+        ids.reserve(all->second.size() + named->second.size());
+        std::merge(all->second.begin(), all->second.end(), named->second.begin(), named->second.end(),
+                   std::back_inserter(ids));
+    }
+    else if (all != aIndex.end())
+    {
+        ids = all->second;
+    }
+    else if (named != aIndex.end())
+    {
+        ids = named->second;
+    }
 
+    return ids;
+}
+
+void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aInstanceInfo, Timepoint aBeginTime)
+{
     otbrLogInfo("Service %s is resolved successfully: %s %s host %s addresses %zu", aType.c_str(),
                 aInstanceInfo.mRemoved ? "remove" : "add", aInstanceInfo.mName.c_str(), aInstanceInfo.mHostName.c_str(),
                 aInstanceInfo.mAddresses.size());
@@ -239,35 +636,19 @@ void Publisher::OnServiceResolved(std::string aType, DiscoveredInstanceInfo aIns
     }
 
     UpdateMdnsResponseCounters(mTelemetryInfo.mServiceResolutions, OTBR_ERROR_NONE);
-    UpdateServiceInstanceResolutionEmaLatency(aInstanceInfo.mName, aType, OTBR_ERROR_NONE);
+    UpdateLatency(mTelemetryInfo.mServiceResolutionEmaLatency, mTelemetryInfo.mLatencyHistograms.mServiceResolution,
+                  aBeginTime, OTBR_ERROR_NONE);
 
-    // The `mDiscoverCallbacks` list can get updated as the callbacks
-    // are invoked. We first mark `mShouldInvoke` on all non-null
-    // service callbacks. We clear it before invoking the callback
-    // and restart the iteration over the `mDiscoverCallbacks` list
-    // to find the next one to signal, since the list may have changed.
-    for (DiscoverCallback &callback : mDiscoverCallbacks)
+    // Subscribers can be added or removed as the callbacks are invoked.
+    // The interested subscribers are collected first, and each of them
+    // is looked up again right before invoking it to skip removed ones.
+    for (uint64_t id : FindSubscribers(mServiceSubscribers, aType))
     {
-        if (callback.mServiceCallback != nullptr)
-        {
-            callback.mShouldInvoke = true;
-            checkToInvoke          = true;
-        }
-    }
+        auto it = mDiscoverCallbacks.find(id);
 
-    while (checkToInvoke)
-    {
-        checkToInvoke = false;
-
-        for (DiscoverCallback &callback : mDiscoverCallbacks)
+        if (it != mDiscoverCallbacks.end())
         {
-            if (callback.mShouldInvoke)
-            {
-                callback.mShouldInvoke = false;
-                checkToInvoke          = true;
-                callback.mServiceCallback(aType, aInstanceInfo);
-                break;
-            }
+            it->second.mServiceCallback(aType, aInstanceInfo);
         }
     }
 }
@@ -285,10 +666,8 @@ void Publisher::OnServiceRemoved(uint32_t aNetifIndex, std::string aType, std::s
     OnServiceResolved(aType, instanceInfo);
 }
 
-void Publisher::OnHostResolved(std::string aHostName, Publisher::DiscoveredHostInfo aHostInfo)
+void Publisher::OnHostResolved(std::string aHostName, Publisher::DiscoveredHostInfo aHostInfo, Timepoint aBeginTime)
 {
-    bool checkToInvoke = false;
-
     otbrLogInfo("Host %s is resolved successfully: host %s addresses %zu ttl %u", aHostName.c_str(),
                 aHostInfo.mHostName.c_str(), aHostInfo.mAddresses.size(), aHostInfo.mTtl);
 
@@ -298,36 +677,17 @@ void Publisher::OnHostResolved(std::string aHostName, Publisher::DiscoveredHostI
     }
 
     UpdateMdnsResponseCounters(mTelemetryInfo.mHostResolutions, OTBR_ERROR_NONE);
-    UpdateHostResolutionEmaLatency(aHostName, OTBR_ERROR_NONE);
-
-    // The `mDiscoverCallbacks` list can get updated as the callbacks
-    // are invoked. We first mark `mShouldInvoke` on all non-null
-    // host callbacks. We clear it before invoking the callback
-    // and restart the iteration over the `mDiscoverCallbacks` list
-    // to find the next one to signal, since the list may have changed.
-
-    for (DiscoverCallback &callback : mDiscoverCallbacks)
-    {
-        if (callback.mHostCallback != nullptr)
-        {
-            callback.mShouldInvoke = true;
-            checkToInvoke          = true;
-        }
-    }
+    UpdateLatency(mTelemetryInfo.mHostResolutionEmaLatency, mTelemetryInfo.mLatencyHistograms.mHostResolution,
+                  aBeginTime, OTBR_ERROR_NONE);
 
-    while (checkToInvoke)
+    // See `OnServiceResolved()` for subscribers changing during the callbacks.
+    for (uint64_t id : FindSubscribers(mHostSubscribers, aHostName))
     {
-        checkToInvoke = false;
+        auto it = mDiscoverCallbacks.find(id);
 
-        for (DiscoverCallback &callback : mDiscoverCallbacks)
+        if (it != mDiscoverCallbacks.end())
         {
-            if (callback.mShouldInvoke)
-            {
-                callback.mShouldInvoke = false;
-                checkToInvoke          = true;
-                callback.mHostCallback(aHostName, aHostInfo);
-                break;
-            }
+            it->second.mHostCallback(aHostName, aHostInfo);
         }
     }
 }
@@ -406,8 +766,21 @@ Publisher::ResultCallback Publisher::HandleDuplicateServiceRegistration(const st
 
     if (serviceReg->IsOutdated(aHostName, aName, aType, aSubTypeList, aPort, aTxtData))
     {
-        otbrLogInfo("Removing existing service %s.%s: outdated", aName.c_str(), aType.c_str());
-        RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
+        // An established service whose TXT data is the only change is updated in place, so that its
+        // other records are neither withdrawn nor probed and announced again.
+        if (serviceReg->IsCompleted() &&
+            !serviceReg->IsOutdated(aHostName, aName, aType, aSubTypeList, aPort, serviceReg->mTxtData) &&
+            serviceReg->UpdateTxtData(aTxtData) == OTBR_ERROR_NONE)
+        {
+            otbrLogInfo("Updated TXT data of existing service %s.%s", aName.c_str(), aType.c_str());
+            serviceReg->mUpdateTime = Clock::now();
+            std::move(aCallback)(OTBR_ERROR_NONE);
+        }
+        else
+        {
+            otbrLogInfo("Removing existing service %s.%s: outdated", aName.c_str(), aType.c_str());
+            RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
+        }
     }
     else if (serviceReg->IsCompleted())
     {
@@ -419,14 +792,7 @@ Publisher::ResultCallback Publisher::HandleDuplicateServiceRegistration(const st
     {
         // If the same service is being registered with the same parameters,
         // let's join the waiting queue for the result.
-        serviceReg->mCallback = std::bind(
-            [](std::shared_ptr<ResultCallback> aExistingCallback, std::shared_ptr<ResultCallback> aNewCallback,
-               otbrError aError) {
-                std::move (*aExistingCallback)(aError);
-                std::move (*aNewCallback)(aError);
-            },
-            std::make_shared<ResultCallback>(std::move(serviceReg->mCallback)),
-            std::make_shared<ResultCallback>(std::move(aCallback)), std::placeholders::_1);
+        serviceReg->mCallback = MergeResultCallbacks(std::move(serviceReg->mCallback), std::move(aCallback));
     }
 
 exit:
@@ -443,8 +809,19 @@ Publisher::ResultCallback Publisher::HandleDuplicateHostRegistration(const std::
 
     if (hostReg->IsOutdated(aName, aAddresses))
     {
-        otbrLogInfo("Removing existing host %s: outdated", aName.c_str());
-        RemoveHostRegistration(hostReg->mName, OTBR_ERROR_ABORTED);
+        // Only the changed address records of an established host are added or removed.
+        if (hostReg->IsCompleted() && !aAddresses.empty() && hostReg->mName == aName &&
+            hostReg->UpdateAddresses(SortAddressList(aAddresses)) == OTBR_ERROR_NONE)
+        {
+            otbrLogInfo("Updated addresses of existing host %s", aName.c_str());
+            hostReg->mUpdateTime = Clock::now();
+            std::move(aCallback)(OTBR_ERROR_NONE);
+        }
+        else
+        {
+            otbrLogInfo("Removing existing host %s: outdated", aName.c_str());
+            RemoveHostRegistration(hostReg->mName, OTBR_ERROR_ABORTED);
+        }
     }
     else if (hostReg->IsCompleted())
     {
@@ -456,14 +833,7 @@ Publisher::ResultCallback Publisher::HandleDuplicateHostRegistration(const std::
     {
         // If the same service is being registered with the same parameters,
         // let's join the waiting queue for the result.
-        hostReg->mCallback = std::bind(
-            [](std::shared_ptr<ResultCallback> aExistingCallback, std::shared_ptr<ResultCallback> aNewCallback,
-               otbrError aError) {
-                std::move (*aExistingCallback)(aError);
-                std::move (*aNewCallback)(aError);
-            },
-            std::make_shared<ResultCallback>(std::move(hostReg->mCallback)),
-            std::make_shared<ResultCallback>(std::move(aCallback)), std::placeholders::_1);
+        hostReg->mCallback = MergeResultCallbacks(std::move(hostReg->mCallback), std::move(aCallback));
     }
 
 exit:
@@ -525,14 +895,7 @@ Publisher::ResultCallback Publisher::HandleDuplicateKeyRegistration(const std::s
     {
         // If the same key is being registered with the same parameters,
         // let's join the waiting queue for the result.
-        keyReg->mCallback = std::bind(
-            [](std::shared_ptr<ResultCallback> aExistingCallback, std::shared_ptr<ResultCallback> aNewCallback,
-               otbrError aError) {
-                std::move (*aExistingCallback)(aError);
-                std::move (*aNewCallback)(aError);
-            },
-            std::make_shared<ResultCallback>(std::move(keyReg->mCallback)),
-            std::make_shared<ResultCallback>(std::move(aCallback)), std::placeholders::_1);
+        keyReg->mCallback = MergeResultCallbacks(std::move(keyReg->mCallback), std::move(aCallback));
     }
 
 exit:
@@ -594,6 +957,13 @@ bool Publisher::ServiceRegistration::IsOutdated(const std::string &aHostName,
              mPort == aPort && mTxtData == aTxtData);
 }
 
+otbrError Publisher::ServiceRegistration::UpdateTxtData(const TxtData &aTxtData)
+{
+    OTBR_UNUSED_VARIABLE(aTxtData);
+
+    return OTBR_ERROR_NOT_IMPLEMENTED;
+}
+
 void Publisher::ServiceRegistration::Complete(otbrError aError)
 {
     OnComplete(aError);
@@ -604,8 +974,11 @@ void Publisher::ServiceRegistration::OnComplete(otbrError aError)
 {
     if (!IsCompleted())
     {
-        mPublisher->UpdateMdnsResponseCounters(mPublisher->mTelemetryInfo.mServiceRegistrations, aError);
-        mPublisher->UpdateServiceRegistrationEmaLatency(mName, mType, aError);
+        MdnsTelemetryInfo &info = mPublisher->mTelemetryInfo;
+
+        UpdateMdnsResponseCounters(info.mServiceRegistrations, aError);
+        UpdateLatency(info.mServiceRegistrationEmaLatency, info.mLatencyHistograms.mServiceRegistration, mBeginTime,
+                      aError);
     }
 }
 
@@ -614,6 +987,13 @@ bool Publisher::HostRegistration::IsOutdated(const std::string &aName, const Add
     return !(mName == aName && mAddresses == aAddresses);
 }
 
+otbrError Publisher::HostRegistration::UpdateAddresses(const AddressList &aAddresses)
+{
+    OTBR_UNUSED_VARIABLE(aAddresses);
+
+    return OTBR_ERROR_NOT_IMPLEMENTED;
+}
+
 void Publisher::HostRegistration::Complete(otbrError aError)
 {
     OnComplete(aError);
@@ -624,8 +1004,10 @@ void Publisher::HostRegistration::OnComplete(otbrError aError)
 {
     if (!IsCompleted())
     {
-        mPublisher->UpdateMdnsResponseCounters(mPublisher->mTelemetryInfo.mHostRegistrations, aError);
-        mPublisher->UpdateHostRegistrationEmaLatency(mName, aError);
+        MdnsTelemetryInfo &info = mPublisher->mTelemetryInfo;
+
+        UpdateMdnsResponseCounters(info.mHostRegistrations, aError);
+        UpdateLatency(info.mHostRegistrationEmaLatency, info.mLatencyHistograms.mHostRegistration, mBeginTime, aError);
     }
 }
 
@@ -644,8 +1026,10 @@ void Publisher::KeyRegistration::OnComplete(otbrError aError)
 {
     if (!IsCompleted())
     {
-        mPublisher->UpdateMdnsResponseCounters(mPublisher->mTelemetryInfo.mKeyRegistrations, aError);
-        mPublisher->UpdateKeyRegistrationEmaLatency(mName, aError);
+        MdnsTelemetryInfo &info = mPublisher->mTelemetryInfo;
+
+        UpdateMdnsResponseCounters(info.mKeyRegistrations, aError);
+        UpdateLatency(info.mKeyRegistrationEmaLatency, info.mLatencyHistograms.mKeyRegistration, mBeginTime, aError);
     }
 }
 
@@ -701,68 +1085,21 @@ exit:
     return;
 }
 
-void Publisher::UpdateServiceRegistrationEmaLatency(const std::string &aInstanceName,
-                                                    const std::string &aType,
-                                                    otbrError          aError)
-{
-    auto it = mServiceRegistrationBeginTime.find(std::make_pair(aInstanceName, aType));
-
-    if (it != mServiceRegistrationBeginTime.end())
-    {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mServiceRegistrationEmaLatency, latency, aError);
-        mServiceRegistrationBeginTime.erase(it);
-    }
-}
-
-void Publisher::UpdateHostRegistrationEmaLatency(const std::string &aHostName, otbrError aError)
-{
-    auto it = mHostRegistrationBeginTime.find(aHostName);
-
-    if (it != mHostRegistrationBeginTime.end())
-    {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mHostRegistrationEmaLatency, latency, aError);
-        mHostRegistrationBeginTime.erase(it);
-    }
-}
-
-void Publisher::UpdateKeyRegistrationEmaLatency(const std::string &aKeyName, otbrError aError)
+void Publisher::UpdateLatency(uint32_t         &aEmaLatency,
+                              LatencyHistogram &aHistogram,
+                              Timepoint         aBeginTime,
+                              otbrError         aError)
 {
-    auto it = mKeyRegistrationBeginTime.find(aKeyName);
+    uint32_t latency;
 
-    if (it != mKeyRegistrationBeginTime.end())
-    {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mKeyRegistrationEmaLatency, latency, aError);
-        mKeyRegistrationBeginTime.erase(it);
-    }
-}
+    VerifyOrExit(aBeginTime != Timepoint::min() && aError != OTBR_ERROR_ABORTED);
 
-void Publisher::UpdateServiceInstanceResolutionEmaLatency(const std::string &aInstanceName,
-                                                          const std::string &aType,
-                                                          otbrError          aError)
-{
-    auto it = mServiceInstanceResolutionBeginTime.find(std::make_pair(aInstanceName, aType));
+    latency = static_cast<uint32_t>(std::chrono::duration_cast<Milliseconds>(Clock::now() - aBeginTime).count());
+    UpdateEmaLatency(aEmaLatency, latency, aError);
+    aHistogram.Record(latency);
 
-    if (it != mServiceInstanceResolutionBeginTime.end())
-    {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mServiceResolutionEmaLatency, latency, aError);
-        mServiceInstanceResolutionBeginTime.erase(it);
-    }
-}
-
-void Publisher::UpdateHostResolutionEmaLatency(const std::string &aHostName, otbrError aError)
-{
-    auto it = mHostResolutionBeginTime.find(aHostName);
-
-    if (it != mHostResolutionBeginTime.end())
-    {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
-        UpdateEmaLatency(mTelemetryInfo.mHostResolutionEmaLatency, latency, aError);
-        mHostResolutionBeginTime.erase(it);
-    }
+exit:
+    return;
 }
 
 void Publisher::AddAddress(AddressList &aAddressList, const Ip6Address &aAddress)
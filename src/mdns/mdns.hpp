@@ -41,16 +41,17 @@
 #endif
 
 #include <functional>
-#include <list>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <sys/select.h>
 
 #include "common/callback.hpp"
 #include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
 #include "common/time.hpp"
 #include "common/types.hpp"
 
@@ -117,6 +118,79 @@ public:
         }
     };
 
+    /**
+     * This structure represents a TXT entry which refers in place to the bytes of an encoded TXT data buffer.
+     *
+     * The key and value are not null-terminated and stay valid only as long as the TXT data buffer.
+     */
+    struct TxtEntryView
+    {
+        const char    *mKey;                ///< The key of the TXT entry (not null-terminated).
+        uint8_t        mKeyLength;          ///< The key length in bytes.
+        const uint8_t *mValue;              ///< The value of the TXT entry, `nullptr` for a boolean attribute.
+        uint8_t        mValueLength;        ///< The value length in bytes.
+        bool           mIsBooleanAttribute; ///< This entry is boolean attribute (encoded as `key` without `=`).
+
+        /**
+         * This method returns the length of the whole encoded entry (`key` or `key=value`) starting at `mKey`.
+         *
+         * @returns The entry length in bytes.
+         */
+        uint8_t GetEntryLength(void) const;
+
+        /**
+         * This method indicates whether the key of this entry matches a given key (case-insensitive).
+         *
+         * @param[in] aKey  A null-terminated key string.
+         *
+         * @returns TRUE if the keys match, FALSE otherwise.
+         */
+        bool KeyMatches(const char *aKey) const;
+
+        /**
+         * This method copies this entry into an owning `TxtEntry`.
+         *
+         * @returns The `TxtEntry` holding the same key and value.
+         */
+        TxtEntry ToTxtEntry(void) const;
+    };
+
+    /**
+     * This class iterates over the entries of encoded TXT data in place, without copying any key or value.
+     *
+     * Empty entries are skipped.
+     */
+    class TxtIterator
+    {
+    public:
+        /**
+         * The constructor to initialize the iterator.
+         *
+         * @param[in] aTxtData    A pointer to TXT data. Must outlive this iterator and returned entries.
+         * @param[in] aTxtLength  The TXT data length.
+         */
+        TxtIterator(const uint8_t *aTxtData, size_t aTxtLength)
+            : mCurrent(aTxtData)
+            , mEnd(aTxtData + aTxtLength)
+        {
+        }
+
+        /**
+         * This method gets the next TXT entry.
+         *
+         * @param[out] aEntry  A reference to the entry view to output.
+         *
+         * @retval OTBR_ERROR_NONE       Successfully got the next entry.
+         * @retval OTBR_ERROR_NOT_FOUND  There are no more entries.
+         * @retval OTBR_ERROR_PARSE      The TXT data is malformed. Iteration stops.
+         */
+        otbrError GetNextEntry(TxtEntryView &aEntry);
+
+    private:
+        const uint8_t *mCurrent;
+        const uint8_t *mEnd;
+    };
+
     typedef std::vector<uint8_t>     TxtData;
     typedef std::vector<TxtEntry>    TxtList;
     typedef std::vector<std::string> SubTypeList;
@@ -229,6 +303,11 @@ public:
      *                          failure. Specifically, `OTBR_ERROR_DUPLICATED` indicates that the name has
      *                          already been published and the caller can re-publish with a new name if an
      *                          alternative name is available/acceptable.
+     *
+     * An update of a service which only changes its TXT data is applied in place when the implementation supports
+     * it. An update arriving within `OTBR_CONFIG_MDNS_UPDATE_DEBOUNCE_INTERVAL` of the previous change of the same
+     * service is deferred and coalesced with any later update, @p aCallback then receives the result of the
+     * coalesced update.
      */
     void PublishService(const std::string &aHostName,
                         const std::string &aName,
@@ -260,6 +339,9 @@ public:
      *                        failure. Specifically, `OTBR_ERROR_DUPLICATED` indicates that the name has
      *                        already been published and the caller can re-publish with a new name if an
      *                        alternative name is available/acceptable.
+     *
+     * Address changes are applied in place when the implementation supports it and rapid successive updates are
+     * coalesced like in `PublishService()`.
      */
     void PublishHost(const std::string &aName, const AddressList &aAddresses, ResultCallback &&aCallback);
 
@@ -343,6 +425,8 @@ public:
     /**
      * This method sets the callbacks for subscriptions.
      *
+     * The callbacks receive the discovered service instances and hosts of all subscriptions.
+     *
      * @param[in] aInstanceCallback  The callback function to receive discovered service instances.
      * @param[in] aHostCallback      The callback function to receive discovered hosts.
      *
@@ -351,6 +435,31 @@ public:
     uint64_t AddSubscriptionCallbacks(DiscoveredServiceInstanceCallback aInstanceCallback,
                                       DiscoveredHostCallback            aHostCallback);
 
+    /**
+     * This method sets the callback for the subscriptions of a given service type.
+     *
+     * The callback only receives the discovered service instances of @p aType, compared case-insensitively.
+     *
+     * @param[in] aType              The service type, e.g., "_srv._udp" (MUST NOT end with dot).
+     * @param[in] aInstanceCallback  The callback function to receive discovered service instances.
+     *
+     * @returns  The Subscriber ID for the callback.
+     */
+    uint64_t AddServiceSubscriptionCallback(const std::string                &aType,
+                                            DiscoveredServiceInstanceCallback aInstanceCallback);
+
+    /**
+     * This method sets the callback for the subscriptions of a given host.
+     *
+     * The callback only receives the discovered host @p aHostName, compared case-insensitively.
+     *
+     * @param[in] aHostName      The host name (without domain).
+     * @param[in] aHostCallback  The callback function to receive discovered hosts.
+     *
+     * @returns  The Subscriber ID for the callback.
+     */
+    uint64_t AddHostSubscriptionCallback(const std::string &aHostName, DiscoveredHostCallback aHostCallback);
+
     /**
      * This method cancels callbacks for subscriptions.
      *
@@ -367,6 +476,16 @@ public:
      */
     const MdnsTelemetryInfo &GetMdnsTelemetryInfo(void) const { return mTelemetryInfo; }
 
+    /**
+     * This method records the outcome of a Discovery Proxy answer cache lookup in the mDNS statistics.
+     *
+     * @param[in] aIsHit  Whether the query was answered from the cache.
+     */
+    void UpdateDiscoveryProxyCacheCounters(bool aIsHit)
+    {
+        (aIsHit ? mTelemetryInfo.mDiscoveryProxyCacheHits : mTelemetryInfo.mDiscoveryProxyCacheMisses)++;
+    }
+
     virtual ~Publisher(void) = default;
 
     /**
@@ -419,6 +538,35 @@ public:
      */
     static otbrError DecodeTxtData(TxtList &aTxtList, const uint8_t *aTxtData, uint16_t aTxtLength);
 
+    /**
+     * This function writes the TXT entry list to a caller-provided buffer.
+     *
+     * The output is identical to that of `EncodeTxtData(const TxtList &, TxtData &)`, but no memory is allocated.
+     *
+     * @param[in]  aTxtList     A TXT entry list.
+     * @param[out] aBuffer      A pointer to the output buffer.
+     * @param[in]  aBufferSize  The size of @p aBuffer in bytes.
+     * @param[out] aTxtLength   On success, the length of the TXT data written to @p aBuffer.
+     *
+     * @retval OTBR_ERROR_NONE          Successfully write the TXT entry list.
+     * @retval OTBR_ERROR_INVALID_ARGS  The @p aTxtList includes invalid TXT entry or @p aBuffer is too small.
+     */
+    static otbrError EncodeTxtData(const TxtList &aTxtList, uint8_t *aBuffer, size_t aBufferSize, size_t &aTxtLength);
+
+    /**
+     * This function looks up a TXT entry by key in a TXT data buffer, without decoding the other entries.
+     *
+     * @param[in]  aTxtData    A pointer to TXT data.
+     * @param[in]  aTxtLength  The TXT data length.
+     * @param[in]  aKey        The key to look up (case-insensitive).
+     * @param[out] aEntry      On success, the view of the first entry matching @p aKey.
+     *
+     * @retval OTBR_ERROR_NONE       Successfully found the entry.
+     * @retval OTBR_ERROR_NOT_FOUND  There is no entry with @p aKey.
+     * @retval OTBR_ERROR_PARSE      The TXT data is malformed.
+     */
+    static otbrError FindTxtEntry(const uint8_t *aTxtData, size_t aTxtLength, const char *aKey, TxtEntryView &aEntry);
+
 protected:
     static constexpr uint8_t kMaxTextEntrySize = 255;
 
@@ -430,9 +578,14 @@ protected:
         ResultCallback mCallback;
         Publisher     *mPublisher;
 
+        Timepoint      mBeginTime;  // The time this registration was started, for the latency statistics.
+        Timepoint      mUpdateTime; // The last time this registration was created or updated in place.
+
         Registration(ResultCallback &&aCallback, Publisher *aPublisher)
             : mCallback(std::move(aCallback))
             , mPublisher(aPublisher)
+            , mBeginTime(Clock::now())
+            , mUpdateTime(mBeginTime)
         {
         }
         virtual ~Registration(void);
@@ -492,6 +645,10 @@ protected:
                         uint16_t           aPort,
                         const TxtData     &aTxtData) const;
 
+        // Updates the TXT data of this registration without re-registering the service. Implementations
+        // which support it update `mTxtData` on success.
+        virtual otbrError UpdateTxtData(const TxtData &aTxtData);
+
     private:
         void OnComplete(otbrError aError);
     };
@@ -516,6 +673,11 @@ protected:
         // Tells whether this `HostRegistration` object is outdated comparing to the given parameters.
         bool IsOutdated(const std::string &aName, const AddressList &aAddresses) const;
 
+        // Updates the addresses of this registration by only adding and removing the changed address records.
+        // Implementations which support it update `mAddresses` on success and must leave the registration in a
+        // state which can be unregistered on failure.
+        virtual otbrError UpdateAddresses(const AddressList &aAddresses);
+
     private:
         void OnComplete(otbrError aError);
     };
@@ -551,6 +713,28 @@ protected:
     using KeyRegistrationPtr     = std::shared_ptr<KeyRegistration>;
     using KeyRegistrationMap     = std::map<std::string, KeyRegistrationPtr>;
 
+    struct PendingServiceUpdate
+    {
+        std::string        mHostName;
+        std::string        mName;
+        std::string        mType;
+        SubTypeList        mSubTypeList;
+        uint16_t           mPort;
+        TxtData            mTxtData;
+        ResultCallback     mCallback;
+        TaskRunner::TaskId mTaskId;
+    };
+
+    struct PendingHostUpdate
+    {
+        std::string        mName;
+        AddressList        mAddresses;
+        ResultCallback     mCallback;
+        TaskRunner::TaskId mTaskId;
+    };
+
+    static const Milliseconds kUpdateDebounceInterval;
+
     static SubTypeList SortSubTypeList(SubTypeList aSubTypeList);
     static AddressList SortAddressList(AddressList aAddressList);
     static std::string MakeFullName(const std::string &aName);
@@ -585,11 +769,28 @@ protected:
     ServiceRegistration *FindServiceRegistration(const std::string &aName, const std::string &aType);
     ServiceRegistration *FindServiceRegistration(const std::string &aNameAndType);
 
-    void OnServiceResolved(std::string aType, DiscoveredInstanceInfo aInstanceInfo);
-    void OnServiceResolveFailed(std::string aType, std::string aInstanceName, int32_t aErrorCode);
+    // `aBeginTime` is the time the resolution was started, or `Timepoint::min()` if the result is not the first
+    // one of a resolution and is therefore not counted in the latency statistics. See `TakeBeginTime()`.
+    void OnServiceResolved(std::string            aType,
+                           DiscoveredInstanceInfo aInstanceInfo,
+                           Timepoint              aBeginTime = Timepoint::min());
+    void OnServiceResolveFailed(std::string aType,
+                                std::string aInstanceName,
+                                int32_t     aErrorCode,
+                                Timepoint   aBeginTime = Timepoint::min());
     void OnServiceRemoved(uint32_t aNetifIndex, std::string aType, std::string aInstanceName);
-    void OnHostResolved(std::string aHostName, DiscoveredHostInfo aHostInfo);
-    void OnHostResolveFailed(std::string aHostName, int32_t aErrorCode);
+    void OnHostResolved(std::string aHostName, DiscoveredHostInfo aHostInfo, Timepoint aBeginTime = Timepoint::min());
+    void OnHostResolveFailed(std::string aHostName, int32_t aErrorCode, Timepoint aBeginTime = Timepoint::min());
+
+    // Returns the begin time of a resolution kept by a backend and clears it, so that only the first result of
+    // the resolution is counted in the latency statistics.
+    static Timepoint TakeBeginTime(Timepoint &aBeginTime)
+    {
+        Timepoint beginTime = aBeginTime;
+
+        aBeginTime = Timepoint::min();
+        return beginTime;
+    }
 
     // Handles the cases that there is already a registration for the same service.
     // If the returned callback is completed, current registration should be considered
@@ -619,18 +820,43 @@ protected:
     KeyRegistration *FindKeyRegistration(const std::string &aName);
     KeyRegistration *FindKeyRegistration(const std::string &aName, const std::string &aType);
 
+    // Returns a callback which invokes both @p aFirst and @p aSecond with the result.
+    static ResultCallback MergeResultCallbacks(ResultCallback &&aFirst, ResultCallback &&aSecond);
+
+    // Defers the update of a service or host changed less than `kUpdateDebounceInterval` ago, or coalesces it
+    // with an already deferred one. Returns whether @p aCallback was taken over.
+    bool DebounceServiceUpdate(const std::string &aHostName,
+                               const std::string &aName,
+                               const std::string &aType,
+                               const SubTypeList &aSubTypeList,
+                               uint16_t           aPort,
+                               const TxtData     &aTxtData,
+                               ResultCallback    &aCallback);
+    bool DebounceHostUpdate(const std::string &aName, const AddressList &aAddresses, ResultCallback &aCallback);
+    void FlushServiceUpdate(const std::string &aFullName);
+    void FlushHostUpdate(const std::string &aFullName);
+
+    // Drops deferred updates, their callbacks are invoked with `OTBR_ERROR_ABORTED`. Implementations call these
+    // when a name is unpublished and when the publisher stops.
+    void CancelPendingServiceUpdate(const std::string &aName, const std::string &aType);
+    void CancelPendingHostUpdate(const std::string &aName);
+    void CancelPendingUpdates(void);
+
+    void PublishServiceNow(const std::string &aHostName,
+                           const std::string &aName,
+                           const std::string &aType,
+                           const SubTypeList &aSubTypeList,
+                           uint16_t           aPort,
+                           const TxtData     &aTxtData,
+                           ResultCallback   &&aCallback);
+    void PublishHostNow(const std::string &aName, const AddressList &aAddresses, ResultCallback &&aCallback);
+
     static void UpdateMdnsResponseCounters(MdnsResponseCounters &aCounters, otbrError aError);
     static void UpdateEmaLatency(uint32_t &aEmaLatency, uint32_t aLatency, otbrError aError);
-
-    void UpdateServiceRegistrationEmaLatency(const std::string &aInstanceName,
-                                             const std::string &aType,
-                                             otbrError          aError);
-    void UpdateHostRegistrationEmaLatency(const std::string &aHostName, otbrError aError);
-    void UpdateKeyRegistrationEmaLatency(const std::string &aKeyName, otbrError aError);
-    void UpdateServiceInstanceResolutionEmaLatency(const std::string &aInstanceName,
-                                                   const std::string &aType,
-                                                   otbrError          aError);
-    void UpdateHostResolutionEmaLatency(const std::string &aHostName, otbrError aError);
+    static void UpdateLatency(uint32_t         &aEmaLatency,
+                              LatencyHistogram &aHistogram,
+                              Timepoint         aBeginTime,
+                              otbrError         aError);
 
     static void AddAddress(AddressList &aAddressList, const Ip6Address &aAddress);
     static void RemoveAddress(AddressList &aAddressList, const Ip6Address &aAddress);
@@ -639,38 +865,43 @@ protected:
     HostRegistrationMap    mHostRegistrations;
     KeyRegistrationMap     mKeyRegistrations;
 
+    // Full service or host name -> the update deferred by the debouncing.
+    std::map<std::string, PendingServiceUpdate> mPendingServiceUpdates;
+    std::map<std::string, PendingHostUpdate>    mPendingHostUpdates;
+
+    TaskRunner mTaskRunner;
+
     struct DiscoverCallback
     {
-        DiscoverCallback(uint64_t                          aId,
-                         DiscoveredServiceInstanceCallback aServiceCallback,
-                         DiscoveredHostCallback            aHostCallback)
-            : mId(aId)
-            , mServiceCallback(std::move(aServiceCallback))
+        DiscoverCallback(DiscoveredServiceInstanceCallback aServiceCallback,
+                         DiscoveredHostCallback            aHostCallback,
+                         std::string                       aKey)
+            : mServiceCallback(std::move(aServiceCallback))
             , mHostCallback(std::move(aHostCallback))
-            , mShouldInvoke(false)
+            , mKey(std::move(aKey))
         {
         }
 
-        uint64_t                          mId;
         DiscoveredServiceInstanceCallback mServiceCallback;
         DiscoveredHostCallback            mHostCallback;
-        bool                              mShouldInvoke;
+        std::string                       mKey; // Lowercase service type or host name, empty for all of them.
     };
 
+    // Subscriber IDs in ascending order, which is the order they subscribed in.
+    using SubscriberIdList = std::vector<uint64_t>;
+    // Lowercase service type or host name -> the interested subscribers. The empty key holds the subscribers of all
+    // service types or hosts.
+    using SubscriberIndex = std::unordered_map<std::string, SubscriberIdList>;
+
+    uint64_t                AddDiscoverCallback(DiscoverCallback aCallback);
+    static void             RemoveSubscriber(SubscriberIndex &aIndex, const std::string &aKey, uint64_t aSubscriberId);
+    static SubscriberIdList FindSubscribers(const SubscriberIndex &aIndex, const std::string &aName);
+
     uint64_t mNextSubscriberId = 1;
 
-    std::list<DiscoverCallback> mDiscoverCallbacks;
-
-    // {instance name, service type} -> the timepoint to begin service registration
-    std::map<std::pair<std::string, std::string>, Timepoint> mServiceRegistrationBeginTime;
-    // host name -> the timepoint to begin host registration
-    std::map<std::string, Timepoint> mHostRegistrationBeginTime;
-    // key name -> the timepoint to begin key registration
-    std::map<std::string, Timepoint> mKeyRegistrationBeginTime;
-    // {instance name, service type} -> the timepoint to begin service resolution
-    std::map<std::pair<std::string, std::string>, Timepoint> mServiceInstanceResolutionBeginTime;
-    // host name -> the timepoint to begin host resolution
-    std::map<std::string, Timepoint> mHostResolutionBeginTime;
+    std::unordered_map<uint64_t, DiscoverCallback> mDiscoverCallbacks;
+    SubscriberIndex                                mServiceSubscribers;
+    SubscriberIndex                                mHostSubscribers;
 
 #endif // !OTBR_ENABLE_MDNS_OPENTHREAD
 
@@ -36,6 +36,8 @@
 #include "mdns/mdns_avahi.hpp"
 
 #include <algorithm>
+#include <unordered_map>
+#include <vector>
 
 #include <avahi-client/client.h>
 #include <avahi-common/alternative.h>
@@ -52,6 +54,7 @@
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 #include "common/time.hpp"
+#include "common/timer_queue.hpp"
 
 namespace otbr {
 namespace Mdns {
@@ -72,6 +75,7 @@ struct AvahiWatch
     void              *mContext;      ///< A pointer to application-specific context to use with `mCallback`.
     bool               mShouldReport; ///< Whether or not we need to report events (invoking callback).
     AvahiPoller       &mPoller;       ///< The poller owning this watch.
+    AvahiWatch        *mNext;         ///< The next watch on the same file descriptor.
 
     /**
      * The constructor to initialize an Avahi watch.
@@ -85,10 +89,12 @@ struct AvahiWatch
     AvahiWatch(int aFd, AvahiWatchEvent aEvents, AvahiWatchCallback aCallback, void *aContext, AvahiPoller &aPoller)
         : mFd(aFd)
         , mEvents(aEvents)
+        , mHappened(0)
         , mCallback(aCallback)
         , mContext(aContext)
         , mShouldReport(false)
         , mPoller(aPoller)
+        , mNext(nullptr)
     {
     }
 };
@@ -100,34 +106,26 @@ struct AvahiTimeout
 {
     typedef otbr::Mdns::AvahiPoller AvahiPoller;
 
-    otbr::Timepoint      mTimeout;      ///< Absolute time when this timer timeout.
-    AvahiTimeoutCallback mCallback;     ///< The function to be called when timeout.
-    void                *mContext;      ///< The pointer to application-specific context.
-    bool                 mShouldReport; ///< Whether or not timeout occurred and need to reported (invoking callback).
-    AvahiPoller         &mPoller;       ///< The poller created this timer.
+    otbr::TimerId        mTimerId;  ///< The ID of the timer armed in the poller, or zero if the timer is disabled.
+    AvahiTimeoutCallback mCallback; ///< The function to be called when timeout.
+    void                *mContext;  ///< The pointer to application-specific context.
+    AvahiPoller         &mPoller;   ///< The poller created this timer.
 
     /**
      * The constructor to initialize an AvahiTimeout.
      *
-     * @param[in] aTimeout   A pointer to the time after which the callback should be called.
+     * The timeout is disabled until it is armed by the poller.
+     *
      * @param[in] aCallback  The function to be called after timeout.
      * @param[in] aContext   A pointer to application-specific context.
      * @param[in] aPoller    The AvahiPoller this timeout belongs to.
      */
-    AvahiTimeout(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext, AvahiPoller &aPoller)
-        : mCallback(aCallback)
+    AvahiTimeout(AvahiTimeoutCallback aCallback, void *aContext, AvahiPoller &aPoller)
+        : mTimerId(0)
+        , mCallback(aCallback)
         , mContext(aContext)
-        , mShouldReport(false)
         , mPoller(aPoller)
     {
-        if (aTimeout)
-        {
-            mTimeout = otbr::Clock::now() + otbr::FromTimeval<otbr::Microseconds>(*aTimeout);
-        }
-        else
-        {
-            mTimeout = otbr::Timepoint::min();
-        }
     }
 };
 
@@ -171,21 +169,36 @@ static otbrError DnsErrorToOtbrError(int aAvahiError)
     return error;
 }
 
+/**
+ * This class implements the Avahi poll API on top of the agent main loop.
+ *
+ * Watches are indexed by file descriptor and each watched file descriptor is registered with the main loop
+ * once, so that only the watches on ready file descriptors are visited when dispatching events. Timeouts are
+ * kept in the same timer queue as used by the `TaskRunner`, so that computing the next deadline and
+ * dispatching expired timeouts does not visit idle timeouts.
+ */
 class AvahiPoller : public MainloopProcessor
 {
 public:
     AvahiPoller(void);
 
-    // Implementation of MainloopProcessor.
+    const AvahiPoll *GetAvahiPoll(void) const { return &mAvahiPoll; }
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+protected:
+    // Implementation of MainloopProcessor.
 
-    const AvahiPoll *GetAvahiPoll(void) const { return &mAvahiPoll; }
+    Timepoint GetDeadline(void) const override;
+    void      HandleFdEvent(int aFd, uint8_t aEvents) override;
+    void      HandleTimeout(void) override;
 
 private:
-    typedef std::vector<AvahiWatch *>   Watches;
-    typedef std::vector<AvahiTimeout *> Timers;
+    struct FdWatches
+    {
+        AvahiWatch *mHead;   ///< The list of watches on this file descriptor.
+        int         mEvents; ///< The union of the events of all watches on this file descriptor.
+    };
+
+    typedef std::unordered_map<int, FdWatches> Watches;
 
     static AvahiWatch     *WatchNew(const struct AvahiPoll *aPoll,
                                     int                     aFd,
@@ -206,12 +219,18 @@ private:
     static void            TimeoutFree(AvahiTimeout *aTimer);
     void                   TimeoutFree(AvahiTimeout &aTimer);
 
-    Watches   mWatches;
-    Timers    mTimers;
-    AvahiPoll mAvahiPoll;
+    void UpdateFdEvents(int aFd);
+    void ReportWatches(int aFd, uint8_t aEvents);
+    void ArmTimeout(AvahiTimeout &aTimer, const struct timeval *aTimeout);
+    void DisarmTimeout(AvahiTimeout &aTimer);
+
+    Watches    mWatches;
+    TimerQueue mTimers;
+    AvahiPoll  mAvahiPoll;
 };
 
 AvahiPoller::AvahiPoller(void)
+    : MainloopProcessor(Registration::kPersistent)
 {
     mAvahiPoll.userdata         = this;
     mAvahiPoll.watch_new        = WatchNew;
@@ -235,16 +254,30 @@ AvahiWatch *AvahiPoller::WatchNew(const struct AvahiPoll *aPoll,
 
 AvahiWatch *AvahiPoller::WatchNew(int aFd, AvahiWatchEvent aEvent, AvahiWatchCallback aCallback, void *aContext)
 {
+    AvahiWatch *watch;
+    auto        iter = mWatches.find(aFd);
+
     assert(aEvent && aCallback && aFd >= 0);
 
-    mWatches.push_back(new AvahiWatch(aFd, aEvent, aCallback, aContext, *this));
+    watch = new AvahiWatch(aFd, aEvent, aCallback, aContext, *this);
 
-    return mWatches.back();
+    if (iter == mWatches.end())
+    {
+        iter = mWatches.emplace(aFd, FdWatches{nullptr, 0}).first;
+        RegisterFd(aFd, 0);
+    }
+
+    watch->mNext       = iter->second.mHead;
+    iter->second.mHead = watch;
+    UpdateFdEvents(aFd);
+
+    return watch;
 }
 
 void AvahiPoller::WatchUpdate(AvahiWatch *aWatch, AvahiWatchEvent aEvent)
 {
     aWatch->mEvents = aEvent;
+    aWatch->mPoller.UpdateFdEvents(aWatch->mFd);
 }
 
 AvahiWatchEvent AvahiPoller::WatchGetEvents(AvahiWatch *aWatch)
@@ -259,15 +292,64 @@ void AvahiPoller::WatchFree(AvahiWatch *aWatch)
 
 void AvahiPoller::WatchFree(AvahiWatch &aWatch)
 {
-    for (Watches::iterator it = mWatches.begin(); it != mWatches.end(); ++it)
+    auto iter = mWatches.find(aWatch.mFd);
+
+    VerifyOrExit(iter != mWatches.end());
+
+    for (AvahiWatch **link = &iter->second.mHead; *link != nullptr; link = &(*link)->mNext)
     {
-        if (*it == &aWatch)
+        if (*link == &aWatch)
         {
-            mWatches.erase(it);
+            *link = aWatch.mNext;
             delete &aWatch;
             break;
         }
     }
+
+    if (iter->second.mHead == nullptr)
+    {
+        UnregisterFd(iter->first);
+        mWatches.erase(iter);
+    }
+    else
+    {
+        UpdateFdEvents(iter->first);
+    }
+
+exit:
+    return;
+}
+
+void AvahiPoller::UpdateFdEvents(int aFd)
+{
+    FdWatches &fdWatches = mWatches[aFd];
+    uint8_t    events    = 0;
+
+    fdWatches.mEvents = 0;
+
+    for (AvahiWatch *watch = fdWatches.mHead; watch != nullptr; watch = watch->mNext)
+    {
+        fdWatches.mEvents |= watch->mEvents;
+    }
+
+    if (AVAHI_WATCH_IN & fdWatches.mEvents)
+    {
+        events |= kEventReadable;
+    }
+
+    if (AVAHI_WATCH_OUT & fdWatches.mEvents)
+    {
+        events |= kEventWritable;
+    }
+
+    if (AVAHI_WATCH_ERR & fdWatches.mEvents)
+    {
+        events |= kEventError;
+    }
+
+    // TODO what do with AVAHI_WATCH_HUP event type?
+
+    ModifyFd(aFd, events);
 }
 
 AvahiTimeout *AvahiPoller::TimeoutNew(const AvahiPoll      *aPoll,
@@ -281,20 +363,17 @@ AvahiTimeout *AvahiPoller::TimeoutNew(const AvahiPoll      *aPoll,
 
 AvahiTimeout *AvahiPoller::TimeoutNew(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext)
 {
-    mTimers.push_back(new AvahiTimeout(aTimeout, aCallback, aContext, *this));
-    return mTimers.back();
+    AvahiTimeout *timer = new AvahiTimeout(aCallback, aContext, *this);
+
+    ArmTimeout(*timer, aTimeout);
+
+    return timer;
 }
 
 void AvahiPoller::TimeoutUpdate(AvahiTimeout *aTimer, const struct timeval *aTimeout)
 {
-    if (aTimeout == nullptr)
-    {
-        aTimer->mTimeout = Timepoint::min();
-    }
-    else
-    {
-        aTimer->mTimeout = Clock::now() + FromTimeval<Microseconds>(*aTimeout);
-    }
+    aTimer->mPoller.DisarmTimeout(*aTimer);
+    aTimer->mPoller.ArmTimeout(*aTimer, aTimeout);
 }
 
 void AvahiPoller::TimeoutFree(AvahiTimeout *aTimer)
@@ -304,166 +383,117 @@ void AvahiPoller::TimeoutFree(AvahiTimeout *aTimer)
 
 void AvahiPoller::TimeoutFree(AvahiTimeout &aTimer)
 {
-    for (Timers::iterator it = mTimers.begin(); it != mTimers.end(); ++it)
-    {
-        if (*it == &aTimer)
-        {
-            mTimers.erase(it);
-            delete &aTimer;
-            break;
-        }
-    }
+    DisarmTimeout(aTimer);
+    delete &aTimer;
 }
 
-void AvahiPoller::Update(MainloopContext &aMainloop)
+void AvahiPoller::ArmTimeout(AvahiTimeout &aTimer, const struct timeval *aTimeout)
 {
-    Timepoint now = Clock::now();
+    AvahiTimeout *timer = &aTimer;
 
-    for (AvahiWatch *watch : mWatches)
-    {
-        int             fd     = watch->mFd;
-        AvahiWatchEvent events = watch->mEvents;
+    VerifyOrExit(aTimeout != nullptr);
 
-        if (AVAHI_WATCH_IN & events)
-        {
-            FD_SET(fd, &aMainloop.mReadFdSet);
-        }
+    aTimer.mTimerId = mTimers.Add(Clock::now() + FromTimeval<Microseconds>(*aTimeout), [timer]() {
+        // Like other Avahi poll implementations, a timeout fires once and stays disabled until updated.
+        timer->mTimerId = 0;
+        timer->mCallback(timer, timer->mContext);
+    });
 
-        if (AVAHI_WATCH_OUT & events)
-        {
-            FD_SET(fd, &aMainloop.mWriteFdSet);
-        }
-
-        if (AVAHI_WATCH_ERR & events)
-        {
-            FD_SET(fd, &aMainloop.mErrorFdSet);
-        }
-
-        if (AVAHI_WATCH_HUP & events)
-        {
-            // TODO what do with this event type?
-        }
-
-        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
+exit:
+    return;
+}
 
-        watch->mHappened = 0;
+void AvahiPoller::DisarmTimeout(AvahiTimeout &aTimer)
+{
+    if (aTimer.mTimerId != 0)
+    {
+        mTimers.Remove(aTimer.mTimerId);
+        aTimer.mTimerId = 0;
     }
+}
 
-    for (AvahiTimeout *timer : mTimers)
-    {
-        Timepoint timeout = timer->mTimeout;
+Timepoint AvahiPoller::GetDeadline(void) const
+{
+    return mTimers.IsEmpty() ? Timepoint::max() : mTimers.GetNextDeadline();
+}
 
-        if (timeout == Timepoint::min())
-        {
-            continue;
-        }
+void AvahiPoller::HandleFdEvent(int aFd, uint8_t aEvents)
+{
+    ReportWatches(aFd, aEvents);
+}
 
-        if (timeout <= now)
-        {
-            aMainloop.mTimeout = ToTimeval(Microseconds::zero());
-            break;
-        }
-        else
-        {
-            auto delay = std::chrono::duration_cast<Microseconds>(timeout - now);
+void AvahiPoller::HandleTimeout(void)
+{
+    Timepoint now = Clock::now();
+    TimerTask task;
 
-            if (delay < FromTimeval<Microseconds>(aMainloop.mTimeout))
-            {
-                aMainloop.mTimeout = ToTimeval(delay);
-            }
-        }
+    // Timeouts which are updated or freed by a callback are removed from the queue,
+    // so only armed timeouts are reported here.
+    while (mTimers.PopExpired(now, task))
+    {
+        task();
     }
 }
 
-void AvahiPoller::Process(const MainloopContext &aMainloop)
+void AvahiPoller::ReportWatches(int aFd, uint8_t aEvents)
 {
-    Timepoint now          = Clock::now();
-    bool      shouldReport = false;
+    auto iter = mWatches.find(aFd);
+
+    VerifyOrExit(iter != mWatches.end());
 
-    for (AvahiWatch *watch : mWatches)
+    for (AvahiWatch *watch = iter->second.mHead; watch != nullptr; watch = watch->mNext)
     {
-        int             fd     = watch->mFd;
         AvahiWatchEvent events = watch->mEvents;
 
         watch->mHappened = 0;
 
-        if ((AVAHI_WATCH_IN & events) && FD_ISSET(fd, &aMainloop.mReadFdSet))
+        if ((AVAHI_WATCH_IN & events) && (aEvents & kEventReadable))
         {
             watch->mHappened |= AVAHI_WATCH_IN;
         }
 
-        if ((AVAHI_WATCH_OUT & events) && FD_ISSET(fd, &aMainloop.mWriteFdSet))
+        if ((AVAHI_WATCH_OUT & events) && (aEvents & kEventWritable))
         {
             watch->mHappened |= AVAHI_WATCH_OUT;
         }
 
-        if ((AVAHI_WATCH_ERR & events) && FD_ISSET(fd, &aMainloop.mErrorFdSet))
+        if ((AVAHI_WATCH_ERR & events) && (aEvents & kEventError))
         {
             watch->mHappened |= AVAHI_WATCH_ERR;
         }
 
-        if (watch->mHappened != 0)
-        {
-            watch->mShouldReport = true;
-            shouldReport         = true;
-        }
+        watch->mShouldReport = (watch->mHappened != 0);
     }
 
-    // When we invoke the callback for an `AvahiWatch` or `AvahiTimeout`,
-    // the Avahi module can call any of `mAvahiPoll` APIs we provided to
-    // it. For example, it can update or free any of `AvahiWatch/Timeout`
-    // entries, which in turn, modifies our `mWatches` or `mTimers` list.
+    // When we invoke the callback for an `AvahiWatch`, the Avahi module
+    // can call any of `mAvahiPoll` APIs we provided to it. For example,
+    // it can update or free any of the watches on this file descriptor.
     // So, before invoking the callback, we update the entry's state and
-    // then restart the iteration over the `mWacthes` list to find the
-    // next entry to report, as the list may have changed.
+    // then look up the file descriptor again to find the next watch to
+    // report, as its list may have changed.
 
-    while (shouldReport)
+    while (true)
     {
-        shouldReport = false;
+        AvahiWatch *watch;
 
-        for (AvahiWatch *watch : mWatches)
-        {
-            if (watch->mShouldReport)
-            {
-                shouldReport         = true;
-                watch->mShouldReport = false;
-                watch->mCallback(watch, watch->mFd, WatchGetEvents(watch), watch->mContext);
-
-                break;
-            }
-        }
-    }
+        iter = mWatches.find(aFd);
+        VerifyOrExit(iter != mWatches.end());
 
-    for (AvahiTimeout *timer : mTimers)
-    {
-        if (timer->mTimeout == Timepoint::min())
-        {
-            continue;
-        }
+        watch = iter->second.mHead;
 
-        if (timer->mTimeout <= now)
+        while (watch != nullptr && !watch->mShouldReport)
         {
-            timer->mShouldReport = true;
-            shouldReport         = true;
+            watch = watch->mNext;
         }
-    }
 
-    while (shouldReport)
-    {
-        shouldReport = false;
+        VerifyOrExit(watch != nullptr);
 
-        for (AvahiTimeout *timer : mTimers)
-        {
-            if (timer->mShouldReport)
-            {
-                shouldReport         = true;
-                timer->mShouldReport = false;
-                timer->mCallback(timer, timer->mContext);
-
-                break;
-            }
-        }
+        watch->mShouldReport = false;
+        watch->mCallback(watch, aFd, WatchGetEvents(watch), watch->mContext);
     }
+
+exit:
+    return;
 }
 
 PublisherAvahi::PublisherAvahi(StateCallback aStateCallback)
@@ -484,6 +514,35 @@ PublisherAvahi::AvahiServiceRegistration::~AvahiServiceRegistration(void)
     ReleaseGroup(mEntryGroup);
 }
 
+otbrError PublisherAvahi::AvahiServiceRegistration::UpdateTxtData(const TxtData &aTxtData)
+{
+    otbrError error      = OTBR_ERROR_NONE;
+    int       avahiError = AVAHI_OK;
+
+    // Aligned with AvahiStringList
+    AvahiStringList  txtBuffer[(kMaxSizeOfTxtRecord - 1) / sizeof(AvahiStringList) + 1];
+    AvahiStringList *txtHead = nullptr;
+
+    VerifyOrExit(mPublisher->IsStarted(), error = OTBR_ERROR_INVALID_STATE);
+    SuccessOrExit(error = TxtDataToAvahiStringList(aTxtData, txtBuffer, sizeof(txtBuffer), txtHead));
+
+    // Only the TXT record is replaced, the entry group stays established.
+    avahiError = avahi_entry_group_update_service_txt_strlst(mEntryGroup, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC,
+                                                             AvahiPublishFlags{}, mName.c_str(), mType.c_str(),
+                                                             /* domain */ nullptr, txtHead);
+    VerifyOrExit(avahiError == AVAHI_OK, error = OTBR_ERROR_MDNS);
+
+    mTxtData = aTxtData;
+
+exit:
+    if (avahiError != AVAHI_OK)
+    {
+        otbrLogWarning("Failed to update TXT data of service %s.%s: %s", mName.c_str(), mType.c_str(),
+                       avahi_strerror(avahiError));
+    }
+    return error;
+}
+
 PublisherAvahi::AvahiHostRegistration::~AvahiHostRegistration(void)
 {
     ReleaseGroup(mEntryGroup);
@@ -519,6 +578,8 @@ bool PublisherAvahi::IsStarted(void) const
 
 void PublisherAvahi::Stop(void)
 {
+    CancelPendingUpdates();
+
     mServiceRegistrations.clear();
     mHostRegistrations.clear();
 
@@ -774,6 +835,8 @@ void PublisherAvahi::UnpublishService(const std::string &aName, const std::strin
 {
     otbrError error = OTBR_ERROR_NONE;
 
+    CancelPendingServiceUpdate(aName, aType);
+
     VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
     RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
 
@@ -839,6 +902,8 @@ void PublisherAvahi::UnpublishHost(const std::string &aName, ResultCallback &&aC
 {
     otbrError error = OTBR_ERROR_NONE;
 
+    CancelPendingHostUpdate(aName);
+
     VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
     RemoveHostRegistration(aName, OTBR_ERROR_ABORTED);
 
@@ -908,42 +973,36 @@ otbrError PublisherAvahi::TxtDataToAvahiStringList(const TxtData    &aTxtData,
                                                    size_t            aBufferSize,
                                                    AvahiStringList *&aHead)
 {
-    otbrError        error = OTBR_ERROR_NONE;
-    size_t           used  = 0;
-    AvahiStringList *last  = nullptr;
-    AvahiStringList *curr  = aBuffer;
+    otbrError        error;
+    size_t           used = 0;
+    AvahiStringList *last = nullptr;
+    AvahiStringList *curr = aBuffer;
     const uint8_t   *next;
-    const uint8_t   *data    = aTxtData.data();
-    const uint8_t   *dataEnd = aTxtData.data() + aTxtData.size();
+    TxtIterator      iterator(aTxtData.data(), aTxtData.size());
+    TxtEntryView     entry;
 
     aHead = nullptr;
 
-    while (data < dataEnd)
+    // Each entry is copied once from the TXT data straight into the string list buffer.
+    while ((error = iterator.GetNextEntry(entry)) == OTBR_ERROR_NONE)
     {
-        uint8_t entryLength = *data++;
+        uint8_t entryLength = entry.GetEntryLength();
         size_t  needed      = sizeof(AvahiStringList) - sizeof(AvahiStringList::text) + entryLength;
 
-        if (entryLength == 0)
-        {
-            continue;
-        }
-
-        VerifyOrExit(data + entryLength <= dataEnd, error = OTBR_ERROR_PARSE);
-
         VerifyOrExit(used + needed <= aBufferSize, error = OTBR_ERROR_INVALID_ARGS);
         curr->next = last;
         last       = curr;
 
-        memcpy(curr->text, data, entryLength);
+        memcpy(curr->text, entry.mKey, entryLength);
         curr->size = entryLength;
 
-        data += entryLength;
-
         next = curr->text + curr->size;
         curr = OTBR_ALIGNED(next, AvahiStringList *);
         used = static_cast<size_t>(reinterpret_cast<uint8_t *>(curr) - reinterpret_cast<uint8_t *>(aBuffer));
     }
 
+    VerifyOrExit(error == OTBR_ERROR_NOT_FOUND);
+    error = OTBR_ERROR_NONE;
     aHead = last;
 
 exit:
@@ -1211,12 +1270,11 @@ void PublisherAvahi::ServiceSubscription::Resolve(uint32_t           aInterfaceI
 {
     auto serviceResolver = MakeUnique<ServiceResolver>();
 
-    mPublisherAvahi->mServiceInstanceResolutionBeginTime[std::make_pair(aInstanceName, aType)] = Clock::now();
-
     otbrLogInfo("Resolve service %s.%s inf %" PRIu32, aInstanceName.c_str(), aType.c_str(), aInterfaceIndex);
 
     serviceResolver->mType            = aType;
     serviceResolver->mPublisherAvahi  = this->mPublisherAvahi;
+    serviceResolver->mBeginTime       = Clock::now();
     serviceResolver->mServiceResolver = avahi_service_resolver_new(
         mPublisherAvahi->mClient, aInterfaceIndex, aProtocol, aInstanceName.c_str(), aType.c_str(),
         /* domain */ nullptr, AVAHI_PROTO_UNSPEC, static_cast<AvahiLookupFlags>(AVAHI_LOOKUP_NO_ADDRESS),
@@ -1331,7 +1389,7 @@ exit:
     }
     if (!resolved && avahiError != AVAHI_OK)
     {
-        mPublisherAvahi->OnServiceResolveFailed(aType, aName, avahiError);
+        mPublisherAvahi->OnServiceResolveFailed(aType, aName, avahiError, TakeBeginTime(mBeginTime));
     }
 }
 
@@ -1421,11 +1479,11 @@ exit:
     if (mResolved && shouldReport)
     {
         // NOTE: This `HostSubscrption` object may be freed in `OnHostResolved`.
-        mPublisherAvahi->OnServiceResolved(mType, mInstanceInfo);
+        mPublisherAvahi->OnServiceResolved(mType, mInstanceInfo, TakeBeginTime(mBeginTime));
     }
     else if (avahiError != AVAHI_OK)
     {
-        mPublisherAvahi->OnServiceResolveFailed(mType, mInstanceInfo.mName, avahiError);
+        mPublisherAvahi->OnServiceResolveFailed(mType, mInstanceInfo.mName, avahiError, TakeBeginTime(mBeginTime));
     }
 }
 
@@ -1471,7 +1529,7 @@ void PublisherAvahi::HostSubscription::Resolve(void)
 {
     std::string fullHostName = MakeFullHostName(mHostName);
 
-    mPublisherAvahi->mHostResolutionBeginTime[mHostName] = Clock::now();
+    mBeginTime = Clock::now();
 
     otbrLogInfo("Resolve host %s inf %d", fullHostName.c_str(), static_cast<int>(AVAHI_IF_UNSPEC));
     mRecordBrowser = avahi_record_browser_new(mPublisherAvahi->mClient, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC,
@@ -1574,11 +1632,11 @@ exit:
     if (mResolved && shouldReport)
     {
         // NOTE: This `HostSubscrption` object may be freed in `OnHostResolved`.
-        mPublisherAvahi->OnHostResolved(mHostName, mHostInfo);
+        mPublisherAvahi->OnHostResolved(mHostName, mHostInfo, TakeBeginTime(mBeginTime));
     }
     else if (avahiError != AVAHI_OK)
     {
-        mPublisherAvahi->OnHostResolveFailed(mHostName, avahiError);
+        mPublisherAvahi->OnHostResolveFailed(mHostName, avahiError, TakeBeginTime(mBeginTime));
     }
 }
 
@@ -135,6 +135,7 @@ private:
 
         ~AvahiServiceRegistration(void) override;
         const AvahiEntryGroup *GetEntryGroup(void) const { return mEntryGroup; }
+        otbrError              UpdateTxtData(const TxtData &aTxtData) override;
 
     private:
         AvahiEntryGroup *mEntryGroup;
@@ -197,6 +198,7 @@ private:
             , mHostName(std::move(aHostName))
             , mRecordBrowser(nullptr)
             , mResolved(false)
+            , mBeginTime(Timepoint::min())
         {
         }
 
@@ -231,6 +233,7 @@ private:
         DiscoveredHostInfo  mHostInfo;
         AvahiRecordBrowser *mRecordBrowser;
         bool                mResolved;
+        Timepoint           mBeginTime; // When `Resolve()` was called, until the first result is reported.
     };
 
     struct ServiceResolver
@@ -302,7 +305,8 @@ private:
         AvahiServiceResolver  *mServiceResolver = nullptr;
         AvahiRecordBrowser    *mRecordBrowser   = nullptr;
         DiscoveredInstanceInfo mInstanceInfo;
-        bool                   mResolved = false;
+        bool                   mResolved  = false;
+        Timepoint              mBeginTime = Timepoint::min(); // When resolving started, until the first result.
     };
     struct ServiceSubscription : public Subscription
     {
@@ -253,7 +253,8 @@ bool IsRetryableError(DNSServiceErrorType aError)
 }
 
 PublisherMDnsSd::PublisherMDnsSd(StateCallback aCallback)
-    : mHostsRef(nullptr)
+    : MainloopProcessor(Registration::kPersistent)
+    , mSharedRef(nullptr)
     , mState(State::kIdle)
     , mStateCallback(std::move(aCallback))
 {
@@ -278,13 +279,21 @@ bool PublisherMDnsSd::IsStarted(void) const
 
 void PublisherMDnsSd::Stop(StopMode aStopMode)
 {
+    DNSServiceRef brokenRef = nullptr;
+
     VerifyOrExit(mState == State::kReady);
 
     // If we get a `kDNSServiceErr_ServiceNotRunning` and need to
-    // restart the `Publisher`, we should immediately de-allocate
-    // all `ServiceRef`. Otherwise, we first clear the `Registrations`
+    // restart the `Publisher`, we should not try to remove records
+    // over the broken connection, so `mSharedRef` is detached first
+    // and `DnssdHostRegisteration` and `DnssdKeyRegistration` skip
+    // their updates. Otherwise, we first clear the `Registrations`
     // list so that `DnssdHostRegisteration` destructor gets the chance
     // to update registered records if needed.
+    //
+    // In both cases, the shared connection is deallocated last since
+    // deallocating it implicitly frees all subordinate `DNSServiceRef`s
+    // still held by the registrations and subscriptions.
 
     switch (aStopMode)
     {
@@ -292,192 +301,99 @@ void PublisherMDnsSd::Stop(StopMode aStopMode)
         break;
 
     case kStopOnServiceNotRunningError:
-        DeallocateHostsRef();
+        brokenRef  = mSharedRef;
+        mSharedRef = nullptr;
         break;
     }
 
+    CancelPendingUpdates();
+
     mServiceRegistrations.clear();
     mHostRegistrations.clear();
     mKeyRegistrations.clear();
-    DeallocateHostsRef();
 
     mSubscribedServices.clear();
     mSubscribedHosts.clear();
 
-    mState = State::kIdle;
-
-exit:
-    return;
-}
-
-DNSServiceErrorType PublisherMDnsSd::CreateSharedHostsRef(void)
-{
-    DNSServiceErrorType dnsError = kDNSServiceErr_NoError;
-
-    VerifyOrExit(mHostsRef == nullptr);
-
-    dnsError = DNSServiceCreateConnection(&mHostsRef);
-    otbrLogDebug("Created new shared DNSServiceRef: %p", mHostsRef);
-
-exit:
-    return dnsError;
-}
+    DeallocateSharedConnection();
 
-void PublisherMDnsSd::DeallocateHostsRef(void)
-{
-    VerifyOrExit(mHostsRef != nullptr);
+    if (brokenRef != nullptr)
+    {
+        DNSServiceRefDeallocate(brokenRef);
+        otbrLogDebug("Deallocated broken shared DNSServiceRef: %p", brokenRef);
+    }
 
-    HandleServiceRefDeallocating(mHostsRef);
-    DNSServiceRefDeallocate(mHostsRef);
-    otbrLogDebug("Deallocated DNSServiceRef for hosts: %p", mHostsRef);
-    mHostsRef = nullptr;
+    mState = State::kIdle;
 
 exit:
     return;
 }
 
-void PublisherMDnsSd::Update(MainloopContext &aMainloop)
+DNSServiceErrorType PublisherMDnsSd::CreateSharedConnection(void)
 {
-    mTaskRunner.Update(aMainloop);
+    DNSServiceErrorType dnsError = kDNSServiceErr_NoError;
 
-    for (auto &kv : mServiceRegistrations)
-    {
-        auto &serviceReg = static_cast<DnssdServiceRegistration &>(*kv.second);
+    VerifyOrExit(mSharedRef == nullptr);
 
-        serviceReg.Update(aMainloop);
-    }
+    dnsError = DNSServiceCreateConnection(&mSharedRef);
+    otbrLogDebug("Created new shared DNSServiceRef: %p", mSharedRef);
 
-    if (mHostsRef != nullptr)
+    if (dnsError == kDNSServiceErr_NoError)
     {
-        int fd = DNSServiceRefSockFD(mHostsRef);
+        int fd = DNSServiceRefSockFD(mSharedRef);
 
         assert(fd != -1);
 
-        aMainloop.AddFdToReadSet(fd);
-    }
-
-    for (const auto &service : mSubscribedServices)
-    {
-        service->UpdateAll(aMainloop);
+        RegisterFd(fd, kEventReadable);
     }
 
-    for (const auto &host : mSubscribedHosts)
-    {
-        host->Update(aMainloop);
-    }
+exit:
+    return dnsError;
 }
 
-void PublisherMDnsSd::Process(const MainloopContext &aMainloop)
+void PublisherMDnsSd::DeallocateSharedConnection(void)
 {
-    mServiceRefsToProcess.clear();
-
-    mTaskRunner.Process(aMainloop);
-
-    for (auto &kv : mServiceRegistrations)
-    {
-        auto &serviceReg = static_cast<DnssdServiceRegistration &>(*kv.second);
-
-        serviceReg.Process(aMainloop, mServiceRefsToProcess);
-    }
-
-    if (mHostsRef != nullptr)
-    {
-        int fd = DNSServiceRefSockFD(mHostsRef);
-
-        if (FD_ISSET(fd, &aMainloop.mReadFdSet))
-        {
-            mServiceRefsToProcess.push_back(mHostsRef);
-        }
-    }
+    VerifyOrExit(mSharedRef != nullptr);
 
-    for (const auto &service : mSubscribedServices)
-    {
-        service->ProcessAll(aMainloop, mServiceRefsToProcess);
-    }
-
-    for (const auto &host : mSubscribedHosts)
-    {
-        host->Process(aMainloop, mServiceRefsToProcess);
-    }
-
-    for (DNSServiceRef serviceRef : mServiceRefsToProcess)
-    {
-        DNSServiceErrorType error;
-
-        // As we go through the list of `mServiceRefsToProcess` the call
-        // to `DNSServiceProcessResult()` can itself invoke callbacks
-        // into `PublisherMDnsSd` and OT, which in turn, may change the
-        // state of `Publisher` and potentially trigger a previously
-        // valid `ServiceRef` in the list to be deallocated. We use
-        // `HandleServiceRefDeallocating()` which is called whenever a
-        // `ServiceRef` is being deallocated and from this we update
-        // the entry in `mServiceRefsToProcess` list to `nullptr` so to
-        // avoid calling `DNSServiceProcessResult()` on an already
-        // freed `ServiceRef`.
-
-        if (serviceRef == nullptr)
-        {
-            continue;
-        }
+    UnregisterFd(DNSServiceRefSockFD(mSharedRef));
+    DNSServiceRefDeallocate(mSharedRef);
+    otbrLogDebug("Deallocated shared DNSServiceRef: %p", mSharedRef);
+    mSharedRef = nullptr;
 
-        error = DNSServiceProcessResult(serviceRef);
-
-        if (error != kDNSServiceErr_NoError)
-        {
-            otbrLogLevel logLevel = (error == kDNSServiceErr_BadReference) ? OTBR_LOG_INFO : OTBR_LOG_WARNING;
-            otbrLog(logLevel, OTBR_LOG_TAG, "DNSServiceProcessResult failed: %s (serviceRef = %p)",
-                    DNSErrorToString(error), serviceRef);
-        }
-        if (error == kDNSServiceErr_ServiceNotRunning)
-        {
-            otbrLogWarning("Need to reconnect to mdnsd");
-            Stop(kStopOnServiceNotRunningError);
-            Start();
-            ExitNow();
-        }
-    }
 exit:
     return;
 }
 
-void PublisherMDnsSd::HandleServiceRefDeallocating(const DNSServiceRef &aServiceRef)
-{
-    for (DNSServiceRef &entry : mServiceRefsToProcess)
-    {
-        if (entry == aServiceRef)
-        {
-            entry = nullptr;
-        }
-    }
-}
-
-void PublisherMDnsSd::DnssdServiceRegistration::Update(MainloopContext &aMainloop) const
+void PublisherMDnsSd::HandleFdEvent(int aFd, uint8_t aEvents)
 {
-    int fd;
+    DNSServiceErrorType error;
 
-    VerifyOrExit(mServiceRef != nullptr);
+    OTBR_UNUSED_VARIABLE(aFd);
+    OTBR_UNUSED_VARIABLE(aEvents);
 
-    fd = DNSServiceRefSockFD(mServiceRef);
-    VerifyOrExit(fd != -1);
+    VerifyOrExit(mSharedRef != nullptr);
 
-    aMainloop.AddFdToReadSet(fd);
+    // A single `DNSServiceProcessResult()` call on the shared connection
+    // dispatches the pending reply to the callback of the subordinate
+    // `DNSServiceRef` it belongs to. The callbacks may deallocate their
+    // own (or other) subordinate `DNSServiceRef`s, which is safe as long
+    // as the shared connection itself is kept.
 
-exit:
-    return;
-}
+    error = DNSServiceProcessResult(mSharedRef);
 
-void PublisherMDnsSd::DnssdServiceRegistration::Process(const MainloopContext      &aMainloop,
-                                                        std::vector<DNSServiceRef> &aReadyServices) const
-{
-    int fd;
-
-    VerifyOrExit(mServiceRef != nullptr);
-
-    fd = DNSServiceRefSockFD(mServiceRef);
-    VerifyOrExit(fd != -1);
-
-    VerifyOrExit(FD_ISSET(fd, &aMainloop.mReadFdSet));
-    aReadyServices.push_back(mServiceRef);
+    if (error != kDNSServiceErr_NoError)
+    {
+        otbrLogLevel logLevel = (error == kDNSServiceErr_BadReference) ? OTBR_LOG_INFO : OTBR_LOG_WARNING;
+        otbrLog(logLevel, OTBR_LOG_TAG, "DNSServiceProcessResult failed: %s (serviceRef = %p)",
+                DNSErrorToString(error), mSharedRef);
+    }
+    if (error == kDNSServiceErr_ServiceNotRunning)
+    {
+        otbrLogWarning("Need to reconnect to mdnsd");
+        Stop(kStopOnServiceNotRunningError);
+        Start();
+        ExitNow();
+    }
 
 exit:
     return;
@@ -518,13 +434,20 @@ otbrError PublisherMDnsSd::DnssdServiceRegistration::Register(void)
     // most.
     // TODO: Abort on `Timeout` error, as it indicates an unresponsive mDNSResponder. This may require removing
     // `kDNSServiceErr_Timeout` from `IsRetryableError` and adding specific handling for it.
-    dnsError = DNSServiceRegister(&mServiceRef, kDNSServiceFlagsNoAutoRename, kDNSServiceInterfaceIndexAny,
-                                  serviceNameCString, regType.c_str(),
-                                  /* domain */ nullptr, hostNameCString, htons(mPort), mTxtData.size(), mTxtData.data(),
-                                  HandleRegisterResult, this);
+    dnsError = GetPublisher().CreateSharedConnection();
+
+    if (dnsError == kDNSServiceErr_NoError)
+    {
+        mServiceRef = GetPublisher().mSharedRef;
+        dnsError    = DNSServiceRegister(&mServiceRef, kDNSServiceFlagsShareConnection | kDNSServiceFlagsNoAutoRename,
+                                         kDNSServiceInterfaceIndexAny, serviceNameCString, regType.c_str(),
+                                         /* domain */ nullptr, hostNameCString, htons(mPort), mTxtData.size(),
+                                         mTxtData.data(), HandleRegisterResult, this);
+    }
 
     if (dnsError != kDNSServiceErr_NoError)
     {
+        mServiceRef = nullptr;
         HandleRegisterResult(/* aFlags */ 0, dnsError);
     }
 
@@ -537,6 +460,26 @@ exit:
     return GetPublisher().DnsErrorToOtbrError(dnsError);
 }
 
+otbrError PublisherMDnsSd::DnssdServiceRegistration::UpdateTxtData(const TxtData &aTxtData)
+{
+    DNSServiceErrorType dnsError;
+
+    VerifyOrExit(GetPublisher().IsStarted(), dnsError = kDNSServiceErr_ServiceNotRunning);
+    VerifyOrExit(mServiceRef != nullptr, dnsError = kDNSServiceErr_BadReference);
+
+    // A null `DNSRecordRef` refers to the TXT record registered along with the service.
+    dnsError = DNSServiceUpdateRecord(mServiceRef, /* RecordRef */ nullptr, /* flags */ 0, aTxtData.size(),
+                                      aTxtData.data(), /* ttl */ 0);
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+    mTxtData = aTxtData;
+
+exit:
+    otbrLogResult(DNSErrorToOtbrError(dnsError), "Update TXT data of service %s.%s: %s", mName.c_str(), mType.c_str(),
+                  DNSErrorToString(dnsError));
+    return GetPublisher().DnsErrorToOtbrError(dnsError);
+}
+
 void PublisherMDnsSd::DnssdServiceRegistration::Unregister(void)
 {
     DnssdKeyRegistration *keyReg = mRelatedKeyReg;
@@ -557,7 +500,6 @@ void PublisherMDnsSd::DnssdServiceRegistration::Unregister(void)
         keyReg->Unregister();
     }
 
-    GetPublisher().HandleServiceRefDeallocating(mServiceRef);
     DNSServiceRefDeallocate(mServiceRef);
     mServiceRef = nullptr;
 
@@ -624,19 +566,8 @@ otbrError PublisherMDnsSd::DnssdHostRegistration::Register(void)
 
     for (const Ip6Address &address : mAddresses)
     {
-        DNSRecordRef recordRef = nullptr;
-
-        dnsError = GetPublisher().CreateSharedHostsRef();
-        VerifyOrExit(dnsError == kDNSServiceErr_NoError);
-
-        dnsError = DNSServiceRegisterRecord(GetPublisher().mHostsRef, &recordRef, kDNSServiceFlagsShared,
-                                            kDNSServiceInterfaceIndexAny, MakeFullHostName(mName).c_str(),
-                                            kDNSServiceType_AAAA, kDNSServiceClass_IN, sizeof(address.m8), address.m8,
-                                            /* ttl */ 0, HandleRegisterResult, this);
+        dnsError = RegisterAddressRecord(address);
         VerifyOrExit(dnsError == kDNSServiceErr_NoError);
-
-        mAddrRecordRefs.push_back(recordRef);
-        mAddrRegistered.push_back(false);
     }
 
 exit:
@@ -648,35 +579,63 @@ exit:
     return GetPublisher().DnsErrorToOtbrError(dnsError);
 }
 
-void PublisherMDnsSd::DnssdHostRegistration::Unregister(void)
+otbrError PublisherMDnsSd::DnssdHostRegistration::UpdateAddresses(const AddressList &aAddresses)
 {
-    DNSServiceErrorType dnsError;
+    DNSServiceErrorType       dnsError = kDNSServiceErr_NoError;
+    std::vector<DNSRecordRef> addrRecordRefs;
+    std::vector<bool>         addrRegistered;
 
-    VerifyOrExit(GetPublisher().IsStarted());
-    VerifyOrExit(GetPublisher().mHostsRef != nullptr);
+    VerifyOrExit(GetPublisher().IsStarted(), dnsError = kDNSServiceErr_ServiceNotRunning);
+    VerifyOrExit(GetPublisher().mSharedRef != nullptr, dnsError = kDNSServiceErr_BadReference);
+    VerifyOrExit(mAddrRecordRefs.size() == mAddresses.size(), dnsError = kDNSServiceErr_BadState);
 
-    for (size_t index = 0; index < mAddrRecordRefs.size(); index++)
+    // The records of new addresses are appended first, so that the registration can still be
+    // unregistered as a whole if registering one of them fails.
+    for (const Ip6Address &address : aAddresses)
     {
-        const Ip6Address &address = mAddresses[index];
+        if (std::find(mAddresses.begin(), mAddresses.end(), address) == mAddresses.end())
+        {
+            otbrLogInfo("Adding address %s to host %s", address.ToString().c_str(), mName.c_str());
 
-        if (mAddrRegistered[index])
+            dnsError = RegisterAddressRecord(address);
+            VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+            mAddresses.push_back(address);
+        }
+    }
+
+    for (size_t index = 0; index < mAddresses.size(); index++)
+    {
+        if (std::find(aAddresses.begin(), aAddresses.end(), mAddresses[index]) == aAddresses.end())
         {
-            // The Bonjour mDNSResponder somehow doesn't send goodbye message for the AAAA record when it is
-            // removed by `DNSServiceRemoveRecord`. Per RFC 6762, a goodbye message of a record sets its TTL
-            // to zero but the receiver should record the TTL of 1 and flushes the cache 1 second later. Here
-            // we remove the AAAA record after updating its TTL to 1 second. This has the same effect as
-            // sending a goodbye message.
-            // TODO: resolve the goodbye issue with Bonjour mDNSResponder.
-            dnsError = DNSServiceUpdateRecord(GetPublisher().mHostsRef, mAddrRecordRefs[index], kDNSServiceFlagsUnique,
-                                              sizeof(address.m8), address.m8, /* ttl */ 1);
-            otbrLogResult(DNSErrorToOtbrError(dnsError), "Send goodbye message for host %s address %s: %s",
-                          MakeFullHostName(mName).c_str(), address.ToString().c_str(), DNSErrorToString(dnsError));
+            otbrLogInfo("Removing address %s from host %s", mAddresses[index].ToString().c_str(), mName.c_str());
+            RemoveAddressRecord(index);
         }
+    }
 
-        dnsError = DNSServiceRemoveRecord(GetPublisher().mHostsRef, mAddrRecordRefs[index], /* flags */ 0);
+    for (const Ip6Address &address : aAddresses)
+    {
+        size_t index = std::find(mAddresses.begin(), mAddresses.end(), address) - mAddresses.begin();
 
-        otbrLogResult(DNSErrorToOtbrError(dnsError), "Remove record for host %s address %s: %s",
-                      MakeFullHostName(mName).c_str(), address.ToString().c_str(), DNSErrorToString(dnsError));
+        addrRecordRefs.push_back(mAddrRecordRefs[index]);
+        addrRegistered.push_back(mAddrRegistered[index]);
+    }
+
+    mAddresses      = aAddresses;
+    mAddrRecordRefs = std::move(addrRecordRefs);
+    mAddrRegistered = std::move(addrRegistered);
+
+exit:
+    return GetPublisher().DnsErrorToOtbrError(dnsError);
+}
+
+void PublisherMDnsSd::DnssdHostRegistration::Unregister(void)
+{
+    VerifyOrExit(GetPublisher().IsStarted());
+    VerifyOrExit(GetPublisher().mSharedRef != nullptr);
+
+    for (size_t index = 0; index < mAddrRecordRefs.size(); index++)
+    {
+        RemoveAddressRecord(index);
     }
 
 exit:
@@ -684,6 +643,52 @@ exit:
     mAddrRecordRefs.clear();
 }
 
+DNSServiceErrorType PublisherMDnsSd::DnssdHostRegistration::RegisterAddressRecord(const Ip6Address &aAddress)
+{
+    DNSServiceErrorType dnsError;
+    DNSRecordRef        recordRef = nullptr;
+
+    dnsError = GetPublisher().CreateSharedConnection();
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+    dnsError = DNSServiceRegisterRecord(GetPublisher().mSharedRef, &recordRef, kDNSServiceFlagsShared,
+                                        kDNSServiceInterfaceIndexAny, MakeFullHostName(mName).c_str(),
+                                        kDNSServiceType_AAAA, kDNSServiceClass_IN, sizeof(aAddress.m8), aAddress.m8,
+                                        /* ttl */ 0, HandleRegisterResult, this);
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+    mAddrRecordRefs.push_back(recordRef);
+    mAddrRegistered.push_back(false);
+
+exit:
+    return dnsError;
+}
+
+void PublisherMDnsSd::DnssdHostRegistration::RemoveAddressRecord(size_t aIndex)
+{
+    const Ip6Address   &address = mAddresses[aIndex];
+    DNSServiceErrorType dnsError;
+
+    if (mAddrRegistered[aIndex])
+    {
+        // The Bonjour mDNSResponder somehow doesn't send goodbye message for the AAAA record when it is
+        // removed by `DNSServiceRemoveRecord`. Per RFC 6762, a goodbye message of a record sets its TTL
+        // to zero but the receiver should record the TTL of 1 and flushes the cache 1 second later. Here
+        // we remove the AAAA record after updating its TTL to 1 second. This has the same effect as
+        // sending a goodbye message.
+        // TODO: resolve the goodbye issue with Bonjour mDNSResponder.
+        dnsError = DNSServiceUpdateRecord(GetPublisher().mSharedRef, mAddrRecordRefs[aIndex], kDNSServiceFlagsUnique,
+                                          sizeof(address.m8), address.m8, /* ttl */ 1);
+        otbrLogResult(DNSErrorToOtbrError(dnsError), "Send goodbye message for host %s address %s: %s",
+                      MakeFullHostName(mName).c_str(), address.ToString().c_str(), DNSErrorToString(dnsError));
+    }
+
+    dnsError = DNSServiceRemoveRecord(GetPublisher().mSharedRef, mAddrRecordRefs[aIndex], /* flags */ 0);
+
+    otbrLogResult(DNSErrorToOtbrError(dnsError), "Remove record for host %s address %s: %s",
+                  MakeFullHostName(mName).c_str(), address.ToString().c_str(), DNSErrorToString(dnsError));
+}
+
 void PublisherMDnsSd::DnssdHostRegistration::HandleRegisterResult(DNSServiceRef       aServiceRef,
                                                                   DNSRecordRef        aRecordRef,
                                                                   DNSServiceFlags     aFlags,
@@ -774,10 +779,10 @@ otbrError PublisherMDnsSd::DnssdKeyRegistration::Register(void)
     {
         otbrLogInfo("Key %s is being registered individually", mName.c_str());
 
-        dnsError = GetPublisher().CreateSharedHostsRef();
+        dnsError = GetPublisher().CreateSharedConnection();
         VerifyOrExit(dnsError == kDNSServiceErr_NoError);
 
-        dnsError = DNSServiceRegisterRecord(GetPublisher().mHostsRef, &mRecordRef, kDNSServiceFlagsUnique,
+        dnsError = DNSServiceRegisterRecord(GetPublisher().mSharedRef, &mRecordRef, kDNSServiceFlagsUnique,
                                             kDNSServiceInterfaceIndexAny, MakeFullKeyName(mName).c_str(),
                                             kDNSServiceType_KEY, kDNSServiceClass_IN, mKeyData.size(), mKeyData.data(),
                                             /* ttl */ 0, HandleRegisterResult, this);
@@ -811,7 +816,7 @@ void PublisherMDnsSd::DnssdKeyRegistration::Unregister(void)
     }
     else
     {
-        serviceRef = GetPublisher().mHostsRef;
+        serviceRef = GetPublisher().mSharedRef;
 
         otbrLogInfo("Unregistering key %s (was registered individually)", mName.c_str());
     }
@@ -901,6 +906,8 @@ void PublisherMDnsSd::UnpublishService(const std::string &aName, const std::stri
 {
     otbrError error = OTBR_ERROR_NONE;
 
+    CancelPendingServiceUpdate(aName, aType);
+
     VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
     RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
 
@@ -938,6 +945,8 @@ void PublisherMDnsSd::UnpublishHost(const std::string &aName, ResultCallback &&a
 {
     otbrError error = OTBR_ERROR_NONE;
 
+    CancelPendingHostUpdate(aName);
+
     VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
     RemoveHostRegistration(aName, OTBR_ERROR_ABORTED);
 
@@ -1107,40 +1116,21 @@ void PublisherMDnsSd::ServiceRef::DeallocateServiceRef(void)
 {
     if (mServiceRef != nullptr)
     {
-        mPublisher.HandleServiceRefDeallocating(mServiceRef);
         DNSServiceRefDeallocate(mServiceRef);
         mServiceRef = nullptr;
     }
 }
 
-void PublisherMDnsSd::ServiceRef::Update(MainloopContext &aMainloop) const
-{
-    int fd;
-
-    VerifyOrExit(mServiceRef != nullptr);
-
-    fd = DNSServiceRefSockFD(mServiceRef);
-    assert(fd != -1);
-    aMainloop.AddFdToReadSet(fd);
-exit:
-    return;
-}
-
-void PublisherMDnsSd::ServiceRef::Process(const MainloopContext      &aMainloop,
-                                          std::vector<DNSServiceRef> &aReadyServices) const
+DNSServiceErrorType PublisherMDnsSd::ServiceRef::AttachToSharedConnection(void)
 {
-    int fd;
-
-    VerifyOrExit(mServiceRef != nullptr);
+    DNSServiceErrorType dnsError = mPublisher.CreateSharedConnection();
 
-    fd = DNSServiceRefSockFD(mServiceRef);
-    assert(fd != -1);
-    if (FD_ISSET(fd, &aMainloop.mReadFdSet))
+    if (dnsError == kDNSServiceErr_NoError)
     {
-        aReadyServices.push_back(mServiceRef);
+        mServiceRef = mPublisher.mSharedRef;
     }
-exit:
-    return;
+
+    return dnsError;
 }
 
 void PublisherMDnsSd::ServiceSubscription::Release(void)
@@ -1151,11 +1141,24 @@ void PublisherMDnsSd::ServiceSubscription::Release(void)
 
 void PublisherMDnsSd::ServiceSubscription::Browse(void)
 {
+    DNSServiceErrorType dnsError;
+
     assert(mServiceRef == nullptr);
 
     otbrLogInfo("DNSServiceBrowse %s", mType.c_str());
-    DNSServiceBrowse(&mServiceRef, /* flags */ 0, kDNSServiceInterfaceIndexAny, mType.c_str(),
-                     /* domain */ nullptr, HandleBrowseResult, this);
+
+    dnsError = AttachToSharedConnection();
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+    dnsError = DNSServiceBrowse(&mServiceRef, kDNSServiceFlagsShareConnection, kDNSServiceInterfaceIndexAny,
+                                mType.c_str(), /* domain */ nullptr, HandleBrowseResult, this);
+
+exit:
+    if (dnsError != kDNSServiceErr_NoError)
+    {
+        mServiceRef = nullptr;
+        otbrLogWarning("DNSServiceBrowse failed: %s", DNSErrorToString(dnsError));
+    }
 }
 
 void PublisherMDnsSd::ServiceSubscription::HandleBrowseResult(DNSServiceRef       aServiceRef,
@@ -1247,27 +1250,6 @@ void PublisherMDnsSd::ServiceSubscription::Remove(uint32_t           aInterfaceI
     }
 }
 
-void PublisherMDnsSd::ServiceSubscription::UpdateAll(MainloopContext &aMainloop) const
-{
-    Update(aMainloop);
-
-    for (const auto &instance : mResolvingInstances)
-    {
-        instance->Update(aMainloop);
-    }
-}
-
-void PublisherMDnsSd::ServiceSubscription::ProcessAll(const MainloopContext      &aMainloop,
-                                                      std::vector<DNSServiceRef> &aReadyServices) const
-{
-    Process(aMainloop, aReadyServices);
-
-    for (const auto &instance : mResolvingInstances)
-    {
-        instance->Process(aMainloop, aReadyServices);
-    }
-}
-
 bool PublisherMDnsSd::ServiceInstanceResolution::Matches(uint32_t           aInterfaceIndex,
                                                          const std::string &aInstanceName,
                                                          const std::string &aType,
@@ -1286,13 +1268,26 @@ void PublisherMDnsSd::ServiceInstanceResolution::Release(void)
 
 void PublisherMDnsSd::ServiceInstanceResolution::Resolve(void)
 {
+    DNSServiceErrorType dnsError;
+
     assert(mServiceRef == nullptr);
 
-    mSubscription->mPublisher.mServiceInstanceResolutionBeginTime[std::make_pair(mInstanceName, mType)] = Clock::now();
+    mBeginTime = Clock::now();
 
     otbrLogInfo("DNSServiceResolve %s %s inf %u", mInstanceName.c_str(), mType.c_str(), mNetifIndex);
-    DNSServiceResolve(&mServiceRef, /* flags */ kDNSServiceFlagsTimeout, mNetifIndex, mInstanceName.c_str(),
-                      mType.c_str(), mDomain.c_str(), HandleResolveResult, this);
+
+    dnsError = AttachToSharedConnection();
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+    dnsError = DNSServiceResolve(&mServiceRef, kDNSServiceFlagsShareConnection | kDNSServiceFlagsTimeout, mNetifIndex,
+                                 mInstanceName.c_str(), mType.c_str(), mDomain.c_str(), HandleResolveResult, this);
+
+exit:
+    if (dnsError != kDNSServiceErr_NoError)
+    {
+        mServiceRef = nullptr;
+        otbrLogWarning("DNSServiceResolve failed: %s", DNSErrorToString(dnsError));
+    }
 }
 
 void PublisherMDnsSd::ServiceInstanceResolution::HandleResolveResult(DNSServiceRef        aServiceRef,
@@ -1361,7 +1356,8 @@ exit:
     }
     else if (aErrorCode != kDNSServiceErr_NoError || error != OTBR_ERROR_NONE)
     {
-        mSubscription->mPublisher.OnServiceResolveFailed(mSubscription->mType, mInstanceName, aErrorCode);
+        mSubscription->mPublisher.OnServiceResolveFailed(mSubscription->mType, mInstanceName, aErrorCode,
+                                                         TakeBeginTime(mBeginTime));
         FinishResolution();
     }
 }
@@ -1374,12 +1370,17 @@ otbrError PublisherMDnsSd::ServiceInstanceResolution::GetAddrInfo(uint32_t aInte
 
     otbrLogInfo("DNSServiceGetAddrInfo %s inf %d", mInstanceInfo.mHostName.c_str(), aInterfaceIndex);
 
-    dnsError = DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, aInterfaceIndex,
+    dnsError = AttachToSharedConnection();
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+    dnsError = DNSServiceGetAddrInfo(&mServiceRef, kDNSServiceFlagsShareConnection, aInterfaceIndex,
                                      kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4,
                                      mInstanceInfo.mHostName.c_str(), HandleGetAddrInfoResult, this);
 
+exit:
     if (dnsError != kDNSServiceErr_NoError)
     {
+        mServiceRef = nullptr;
         otbrLogWarning("DNSServiceGetAddrInfo failed: %s", DNSErrorToString(dnsError));
     }
 
@@ -1461,9 +1462,10 @@ void PublisherMDnsSd::ServiceInstanceResolution::FinishResolution(void)
     ServiceSubscription   *subscription = mSubscription;
     std::string            serviceName  = mSubscription->mType;
     DiscoveredInstanceInfo instanceInfo = mInstanceInfo;
+    Timepoint              beginTime    = TakeBeginTime(mBeginTime);
 
     // NOTE: The `ServiceSubscription` object may be freed in `OnServiceResolved`.
-    subscription->mPublisher.OnServiceResolved(serviceName, instanceInfo);
+    subscription->mPublisher.OnServiceResolved(serviceName, instanceInfo, beginTime);
 }
 
 void PublisherMDnsSd::HostSubscription::Release()
@@ -1474,17 +1476,28 @@ void PublisherMDnsSd::HostSubscription::Release()
 
 void PublisherMDnsSd::HostSubscription::Resolve(void)
 {
-    std::string fullHostName = MakeFullHostName(mHostName);
+    std::string         fullHostName = MakeFullHostName(mHostName);
+    DNSServiceErrorType dnsError;
 
     assert(mServiceRef == nullptr);
 
-    mPublisher.mHostResolutionBeginTime[mHostName] = Clock::now();
+    mBeginTime = Clock::now();
 
     otbrLogInfo("DNSServiceGetAddrInfo %s inf %d", fullHostName.c_str(), kDNSServiceInterfaceIndexAny);
 
-    DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, kDNSServiceInterfaceIndexAny,
-                          kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4, fullHostName.c_str(),
-                          HandleResolveResult, this);
+    dnsError = AttachToSharedConnection();
+    VerifyOrExit(dnsError == kDNSServiceErr_NoError);
+
+    dnsError = DNSServiceGetAddrInfo(&mServiceRef, kDNSServiceFlagsShareConnection, kDNSServiceInterfaceIndexAny,
+                                     kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4, fullHostName.c_str(),
+                                     HandleResolveResult, this);
+
+exit:
+    if (dnsError != kDNSServiceErr_NoError)
+    {
+        mServiceRef = nullptr;
+        otbrLogWarning("DNSServiceGetAddrInfo failed: %s", DNSErrorToString(dnsError));
+    }
 }
 
 void PublisherMDnsSd::HostSubscription::HandleResolveResult(DNSServiceRef          aServiceRef,
@@ -1550,11 +1563,11 @@ exit:
     }
     else if (aErrorCode != kDNSServiceErr_NoError)
     {
-        mPublisher.OnHostResolveFailed(aHostName, aErrorCode);
+        mPublisher.OnHostResolveFailed(aHostName, aErrorCode, TakeBeginTime(mBeginTime));
     }
     else if (!moreComing && !mHostInfo.mAddresses.empty())
     {
-        mPublisher.OnHostResolved(mHostName, mHostInfo);
+        mPublisher.OnHostResolved(mHostName, mHostInfo, TakeBeginTime(mBeginTime));
     }
 }
 
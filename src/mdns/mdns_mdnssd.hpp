@@ -79,12 +79,11 @@ public:
     bool      IsStarted(void) const override;
     void      Stop(void) override { Stop(kNormalStop); }
 
+protected:
     // Implementation of MainloopProcessor.
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    void HandleFdEvent(int aFd, uint8_t aEvents) override;
 
-protected:
     otbrError PublishServiceImpl(const std::string &aHostName,
                                  const std::string &aName,
                                  const std::string &aType,
@@ -125,9 +124,8 @@ private:
 
         ~DnssdServiceRegistration(void) override { Unregister(); }
 
-        void      Update(MainloopContext &aMainloop) const;
-        void      Process(const MainloopContext &aMainloop, std::vector<DNSServiceRef> &aReadyServices) const;
         otbrError Register(void);
+        otbrError UpdateTxtData(const TxtData &aTxtData) override;
 
     private:
         void             Unregister(void);
@@ -153,16 +151,19 @@ private:
         ~DnssdHostRegistration(void) override { Unregister(); }
 
         otbrError Register(void);
+        otbrError UpdateAddresses(const AddressList &aAddresses) override;
 
     private:
-        void             Unregister(void);
-        PublisherMDnsSd &GetPublisher(void) { return *static_cast<PublisherMDnsSd *>(mPublisher); }
-        void             HandleRegisterResult(DNSRecordRef aRecordRef, DNSServiceErrorType aError);
-        static void      HandleRegisterResult(DNSServiceRef       aServiceRef,
-                                              DNSRecordRef        aRecordRef,
-                                              DNSServiceFlags     aFlags,
-                                              DNSServiceErrorType aErrorCode,
-                                              void               *aContext);
+        void                Unregister(void);
+        DNSServiceErrorType RegisterAddressRecord(const Ip6Address &aAddress);
+        void                RemoveAddressRecord(size_t aIndex);
+        PublisherMDnsSd    &GetPublisher(void) { return *static_cast<PublisherMDnsSd *>(mPublisher); }
+        void                HandleRegisterResult(DNSRecordRef aRecordRef, DNSServiceErrorType aError);
+        static void         HandleRegisterResult(DNSServiceRef       aServiceRef,
+                                                 DNSRecordRef        aRecordRef,
+                                                 DNSServiceFlags     aFlags,
+                                                 DNSServiceErrorType aErrorCode,
+                                                 void               *aContext);
 
         std::vector<DNSRecordRef> mAddrRecordRefs;
         std::vector<bool>         mAddrRegistered;
@@ -206,10 +207,9 @@ private:
 
         ~ServiceRef() { Release(); }
 
-        void Update(MainloopContext &aMainloop) const;
-        void Process(const MainloopContext &aMainloop, std::vector<DNSServiceRef> &aReadyServices) const;
-        void Release(void);
-        void DeallocateServiceRef(void);
+        DNSServiceErrorType AttachToSharedConnection(void);
+        void                Release(void);
+        void                DeallocateServiceRef(void);
     };
 
     struct ServiceSubscription;
@@ -227,6 +227,7 @@ private:
             , mType(std::move(aType))
             , mDomain(std::move(aDomain))
             , mNetifIndex(aNetifIndex)
+            , mBeginTime(Timepoint::min())
         {
         }
 
@@ -280,6 +281,7 @@ private:
         std::string            mDomain;
         uint32_t               mNetifIndex;
         DiscoveredInstanceInfo mInstanceInfo;
+        Timepoint              mBeginTime; // When `Resolve()` was called, until the first result is reported.
     };
 
     struct ServiceSubscription : public ServiceRef, public std::enable_shared_from_this<ServiceSubscription>
@@ -301,8 +303,6 @@ private:
                     const std::string &aInstanceName,
                     const std::string &aType,
                     const std::string &aDomain);
-        void UpdateAll(MainloopContext &aMainloop) const;
-        void ProcessAll(const MainloopContext &aMainloop, std::vector<DNSServiceRef> &aReadyServices) const;
 
         static void HandleBrowseResult(DNSServiceRef       aServiceRef,
                                        DNSServiceFlags     aFlags,
@@ -331,6 +331,7 @@ private:
         explicit HostSubscription(PublisherMDnsSd &aPublisher, std::string aHostName)
             : ServiceRef(aPublisher)
             , mHostName(std::move(aHostName))
+            , mBeginTime(Timepoint::min())
         {
         }
 
@@ -354,6 +355,7 @@ private:
 
         std::string        mHostName;
         DiscoveredHostInfo mHostInfo;
+        Timepoint          mBeginTime; // When `Resolve()` was called, until the first result is reported.
     };
 
     using ServiceSubscriptionList = std::vector<std::shared_ptr<ServiceSubscription>>;
@@ -362,9 +364,8 @@ private:
     static std::string MakeRegType(const std::string &aType, SubTypeList aSubTypeList);
 
     void                Stop(StopMode aStopMode);
-    DNSServiceErrorType CreateSharedHostsRef(void);
-    void                DeallocateHostsRef(void);
-    void                HandleServiceRefDeallocating(const DNSServiceRef &aServiceRef);
+    DNSServiceErrorType CreateSharedConnection(void);
+    void                DeallocateSharedConnection(void);
 
     template <typename DnssdType> void ScheduleRetry(DnssdType *aPtr, std::function<void(DnssdType *)> aAction)
     {
@@ -379,16 +380,15 @@ private:
         });
     }
 
-    DNSServiceRef mHostsRef;
+    // All `DNSServiceRef`s of registrations and subscriptions are created as
+    // subordinates of `mSharedRef` (`kDNSServiceFlagsShareConnection`) so that
+    // a single socket to the mDNS daemon is polled and processed.
+    DNSServiceRef mSharedRef;
     State         mState;
     StateCallback mStateCallback;
 
     ServiceSubscriptionList mSubscribedServices;
     HostSubscriptionList    mSubscribedHosts;
-
-    std::vector<DNSServiceRef> mServiceRefsToProcess;
-
-    TaskRunner mTaskRunner;
 };
 
 /**
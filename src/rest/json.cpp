@@ -381,124 +381,130 @@ std::string Node2JsonString(const NodeInfo &aNode)
     return ret;
 }
 
-std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet)
+static cJSON *DiagNode2Json(const std::vector<otNetworkDiagTlv> &aDiag)
 {
-    cJSON      *diagInfo          = cJSON_CreateArray();
-    cJSON      *diagInfoOfOneNode = nullptr;
-    cJSON      *addrList          = nullptr;
-    cJSON      *tableList         = nullptr;
-    std::string ret;
-    uint64_t    timeout;
+    cJSON   *diagInfoOfOneNode = cJSON_CreateObject();
+    cJSON   *addrList          = nullptr;
+    cJSON   *tableList         = nullptr;
+    uint64_t timeout;
 
-    for (auto diagItem : aDiagSet)
+    for (const otNetworkDiagTlv &diagTlv : aDiag)
     {
-        diagInfoOfOneNode = cJSON_CreateObject();
-        for (auto diagTlv : diagItem)
+        switch (diagTlv.mType)
         {
-            switch (diagTlv.mType)
-            {
-            case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
+        case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "ExtAddress",
-                                      Bytes2HexJson(diagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "ExtAddress",
+                                  Bytes2HexJson(diagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Rloc16", cJSON_CreateNumber(diagTlv.mData.mAddr16));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "Rloc16", cJSON_CreateNumber(diagTlv.mData.mAddr16));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Mode", Mode2Json(diagTlv.mData.mMode));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "Mode", Mode2Json(diagTlv.mData.mMode));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
 
-                timeout = static_cast<uint64_t>(diagTlv.mData.mTimeout);
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Timeout", cJSON_CreateNumber(timeout));
+            timeout = static_cast<uint64_t>(diagTlv.mData.mTimeout);
+            cJSON_AddItemToObject(diagInfoOfOneNode, "Timeout", cJSON_CreateNumber(timeout));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Connectivity",
-                                      Connectivity2Json(diagTlv.mData.mConnectivity));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "Connectivity",
+                                  Connectivity2Json(diagTlv.mData.mConnectivity));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Route", Route2Json(diagTlv.mData.mRoute));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "Route", Route2Json(diagTlv.mData.mRoute));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "LeaderData", LeaderData2Json(diagTlv.mData.mLeaderData));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "LeaderData", LeaderData2Json(diagTlv.mData.mLeaderData));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "NetworkData",
-                                      Bytes2HexJson(diagTlv.mData.mNetworkData.m8, diagTlv.mData.mNetworkData.mCount));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "NetworkData",
+                                  Bytes2HexJson(diagTlv.mData.mNetworkData.m8, diagTlv.mData.mNetworkData.mCount));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
 
-                addrList = cJSON_CreateArray();
+            addrList = cJSON_CreateArray();
 
-                for (uint16_t i = 0; i < diagTlv.mData.mIp6AddrList.mCount; ++i)
-                {
-                    cJSON_AddItemToArray(addrList, IpAddr2Json(diagTlv.mData.mIp6AddrList.mList[i]));
-                }
-                cJSON_AddItemToObject(diagInfoOfOneNode, "IP6AddressList", addrList);
+            for (uint16_t i = 0; i < diagTlv.mData.mIp6AddrList.mCount; ++i)
+            {
+                cJSON_AddItemToArray(addrList, IpAddr2Json(diagTlv.mData.mIp6AddrList.mList[i]));
+            }
+            cJSON_AddItemToObject(diagInfoOfOneNode, "IP6AddressList", addrList);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "MACCounters", MacCounters2Json(diagTlv.mData.mMacCounters));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "MACCounters", MacCounters2Json(diagTlv.mData.mMacCounters));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "BatteryLevel",
-                                      cJSON_CreateNumber(diagTlv.mData.mBatteryLevel));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "BatteryLevel",
+                                  cJSON_CreateNumber(diagTlv.mData.mBatteryLevel));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "SupplyVoltage",
-                                      cJSON_CreateNumber(diagTlv.mData.mSupplyVoltage));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "SupplyVoltage",
+                                  cJSON_CreateNumber(diagTlv.mData.mSupplyVoltage));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
 
-                tableList = cJSON_CreateArray();
+            tableList = cJSON_CreateArray();
 
-                for (uint16_t i = 0; i < diagTlv.mData.mChildTable.mCount; ++i)
-                {
-                    cJSON_AddItemToArray(tableList, ChildTableEntry2Json(diagTlv.mData.mChildTable.mTable[i]));
-                }
+            for (uint16_t i = 0; i < diagTlv.mData.mChildTable.mCount; ++i)
+            {
+                cJSON_AddItemToArray(tableList, ChildTableEntry2Json(diagTlv.mData.mChildTable.mTable[i]));
+            }
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "ChildTable", tableList);
+            cJSON_AddItemToObject(diagInfoOfOneNode, "ChildTable", tableList);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
 
-                cJSON_AddItemToObject(
-                    diagInfoOfOneNode, "ChannelPages",
-                    Bytes2HexJson(diagTlv.mData.mChannelPages.m8, diagTlv.mData.mChannelPages.mCount));
+            cJSON_AddItemToObject(
+                diagInfoOfOneNode, "ChannelPages",
+                Bytes2HexJson(diagTlv.mData.mChannelPages.m8, diagTlv.mData.mChannelPages.mCount));
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "MaxChildTimeout",
-                                      cJSON_CreateNumber(diagTlv.mData.mMaxChildTimeout));
+            cJSON_AddItemToObject(diagInfoOfOneNode, "MaxChildTimeout",
+                                  cJSON_CreateNumber(diagTlv.mData.mMaxChildTimeout));
 
-                break;
-            default:
-                break;
-            }
+            break;
+        default:
+            break;
         }
-        cJSON_AddItemToArray(diagInfo, diagInfoOfOneNode);
+    }
+
+    return diagInfoOfOneNode;
+}
+
+std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet)
+{
+    cJSON      *diagInfo = cJSON_CreateArray();
+    std::string ret;
+
+    for (const std::vector<otNetworkDiagTlv> &diagItem : aDiagSet)
+    {
+        cJSON_AddItemToArray(diagInfo, DiagNode2Json(diagItem));
     }
 
     ret = Json2String(diagInfo);
@@ -508,6 +514,23 @@ std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aD
     return ret;
 }
 
+std::string DiagNode2JsonString(const std::vector<otNetworkDiagTlv> &aDiag)
+{
+    cJSON      *diagInfoOfOneNode = DiagNode2Json(aDiag);
+    char       *jsonOut           = cJSON_PrintUnformatted(diagInfoOfOneNode);
+    std::string ret;
+
+    if (jsonOut != nullptr)
+    {
+        ret = jsonOut;
+        cJSON_free(jsonOut);
+    }
+
+    cJSON_Delete(diagInfoOfOneNode);
+
+    return ret;
+}
+
 std::string Bytes2HexJsonString(const uint8_t *aBytes, uint8_t aLength)
 {
     cJSON      *hex = Bytes2HexJson(aBytes, aLength);
@@ -130,6 +130,17 @@ std::string Node2JsonString(const NodeInfo &aNode);
  */
 std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet);
 
+/**
+ * This method formats the diagnostic TLVs of one node to a Json object and serialize it to a compact string.
+ *
+ * The string does not contain any line break, so it can be embedded as-is in a Server-Sent Event.
+ *
+ * @param[in] aDiag  A vector of diagnostic TLVs of one node.
+ *
+ * @returns A string of serialized Json object.
+ */
+std::string DiagNode2JsonString(const std::vector<otNetworkDiagTlv> &aDiag);
+
 /**
  * This method formats an Ipv6Address to a Json string and serialize it to a string.
  *
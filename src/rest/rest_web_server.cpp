@@ -31,6 +31,7 @@
 
 #include "rest/rest_web_server.hpp"
 
+#include <algorithm>
 #include <chrono>
 
 #include <arpa/inet.h>
@@ -65,10 +66,6 @@
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_COMMISSION "/networks/commission"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_PREFIX "/networks/current/prefix"
 
-using std::chrono::duration_cast;
-using std::chrono::microseconds;
-using std::chrono::steady_clock;
-
 using namespace httplib;
 
 namespace otbr {
@@ -80,11 +77,39 @@ static const char *kMulticastAddrAllRouters = "ff03::2";
 // Default TlvTypes for Diagnostic inforamtion
 static const uint8_t kAllTlvTypes[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 14, 15, 16, 17, 19};
 
-// Timeout (in Microseconds) for deleting outdated diagnostics
-static const uint32_t kDiagResetTimeout = 3000000;
+// Interval at which the diagnostics cache is refreshed while clients are using it.
+static constexpr Milliseconds kDiagRefreshInterval = Milliseconds(OTBR_CONFIG_REST_DIAG_REFRESH_INTERVAL);
+
+// Age after which a node which stopped answering is dropped from the diagnostics cache.
+static constexpr Milliseconds kDiagMaxAge = kDiagRefreshInterval * 3;
+
+// RLOC16 of nodes which answered without it, ordered after all the others.
+static constexpr uint16_t kDiagUnknownRloc16 = 0xfffe;
+
+// Time for collecting the answers to one multicast diagnostic request.
+static constexpr Milliseconds kDiagCollectTimeout = Milliseconds(2000);
+
+// Number of refresh intervals without any request after which the collector stops sending diagnostic requests.
+static constexpr uint8_t kDiagMaxIdleRounds = 4;
+
+// Interval at which a comment is sent on an idle diagnostics stream, to detect clients which went away.
+static constexpr Milliseconds kDiagStreamKeepAliveInterval = Milliseconds(15000);
+
+// Timeout for a request to be finished from the main loop, on top of the time the request itself needs.
+static constexpr Milliseconds kMainLoopResponseTimeout = Milliseconds(10000);
+
+// Age after which the `/node` snapshot is refreshed in the background. Some of its content, such as the number
+// of routers, changes without any `otChangedFlags` being signaled.
+static constexpr Milliseconds kNodeSnapshotRefreshAge = Milliseconds(5000);
 
-// Timeout (in Microseconds) for collecting diagnostics
-static const uint32_t kDiagCollectTimeout = 2000000;
+// Age after which the `/node` snapshot is no longer served, requests wait for a fresh one instead.
+static constexpr Milliseconds kNodeSnapshotMaxAge = Milliseconds(30000);
+
+// Changes which invalidate the `/node` snapshot.
+static constexpr otChangedFlags kNodeSnapshotChangedFlags =
+    OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_RLOC_ADDED | OT_CHANGED_THREAD_RLOC_REMOVED |
+    OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA | OT_CHANGED_THREAD_NETWORK_NAME |
+    OT_CHANGED_THREAD_EXT_PANID | OT_CHANGED_ACTIVE_DATASET;
 
 HttpMethod GetMethod(const Request &aRequest)
 {
@@ -104,6 +129,17 @@ HttpMethod GetMethod(const Request &aRequest)
 
 RestWebServer::RestWebServer(Host::RcpHost &aHost)
     : mHost(aHost)
+    , mNodeSnapshotUpdatePending(false)
+    , mDiagSequence(0)
+    , mDiagRoundsStarted(0)
+    , mDiagRoundsFinished(0)
+    , mDiagIdleRounds(kDiagMaxIdleRounds)
+    , mDiagCollecting(false)
+    , mDiagLastRoundFailed(false)
+    , mDiagRequested(false)
+    , mDiagCollectorIdle(true)
+    , mDiagSnapshot(std::make_shared<DiagSnapshot>())
+    , mDiagStopped(false)
 {
     mServer.Get(OT_REST_RESOURCE_PATH_DIAGNOSTICS, MakeHandler(&RestWebServer::Diagnostic));
     mServer.Get(OT_REST_RESOURCE_PATH_NODE, MakeHandler(&RestWebServer::NodeInfo));
@@ -137,6 +173,13 @@ RestWebServer::RestWebServer(Host::RcpHost &aHost)
 
 RestWebServer::~RestWebServer(void)
 {
+    {
+        std::lock_guard<std::mutex> lock(mDiagMutex);
+
+        mDiagStopped = true;
+    }
+    mDiagCondVar.notify_all();
+
     if (mServer.is_running())
     {
         mServer.stop();
@@ -147,91 +190,231 @@ RestWebServer::~RestWebServer(void)
     }
 }
 
-void RestWebServer::ErrorHandler(Response &aResponse, StatusCode aErrorCode) const
+RestWebServer::NodeSnapshotPtr RestWebServer::GetNodeSnapshot(void) const
 {
-    std::string errorMessage = status_message(aErrorCode);
-    std::string body         = Json::Error2JsonString(aErrorCode, errorMessage);
+    // The first snapshot is taken in `Init()`, before the server starts listening.
+    NodeSnapshotPtr snapshot = std::atomic_load(&mNodeSnapshot);
+    Milliseconds    age      = std::chrono::duration_cast<Milliseconds>(Clock::now() - snapshot->mTime);
 
-    aResponse.status = aErrorCode;
-    aResponse.set_content(body, OT_REST_CONTENT_TYPE_JSON);
+    if (age >= kNodeSnapshotMaxAge)
+    {
+        // Nothing refreshed the snapshot for a long time, don't serve it.
+        RequestNodeSnapshotUpdate();
+        snapshot = WaitNodeSnapshot(snapshot->mTime, kMainLoopResponseTimeout);
+    }
+    else if (age >= kNodeSnapshotRefreshAge)
+    {
+        // Serve the current snapshot and refresh it for the following requests.
+        RequestNodeSnapshotUpdate();
+    }
+
+    return snapshot;
 }
 
-void RestWebServer::GetNodeInfo(Response &aResponse) const
+RestWebServer::NodeSnapshotPtr RestWebServer::WaitNodeSnapshot(Timepoint aNewerThan, Milliseconds aTimeout) const
 {
-    otbrError   error = OTBR_ERROR_NONE;
-    std::string body;
+    std::unique_lock<std::mutex> lock(mNodeSnapshotMutex);
+    NodeSnapshotPtr              snapshot;
+
+    mNodeSnapshotCondVar.wait_for(lock, aTimeout, [this, &snapshot, aNewerThan]() {
+        snapshot = std::atomic_load(&mNodeSnapshot);
+        return snapshot->mTime > aNewerThan;
+    });
+
+    return (snapshot->mTime > aNewerThan) ? snapshot : nullptr;
+}
+
+void RestWebServer::RespondWithNodeSnapshot(Response                  &aResponse,
+                                            std::string NodeSnapshot::*aBody,
+                                            bool NodeSnapshot::*aIsValid) const
+{
+    NodeSnapshotPtr snapshot = GetNodeSnapshot();
+
+    VerifyOrExit(snapshot != nullptr, ErrorHandler(aResponse, StatusCode::ServiceUnavailable_503));
+    VerifyOrExit(aIsValid == nullptr || (*snapshot).*aIsValid,
+                 ErrorHandler(aResponse, StatusCode::InternalServerError_500));
 
-    SuccessOrExit(error = RunInMainLoop([this, &body]() -> otbrError {
-                      struct NodeInfo node = {};
-                      otRouterInfo    routerInfo;
-                      uint8_t         maxRouterId;
+    aResponse.set_content((*snapshot).*aBody, OT_REST_CONTENT_TYPE_JSON);
+    aResponse.status = StatusCode::OK_200;
 
-                      if (otBorderAgentGetId(GetInstance(), &node.mBaId) != OT_ERROR_NONE)
-                          return OTBR_ERROR_REST;
+exit:
+    return;
+}
 
-                      (void)otThreadGetLeaderData(GetInstance(), &node.mLeaderData);
+void RestWebServer::RequestNodeSnapshotUpdate(void) const
+{
+    if (!mNodeSnapshotUpdatePending.exchange(true))
+    {
+        mHost.GetTaskRunner().Post([this]() { UpdateNodeSnapshot(); });
+    }
+}
 
-                      node.mNumOfRouter = 0;
-                      maxRouterId       = otThreadGetMaxRouterId(GetInstance());
-                      for (uint8_t i = 0; i <= maxRouterId; ++i)
-                      {
-                          if (otThreadGetRouterInfo(GetInstance(), i, &routerInfo) != OT_ERROR_NONE)
-                          {
-                              continue;
-                          }
-                          ++node.mNumOfRouter;
-                      }
+void RestWebServer::HandleThreadStateChanged(otChangedFlags aFlags) const
+{
+    if (aFlags & kNodeSnapshotChangedFlags)
+    {
+        // Several changes signaled in the same main loop iteration are folded into one update.
+        RequestNodeSnapshotUpdate();
+    }
+}
 
-                      node.mRole        = GetDeviceRoleName(otThreadGetDeviceRole(GetInstance()));
-                      node.mExtAddress  = reinterpret_cast<const uint8_t *>(otLinkGetExtendedAddress(GetInstance()));
-                      node.mNetworkName = otThreadGetNetworkName(GetInstance());
-                      node.mRloc16      = otThreadGetRloc16(GetInstance());
-                      node.mExtPanId    = reinterpret_cast<const uint8_t *>(otThreadGetExtendedPanId(GetInstance()));
-                      node.mRlocAddress = *otThreadGetRloc(GetInstance());
+RestWebServer::NodeSnapshotPtr RestWebServer::UpdateNodeSnapshot(void) const
+{
+    std::shared_ptr<NodeSnapshot> snapshot = std::make_shared<NodeSnapshot>();
+    struct NodeInfo               node     = {};
+    otRouterInfo                  routerInfo;
+    uint8_t                       maxRouterId;
 
-                      body = Json::Node2JsonString(node);
+    mNodeSnapshotUpdatePending = false;
 
-                      return OTBR_ERROR_NONE;
-                  }));
+    snapshot->mTime          = Clock::now();
+    snapshot->mHasBaId       = (otBorderAgentGetId(GetInstance(), &node.mBaId) == OT_ERROR_NONE);
+    snapshot->mHasLeaderData = (otThreadGetLeaderData(GetInstance(), &node.mLeaderData) == OT_ERROR_NONE);
 
-    aResponse.set_content(body, OT_REST_CONTENT_TYPE_JSON);
+    node.mNumOfRouter = 0;
+    maxRouterId       = otThreadGetMaxRouterId(GetInstance());
+    for (uint8_t i = 0; i <= maxRouterId; ++i)
+    {
+        if (otThreadGetRouterInfo(GetInstance(), i, &routerInfo) != OT_ERROR_NONE)
+        {
+            continue;
+        }
+        ++node.mNumOfRouter;
+    }
 
-exit:
-    if (error == OTBR_ERROR_NONE)
+    node.mRole        = GetDeviceRoleName(otThreadGetDeviceRole(GetInstance()));
+    node.mExtAddress  = reinterpret_cast<const uint8_t *>(otLinkGetExtendedAddress(GetInstance()));
+    node.mNetworkName = otThreadGetNetworkName(GetInstance());
+    node.mRloc16      = otThreadGetRloc16(GetInstance());
+    node.mExtPanId    = reinterpret_cast<const uint8_t *>(otThreadGetExtendedPanId(GetInstance()));
+    node.mRlocAddress = *otThreadGetRloc(GetInstance());
+
+    if (snapshot->mHasBaId)
     {
-        aResponse.status = StatusCode::OK_200;
+        snapshot->mNode = Json::Node2JsonString(node);
+        snapshot->mBaId = Json::Bytes2HexJsonString(node.mBaId.mId, sizeof(node.mBaId));
     }
-    else
+
+    if (snapshot->mHasLeaderData)
+    {
+        snapshot->mLeaderData = Json::LeaderData2JsonString(node.mLeaderData);
+    }
+
+    snapshot->mExtAddress  = Json::Bytes2HexJsonString(node.mExtAddress, OT_EXT_ADDRESS_SIZE);
+    snapshot->mState       = Json::String2JsonString(node.mRole);
+    snapshot->mNetworkName = Json::String2JsonString(node.mNetworkName);
+    snapshot->mNumOfRouter = Json::Number2JsonString(node.mNumOfRouter);
+    snapshot->mRloc16      = Json::Number2JsonString(node.mRloc16);
+    snapshot->mExtPanId    = Json::Bytes2HexJsonString(node.mExtPanId, OT_EXT_PAN_ID_SIZE);
+    snapshot->mRloc        = Json::IpAddr2JsonString(node.mRlocAddress);
+
     {
-        ErrorHandler(aResponse, StatusCode::InternalServerError_500);
+        std::lock_guard<std::mutex> lock(mNodeSnapshotMutex);
+
+        std::atomic_store(&mNodeSnapshot, NodeSnapshotPtr(snapshot));
     }
+    mNodeSnapshotCondVar.notify_all();
+
+    return snapshot;
 }
 
-void RestWebServer::DeleteNodeInfo(Response &aResponse) const
+void RestWebServer::PendingResponse::Finish(StatusCode aStatus, std::string aBody, const char *aContentType)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
 
-    error = RunInMainLoop([this]() {
-        VerifyOrReturn(mHost.GetThreadHelper()->Detach() == OT_ERROR_NONE, OTBR_ERROR_INVALID_STATE);
-        VerifyOrReturn(otInstanceErasePersistentInfo(GetInstance()) == OT_ERROR_NONE, OTBR_ERROR_REST);
-        mHost.Reset();
-        return OTBR_ERROR_NONE;
-    });
+        VerifyOrExit(!mFinished);
 
-    if (error == OTBR_ERROR_NONE)
-    {
-        aResponse.status = StatusCode::OK_200;
+        mFinished    = true;
+        mStatus      = aStatus;
+        mBody        = std::move(aBody);
+        mContentType = aContentType;
     }
-    else if (error == OTBR_ERROR_INVALID_STATE)
+
+    mCondVar.notify_all();
+
+exit:
+    return;
+}
+
+void RestWebServer::PendingResponse::FinishWithError(StatusCode aErrorCode)
+{
+    Finish(aErrorCode, Json::Error2JsonString(aErrorCode, status_message(aErrorCode)));
+}
+
+bool RestWebServer::PendingResponse::Wait(Response &aResponse, Milliseconds aTimeout)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    bool                         finished = mCondVar.wait_for(lock, aTimeout, [this]() { return mFinished; });
+
+    if (finished)
     {
-        ErrorHandler(aResponse, StatusCode::Conflict_409);
+        aResponse.status = mStatus;
+
+        if (!mBody.empty())
+        {
+            aResponse.set_content(mBody, mContentType);
+        }
     }
-    else if (error != OTBR_ERROR_NONE)
+
+    return finished;
+}
+
+void RestWebServer::RunInMainLoopAndWait(Response &aResponse, Continuation aContinuation) const
+{
+    PendingResponsePtr pending = std::make_shared<PendingResponse>();
+
+    // The main loop keeps its own reference, so a late `Finish()` after a timeout is harmless.
+    mHost.GetTaskRunner().Post([pending, aContinuation]() { aContinuation(pending); });
+
+    if (!pending->Wait(aResponse, kMainLoopResponseTimeout))
     {
-        ErrorHandler(aResponse, StatusCode::InternalServerError_500);
+        otbrLogWarning("Timed out waiting for the main loop to finish the response");
+        ErrorHandler(aResponse, StatusCode::ServiceUnavailable_503);
     }
 }
 
+void RestWebServer::ErrorHandler(Response &aResponse, StatusCode aErrorCode) const
+{
+    std::string errorMessage = status_message(aErrorCode);
+    std::string body         = Json::Error2JsonString(aErrorCode, errorMessage);
+
+    aResponse.status = aErrorCode;
+    aResponse.set_content(body, OT_REST_CONTENT_TYPE_JSON);
+}
+
+void RestWebServer::GetNodeInfo(Response &aResponse) const
+{
+    RespondWithNodeSnapshot(aResponse, &NodeSnapshot::mNode, &NodeSnapshot::mHasBaId);
+}
+
+void RestWebServer::DeleteNodeInfo(Response &aResponse) const
+{
+    RunInMainLoopAndWait(aResponse, [this](const PendingResponsePtr &aPending) {
+        otbrError error = OTBR_ERROR_NONE;
+
+        VerifyOrExit(mHost.GetThreadHelper()->Detach() == OT_ERROR_NONE, error = OTBR_ERROR_INVALID_STATE);
+        VerifyOrExit(otInstanceErasePersistentInfo(GetInstance()) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
+        mHost.Reset();
+
+    exit:
+        switch (error)
+        {
+        case OTBR_ERROR_NONE:
+            // Requests following this one must not see the node as it was before the reset.
+            UpdateNodeSnapshot();
+            aPending->Finish(StatusCode::OK_200);
+            break;
+        case OTBR_ERROR_INVALID_STATE:
+            aPending->FinishWithError(StatusCode::Conflict_409);
+            break;
+        default:
+            aPending->FinishWithError(StatusCode::InternalServerError_500);
+            break;
+        }
+    });
+}
+
 void RestWebServer::NodeInfo(const Request &aRequest, Response &aResponse) const
 {
     switch (GetMethod(aRequest))
@@ -250,24 +433,7 @@ void RestWebServer::NodeInfo(const Request &aRequest, Response &aResponse) const
 
 void RestWebServer::GetDataBaId(Response &aResponse) const
 {
-    otbrError       error = OTBR_ERROR_NONE;
-    otBorderAgentId id;
-    std::string     body;
-
-    VerifyOrExit(RunInMainLoop(otBorderAgentGetId, GetInstance(), &id) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
-
-    body = Json::Bytes2HexJsonString(id.mId, sizeof(id));
-    aResponse.set_content(body, OT_REST_CONTENT_TYPE_JSON);
-
-exit:
-    if (error == OTBR_ERROR_NONE)
-    {
-        aResponse.status = StatusCode::OK_200;
-    }
-    else
-    {
-        ErrorHandler(aResponse, StatusCode::InternalServerError_500);
-    }
+    RespondWithNodeSnapshot(aResponse, &NodeSnapshot::mBaId, &NodeSnapshot::mHasBaId);
 }
 
 void RestWebServer::BaId(const Request &aRequest, Response &aResponse) const
@@ -284,12 +450,7 @@ void RestWebServer::BaId(const Request &aRequest, Response &aResponse) const
 
 void RestWebServer::GetDataExtendedAddr(Response &aResponse) const
 {
-    const uint8_t *extAddress =
-        reinterpret_cast<const uint8_t *>(RunInMainLoop(otLinkGetExtendedAddress, GetInstance()));
-    std::string body = Json::Bytes2HexJsonString(extAddress, OT_EXT_ADDRESS_SIZE);
-
-    aResponse.set_content(body, OT_REST_CONTENT_TYPE_JSON);
-    aResponse.status = StatusCode::OK_200;
+    RespondWithNodeSnapshot(aResponse, &NodeSnapshot::mExtAddress);
 }
 
 void RestWebServer::ExtendedAddr(const Request &aRequest, Response &aResponse) const
@@ -306,59 +467,57 @@ void RestWebServer::ExtendedAddr(const Request &aRequest, Response &aResponse) c
 
 void RestWebServer::GetDataState(Response &aResponse) const
 {
-    std::string  state;
-    otDeviceRole role;
-
-    role  = RunInMainLoop(otThreadGetDeviceRole, GetInstance());
-    state = Json::String2JsonString(GetDeviceRoleName(role));
-    aResponse.set_content(state, OT_REST_CONTENT_TYPE_JSON);
-    aResponse.status = StatusCode::OK_200;
+    RespondWithNodeSnapshot(aResponse, &NodeSnapshot::mState);
 }
 
 void RestWebServer::SetDataState(const Request &aRequest, Response &aResponse) const
 {
-    otbrError error = OTBR_ERROR_NONE;
-
     std::string body;
 
-    VerifyOrExit(Json::JsonString2String(aRequest.body, body), error = OTBR_ERROR_INVALID_ARGS);
-    SuccessOrExit(
-        error = RunInMainLoop([this, &body]() {
-            if (body == "enable")
-            {
-                if (!otIp6IsEnabled(GetInstance()))
-                {
-                    VerifyOrReturn(otIp6SetEnabled(GetInstance(), true) == OT_ERROR_NONE, OTBR_ERROR_INVALID_STATE);
-                }
-                VerifyOrReturn(otThreadSetEnabled(GetInstance(), true) == OT_ERROR_NONE, OTBR_ERROR_INVALID_STATE);
-            }
-            else if (body == "disable")
-            {
-                VerifyOrReturn(otThreadSetEnabled(GetInstance(), false) == OT_ERROR_NONE, OTBR_ERROR_INVALID_STATE);
-                VerifyOrReturn(otIp6SetEnabled(GetInstance(), false) == OT_ERROR_NONE, OTBR_ERROR_INVALID_STATE);
-            }
-            else
+    VerifyOrExit(Json::JsonString2String(aRequest.body, body), ErrorHandler(aResponse, StatusCode::BadRequest_400));
+
+    RunInMainLoopAndWait(aResponse, [this, body](const PendingResponsePtr &aPending) {
+        otbrError error = OTBR_ERROR_NONE;
+
+        if (body == "enable")
+        {
+            if (!otIp6IsEnabled(GetInstance()))
             {
-                return OTBR_ERROR_INVALID_ARGS;
+                VerifyOrExit(otIp6SetEnabled(GetInstance(), true) == OT_ERROR_NONE, error = OTBR_ERROR_INVALID_STATE);
             }
-            return OTBR_ERROR_NONE;
-        }));
+            VerifyOrExit(otThreadSetEnabled(GetInstance(), true) == OT_ERROR_NONE, error = OTBR_ERROR_INVALID_STATE);
+        }
+        else if (body == "disable")
+        {
+            VerifyOrExit(otThreadSetEnabled(GetInstance(), false) == OT_ERROR_NONE, error = OTBR_ERROR_INVALID_STATE);
+            VerifyOrExit(otIp6SetEnabled(GetInstance(), false) == OT_ERROR_NONE, error = OTBR_ERROR_INVALID_STATE);
+        }
+        else
+        {
+            ExitNow(error = OTBR_ERROR_INVALID_ARGS);
+        }
 
-    aResponse.status = StatusCode::OK_200;
+    exit:
+        switch (error)
+        {
+        case OTBR_ERROR_NONE:
+            UpdateNodeSnapshot();
+            aPending->Finish(StatusCode::OK_200);
+            break;
+        case OTBR_ERROR_INVALID_STATE:
+            aPending->FinishWithError(StatusCode::Conflict_409);
+            break;
+        case OTBR_ERROR_INVALID_ARGS:
+            aPending->FinishWithError(StatusCode::BadRequest_400);
+            break;
+        default:
+            aPending->FinishWithError(StatusCode::InternalServerError_500);
+            break;
+        }
+    });
 
 exit:
-    if (error == OTBR_ERROR_INVALID_STATE)
-    {
-        ErrorHandler(aResponse, StatusCode::Conflict_409);
-    }
-    if (error == OTBR_ERROR_INVALID_ARGS)
-    {
-        ErrorHandler(aResponse, StatusCode::BadRequest_400);
-    }
-    else if (error != OTBR_ERROR_NONE)
-    {
-        ErrorHandler(aResponse, StatusCode::InternalServerError_500);
-    }
+    return;
 }
 
 void RestWebServer::State(const Request &aRequest, Response &aResponse) const
@@ -382,13 +541,7 @@ void RestWebServer::State(const Request &aRequest, Response &aResponse) const
 
 void RestWebServer::GetDataNetworkName(Response &aResponse) const
 {
-    std::string networkName;
-
-    networkName = RunInMainLoop(otThreadGetNetworkName, GetInstance());
-    auto body   = Json::String2JsonString(networkName);
-
-    aResponse.set_content(body, OT_REST_CONTENT_TYPE_JSON);
-    aResponse.status = StatusCode::OK_200;
+    RespondWithNodeSnapshot(aResponse, &NodeSnapshot::mNetworkName);
 }
 
 void RestWebServer::NetworkName(const Request &aRequest, Response &aResponse) const
@@ -405,26 +558,7 @@ void RestWebServer::NetworkName(const Request &aRequest, Response &aResponse) co
 
 void RestWebServer::GetDataLeaderData(Response &aResponse) const
 {
-    otbrError    error = OTBR_ERROR_NONE;
-    otLeaderData leaderData;
-    std::string  body;
-
-    VerifyOrExit(RunInMainLoop(otThreadGetLeaderData, GetInstance(), &leaderData) == OT_ERROR_NONE,
-                 error = OTBR_ERROR_REST);
-
-    body = Json::LeaderData2JsonString(leaderData);
-
-    aResponse.set_content(body, OT_REST_CONTENT_TYPE_JSON);
-
-exit:
-    if (error == OTBR_ERROR_NONE)
-    {
-        aResponse.status = StatusCode::OK_200;
-    }
-    else
-    {
-        ErrorHandler(aResponse, StatusCode::InternalServerError_500);
-    }
+    RespondWithNodeSnapshot(aResponse, &NodeSnapshot::mLeaderData, &NodeSnapshot::mHasLeaderData);
 }
 
 void RestWebServer::LeaderData(const Request &aRequest, Response &aResponse) const
@@ -441,25 +575,7 @@ void RestWebServer::LeaderData(const Request &aRequest, Response &aResponse) con
 
 void RestWebServer::GetDataNumOfRoute(Response &aResponse) const
 {
-    std::string body = RunInMainLoop([this]() {
-        uint8_t      count = 0;
-        uint8_t      maxRouterId;
-        otRouterInfo routerInfo;
-        maxRouterId = otThreadGetMaxRouterId(GetInstance());
-        for (uint8_t i = 0; i <= maxRouterId; ++i)
-        {
-            if (otThreadGetRouterInfo(GetInstance(), i, &routerInfo) != OT_ERROR_NONE)
-            {
-                continue;
-            }
-            ++count;
-        }
-
-        return Json::Number2JsonString(count);
-    });
-
-    aResponse.set_content(body, OT_REST_CONTENT_TYPE_JSON);
-    aResponse.status = StatusCode::OK_200;
+    RespondWithNodeSnapshot(aResponse, &NodeSnapshot::mNumOfRouter);
 }
 
 void RestWebServer::NumOfRoute(const Request &aRequest, Response &aResponse) const
@@ -476,13 +592,7 @@ void RestWebServer::NumOfRoute(const Request &aRequest, Response &aResponse) con
 
 void RestWebServer::GetDataRloc16(Response &aResponse) const
 {
-    uint16_t    rloc16 = RunInMainLoop(otThreadGetRloc16, GetInstance());
-    std::string body;
-
-    body = Json::Number2JsonString(rloc16);
-
-    aResponse.set_content(body, OT_REST_CONTENT_TYPE_JSON);
-    aResponse.status = StatusCode::OK_200;
+    RespondWithNodeSnapshot(aResponse, &NodeSnapshot::mRloc16);
 }
 
 void RestWebServer::Rloc16(const Request &aRequest, Response &aResponse) const
@@ -499,11 +609,7 @@ void RestWebServer::Rloc16(const Request &aRequest, Response &aResponse) const
 
 void RestWebServer::GetDataExtendedPanId(Response &aResponse) const
 {
-    const uint8_t *extPanId = reinterpret_cast<const uint8_t *>(RunInMainLoop(otThreadGetExtendedPanId, GetInstance()));
-    std::string    body     = Json::Bytes2HexJsonString(extPanId, OT_EXT_PAN_ID_SIZE);
-
-    aResponse.set_content(body, OT_REST_CONTENT_TYPE_JSON);
-    aResponse.status = StatusCode::OK_200;
+    RespondWithNodeSnapshot(aResponse, &NodeSnapshot::mExtPanId);
 }
 
 void RestWebServer::ExtendedPanId(const Request &aRequest, Response &aResponse) const
@@ -520,13 +626,7 @@ void RestWebServer::ExtendedPanId(const Request &aRequest, Response &aResponse)
 
 void RestWebServer::GetDataRloc(Response &aResponse) const
 {
-    otIp6Address rlocAddress = *RunInMainLoop(otThreadGetRloc, GetInstance());
-    std::string  body;
-
-    body = Json::IpAddr2JsonString(rlocAddress);
-
-    aResponse.set_content(body, OT_REST_CONTENT_TYPE_JSON);
-    aResponse.status = StatusCode::OK_200;
+    RespondWithNodeSnapshot(aResponse, &NodeSnapshot::mRloc);
 }
 
 void RestWebServer::Rloc(const Request &aRequest, Response &aResponse) const
@@ -543,156 +643,145 @@ void RestWebServer::Rloc(const Request &aRequest, Response &aResponse) const
 
 void RestWebServer::GetDataset(DatasetType aDatasetType, const Request &aRequest, Response &aResponse) const
 {
-    otbrError   error = OTBR_ERROR_NONE;
-    std::string body;
-    std::string contentType = OT_REST_CONTENT_TYPE_JSON;
+    bool isTlv = aRequest.get_header_value(OT_REST_ACCEPT_HEADER) == OT_REST_CONTENT_TYPE_PLAIN;
+
+    Continuation getDataset = [this, aDatasetType, isTlv](const PendingResponsePtr &aPending) {
+        otError     error = OT_ERROR_NONE;
+        std::string body;
 
-    SuccessOrExit(
-        error = RunInMainLoop([this, aDatasetType, &contentType, &aRequest, &body]() {
-            if (aRequest.get_header_value(OT_REST_ACCEPT_HEADER) == OT_REST_CONTENT_TYPE_PLAIN)
+        if (isTlv)
+        {
+            otOperationalDatasetTlvs datasetTlvs;
+
+            if (aDatasetType == DatasetType::kActive)
             {
-                otOperationalDatasetTlvs datasetTlvs;
-
-                if (aDatasetType == DatasetType::kActive)
-                {
-                    VerifyOrReturn(otDatasetGetActiveTlvs(GetInstance(), &datasetTlvs) == OT_ERROR_NONE,
-                                   OTBR_ERROR_NOT_FOUND);
-                }
-                else if (aDatasetType == DatasetType::kPending)
-                {
-                    VerifyOrReturn(otDatasetGetPendingTlvs(GetInstance(), &datasetTlvs) == OT_ERROR_NONE,
-                                   OTBR_ERROR_NOT_FOUND);
-                }
-
-                contentType = OT_REST_CONTENT_TYPE_PLAIN;
-                body        = Utils::Bytes2Hex(datasetTlvs.mTlvs, datasetTlvs.mLength);
+                SuccessOrExit(error = otDatasetGetActiveTlvs(GetInstance(), &datasetTlvs));
             }
             else
             {
-                otOperationalDataset dataset;
-
-                if (aDatasetType == DatasetType::kActive)
-                {
-                    VerifyOrReturn(otDatasetGetActive(GetInstance(), &dataset) == OT_ERROR_NONE, OTBR_ERROR_NOT_FOUND);
-                    body = Json::ActiveDataset2JsonString(dataset);
-                }
-                else if (aDatasetType == DatasetType::kPending)
-                {
-                    VerifyOrReturn(otDatasetGetPending(GetInstance(), &dataset) == OT_ERROR_NONE, OTBR_ERROR_NOT_FOUND);
-                    body = Json::PendingDataset2JsonString(dataset);
-                }
+                SuccessOrExit(error = otDatasetGetPendingTlvs(GetInstance(), &datasetTlvs));
             }
 
-            return OTBR_ERROR_NONE;
-        }));
+            body = Utils::Bytes2Hex(datasetTlvs.mTlvs, datasetTlvs.mLength);
+        }
+        else
+        {
+            otOperationalDataset dataset;
 
-    aResponse.set_content(body, contentType);
+            if (aDatasetType == DatasetType::kActive)
+            {
+                SuccessOrExit(error = otDatasetGetActive(GetInstance(), &dataset));
+                body = Json::ActiveDataset2JsonString(dataset);
+            }
+            else
+            {
+                SuccessOrExit(error = otDatasetGetPending(GetInstance(), &dataset));
+                body = Json::PendingDataset2JsonString(dataset);
+            }
+        }
 
-exit:
-    if (error == OTBR_ERROR_NONE)
-    {
-        aResponse.status = StatusCode::OK_200;
-    }
-    else if (error == OTBR_ERROR_NOT_FOUND)
-    {
-        aResponse.status = StatusCode::NoContent_204;
-    }
-    else
-    {
-        ErrorHandler(aResponse, StatusCode::InternalServerError_500);
-    }
+    exit:
+        if (error == OT_ERROR_NONE)
+        {
+            aPending->Finish(StatusCode::OK_200, std::move(body),
+                             isTlv ? OT_REST_CONTENT_TYPE_PLAIN : OT_REST_CONTENT_TYPE_JSON);
+        }
+        else
+        {
+            aPending->Finish(StatusCode::NoContent_204);
+        }
+    };
+
+    RunInMainLoopAndWait(aResponse, std::move(getDataset));
 }
 
 void RestWebServer::SetDataset(DatasetType aDatasetType, const Request &aRequest, Response &aResponse) const
 {
-    otbrError       error = OTBR_ERROR_NONE;
-    struct NodeInfo node;
-    std::string     body;
-    StatusCode      errorCode = StatusCode::OK_200;
+    bool        isTlv = aRequest.get_header_value(OT_REST_CONTENT_TYPE_HEADER) == OT_REST_CONTENT_TYPE_PLAIN;
+    std::string body  = aRequest.body;
 
-    SuccessOrExit(
-        error = RunInMainLoop([this, aDatasetType, &errorCode, &aRequest]() {
-            bool                     isTlv;
-            otOperationalDataset     dataset = {};
-            otOperationalDatasetTlvs datasetTlvs;
-            otError                  errorOt = OT_ERROR_NONE;
+    Continuation setDataset = [this, aDatasetType, isTlv, body](const PendingResponsePtr &aPending) {
+        otbrError                error   = OTBR_ERROR_NONE;
+        StatusCode               status  = StatusCode::OK_200;
+        otOperationalDataset     dataset = {};
+        otOperationalDatasetTlvs datasetTlvs;
+        otError                  errorOt = OT_ERROR_NONE;
+
+        if (aDatasetType == DatasetType::kActive)
+        {
+            VerifyOrExit(otThreadGetDeviceRole(GetInstance()) == OT_DEVICE_ROLE_DISABLED,
+                         error = OTBR_ERROR_INVALID_STATE);
+            errorOt = otDatasetGetActiveTlvs(GetInstance(), &datasetTlvs);
+        }
+        else
+        {
+            errorOt = otDatasetGetPendingTlvs(GetInstance(), &datasetTlvs);
+        }
+
+        // Create a new operational dataset if it doesn't exist.
+        if (errorOt == OT_ERROR_NOT_FOUND)
+        {
+            VerifyOrExit(otDatasetCreateNewNetwork(GetInstance(), &dataset) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
+            otDatasetConvertToTlvs(&dataset, &datasetTlvs);
+            status = StatusCode::Created_201;
+        }
 
+        if (isTlv)
+        {
+            int                      ret;
+            otOperationalDatasetTlvs datasetUpdateTlvs;
+
+            ret = Json::Hex2BytesJsonString(body, datasetUpdateTlvs.mTlvs, OT_OPERATIONAL_DATASET_MAX_LENGTH);
+            VerifyOrExit(ret >= 0, error = OTBR_ERROR_INVALID_ARGS);
+            datasetUpdateTlvs.mLength = ret;
+
+            VerifyOrExit(otDatasetParseTlvs(&datasetUpdateTlvs, &dataset) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
+            VerifyOrExit(otDatasetUpdateTlvs(&dataset, &datasetTlvs) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
+        }
+        else
+        {
             if (aDatasetType == DatasetType::kActive)
             {
-                VerifyOrReturn(otThreadGetDeviceRole(GetInstance()) == OT_DEVICE_ROLE_DISABLED,
-                               OTBR_ERROR_INVALID_STATE);
-                errorOt = otDatasetGetActiveTlvs(GetInstance(), &datasetTlvs);
-            }
-            else if (aDatasetType == DatasetType::kPending)
-            {
-                errorOt = otDatasetGetPendingTlvs(GetInstance(), &datasetTlvs);
+                VerifyOrExit(Json::JsonActiveDatasetString2Dataset(body, dataset), error = OTBR_ERROR_INVALID_ARGS);
             }
-
-            // Create a new operational dataset if it doesn't exist.
-            if (errorOt == OT_ERROR_NOT_FOUND)
+            else
             {
-                VerifyOrReturn(otDatasetCreateNewNetwork(GetInstance(), &dataset) == OT_ERROR_NONE, OTBR_ERROR_REST);
-                otDatasetConvertToTlvs(&dataset, &datasetTlvs);
-                errorCode = StatusCode::Created_201;
+                VerifyOrExit(Json::JsonPendingDatasetString2Dataset(body, dataset), error = OTBR_ERROR_INVALID_ARGS);
+                VerifyOrExit(dataset.mComponents.mIsDelayPresent, error = OTBR_ERROR_INVALID_ARGS);
             }
+            VerifyOrExit(otDatasetUpdateTlvs(&dataset, &datasetTlvs) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
+        }
 
-            isTlv = aRequest.get_header_value(OT_REST_CONTENT_TYPE_HEADER) == OT_REST_CONTENT_TYPE_PLAIN;
-
-            if (isTlv)
-            {
-                int                      ret;
-                otOperationalDatasetTlvs datasetUpdateTlvs;
-
-                ret = Json::Hex2BytesJsonString(aRequest.body, datasetUpdateTlvs.mTlvs,
-                                                OT_OPERATIONAL_DATASET_MAX_LENGTH);
-                VerifyOrReturn(ret >= 0, OTBR_ERROR_INVALID_ARGS);
-                datasetUpdateTlvs.mLength = ret;
-
-                VerifyOrReturn(otDatasetParseTlvs(&datasetUpdateTlvs, &dataset) == OT_ERROR_NONE, OTBR_ERROR_REST);
-                VerifyOrReturn(otDatasetUpdateTlvs(&dataset, &datasetTlvs) == OT_ERROR_NONE, OTBR_ERROR_REST);
-            }
-            else
-            {
-                if (aDatasetType == DatasetType::kActive)
-                {
-                    VerifyOrReturn(Json::JsonActiveDatasetString2Dataset(aRequest.body, dataset),
-                                   OTBR_ERROR_INVALID_ARGS);
-                }
-                else if (aDatasetType == DatasetType::kPending)
-                {
-                    VerifyOrReturn(Json::JsonPendingDatasetString2Dataset(aRequest.body, dataset),
-                                   OTBR_ERROR_INVALID_ARGS);
-                    VerifyOrReturn(dataset.mComponents.mIsDelayPresent, OTBR_ERROR_INVALID_ARGS);
-                }
-                VerifyOrReturn(otDatasetUpdateTlvs(&dataset, &datasetTlvs) == OT_ERROR_NONE, OTBR_ERROR_REST);
-            }
-
-            if (aDatasetType == DatasetType::kActive)
-            {
-                VerifyOrReturn(otDatasetSetActiveTlvs(GetInstance(), &datasetTlvs) == OT_ERROR_NONE, OTBR_ERROR_REST);
-            }
-            else if (aDatasetType == DatasetType::kPending)
-            {
-                VerifyOrReturn(otDatasetSetPendingTlvs(GetInstance(), &datasetTlvs) == OT_ERROR_NONE, OTBR_ERROR_REST);
-            }
-            return OTBR_ERROR_NONE;
-        }));
+        if (aDatasetType == DatasetType::kActive)
+        {
+            VerifyOrExit(otDatasetSetActiveTlvs(GetInstance(), &datasetTlvs) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
+        }
+        else
+        {
+            VerifyOrExit(otDatasetSetPendingTlvs(GetInstance(), &datasetTlvs) == OT_ERROR_NONE,
+                         error = OTBR_ERROR_REST);
+        }
 
-    aResponse.status = errorCode;
+    exit:
+        switch (error)
+        {
+        case OTBR_ERROR_NONE:
+            UpdateNodeSnapshot();
+            aPending->Finish(status);
+            break;
+        case OTBR_ERROR_INVALID_ARGS:
+            aPending->FinishWithError(StatusCode::BadRequest_400);
+            break;
+        case OTBR_ERROR_INVALID_STATE:
+            aPending->FinishWithError(StatusCode::Conflict_409);
+            break;
+        default:
+            aPending->FinishWithError(StatusCode::InternalServerError_500);
+            break;
+        }
+    };
 
-exit:
-    if (error == OTBR_ERROR_INVALID_ARGS)
-    {
-        ErrorHandler(aResponse, StatusCode::BadRequest_400);
-    }
-    else if (error == OTBR_ERROR_INVALID_STATE)
-    {
-        ErrorHandler(aResponse, StatusCode::Conflict_409);
-    }
-    else if (error != OTBR_ERROR_NONE)
-    {
-        ErrorHandler(aResponse, StatusCode::InternalServerError_500);
-    }
+    RunInMainLoopAndWait(aResponse, std::move(setDataset));
 }
 
 void RestWebServer::Dataset(DatasetType aDatasetType, const Request &aRequest, Response &aResponse) const
@@ -726,58 +815,58 @@ void RestWebServer::DatasetPending(const Request &aRequest, Response &aResponse)
 
 void RestWebServer::GetCommissionerState(Response &aResponse) const
 {
-    std::string         state;
-    otCommissionerState stateCode;
+    RunInMainLoopAndWait(aResponse, [this](const PendingResponsePtr &aPending) {
+        otCommissionerState state = otCommissionerGetState(GetInstance());
 
-    stateCode = RunInMainLoop(otCommissionerGetState, GetInstance());
-    state     = Json::String2JsonString(GetCommissionerStateName(stateCode));
-    aResponse.set_content(state, OT_REST_CONTENT_TYPE_JSON);
-    aResponse.status = StatusCode::OK_200;
+        aPending->Finish(StatusCode::OK_200, Json::String2JsonString(GetCommissionerStateName(state)));
+    });
 }
 
 void RestWebServer::SetCommissionerState(const Request &aRequest, Response &aResponse) const
 {
-    otbrError   error = OTBR_ERROR_NONE;
     std::string body;
 
-    VerifyOrExit(Json::JsonString2String(aRequest.body, body), error = OTBR_ERROR_INVALID_ARGS);
-    SuccessOrExit(error = RunInMainLoop([this, &body]() {
-                      if (body == "enable")
-                      {
-                          VerifyOrReturn(otCommissionerGetState(GetInstance()) == OT_COMMISSIONER_STATE_DISABLED,
-                                         OTBR_ERROR_NONE);
-                          VerifyOrReturn(otCommissionerStart(GetInstance(), NULL, NULL, NULL) == OT_ERROR_NONE,
-                                         OTBR_ERROR_INVALID_STATE);
-                      }
-                      else if (body == "disable")
-                      {
-                          VerifyOrReturn(otCommissionerGetState(GetInstance()) != OT_COMMISSIONER_STATE_DISABLED,
-                                         OTBR_ERROR_NONE);
-                          VerifyOrReturn(otCommissionerStop(GetInstance()) == OT_ERROR_NONE, OTBR_ERROR_INVALID_STATE);
-                      }
-                      else
-                      {
-                          return OTBR_ERROR_INVALID_ARGS;
-                      }
-                      return OTBR_ERROR_NONE;
-                  }));
+    VerifyOrExit(Json::JsonString2String(aRequest.body, body), ErrorHandler(aResponse, StatusCode::BadRequest_400));
+
+    RunInMainLoopAndWait(aResponse, [this, body](const PendingResponsePtr &aPending) {
+        otbrError error = OTBR_ERROR_NONE;
+
+        if (body == "enable")
+        {
+            VerifyOrExit(otCommissionerGetState(GetInstance()) == OT_COMMISSIONER_STATE_DISABLED);
+            VerifyOrExit(otCommissionerStart(GetInstance(), NULL, NULL, NULL) == OT_ERROR_NONE,
+                         error = OTBR_ERROR_INVALID_STATE);
+        }
+        else if (body == "disable")
+        {
+            VerifyOrExit(otCommissionerGetState(GetInstance()) != OT_COMMISSIONER_STATE_DISABLED);
+            VerifyOrExit(otCommissionerStop(GetInstance()) == OT_ERROR_NONE, error = OTBR_ERROR_INVALID_STATE);
+        }
+        else
+        {
+            ExitNow(error = OTBR_ERROR_INVALID_ARGS);
+        }
+
+    exit:
+        switch (error)
+        {
+        case OTBR_ERROR_NONE:
+            aPending->Finish(StatusCode::OK_200);
+            break;
+        case OTBR_ERROR_INVALID_STATE:
+            aPending->FinishWithError(StatusCode::Conflict_409);
+            break;
+        case OTBR_ERROR_INVALID_ARGS:
+            aPending->FinishWithError(StatusCode::BadRequest_400);
+            break;
+        default:
+            aPending->FinishWithError(StatusCode::InternalServerError_500);
+            break;
+        }
+    });
 
 exit:
-    switch (error)
-    {
-    case OTBR_ERROR_NONE:
-        aResponse.status = StatusCode::OK_200;
-        break;
-    case OTBR_ERROR_INVALID_STATE:
-        ErrorHandler(aResponse, StatusCode::Conflict_409);
-        break;
-    case OTBR_ERROR_INVALID_ARGS:
-        ErrorHandler(aResponse, StatusCode::BadRequest_400);
-        break;
-    default:
-        ErrorHandler(aResponse, StatusCode::InternalServerError_500);
-        break;
-    }
+    return;
 }
 
 void RestWebServer::CommissionerState(const Request &aRequest, Response &aResponse) const
@@ -801,9 +890,7 @@ void RestWebServer::CommissionerState(const Request &aRequest, Response &aRespon
 
 void RestWebServer::GetJoiners(Response &aResponse) const
 {
-    std::string body;
-
-    body = RunInMainLoop([this]() {
+    RunInMainLoopAndWait(aResponse, [this](const PendingResponsePtr &aPending) {
         std::vector<otJoinerInfo> joinerTable;
         otJoinerInfo              joinerInfo;
         uint16_t                  iter = 0;
@@ -813,93 +900,75 @@ void RestWebServer::GetJoiners(Response &aResponse) const
             joinerTable.push_back(joinerInfo);
         }
 
-        return Json::JoinerTable2JsonString(joinerTable);
+        aPending->Finish(StatusCode::OK_200, Json::JoinerTable2JsonString(joinerTable));
     });
-
-    aResponse.set_content(body, OT_REST_CONTENT_TYPE_JSON);
-    aResponse.status = StatusCode::OK_200;
 }
 
 void RestWebServer::AddJoiner(const Request &aRequest, Response &aResponse) const
 {
-    otbrError error   = OTBR_ERROR_NONE;
-    otError   errorOt = OT_ERROR_NONE;
+    otJoinerInfo joiner;
 
-    SuccessOrExit(
-        error = RunInMainLoop([this, &errorOt, &aRequest]() {
-            otJoinerInfo        joiner;
-            const otExtAddress *addrPtr                         = nullptr;
-            const uint8_t       emptyArray[OT_EXT_ADDRESS_SIZE] = {0};
+    VerifyOrExit(Json::JsonJoinerInfoString2JoinerInfo(aRequest.body, joiner),
+                 ErrorHandler(aResponse, StatusCode::BadRequest_400));
 
-            VerifyOrReturn(otCommissionerGetState(GetInstance()) == OT_COMMISSIONER_STATE_ACTIVE,
-                           OTBR_ERROR_INVALID_STATE);
+    RunInMainLoopAndWait(aResponse, [this, joiner](const PendingResponsePtr &aPending) {
+        otError             error                           = OT_ERROR_NONE;
+        const otExtAddress *addrPtr                         = &joiner.mSharedId.mEui64;
+        const uint8_t       emptyArray[OT_EXT_ADDRESS_SIZE] = {0};
 
-            VerifyOrReturn(Json::JsonJoinerInfoString2JoinerInfo(aRequest.body, joiner), OTBR_ERROR_INVALID_ARGS);
+        VerifyOrExit(otCommissionerGetState(GetInstance()) == OT_COMMISSIONER_STATE_ACTIVE,
+                     aPending->FinishWithError(StatusCode::Conflict_409));
 
-            addrPtr = &joiner.mSharedId.mEui64;
-            if (memcmp(&joiner.mSharedId.mEui64, emptyArray, OT_EXT_ADDRESS_SIZE) == 0)
-            {
-                addrPtr = nullptr;
-            }
+        if (memcmp(&joiner.mSharedId.mEui64, emptyArray, OT_EXT_ADDRESS_SIZE) == 0)
+        {
+            addrPtr = nullptr;
+        }
 
-            if (joiner.mType == OT_JOINER_INFO_TYPE_DISCERNER)
-            {
-                errorOt = otCommissionerAddJoinerWithDiscerner(GetInstance(), &joiner.mSharedId.mDiscerner,
-                                                               joiner.mPskd.m8, joiner.mExpirationTime);
-            }
-            else
-            {
-                errorOt = otCommissionerAddJoiner(GetInstance(), addrPtr, joiner.mPskd.m8, joiner.mExpirationTime);
-            }
-            VerifyOrReturn(errorOt == OT_ERROR_NONE, OTBR_ERROR_OPENTHREAD);
-            return OTBR_ERROR_NONE;
-        }));
+        if (joiner.mType == OT_JOINER_INFO_TYPE_DISCERNER)
+        {
+            error = otCommissionerAddJoinerWithDiscerner(GetInstance(), &joiner.mSharedId.mDiscerner, joiner.mPskd.m8,
+                                                         joiner.mExpirationTime);
+        }
+        else
+        {
+            error = otCommissionerAddJoiner(GetInstance(), addrPtr, joiner.mPskd.m8, joiner.mExpirationTime);
+        }
 
-exit:
-    switch (error)
-    {
-    case OTBR_ERROR_NONE:
-        aResponse.status = StatusCode::OK_200;
-        break;
-    case OTBR_ERROR_INVALID_STATE:
-        ErrorHandler(aResponse, StatusCode::Conflict_409);
-        break;
-    case OTBR_ERROR_INVALID_ARGS:
-        ErrorHandler(aResponse, StatusCode::BadRequest_400);
-        break;
-    case OTBR_ERROR_OPENTHREAD:
-        switch (errorOt)
+        switch (error)
         {
+        case OT_ERROR_NONE:
+            aPending->Finish(StatusCode::OK_200);
+            break;
         case OT_ERROR_INVALID_ARGS:
-            ErrorHandler(aResponse, StatusCode::BadRequest_400);
+            aPending->FinishWithError(StatusCode::BadRequest_400);
             break;
         case OT_ERROR_NO_BUFS:
-            ErrorHandler(aResponse, StatusCode::InsufficientStorage_507);
+            aPending->FinishWithError(StatusCode::InsufficientStorage_507);
             break;
         default:
-            ErrorHandler(aResponse, StatusCode::InternalServerError_500);
+            aPending->FinishWithError(StatusCode::InternalServerError_500);
             break;
         }
-        break;
-    default:
-        ErrorHandler(aResponse, StatusCode::InternalServerError_500);
-        break;
-    }
+
+    exit:
+        return;
+    });
+
+exit:
+    return;
 }
 
 void RestWebServer::RemoveJoiner(const Request &aRequest, Response &aResponse) const
 {
-    otbrError         error = OTBR_ERROR_NONE;
-    otExtAddress      eui64;
-    otExtAddress     *addrPtr   = nullptr;
+    otbrError         error     = OTBR_ERROR_NONE;
+    otExtAddress      eui64     = {};
+    bool              hasEui64  = false;
     otJoinerDiscerner discerner = {
         .mValue  = 0,
         .mLength = 0,
     };
-    std::string body;
-
-    VerifyOrExit(otCommissionerGetState(GetInstance()) == OT_COMMISSIONER_STATE_ACTIVE,
-                 error = OTBR_ERROR_INVALID_STATE);
+    std::string  body;
+    Continuation removeJoiner;
 
     VerifyOrExit(Json::JsonString2String(aRequest.body, body), error = OTBR_ERROR_INVALID_ARGS);
     if (body != "*")
@@ -910,7 +979,7 @@ void RestWebServer::RemoveJoiner(const Request &aRequest, Response &aResponse) c
             error = OTBR_ERROR_NONE;
             VerifyOrExit(Json::Hex2BytesJsonString(body, eui64.m8, OT_EXT_ADDRESS_SIZE) == OT_EXT_ADDRESS_SIZE,
                          error = OTBR_ERROR_INVALID_ARGS);
-            addrPtr = &eui64;
+            hasEui64 = true;
         }
         else if (error != OTBR_ERROR_NONE)
         {
@@ -918,31 +987,32 @@ void RestWebServer::RemoveJoiner(const Request &aRequest, Response &aResponse) c
         }
     }
 
-    // These functions should only return OT_ERROR_NONE or OT_ERROR_NOT_FOUND both treated as successful
-    if (discerner.mLength == 0)
-    {
-        (void)otCommissionerRemoveJoiner(GetInstance(), addrPtr);
-    }
-    else
-    {
-        (void)otCommissionerRemoveJoinerWithDiscerner(GetInstance(), &discerner);
-    }
+    removeJoiner = [this, eui64, hasEui64, discerner](const PendingResponsePtr &aPending) {
+        VerifyOrExit(otCommissionerGetState(GetInstance()) == OT_COMMISSIONER_STATE_ACTIVE,
+                     aPending->FinishWithError(StatusCode::Conflict_409));
+
+        // These functions should only return OT_ERROR_NONE or OT_ERROR_NOT_FOUND both treated as successful
+        if (discerner.mLength == 0)
+        {
+            (void)otCommissionerRemoveJoiner(GetInstance(), hasEui64 ? &eui64 : nullptr);
+        }
+        else
+        {
+            (void)otCommissionerRemoveJoinerWithDiscerner(GetInstance(), &discerner);
+        }
+
+        aPending->Finish(StatusCode::OK_200);
+
+    exit:
+        return;
+    };
+
+    RunInMainLoopAndWait(aResponse, std::move(removeJoiner));
 
 exit:
-    switch (error)
+    if (error == OTBR_ERROR_INVALID_ARGS)
     {
-    case OTBR_ERROR_NONE:
-        aResponse.status = StatusCode::OK_200;
-        break;
-    case OTBR_ERROR_INVALID_STATE:
-        ErrorHandler(aResponse, StatusCode::Conflict_409);
-        break;
-    case OTBR_ERROR_INVALID_ARGS:
         ErrorHandler(aResponse, StatusCode::BadRequest_400);
-        break;
-    default:
-        ErrorHandler(aResponse, StatusCode::InternalServerError_500);
-        break;
     }
 }
 
@@ -992,76 +1062,361 @@ void RestWebServer::CoprocessorVersion(const Request &aRequest, Response &aRespo
     }
 }
 
-void RestWebServer::DeleteOutDatedDiagnostic(void)
+void RestWebServer::Diagnostic(const Request &aRequest, Response &aResponse)
 {
-    for (auto eraseIt = mDiagSet.begin(); eraseIt != mDiagSet.end();)
+    std::string since;
+    uint64_t    sinceSequence = 0;
+    char       *end;
+    bool        stream;
+
+    VerifyOrExit(GetMethod(aRequest) == HttpMethod::kGet, ErrorHandler(aResponse, StatusCode::MethodNotAllowed_405));
+
+    stream = aRequest.get_header_value(OT_REST_ACCEPT_HEADER) == OT_REST_CONTENT_TYPE_EVENT_STREAM;
+
+    if (aRequest.has_param("since"))
     {
-        auto diagInfo = eraseIt->second;
-        auto duration = duration_cast<microseconds>(steady_clock::now() - diagInfo.mStartTime).count();
+        since = aRequest.get_param_value("since");
+    }
+    else if (stream)
+    {
+        // A reconnecting event source resumes from the last event it received.
+        since = aRequest.get_header_value(OT_REST_LAST_EVENT_ID_HEADER);
+    }
 
-        if (duration >= kDiagResetTimeout)
-        {
-            eraseIt = mDiagSet.erase(eraseIt);
-        }
-        else
-        {
-            eraseIt++;
-        }
+    if (!since.empty())
+    {
+        sinceSequence = strtoull(since.c_str(), &end, 10);
+        VerifyOrExit(*end == '\0', ErrorHandler(aResponse, StatusCode::BadRequest_400));
+    }
+
+    RequestDiagnosticCollection();
+
+    if (stream)
+    {
+        StreamDiagnostic(sinceSequence, aResponse);
     }
+    else
+    {
+        GetDiagnostic(sinceSequence, aResponse);
+    }
+
+exit:
+    return;
 }
 
-void RestWebServer::UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag)
+void RestWebServer::GetDiagnostic(uint64_t aSince, Response &aResponse)
 {
-    DiagInfo value;
+    DiagSnapshotPtr snapshot = GetDiagSnapshot();
+    Timepoint       now      = Clock::now();
+    Timepoint       oldest   = now;
+
+    if (snapshot->mRoundsFinished == 0)
+    {
+        // Nothing has been collected yet, wait for the first round.
+        snapshot = WaitDiagSnapshot(UINT64_MAX, 1, kDiagCollectTimeout + kMainLoopResponseTimeout);
+        VerifyOrExit(snapshot != nullptr && snapshot->mRoundsFinished > 0,
+                     ErrorHandler(aResponse, StatusCode::ServiceUnavailable_503));
+    }
+
+    VerifyOrExit(!snapshot->mLastRoundFailed || !snapshot->mNodes.empty(),
+                 ErrorHandler(aResponse, StatusCode::InternalServerError_500));
 
-    value.mStartTime = steady_clock::now();
-    value.mDiagContent.assign(aDiag.begin(), aDiag.end());
-    mDiagSet[aKey] = value;
+    for (const DiagNodePtr &node : snapshot->mNodes)
+    {
+        oldest = std::min(oldest, node->mUpdateTime);
+    }
+
+    aResponse.set_header(OT_REST_DIAG_SEQUENCE_HEADER, std::to_string(snapshot->mSequence));
+    aResponse.set_header(OT_REST_AGE_HEADER, std::to_string(std::chrono::duration_cast<Seconds>(now - oldest).count()));
+    // A sequence number from before a restart can't be resumed from, answer with all the nodes.
+    aResponse.set_content(DiagNodes2JsonString(*snapshot, (aSince > snapshot->mSequence) ? 0 : aSince),
+                          OT_REST_CONTENT_TYPE_JSON);
+    aResponse.status = StatusCode::OK_200;
+
+exit:
+    return;
 }
 
-void RestWebServer::Diagnostic(const Request &aRequest, Response &aResponse)
+void RestWebServer::StreamDiagnostic(uint64_t aSince, Response &aResponse)
+{
+    DiagSnapshotPtr snapshot = GetDiagSnapshot();
+    uint64_t        since    = (aSince > snapshot->mSequence) ? 0 : aSince;
+    uint32_t        untilRound;
+
+    // Follow the ongoing round, or the next one when the collector is waiting for its next refresh.
+    untilRound = snapshot->mRoundsStarted + ((snapshot->mRoundsStarted > snapshot->mRoundsFinished) ? 0 : 1);
+
+    aResponse.set_header("Cache-Control", "no-cache");
+
+    aResponse.set_chunked_content_provider(
+        OT_REST_CONTENT_TYPE_EVENT_STREAM, [this, since, untilRound](size_t aOffset, DataSink &aSink) mutable {
+            DiagSnapshotPtr current = WaitDiagSnapshot(since, untilRound, kDiagStreamKeepAliveInterval);
+            std::string     events;
+            bool            written = true;
+
+            OT_UNUSED_VARIABLE(aOffset);
+
+            VerifyOrExit(current != nullptr, aSink.done());
+
+            events = DiagNodes2EventString(*current, since);
+            since  = current->mSequence;
+
+            if (events.empty() && current->mRoundsFinished < untilRound)
+            {
+                events = ": keep-alive\n\n";
+            }
+
+            if (!events.empty())
+            {
+                written = aSink.write(events.data(), events.size());
+            }
+
+            if (written && current->mRoundsFinished >= untilRound)
+            {
+                aSink.done();
+            }
+
+        exit:
+            return written;
+        });
+}
+
+RestWebServer::DiagSnapshotPtr RestWebServer::GetDiagSnapshot(void)
 {
-    otbrError error = OTBR_ERROR_NONE;
-    OT_UNUSED_VARIABLE(aRequest);
+    std::lock_guard<std::mutex> lock(mDiagMutex);
+
+    return mDiagSnapshot;
+}
+
+RestWebServer::DiagSnapshotPtr RestWebServer::WaitDiagSnapshot(uint64_t     aSince,
+                                                               uint32_t     aUntilRound,
+                                                               Milliseconds aTimeout)
+{
+    std::unique_lock<std::mutex> lock(mDiagMutex);
+
+    mDiagCondVar.wait_for(lock, aTimeout, [this, aSince, aUntilRound]() {
+        return mDiagStopped || mDiagSnapshot->mSequence > aSince || mDiagSnapshot->mRoundsFinished >= aUntilRound;
+    });
+
+    return mDiagStopped ? nullptr : mDiagSnapshot;
+}
+
+void RestWebServer::RequestDiagnosticCollection(void)
+{
+    mDiagRequested = true;
+
+    if (mDiagCollectorIdle.exchange(false))
+    {
+        mHost.GetTaskRunner().Post([this]() {
+            mDiagIdleRounds = 0;
+            StartDiagnosticRound();
+        });
+    }
+}
+
+void RestWebServer::HandleDiagnosticTimer(void)
+{
+    if (mDiagRequested.exchange(false))
+    {
+        mDiagIdleRounds = 0;
+    }
+    else if (mDiagIdleRounds < kDiagMaxIdleRounds)
+    {
+        ++mDiagIdleRounds;
+    }
+
+    if (mDiagIdleRounds >= kDiagMaxIdleRounds)
+    {
+        // Nobody is using the cache, stop flooding the mesh until the next request.
+        mDiagCollectorIdle = true;
+    }
+    else if (Clock::now() - mDiagRoundStartTime >= kDiagRefreshInterval / 2)
+    {
+        // A request waking up the collector may just have started a round.
+        StartDiagnosticRound();
+    }
+
+    mHost.GetTaskRunner().Post(kDiagRefreshInterval, [this]() { HandleDiagnosticTimer(); });
+}
+
+void RestWebServer::StartDiagnosticRound(void)
+{
+    otbrError           error = OTBR_ERROR_NONE;
     struct otIp6Address multicastAddress;
 
+    VerifyOrExit(!mDiagCollecting);
+
     VerifyOrExit(otIp6AddressFromString(kMulticastAddrAllRouters, &multicastAddress) == OT_ERROR_NONE,
                  error = OTBR_ERROR_REST);
-    VerifyOrExit(
-        RunInMainLoop(
-            otThreadSendDiagnosticGet, GetInstance(), &multicastAddress, kAllTlvTypes,
-            static_cast<uint8_t>(sizeof(kAllTlvTypes)),
-            [](otError aError, otMessage *aMessage, const otMessageInfo *aMessageInfo, void *aContext) -> void {
-                static_cast<RestWebServer *>(aContext)->DiagnosticResponseHandler(aError, aMessage, aMessageInfo);
-            },
-            static_cast<void *>(this)) == OT_ERROR_NONE,
-        error = OTBR_ERROR_REST);
-
-    RunInMainLoop(duration_cast<Milliseconds>(Microseconds(kDiagCollectTimeout)), [this] {
-        DeleteOutDatedDiagnostic();
-        return mDiagSet.size();
-    });
+    VerifyOrExit(otThreadSendDiagnosticGet(GetInstance(), &multicastAddress, kAllTlvTypes,
+                                           static_cast<uint8_t>(sizeof(kAllTlvTypes)), DiagnosticResponseHandler,
+                                           static_cast<void *>(this)) == OT_ERROR_NONE,
+                 error = OTBR_ERROR_REST);
+
+    mDiagCollecting      = true;
+    mDiagLastRoundFailed = false;
+    mDiagRoundStartTime  = Clock::now();
+    ++mDiagRoundsStarted;
+    PublishDiagSnapshot();
+
+    mHost.GetTaskRunner().Post(kDiagCollectTimeout, [this]() { FinishDiagnosticRound(); });
 
 exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to send diagnostic request");
+
+        // Finish the round right away, so that waiting requests don't wait for answers which never come.
+        mDiagLastRoundFailed = true;
+        ++mDiagRoundsStarted;
+        FinishDiagnosticRound();
+    }
+}
 
-    if (error == OTBR_ERROR_NONE)
+void RestWebServer::FinishDiagnosticRound(void)
+{
+    Timepoint now = Clock::now();
+
+    for (auto it = mDiagNodes.begin(); it != mDiagNodes.end();)
     {
-        std::vector<std::vector<otNetworkDiagTlv>> diagContentSet;
-        std::string                                body;
+        if (now - it->second->mUpdateTime >= kDiagMaxAge)
+        {
+            it = mDiagNodes.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    mDiagCollecting = false;
+    ++mDiagRoundsFinished;
+    PublishDiagSnapshot();
+}
+
+void RestWebServer::UpdateDiagNode(const std::vector<otNetworkDiagTlv> &aDiag, const otIp6Address &aSource)
+{
+    std::shared_ptr<DiagNode> node = std::make_shared<DiagNode>();
+    std::string               key;
 
-        for (auto it = mDiagSet.begin(); it != mDiagSet.end(); ++it)
+    // The extended address identifies a node across re-attachments which change its RLOC16. Its length differs
+    // from the one of the source address, so the two kinds of keys never collide.
+    key.assign(reinterpret_cast<const char *>(aSource.mFields.m8), sizeof(aSource.mFields.m8));
+    node->mRloc16 = kDiagUnknownRloc16;
+
+    for (const otNetworkDiagTlv &diagTlv : aDiag)
+    {
+        if (diagTlv.mType == OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS)
+        {
+            key.assign(reinterpret_cast<const char *>(diagTlv.mData.mExtAddress.m8),
+                       sizeof(diagTlv.mData.mExtAddress.m8));
+        }
+        else if (diagTlv.mType == OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS)
         {
-            diagContentSet.push_back(it->second.mDiagContent);
+            node->mRloc16 = diagTlv.mData.mAddr16;
         }
+    }
 
-        body             = Json::Diag2JsonString(diagContentSet);
-        aResponse.status = StatusCode::OK_200;
-        aResponse.set_content(body, OT_REST_CONTENT_TYPE_JSON);
+    node->mUpdateTime = Clock::now();
+    node->mJson       = Json::DiagNode2JsonString(aDiag);
+
+    auto it = mDiagNodes.find(key);
+
+    if (it != mDiagNodes.end() && it->second->mJson == node->mJson)
+    {
+        // Only the age changed, deltas keep skipping this node.
+        node->mSequence = it->second->mSequence;
     }
     else
     {
-        ErrorHandler(aResponse, StatusCode::InternalServerError_500);
+        node->mSequence = ++mDiagSequence;
     }
+
+    mDiagNodes[key] = node;
+    PublishDiagSnapshot();
+}
+
+void RestWebServer::PublishDiagSnapshot(void)
+{
+    std::shared_ptr<DiagSnapshot> snapshot = std::make_shared<DiagSnapshot>();
+
+    snapshot->mSequence        = mDiagSequence;
+    snapshot->mRoundsStarted   = mDiagRoundsStarted;
+    snapshot->mRoundsFinished  = mDiagRoundsFinished;
+    snapshot->mLastRoundFailed = mDiagLastRoundFailed;
+    snapshot->mNodes.reserve(mDiagNodes.size());
+
+    for (const auto &entry : mDiagNodes)
+    {
+        snapshot->mNodes.push_back(entry.second);
+    }
+
+    std::sort(snapshot->mNodes.begin(), snapshot->mNodes.end(),
+              [](const DiagNodePtr &aLhs, const DiagNodePtr &aRhs) { return aLhs->mRloc16 < aRhs->mRloc16; });
+
+    {
+        std::lock_guard<std::mutex> lock(mDiagMutex);
+
+        mDiagSnapshot = std::move(snapshot);
+    }
+
+    mDiagCondVar.notify_all();
+}
+
+std::string RestWebServer::DiagNodes2JsonString(const DiagSnapshot &aSnapshot, uint64_t aSince)
+{
+    std::string body = "[";
+
+    for (const DiagNodePtr &node : aSnapshot.mNodes)
+    {
+        if (node->mSequence <= aSince)
+        {
+            continue;
+        }
+
+        if (body.size() > 1)
+        {
+            body += ",";
+        }
+        body += node->mJson;
+    }
+
+    body += "]";
+
+    return body;
+}
+
+std::string RestWebServer::DiagNodes2EventString(const DiagSnapshot &aSnapshot, uint64_t aSince)
+{
+    std::vector<DiagNodePtr> changed;
+    std::string              events;
+
+    for (const DiagNodePtr &node : aSnapshot.mNodes)
+    {
+        if (node->mSequence > aSince)
+        {
+            changed.push_back(node);
+        }
+    }
+
+    // Event IDs must increase, so that a reconnecting client can resume with `Last-Event-ID`.
+    std::sort(changed.begin(), changed.end(),
+              [](const DiagNodePtr &aLhs, const DiagNodePtr &aRhs) { return aLhs->mSequence < aRhs->mSequence; });
+
+    for (const DiagNodePtr &node : changed)
+    {
+        events += "id: " + std::to_string(node->mSequence) + "\ndata: " + node->mJson + "\n\n";
+    }
+
+    return events;
+}
+
+void RestWebServer::DiagnosticResponseHandler(otError              aError,
+                                              otMessage           *aMessage,
+                                              const otMessageInfo *aMessageInfo,
+                                              void                *aContext)
+{
+    static_cast<RestWebServer *>(aContext)->DiagnosticResponseHandler(aError, aMessage, aMessageInfo);
 }
 
 void RestWebServer::DiagnosticResponseHandler(otError              aError,
@@ -1071,24 +1426,14 @@ void RestWebServer::DiagnosticResponseHandler(otError              aError,
     std::vector<otNetworkDiagTlv> diagSet;
     otNetworkDiagTlv              diagTlv;
     otNetworkDiagIterator         iterator = OT_NETWORK_DIAGNOSTIC_ITERATOR_INIT;
-    otError                       error;
-    char                          rloc[7];
-    std::string                   keyRloc = "0xffee";
 
     SuccessOrExit(aError);
 
-    OTBR_UNUSED_VARIABLE(aMessageInfo);
-
-    while ((error = otThreadGetNextDiagnosticTlv(aMessage, &iterator, &diagTlv)) == OT_ERROR_NONE)
+    while (otThreadGetNextDiagnosticTlv(aMessage, &iterator, &diagTlv) == OT_ERROR_NONE)
     {
-        if (diagTlv.mType == OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS)
-        {
-            snprintf(rloc, sizeof(rloc), "0x%04x", diagTlv.mData.mAddr16);
-            keyRloc = Json::CString2JsonString(rloc);
-        }
         diagSet.push_back(diagTlv);
     }
-    UpdateDiag(keyRloc, diagSet);
+    UpdateDiagNode(diagSet, aMessageInfo->mPeerAddr);
 
 exit:
     if (aError != OT_ERROR_NONE)
@@ -1099,6 +1444,11 @@ exit:
 
 void RestWebServer::Init(const std::string &aRestListenAddress, int aRestListenPort)
 {
+    mHost.AddThreadStateChangedCallback([this](otChangedFlags aFlags) { HandleThreadStateChanged(aFlags); });
+    mHost.RegisterResetHandler([this]() { RequestNodeSnapshotUpdate(); });
+    mHost.GetTaskRunner().Post(kDiagRefreshInterval, [this]() { HandleDiagnosticTimer(); });
+    UpdateNodeSnapshot();
+
     mServerThread = std::thread([aRestListenAddress, aRestListenPort, this]() -> void {
         otbrLogInfo("RestWebServer listening on %s:%u", aRestListenAddress.c_str(), aRestListenPort);
         mServer.set_ipv6_v6only(false);
@@ -42,7 +42,12 @@
 #include <netinet/ip.h>
 #include <sys/socket.h>
 
-#include <unordered_map>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include <openthread/border_agent.h>
@@ -86,6 +91,110 @@ private:
     using Response   = httplib::Response;
     using StatusCode = httplib::StatusCode;
 
+    /**
+     * This structure represents the cached network diagnostics of one node.
+     */
+    struct DiagNode
+    {
+        Timepoint   mUpdateTime; ///< The last time the node answered.
+        uint64_t    mSequence;   ///< The sequence number of the last change of the node content.
+        uint16_t    mRloc16;     ///< The RLOC16 the node last answered with.
+        std::string mJson;       ///< The diagnostic TLVs of the node, rendered as a compact JSON object.
+    };
+
+    using DiagNodePtr = std::shared_ptr<const DiagNode>;
+
+    /**
+     * This structure represents the network diagnostics cache as seen by httplib worker threads.
+     *
+     * A snapshot is immutable once published. Nodes which did not change are shared between snapshots.
+     */
+    struct DiagSnapshot
+    {
+        uint64_t                 mSequence        = 0;     ///< The sequence number of the latest change.
+        uint32_t                 mRoundsStarted   = 0;     ///< The number of collection rounds started.
+        uint32_t                 mRoundsFinished  = 0;     ///< The number of collection rounds finished.
+        bool                     mLastRoundFailed = false; ///< Whether the latest round failed to start.
+        std::vector<DiagNodePtr> mNodes;                   ///< The cached nodes, ordered by RLOC16.
+    };
+
+    using DiagSnapshotPtr = std::shared_ptr<const DiagSnapshot>;
+
+    /**
+     * This structure represents the `/node` resources, rendered as JSON bodies in the main loop.
+     *
+     * A snapshot is immutable once published, so httplib worker threads can use it without locking.
+     */
+    struct NodeSnapshot
+    {
+        Timepoint   mTime;          ///< The time the snapshot was taken.
+        bool        mHasBaId;       ///< Whether the Border Agent ID could be read.
+        bool        mHasLeaderData; ///< Whether the leader data could be read.
+        std::string mNode;
+        std::string mBaId;
+        std::string mExtAddress;
+        std::string mState;
+        std::string mNetworkName;
+        std::string mLeaderData;
+        std::string mNumOfRouter;
+        std::string mRloc16;
+        std::string mExtPanId;
+        std::string mRloc;
+    };
+
+    using NodeSnapshotPtr = std::shared_ptr<const NodeSnapshot>;
+
+    /**
+     * This class implements a response which is finished from the main loop.
+     *
+     * The httplib worker thread creates it, hands it to a continuation running in the main loop and waits
+     * on it. The continuation calls `Finish()` whenever the result is ready, without blocking the main loop.
+     *
+     * httplib serves each connection on a thread of its pool and has no way to resume a response later, so the
+     * worker stays parked until the response is finished. Only the main loop is kept from blocking.
+     */
+    class PendingResponse
+    {
+    public:
+        /**
+         * Finishes the response. Only the first call takes effect.
+         *
+         * @param[in] aStatus       The HTTP status code.
+         * @param[in] aBody         The response body.
+         * @param[in] aContentType  The content type of @p aBody.
+         */
+        void Finish(StatusCode aStatus, std::string aBody = "", const char *aContentType = OT_REST_CONTENT_TYPE_JSON);
+
+        /**
+         * Finishes the response with an error body.
+         *
+         * @param[in] aErrorCode  The HTTP status code of the error.
+         */
+        void FinishWithError(StatusCode aErrorCode);
+
+        /**
+         * Waits until the response is finished and copies it into @p aResponse.
+         *
+         * @param[out] aResponse  A reference to the httplib response.
+         * @param[in]  aTimeout   The maximum time to wait.
+         *
+         * @retval TRUE   The response was finished and copied to @p aResponse.
+         * @retval FALSE  The response was not finished within @p aTimeout.
+         */
+        bool Wait(Response &aResponse, Milliseconds aTimeout);
+
+    private:
+        std::mutex              mMutex;
+        std::condition_variable mCondVar;
+        bool                    mFinished = false;
+        StatusCode              mStatus   = StatusCode::InternalServerError_500;
+        std::string             mBody;
+        const char             *mContentType = OT_REST_CONTENT_TYPE_JSON;
+    };
+
+    using PendingResponsePtr = std::shared_ptr<PendingResponse>;
+    using Continuation       = std::function<void(const PendingResponsePtr &aPending)>;
+
     /**
      * This enumeration represents the Dataset type (active or pending).
      */
@@ -133,26 +242,49 @@ private:
     void RemoveJoiner(const Request &aRequest, Response &aResponse) const;
     void GetCoprocessorVersion(Response &aResponse) const;
 
-    void DeleteOutDatedDiagnostic(void);
-    void UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag);
+    NodeSnapshotPtr GetNodeSnapshot(void) const;
+    NodeSnapshotPtr WaitNodeSnapshot(Timepoint aNewerThan, Milliseconds aTimeout) const;
+    NodeSnapshotPtr UpdateNodeSnapshot(void) const;
+    void            RequestNodeSnapshotUpdate(void) const;
+    void            RespondWithNodeSnapshot(Response                  &aResponse,
+                                            std::string NodeSnapshot::*aBody,
+                                            bool NodeSnapshot::*aIsValid = nullptr) const;
+    void            HandleThreadStateChanged(otChangedFlags aFlags) const;
+
+    void GetDiagnostic(uint64_t aSince, Response &aResponse);
+    void StreamDiagnostic(uint64_t aSince, Response &aResponse);
 
-    void DiagnosticResponseHandler(otError aError, const otMessage *aMessage, const otMessageInfo *aMessageInfo);
+    DiagSnapshotPtr    GetDiagSnapshot(void);
+    DiagSnapshotPtr    WaitDiagSnapshot(uint64_t aSince, uint32_t aUntilRound, Milliseconds aTimeout);
+    void               RequestDiagnosticCollection(void);
+    void               HandleDiagnosticTimer(void);
+    void               StartDiagnosticRound(void);
+    void               FinishDiagnosticRound(void);
+    void               UpdateDiagNode(const std::vector<otNetworkDiagTlv> &aDiag, const otIp6Address &aSource);
+    void               PublishDiagSnapshot(void);
+    static std::string DiagNodes2JsonString(const DiagSnapshot &aSnapshot, uint64_t aSince);
+    static std::string DiagNodes2EventString(const DiagSnapshot &aSnapshot, uint64_t aSince);
+
+    static void DiagnosticResponseHandler(otError              aError,
+                                          otMessage           *aMessage,
+                                          const otMessageInfo *aMessageInfo,
+                                          void                *aContext);
+    void        DiagnosticResponseHandler(otError aError, const otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
     otInstance *GetInstance(void) const { return mHost.GetThreadHelper()->GetInstance(); }
 
     void ErrorHandler(Response &aResponse, StatusCode aErrorCode) const;
 
-    template <typename Call, typename... Args>
-    auto RunInMainLoop(Call aCall, Args... aArgs) const -> decltype(aCall(aArgs...))
-    {
-        return mHost.GetTaskRunner().PostAndWait<decltype(aCall(aArgs...))>([&]() { return aCall(aArgs...); });
-    }
-
-    template <typename Call, typename... Args>
-    auto RunInMainLoop(Milliseconds aDelay, Call aCall, Args... aArgs) const -> decltype(aCall(aArgs...))
-    {
-        return mHost.GetTaskRunner().PostAndWait<decltype(aCall(aArgs...))>([&]() { return aCall(aArgs...); }, aDelay);
-    }
+    /**
+     * Runs @p aContinuation in the main loop and blocks the calling httplib worker until it finishes the response.
+     *
+     * The continuation may outlive the request when the wait times out, so it must not refer to @p aResponse
+     * or to the request.
+     *
+     * @param[out] aResponse      A reference to the httplib response.
+     * @param[in]  aContinuation  The continuation which finishes the response from the main loop.
+     */
+    void RunInMainLoopAndWait(Response &aResponse, Continuation aContinuation) const;
 
     template <typename HandlerType> httplib::Server::Handler MakeHandler(HandlerType aHandler)
     {
@@ -166,7 +298,33 @@ private:
     httplib::Server mServer;
     std::thread     mServerThread;
 
-    std::unordered_map<std::string, DiagInfo> mDiagSet;
+    // Published with `std::atomic_store()` in the main loop and read with `std::atomic_load()` by worker threads.
+    mutable NodeSnapshotPtr   mNodeSnapshot;
+    mutable std::atomic<bool> mNodeSnapshotUpdatePending;
+
+    // Notified when a new `/node` snapshot is published, for requests which can't be served the current one.
+    mutable std::mutex              mNodeSnapshotMutex;
+    mutable std::condition_variable mNodeSnapshotCondVar;
+
+    // Network diagnostics cache, only accessed in the main loop.
+    std::map<std::string, DiagNodePtr> mDiagNodes; ///< Cached nodes keyed by extended or source address.
+    uint64_t                           mDiagSequence;
+    uint32_t                           mDiagRoundsStarted;
+    uint32_t                           mDiagRoundsFinished;
+    uint8_t                            mDiagIdleRounds;
+    bool                               mDiagCollecting;
+    bool                               mDiagLastRoundFailed;
+    Timepoint                          mDiagRoundStartTime;
+
+    // Set by worker threads to keep the collector running, or to wake it up when idle.
+    std::atomic<bool> mDiagRequested;
+    std::atomic<bool> mDiagCollectorIdle;
+
+    // Published by the main loop and waited on by worker threads streaming the diagnostics.
+    std::mutex              mDiagMutex;
+    std::condition_variable mDiagCondVar;
+    DiagSnapshotPtr         mDiagSnapshot;
+    bool                    mDiagStopped;
 };
 
 } // namespace rest
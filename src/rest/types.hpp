@@ -45,10 +45,14 @@
 #include "openthread/netdiag.h"
 
 #define OT_REST_ACCEPT_HEADER "Accept"
+#define OT_REST_AGE_HEADER "Age"
 #define OT_REST_CONTENT_TYPE_HEADER "Content-Type"
+#define OT_REST_LAST_EVENT_ID_HEADER "Last-Event-ID"
+#define OT_REST_DIAG_SEQUENCE_HEADER "X-Diagnostic-Sequence"
 
 #define OT_REST_CONTENT_TYPE_JSON "application/json"
 #define OT_REST_CONTENT_TYPE_PLAIN "text/plain"
+#define OT_REST_CONTENT_TYPE_EVENT_STREAM "text/event-stream"
 
 using std::chrono::steady_clock;
 
@@ -112,12 +116,6 @@ struct NodeInfo
     std::string     mNetworkName;
 };
 
-struct DiagInfo
-{
-    steady_clock::time_point      mStartTime;
-    std::vector<otNetworkDiagTlv> mDiagContent;
-};
-
 } // namespace rest
 } // namespace otbr
 
@@ -41,9 +41,12 @@
 #error "The Advertising Proxy requires OTBR_ENABLE_MDNS_AVAHI, OTBR_ENABLE_MDNS_MDNSSD or OTBR_ENABLE_MDNS_MOJO"
 #endif
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 #include <assert.h>
+#include <string.h>
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
@@ -51,13 +54,29 @@
 
 namespace otbr {
 
+static constexpr uint32_t kRepublishBatchSize  = OTBR_CONFIG_SRP_REPUBLISH_BATCH_SIZE;
+static constexpr uint32_t kRepublishMaxInFlight = OTBR_CONFIG_SRP_REPUBLISH_MAX_IN_FLIGHT;
+
+// A republish is deferred while this many SRP updates are waiting for their mDNS registrations.
+static constexpr size_t kRepublishMaxOutstandingUpdates = 8;
+
+// Delay before retrying a batch deferred because of outstanding SRP updates.
+static constexpr Milliseconds kRepublishRetryDelay = Milliseconds(100);
+
 AdvertisingProxy::AdvertisingProxy(Host::RcpHost &aHost, Mdns::Publisher &aPublisher)
     : mHost(aHost)
     , mPublisher(aPublisher)
     , mIsEnabled(false)
+    , mRepublishQueue(kRepublishBatchSize, kRepublishMaxInFlight)
+    , mRepublishGeneration(0)
+    , mRepublishTaskId(0)
+    , mRepublishMetrics()
 {
-    mHost.RegisterResetHandler(
-        [this]() { otSrpServerSetServiceUpdateHandler(GetInstance(), AdvertisingHandler, this); });
+    mHost.RegisterResetHandler([this]() {
+        // The hosts queued for republishing are gone with the reset instance.
+        CancelRepublish();
+        otSrpServerSetServiceUpdateHandler(GetInstance(), AdvertisingHandler, this);
+    });
 }
 
 void AdvertisingProxy::SetEnabled(bool aIsEnabled)
@@ -95,6 +114,8 @@ void AdvertisingProxy::Stop(void)
         otSrpServerSetServiceUpdateHandler(GetInstance(), nullptr, nullptr);
     }
 
+    CancelRepublish();
+
     otbrLogInfo("Stopped");
 }
 
@@ -115,6 +136,9 @@ void AdvertisingProxy::AdvertisingHandler(otSrpServerServiceUpdateId aId,
     OutstandingUpdate *update = nullptr;
     otbrError          error  = OTBR_ERROR_NONE;
 
+    // The SRP server may remove `aHost` or the host it replaces right after this call.
+    mRepublishQueue.InvalidateHosts();
+
     VerifyOrExit(IsEnabled());
 
     mOutstandingUpdates.emplace_back();
@@ -126,7 +150,7 @@ void AdvertisingProxy::AdvertisingHandler(otSrpServerServiceUpdateId aId,
     if (error != OTBR_ERROR_NONE || update->mCallbackCount == 0)
     {
         mOutstandingUpdates.pop_back();
-        otSrpServerHandleServiceUpdateResult(GetInstance(), aId, OtbrErrorToOtError(error));
+        HandleSrpServiceUpdateResult(aId, error);
     }
 
 exit:
@@ -148,7 +172,7 @@ void AdvertisingProxy::OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId,
             // elements may be added to `otSrpServerHandleServiceUpdateResult` and
             // the iterator will be invalidated.
             mOutstandingUpdates.erase(update);
-            otSrpServerHandleServiceUpdateResult(GetInstance(), aUpdateId, OtbrErrorToOtError(aError));
+            HandleSrpServiceUpdateResult(aUpdateId, aError);
         }
         else
         {
@@ -159,6 +183,14 @@ void AdvertisingProxy::OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId,
     }
 }
 
+void AdvertisingProxy::HandleSrpServiceUpdateResult(otSrpServerServiceUpdateId aId, otbrError aError)
+{
+    otSrpServerHandleServiceUpdateResult(GetInstance(), aId, OtbrErrorToOtError(aError));
+
+    // Committing the update may have replaced an existing host.
+    mRepublishQueue.InvalidateHosts();
+}
+
 std::vector<Ip6Address> AdvertisingProxy::GetEligibleAddresses(const otIp6Address *aHostAddresses,
                                                                uint8_t             aHostAddressNum)
 {
@@ -202,16 +234,166 @@ void AdvertisingProxy::PublishAllHostsAndServices(void)
     VerifyOrExit(IsEnabled());
     VerifyOrExit(mPublisher.IsStarted());
 
-    otbrLogInfo("Publish all hosts and services");
+    CancelRepublish();
+    mRepublishMetrics.mTotalHosts = 0;
+
     while ((host = otSrpServerGetNextHost(GetInstance(), host)))
     {
-        PublishHostAndItsServices(host, nullptr);
+        otSrpServerLeaseInfo leaseInfo;
+
+        otSrpServerHostGetLeaseInfo(host, &leaseInfo);
+        mRepublishQueue.Add(host, otSrpServerHostGetFullName(host),
+                            SrpRepublishQueue::GetOrderKey(leaseInfo.mLease, leaseInfo.mRemainingLease,
+                                                           otSrpServerHostIsDeleted(host)));
+        ++mRepublishMetrics.mTotalHosts;
+    }
+
+    mRepublishQueue.Sort();
+
+    ++mRepublishMetrics.mRounds;
+    mRepublishMetrics.mInProgress         = true;
+    mRepublishMetrics.mPublishedHosts     = 0;
+    mRepublishMetrics.mRegistrations      = 0;
+    mRepublishMetrics.mBatches            = 0;
+    mRepublishMetrics.mBackPressureStalls = 0;
+    mRepublishStartTime                   = Clock::now();
+
+    otbrLogInfo("Publish all hosts and services: %u hosts", mRepublishMetrics.mTotalHosts);
+    ScheduleRepublish(Milliseconds::zero());
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::ScheduleRepublish(Milliseconds aDelay)
+{
+    VerifyOrExit(mRepublishTaskId == 0);
+
+    mRepublishTaskId = mHost.GetTaskRunner().Post(aDelay, [this]() {
+        mRepublishTaskId = 0;
+        RepublishNextBatch();
+    });
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::CancelRepublish(void)
+{
+    if (mRepublishTaskId != 0)
+    {
+        mHost.GetTaskRunner().Cancel(mRepublishTaskId);
+        mRepublishTaskId = 0;
+    }
+
+    if (mRepublishMetrics.mInProgress)
+    {
+        otbrLogInfo("Abort republishing, %u of %u hosts published", mRepublishMetrics.mPublishedHosts,
+                    mRepublishMetrics.mTotalHosts);
+    }
+
+    mRepublishQueue.Clear();
+    ++mRepublishGeneration;
+    mRepublishMetrics.mInProgress = false;
+}
+
+void AdvertisingProxy::RepublishNextBatch(void)
+{
+    if (!IsEnabled() || !mPublisher.IsStarted())
+    {
+        // The republish starts over once the publisher is ready again.
+        CancelRepublish();
+        ExitNow();
+    }
+
+    if (mRepublishQueue.IsWindowFull())
+    {
+        // Resumed by `HandleRepublishResult()` once the publisher caught up.
+        ++mRepublishMetrics.mBackPressureStalls;
+        ExitNow();
+    }
+
+    if (mOutstandingUpdates.size() >= kRepublishMaxOutstandingUpdates)
+    {
+        // Let updates from SRP clients go first.
+        ++mRepublishMetrics.mBackPressureStalls;
+        ScheduleRepublish(kRepublishRetryDelay);
+        ExitNow();
+    }
+
+    ++mRepublishMetrics.mBatches;
+
+    mRepublishMetrics.mPublishedHosts += mRepublishQueue.PublishBatch(
+        [this](const otSrpServerHost *aHost) { PublishHostAndItsServices(aHost, nullptr); },
+        [this](SrpRepublishQueue::HostMap &aHosts) {
+            const otSrpServerHost *host = nullptr;
+
+            while ((host = otSrpServerGetNextHost(GetInstance(), host)))
+            {
+                aHosts[otSrpServerHostGetFullName(host)] = host;
+            }
+        });
+
+    otbrLogDebug("Republished %u of %u hosts, %u registrations in flight", mRepublishMetrics.mPublishedHosts,
+                 mRepublishMetrics.mTotalHosts, mRepublishQueue.GetInFlight());
+
+    if (mRepublishQueue.IsEmpty())
+    {
+        FinishRepublishIfDone();
+    }
+    else if (!mRepublishQueue.IsWindowFull())
+    {
+        ScheduleRepublish(Milliseconds::zero());
+    }
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::CountRepublishRegistration(void)
+{
+    mRepublishQueue.HandleRegistration();
+    ++mRepublishMetrics.mRegistrations;
+}
+
+void AdvertisingProxy::HandleRepublishResult(uint32_t aGeneration)
+{
+    bool resume;
+
+    VerifyOrExit(aGeneration == mRepublishGeneration);
+
+    resume = mRepublishQueue.HandleResult();
+
+    if (mRepublishQueue.IsEmpty())
+    {
+        FinishRepublishIfDone();
+    }
+    else if (resume)
+    {
+        ScheduleRepublish(Milliseconds::zero());
     }
 
 exit:
     return;
 }
 
+void AdvertisingProxy::FinishRepublishIfDone(void)
+{
+    VerifyOrExit(mRepublishMetrics.mInProgress && mRepublishQueue.IsEmpty() && mRepublishQueue.GetInFlight() == 0);
+
+    mRepublishMetrics.mInProgress   = false;
+    mRepublishMetrics.mLastDuration = std::chrono::duration_cast<Milliseconds>(Clock::now() - mRepublishStartTime);
+    mRepublishMetrics.mMaxDuration  = std::max(mRepublishMetrics.mMaxDuration, mRepublishMetrics.mLastDuration);
+
+    otbrLogInfo("Published all %u hosts and %u registrations in %lld ms, %u batches, %u stalls",
+                mRepublishMetrics.mTotalHosts, mRepublishMetrics.mRegistrations,
+                static_cast<long long>(mRepublishMetrics.mLastDuration.count()), mRepublishMetrics.mBatches,
+                mRepublishMetrics.mBackPressureStalls);
+
+exit:
+    return;
+}
+
 otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHost, OutstandingUpdate *aUpdate)
 {
     otbrError                  error = OTBR_ERROR_NONE;
@@ -223,6 +405,7 @@ otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHo
     const otSrpServerService  *service;
     otSrpServerServiceUpdateId updateId     = 0;
     bool                       hasUpdate    = false;
+    uint32_t                   generation   = mRepublishGeneration;
     std::string                fullHostName = otSrpServerHostGetFullName(aHost);
 
     otbrLogInfo("Advertise SRP service updates: host=%s", fullHostName.c_str());
@@ -261,21 +444,33 @@ otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHo
             Mdns::Publisher::SubTypeList subTypeList = MakeSubTypeList(service);
 
             otbrLogDebug("Publish SRP service '%s'", fullServiceName.c_str());
+            if (!hasUpdate)
+            {
+                CountRepublishRegistration();
+            }
             mPublisher.PublishService(
                 hostName, serviceName, serviceType, subTypeList, otSrpServerServiceGetPort(service), txtData,
-                [this, hasUpdate, updateId, fullServiceName](otbrError aError) {
+                [this, hasUpdate, updateId, generation, fullServiceName](otbrError aError) {
                     otbrLogResult(aError, "Handle publish SRP service '%s'", fullServiceName.c_str());
                     if (hasUpdate)
                     {
                         OnMdnsPublishResult(updateId, aError);
                     }
+                    else
+                    {
+                        HandleRepublishResult(generation);
+                    }
                 });
         }
         else
         {
             otbrLogDebug("Unpublish SRP service '%s'", fullServiceName.c_str());
+            if (!hasUpdate)
+            {
+                CountRepublishRegistration();
+            }
             mPublisher.UnpublishService(
-                serviceName, serviceType, [this, hasUpdate, updateId, fullServiceName](otbrError aError) {
+                serviceName, serviceType, [this, hasUpdate, updateId, generation, fullServiceName](otbrError aError) {
                     // Treat `NOT_FOUND` as success when unpublishing service
                     aError = (aError == OTBR_ERROR_NOT_FOUND) ? OTBR_ERROR_NONE : aError;
                     otbrLogResult(aError, "Handle unpublish SRP service '%s'", fullServiceName.c_str());
@@ -283,6 +478,10 @@ otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHo
                     {
                         OnMdnsPublishResult(updateId, aError);
                     }
+                    else
+                    {
+                        HandleRepublishResult(generation);
+                    }
                 });
         }
     }
@@ -295,20 +494,32 @@ otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHo
         otbrLogDebug("Publish SRP host '%s'", fullHostName.c_str());
 
         addresses = GetEligibleAddresses(hostAddresses, hostAddressNum);
+        if (!hasUpdate)
+        {
+            CountRepublishRegistration();
+        }
         mPublisher.PublishHost(
             hostName, addresses,
-            Mdns::Publisher::ResultCallback([this, hasUpdate, updateId, fullHostName](otbrError aError) {
+            Mdns::Publisher::ResultCallback([this, hasUpdate, updateId, generation, fullHostName](otbrError aError) {
                 otbrLogResult(aError, "Handle publish SRP host '%s'", fullHostName.c_str());
                 if (hasUpdate)
                 {
                     OnMdnsPublishResult(updateId, aError);
                 }
+                else
+                {
+                    HandleRepublishResult(generation);
+                }
             }));
     }
     else
     {
         otbrLogDebug("Unpublish SRP host '%s'", fullHostName.c_str());
-        mPublisher.UnpublishHost(hostName, [this, hasUpdate, updateId, fullHostName](otbrError aError) {
+        if (!hasUpdate)
+        {
+            CountRepublishRegistration();
+        }
+        mPublisher.UnpublishHost(hostName, [this, hasUpdate, updateId, generation, fullHostName](otbrError aError) {
             // Treat `NOT_FOUND` as success when unpublishing host.
             aError = (aError == OTBR_ERROR_NOT_FOUND) ? OTBR_ERROR_NONE : aError;
             otbrLogResult(aError, "Handle unpublish SRP host '%s'", fullHostName.c_str());
@@ -316,6 +527,10 @@ otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHo
             {
                 OnMdnsPublishResult(updateId, aError);
             }
+            else
+            {
+                HandleRepublishResult(generation);
+            }
         });
     }
 
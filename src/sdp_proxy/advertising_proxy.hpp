@@ -44,8 +44,11 @@
 #include <openthread/srp_server.h>
 
 #include "common/code_utils.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
 #include "host/rcp_host.hpp"
 #include "mdns/mdns.hpp"
+#include "sdp_proxy/srp_republish_queue.hpp"
 
 namespace otbr {
 
@@ -55,6 +58,22 @@ namespace otbr {
 class AdvertisingProxy : public Mdns::StateObserver, private NonCopyable
 {
 public:
+    /**
+     * This structure represents the progress of republishing all hosts and services.
+     */
+    struct RepublishMetrics
+    {
+        bool         mInProgress;         ///< Whether a republish is ongoing.
+        uint32_t     mRounds;             ///< The number of republishes started.
+        uint32_t     mTotalHosts;         ///< The number of hosts of the current or last republish.
+        uint32_t     mPublishedHosts;     ///< The number of hosts republished so far.
+        uint32_t     mRegistrations;      ///< The number of mDNS registrations issued so far.
+        uint32_t     mBatches;            ///< The number of batches so far.
+        uint32_t     mBackPressureStalls; ///< The number of times a batch was deferred by back-pressure.
+        Milliseconds mLastDuration;       ///< The time to fully republish, of the last finished republish.
+        Milliseconds mMaxDuration;        ///< The longest time to fully republish.
+    };
+
     /**
      * This constructor initializes the Advertising Proxy object.
      *
@@ -72,9 +91,21 @@ public:
 
     /**
      * This method publishes all registered hosts and services.
+     *
+     * Hosts with the most recent lease activity are published first and deleted hosts last. The registrations are
+     * issued in batches of `OTBR_CONFIG_SRP_REPUBLISH_BATCH_SIZE` per main loop iteration, and deferred while the mDNS
+     * publisher has `OTBR_CONFIG_SRP_REPUBLISH_MAX_IN_FLIGHT` pending registrations or SRP updates are waiting to be
+     * advertised.
      */
     void PublishAllHostsAndServices(void);
 
+    /**
+     * This method returns the progress of republishing all hosts and services.
+     *
+     * @returns The republish metrics.
+     */
+    const RepublishMetrics &GetRepublishMetrics(void) const { return mRepublishMetrics; }
+
     /**
      * This method handles mDNS publisher's state changes.
      *
@@ -120,6 +151,14 @@ private:
      */
     otbrError PublishHostAndItsServices(const otSrpServerHost *aHost, OutstandingUpdate *aUpdate);
 
+    void ScheduleRepublish(Milliseconds aDelay);
+    void CancelRepublish(void);
+    void RepublishNextBatch(void);
+    void CountRepublishRegistration(void);
+    void HandleRepublishResult(uint32_t aGeneration);
+    void FinishRepublishIfDone(void);
+    void HandleSrpServiceUpdateResult(otSrpServerServiceUpdateId aId, otbrError aError);
+
     otInstance *GetInstance(void) { return mHost.GetInstance(); }
 
     // A reference to the NCP controller, has no ownership.
@@ -132,6 +171,14 @@ private:
 
     // A vector that tracks outstanding updates.
     std::vector<OutstandingUpdate> mOutstandingUpdates;
+
+    // The hosts left to republish, in publishing order.
+    SrpRepublishQueue mRepublishQueue;
+    // Identifies the current republish, results of registrations issued by an earlier one are ignored.
+    uint32_t           mRepublishGeneration;
+    TaskRunner::TaskId mRepublishTaskId;
+    Timepoint          mRepublishStartTime;
+    RepublishMetrics   mRepublishMetrics;
 };
 
 } // namespace otbr
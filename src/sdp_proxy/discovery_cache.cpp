@@ -0,0 +1,289 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the subscriptions and answer cache of the DNS-SD Discovery Proxy.
+ */
+
+#include "sdp_proxy/discovery_cache.hpp"
+
+#if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+
+#include "utils/string_utils.hpp"
+
+namespace otbr {
+namespace Dnssd {
+
+bool DiscoveryCache::AddSubscription(const DnsUtils::DnsNameInfo &aNameInfo)
+{
+    Subscription &subscription = mSubscriptions[GetSubscriptionKey(aNameInfo)];
+
+    if (subscription.mRefCount == 0)
+    {
+        subscription.mNameInfo = aNameInfo;
+    }
+
+    return (subscription.mRefCount++ == 0);
+}
+
+bool DiscoveryCache::RemoveSubscription(const DnsUtils::DnsNameInfo &aNameInfo, DnsUtils::DnsNameInfo &aSubscribedName)
+{
+    auto it     = mSubscriptions.find(GetSubscriptionKey(aNameInfo));
+    bool isLast = false;
+
+    VerifyOrExit(it != mSubscriptions.end());
+    VerifyOrExit(--it->second.mRefCount == 0);
+
+    aSubscribedName = std::move(it->second.mNameInfo);
+    mSubscriptions.erase(it);
+    isLast = true;
+
+exit:
+    return isLast;
+}
+
+uint32_t DiscoveryCache::GetSubscriptionRefCount(const DnsUtils::DnsNameInfo &aNameInfo) const
+{
+    auto it = mSubscriptions.find(GetSubscriptionKey(aNameInfo));
+
+    return (it != mSubscriptions.end()) ? it->second.mRefCount : 0;
+}
+
+std::vector<DnsUtils::DnsNameInfo> DiscoveryCache::GetSubscriptions(void) const
+{
+    std::vector<DnsUtils::DnsNameInfo> subscriptions;
+
+    for (const auto &entry : mSubscriptions)
+    {
+        subscriptions.push_back(entry.second.mNameInfo);
+    }
+
+    return subscriptions;
+}
+
+void DiscoveryCache::UpdateInstance(const std::string            &aType,
+                                    const DiscoveredInstanceInfo &aInstanceInfo,
+                                    Timepoint                     aNow)
+{
+    if (aInstanceInfo.mTtl > 0)
+    {
+        std::string serviceKey  = StringUtils::ToLowercase(aType);
+        std::string instanceKey = StringUtils::ToLowercase(DnsUtils::UnescapeInstanceName(aInstanceInfo.mName));
+        Timepoint   expireTime  = aNow + Seconds(aInstanceInfo.mTtl);
+
+        PurgeExpiredEntries(aNow);
+
+        auto           result = mServiceCache[serviceKey].emplace(instanceKey, InstanceEntry());
+        InstanceEntry &entry  = result.first->second;
+
+        if (!result.second)
+        {
+            mExpiryQueue.erase(entry.mExpiryIt);
+        }
+
+        entry.mCached   = {aInstanceInfo, expireTime};
+        entry.mExpiryIt = mExpiryQueue.emplace(expireTime, ExpiryKey{false, serviceKey, instanceKey});
+    }
+    else
+    {
+        RemoveInstance(aType, aInstanceInfo.mName);
+    }
+}
+
+void DiscoveryCache::RemoveInstance(const std::string &aType, const std::string &aInstanceName)
+{
+    auto serviceIt  = mServiceCache.find(StringUtils::ToLowercase(aType));
+    auto instanceIt = InstanceCache::iterator();
+
+    VerifyOrExit(serviceIt != mServiceCache.end());
+
+    instanceIt = serviceIt->second.find(StringUtils::ToLowercase(DnsUtils::UnescapeInstanceName(aInstanceName)));
+    VerifyOrExit(instanceIt != serviceIt->second.end());
+
+    mExpiryQueue.erase(instanceIt->second.mExpiryIt);
+    serviceIt->second.erase(instanceIt);
+
+    if (serviceIt->second.empty())
+    {
+        mServiceCache.erase(serviceIt);
+    }
+
+exit:
+    return;
+}
+
+void DiscoveryCache::UpdateHost(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo, Timepoint aNow)
+{
+    std::string hostKey = StringUtils::ToLowercase(aHostName);
+
+    if (aHostInfo.mTtl > 0 && !aHostInfo.mAddresses.empty())
+    {
+        Timepoint expireTime = aNow + Seconds(aHostInfo.mTtl);
+
+        PurgeExpiredEntries(aNow);
+
+        auto       result = mHostCache.emplace(hostKey, HostEntry());
+        HostEntry &entry  = result.first->second;
+
+        if (!result.second)
+        {
+            mExpiryQueue.erase(entry.mExpiryIt);
+        }
+
+        entry.mCached   = {aHostInfo, expireTime};
+        entry.mExpiryIt = mExpiryQueue.emplace(expireTime, ExpiryKey{true, std::string(), hostKey});
+    }
+    else
+    {
+        auto it = mHostCache.find(hostKey);
+
+        if (it != mHostCache.end())
+        {
+            mExpiryQueue.erase(it->second.mExpiryIt);
+            mHostCache.erase(it);
+        }
+    }
+}
+
+bool DiscoveryCache::FindInstances(const DnsUtils::DnsNameInfo &aNameInfo,
+                                   Timepoint                    aNow,
+                                   std::vector<CachedInstance> &aInstances) const
+{
+    auto serviceIt = mServiceCache.find(StringUtils::ToLowercase(aNameInfo.mServiceName));
+
+    aInstances.clear();
+
+    VerifyOrExit(serviceIt != mServiceCache.end());
+
+    if (aNameInfo.mInstanceName.empty())
+    {
+        // Instances resolved one by one are only a part of the browse result.
+        VerifyOrExit(GetSubscriptionRefCount(aNameInfo) > 0);
+
+        for (const auto &entry : serviceIt->second)
+        {
+            if (GetRemainingTtl(entry.second.mCached.mExpireTime, aNow) > 0)
+            {
+                aInstances.push_back(entry.second.mCached);
+            }
+        }
+    }
+    else
+    {
+        auto instanceIt = serviceIt->second.find(StringUtils::ToLowercase(aNameInfo.mInstanceName));
+
+        if (instanceIt != serviceIt->second.end() &&
+            GetRemainingTtl(instanceIt->second.mCached.mExpireTime, aNow) > 0)
+        {
+            aInstances.push_back(instanceIt->second.mCached);
+        }
+    }
+
+exit:
+    return !aInstances.empty();
+}
+
+bool DiscoveryCache::FindHost(const std::string &aHostName, Timepoint aNow, CachedHost &aHost) const
+{
+    auto it    = mHostCache.find(StringUtils::ToLowercase(aHostName));
+    bool found = false;
+
+    VerifyOrExit(it != mHostCache.end() && GetRemainingTtl(it->second.mCached.mExpireTime, aNow) > 0);
+    aHost = it->second.mCached;
+    found = true;
+
+exit:
+    return found;
+}
+
+void DiscoveryCache::Clear(void)
+{
+    mSubscriptions.clear();
+    mServiceCache.clear();
+    mHostCache.clear();
+    mExpiryQueue.clear();
+}
+
+void DiscoveryCache::PurgeExpiredEntries(Timepoint aNow)
+{
+    // The queue is ordered by expire time, so this stops at the first entry which has not expired.
+    while (!mExpiryQueue.empty() && GetRemainingTtl(mExpiryQueue.begin()->first, aNow) == 0)
+    {
+        const ExpiryKey &key = mExpiryQueue.begin()->second;
+
+        if (key.mIsHost)
+        {
+            mHostCache.erase(key.mKey);
+        }
+        else
+        {
+            auto serviceIt = mServiceCache.find(key.mServiceKey);
+
+            serviceIt->second.erase(key.mKey);
+
+            if (serviceIt->second.empty())
+            {
+                mServiceCache.erase(serviceIt);
+            }
+        }
+
+        mExpiryQueue.erase(mExpiryQueue.begin());
+    }
+}
+
+std::string DiscoveryCache::GetSubscriptionKey(const DnsUtils::DnsNameInfo &aNameInfo)
+{
+    std::string key = aNameInfo.mHostName;
+
+    // Service keys always end with the service type, whose labels start with an underscore, so they never collide
+    // with host keys.
+    if (key.empty())
+    {
+        key = aNameInfo.mInstanceName + "." + aNameInfo.mServiceName;
+    }
+
+    return StringUtils::ToLowercase(key);
+}
+
+uint32_t DiscoveryCache::GetRemainingTtl(Timepoint aExpireTime, Timepoint aNow)
+{
+    uint32_t ttl = 0;
+
+    if (aExpireTime > aNow)
+    {
+        ttl = static_cast<uint32_t>(std::chrono::duration_cast<Seconds>(aExpireTime - aNow).count());
+    }
+
+    return ttl;
+}
+
+} // namespace Dnssd
+} // namespace otbr
+
+#endif // OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
@@ -0,0 +1,242 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the subscriptions and answer cache of the DNS-SD Discovery Proxy.
+ */
+
+#ifndef OTBR_AGENT_DISCOVERY_CACHE_HPP_
+#define OTBR_AGENT_DISCOVERY_CACHE_HPP_
+
+#include "openthread-br/config.h"
+
+#if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+#include "common/time.hpp"
+#include "mdns/mdns.hpp"
+#include "utils/dns_utils.hpp"
+
+namespace otbr {
+namespace Dnssd {
+
+/**
+ * This class keeps the DNS query subscriptions of the Discovery Proxy and the mDNS answers discovered for them.
+ *
+ * Queries for the same name share one reference-counted subscription. Discovered service instances and hosts are
+ * cached until their mDNS TTL expires, so that a new query can be answered right away while its mDNS subscription
+ * catches up.
+ */
+class DiscoveryCache : private NonCopyable
+{
+public:
+    using DiscoveredInstanceInfo = Mdns::Publisher::DiscoveredInstanceInfo;
+    using DiscoveredHostInfo     = Mdns::Publisher::DiscoveredHostInfo;
+
+    /**
+     * This structure represents a cached service instance.
+     */
+    struct CachedInstance
+    {
+        DiscoveredInstanceInfo mInfo;       ///< The instance, with the addresses to answer.
+        Timepoint              mExpireTime; ///< The time when the mDNS TTL of the instance expires.
+    };
+
+    /**
+     * This structure represents a cached host.
+     */
+    struct CachedHost
+    {
+        DiscoveredHostInfo mInfo;       ///< The host, with the addresses to answer.
+        Timepoint          mExpireTime; ///< The time when the mDNS TTL of the host expires.
+    };
+
+    /**
+     * This method adds a reference to the subscription of a DNS name.
+     *
+     * @param[in] aNameInfo  The DNS name.
+     *
+     * @retval TRUE   This is the first reference, the mDNS subscription must be started.
+     * @retval FALSE  The mDNS subscription is already running.
+     */
+    bool AddSubscription(const DnsUtils::DnsNameInfo &aNameInfo);
+
+    /**
+     * This method removes a reference to the subscription of a DNS name.
+     *
+     * @param[in]  aNameInfo        The DNS name.
+     * @param[out] aSubscribedName  The DNS name the mDNS subscription was started with, set when TRUE is returned.
+     *
+     * @retval TRUE   This was the last reference, the mDNS subscription must be stopped.
+     * @retval FALSE  The subscription is still referenced, or was not found.
+     */
+    bool RemoveSubscription(const DnsUtils::DnsNameInfo &aNameInfo, DnsUtils::DnsNameInfo &aSubscribedName);
+
+    /**
+     * This method returns the number of references to the subscription of a DNS name.
+     *
+     * @param[in] aNameInfo  The DNS name.
+     *
+     * @returns The number of DNS queries sharing the subscription.
+     */
+    uint32_t GetSubscriptionRefCount(const DnsUtils::DnsNameInfo &aNameInfo) const;
+
+    /**
+     * This method returns the DNS names of all the subscriptions.
+     *
+     * @returns The DNS names of the subscriptions.
+     */
+    std::vector<DnsUtils::DnsNameInfo> GetSubscriptions(void) const;
+
+    /**
+     * This method caches a discovered service instance, or evicts it if its TTL is zero.
+     *
+     * @param[in] aType          The service type.
+     * @param[in] aInstanceInfo  The discovered instance, with the addresses to answer.
+     * @param[in] aNow           The current time.
+     */
+    void UpdateInstance(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo, Timepoint aNow);
+
+    /**
+     * This method evicts a removed service instance.
+     *
+     * @param[in] aType          The service type.
+     * @param[in] aInstanceName  The escaped instance name.
+     */
+    void RemoveInstance(const std::string &aType, const std::string &aInstanceName);
+
+    /**
+     * This method caches a discovered host, or evicts it if it has no address or its TTL is zero.
+     *
+     * @param[in] aHostName  The host name.
+     * @param[in] aHostInfo  The discovered host, with the addresses to answer.
+     * @param[in] aNow       The current time.
+     */
+    void UpdateHost(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo, Timepoint aNow);
+
+    /**
+     * This method looks up the cached instances which answer a browse or a service instance resolve.
+     *
+     * A browse is only answered when an mDNS browse of the service type is already running, so that the cache holds
+     * every instance the browse reported and not only the instances which were resolved one by one. This method must
+     * therefore be called before `AddSubscription()` for the new query.
+     *
+     * @param[in]  aNameInfo   The DNS name of the service or the service instance.
+     * @param[in]  aNow        The current time.
+     * @param[out] aInstances  The cached instances which have not expired.
+     *
+     * @retval TRUE   The query can be answered from the cache.
+     * @retval FALSE  The query can't be answered from the cache.
+     */
+    bool FindInstances(const DnsUtils::DnsNameInfo &aNameInfo,
+                       Timepoint                    aNow,
+                       std::vector<CachedInstance> &aInstances) const;
+
+    /**
+     * This method looks up the cached host which answers a host resolve.
+     *
+     * @param[in]  aHostName  The host name.
+     * @param[in]  aNow       The current time.
+     * @param[out] aHost      The cached host.
+     *
+     * @retval TRUE   The host is cached and has not expired.
+     * @retval FALSE  The host is not cached, or has expired.
+     */
+    bool FindHost(const std::string &aHostName, Timepoint aNow, CachedHost &aHost) const;
+
+    /**
+     * This method removes all the subscriptions and cached answers.
+     */
+    void Clear(void);
+
+    /**
+     * This method returns the remaining TTL of a cached answer.
+     *
+     * @param[in] aExpireTime  The time when the answer expires.
+     * @param[in] aNow         The current time.
+     *
+     * @returns The remaining TTL in seconds, zero if the answer has expired.
+     */
+    static uint32_t GetRemainingTtl(Timepoint aExpireTime, Timepoint aNow);
+
+private:
+    // Identifies a cached instance by its service and instance keys, or a cached host by its host key.
+    struct ExpiryKey
+    {
+        bool        mIsHost;
+        std::string mServiceKey;
+        std::string mKey;
+    };
+
+    // Ordered by expire time, so that purging only visits the entries which have expired.
+    using ExpiryQueue = std::multimap<Timepoint, ExpiryKey>;
+
+    struct InstanceEntry
+    {
+        CachedInstance        mCached;
+        ExpiryQueue::iterator mExpiryIt; // The entry of this instance in `mExpiryQueue`.
+    };
+
+    struct HostEntry
+    {
+        CachedHost            mCached;
+        ExpiryQueue::iterator mExpiryIt; // The entry of this host in `mExpiryQueue`.
+    };
+
+    // Keyed by the lowercase unescaped instance name.
+    using InstanceCache = std::map<std::string, InstanceEntry>;
+
+    struct Subscription
+    {
+        DnsUtils::DnsNameInfo mNameInfo;     // The name passed to the mDNS publisher.
+        uint32_t              mRefCount = 0; // The number of DNS queries sharing this subscription.
+    };
+
+    static std::string GetSubscriptionKey(const DnsUtils::DnsNameInfo &aNameInfo);
+
+    void PurgeExpiredEntries(Timepoint aNow);
+
+    std::map<std::string, Subscription>  mSubscriptions; // Keyed by `GetSubscriptionKey()`.
+    std::map<std::string, InstanceCache> mServiceCache;  // Keyed by the lowercase service type.
+    std::map<std::string, HostEntry>     mHostCache;     // Keyed by the lowercase host name.
+    ExpiryQueue                          mExpiryQueue;   // Every cached instance and host, by expire time.
+};
+
+} // namespace Dnssd
+} // namespace otbr
+
+#endif // OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+
+#endif // OTBR_AGENT_DISCOVERY_CACHE_HPP_
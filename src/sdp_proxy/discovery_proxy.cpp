@@ -92,14 +92,18 @@ void DiscoveryProxy::Start(void)
                              &DiscoveryProxy::OnDiscoveryProxyUnsubscribe, this);
 
     mSubscriberId = mMdnsPublisher.AddSubscriptionCallbacks(
-        [this](const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo) {
-            if (!aInstanceInfo.mRemoved)
+        [this](const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo) {
+            if (aInstanceInfo.mRemoved)
+            {
+                OnServiceRemoved(aType, aInstanceInfo);
+            }
+            else
             {
                 OnServiceDiscovered(aType, aInstanceInfo);
             }
         },
 
-        [this](const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aHostInfo) {
+        [this](const std::string &aHostName, const DiscoveredHostInfo &aHostInfo) {
             OnHostDiscovered(aHostName, aHostInfo);
         });
 
@@ -116,6 +120,21 @@ void DiscoveryProxy::Stop(void)
         mSubscriberId = 0;
     }
 
+    // The Thread stack no longer reports unsubscriptions, release the mDNS subscriptions now.
+    for (const DnsUtils::DnsNameInfo &nameInfo : mCache.GetSubscriptions())
+    {
+        if (nameInfo.mHostName.empty())
+        {
+            mMdnsPublisher.UnsubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
+        }
+        else
+        {
+            mMdnsPublisher.UnsubscribeHost(nameInfo.mHostName);
+        }
+    }
+
+    mCache.Clear();
+
     otbrLogInfo("Stopped");
 }
 
@@ -128,20 +147,27 @@ void DiscoveryProxy::OnDiscoveryProxySubscribe(const char *aFullName)
 {
     std::string           fullName(aFullName);
     DnsUtils::DnsNameInfo nameInfo = DnsUtils::SplitFullDnsName(fullName);
+    bool                  isCacheHit;
 
     otbrLogInfo("Subscribe: %s", fullName.c_str());
 
-    if (GetServiceSubscriptionCount(nameInfo) == 1)
+    // The cache only provides the first answer, the mDNS subscription keeps the query up to date afterwards.
+    isCacheHit = AnswerFromCache(nameInfo);
+    mMdnsPublisher.UpdateDiscoveryProxyCacheCounters(isCacheHit);
+
+    VerifyOrExit(mCache.AddSubscription(nameInfo));
+
+    if (nameInfo.mHostName.empty())
     {
-        if (nameInfo.mHostName.empty())
-        {
-            mMdnsPublisher.SubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
-        }
-        else
-        {
-            mMdnsPublisher.SubscribeHost(nameInfo.mHostName);
-        }
+        mMdnsPublisher.SubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
+    }
+    else
+    {
+        mMdnsPublisher.SubscribeHost(nameInfo.mHostName);
     }
+
+exit:
+    return;
 }
 
 void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFullName)
@@ -153,20 +179,23 @@ void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(const char *aFullName)
 {
     std::string           fullName(aFullName);
     DnsUtils::DnsNameInfo nameInfo = DnsUtils::SplitFullDnsName(fullName);
+    DnsUtils::DnsNameInfo subscribedName;
 
     otbrLogInfo("Unsubscribe: %s", fullName.c_str());
 
-    if (GetServiceSubscriptionCount(nameInfo) <= 1)
+    VerifyOrExit(mCache.RemoveSubscription(nameInfo, subscribedName));
+
+    if (subscribedName.mHostName.empty())
     {
-        if (nameInfo.mHostName.empty())
-        {
-            mMdnsPublisher.UnsubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
-        }
-        else
-        {
-            mMdnsPublisher.UnsubscribeHost(nameInfo.mHostName);
-        }
+        mMdnsPublisher.UnsubscribeService(subscribedName.mServiceName, subscribedName.mInstanceName);
     }
+    else
+    {
+        mMdnsPublisher.UnsubscribeHost(subscribedName.mHostName);
+    }
+
+exit:
+    return;
 }
 
 void DiscoveryProxy::FilterLinkLocalAddresses(const AddressList &aAddrList, AddressList &aFilteredList)
@@ -184,44 +213,25 @@ void DiscoveryProxy::FilterLinkLocalAddresses(const AddressList &aAddrList, Addr
     }
 }
 
-void DiscoveryProxy::OnServiceDiscovered(const std::string                             &aType,
-                                         const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo)
+void DiscoveryProxy::OnServiceDiscovered(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo)
 {
-    otDnssdServiceInstanceInfo instanceInfo;
-    const otDnssdQuery        *query                 = nullptr;
-    std::string                unescapedInstanceName = DnsUtils::UnescapeInstanceName(aInstanceInfo.mName);
-    AddressList                filteredAddrList;
+    const otDnssdQuery    *query                 = nullptr;
+    std::string            unescapedInstanceName = DnsUtils::UnescapeInstanceName(aInstanceInfo.mName);
+    DiscoveredInstanceInfo instanceInfo          = aInstanceInfo;
 
-    FilterLinkLocalAddresses(aInstanceInfo.mAddresses, filteredAddrList);
+    FilterLinkLocalAddresses(aInstanceInfo.mAddresses, instanceInfo.mAddresses);
 
     otbrLogInfo("Service discovered: %s, instance %s hostname %s addresses %zu port %d priority %d "
                 "weight %d",
-                aType.c_str(), aInstanceInfo.mName.c_str(), aInstanceInfo.mHostName.c_str(), filteredAddrList.size(),
-                aInstanceInfo.mPort, aInstanceInfo.mPriority, aInstanceInfo.mWeight);
+                aType.c_str(), instanceInfo.mName.c_str(), instanceInfo.mHostName.c_str(),
+                instanceInfo.mAddresses.size(), instanceInfo.mPort, instanceInfo.mPriority, instanceInfo.mWeight);
 
-    instanceInfo.mAddressNum = filteredAddrList.size();
-
-    if (!filteredAddrList.empty())
-    {
-        instanceInfo.mAddresses = reinterpret_cast<const otIp6Address *>(&filteredAddrList[0]);
-    }
-    else
-    {
-        instanceInfo.mAddresses = nullptr;
-    }
-
-    instanceInfo.mPort      = aInstanceInfo.mPort;
-    instanceInfo.mPriority  = aInstanceInfo.mPriority;
-    instanceInfo.mWeight    = aInstanceInfo.mWeight;
-    instanceInfo.mTxtLength = static_cast<uint16_t>(aInstanceInfo.mTxtData.size());
-    instanceInfo.mTxtData   = aInstanceInfo.mTxtData.data();
-    instanceInfo.mTtl       = CapTtl(aInstanceInfo.mTtl);
+    mCache.UpdateInstance(aType, instanceInfo, Clock::now());
 
     while ((query = otDnssdGetNextQuery(mHost.GetInstance(), query)) != nullptr)
     {
         std::string      instanceName;
         std::string      serviceName;
-        std::string      hostName;
         std::string      domain;
         char             queryName[OT_DNS_MAX_NAME_SIZE];
         otDnssdQueryType type = otDnssdGetQueryTypeAndName(query, &queryName);
@@ -248,41 +258,30 @@ void DiscoveryProxy::OnServiceDiscovered(const std::string
         if (DnsLabelsEqual(serviceName, aType) &&
             (instanceName.empty() || DnsLabelsEqual(instanceName, unescapedInstanceName)))
         {
-            std::string serviceFullName    = aType + "." + domain;
-            std::string translatedHostName = TranslateDomain(aInstanceInfo.mHostName, domain);
-            std::string instanceFullName   = unescapedInstanceName + "." + serviceFullName;
-
-            instanceInfo.mFullName = instanceFullName.c_str();
-            instanceInfo.mHostName = translatedHostName.c_str();
-
-            otDnssdQueryHandleDiscoveredServiceInstance(mHost.GetInstance(), serviceFullName.c_str(), &instanceInfo);
+            AnswerServiceInstance(aType, instanceInfo, domain, CapTtl(instanceInfo.mTtl));
         }
     }
 }
 
-void DiscoveryProxy::OnHostDiscovered(const std::string                         &aHostName,
-                                      const Mdns::Publisher::DiscoveredHostInfo &aHostInfo)
+void DiscoveryProxy::OnServiceRemoved(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo)
 {
-    otDnssdHostInfo     hostInfo;
-    const otDnssdQuery *query            = nullptr;
-    std::string         resolvedHostName = aHostInfo.mHostName;
-    AddressList         filteredAddrList;
+    otbrLogInfo("Service removed: %s, instance %s", aType.c_str(), aInstanceInfo.mName.c_str());
 
-    FilterLinkLocalAddresses(aHostInfo.mAddresses, filteredAddrList);
-    VerifyOrExit(!filteredAddrList.empty());
+    mCache.RemoveInstance(aType, aInstanceInfo.mName);
+}
 
-    otbrLogInfo("Host discovered: %s hostname %s addresses %zu", aHostName.c_str(), aHostInfo.mHostName.c_str(),
-                filteredAddrList.size());
+void DiscoveryProxy::OnHostDiscovered(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo)
+{
+    const otDnssdQuery *query    = nullptr;
+    DiscoveredHostInfo  hostInfo = aHostInfo;
 
-    if (resolvedHostName.empty())
-    {
-        resolvedHostName = aHostName + ".local.";
-    }
+    FilterLinkLocalAddresses(aHostInfo.mAddresses, hostInfo.mAddresses);
+    mCache.UpdateHost(aHostName, hostInfo, Clock::now());
 
-    hostInfo.mAddressNum = filteredAddrList.size();
-    hostInfo.mAddresses  = reinterpret_cast<const otIp6Address *>(&filteredAddrList[0]);
+    VerifyOrExit(!hostInfo.mAddresses.empty());
 
-    hostInfo.mTtl = CapTtl(aHostInfo.mTtl);
+    otbrLogInfo("Host discovered: %s hostname %s addresses %zu", aHostName.c_str(), hostInfo.mHostName.c_str(),
+                hostInfo.mAddresses.size());
 
     while ((query = otDnssdGetNextQuery(mHost.GetInstance(), query)) != nullptr)
     {
@@ -307,9 +306,7 @@ void DiscoveryProxy::OnHostDiscovered(const std::string
 
         if (DnsLabelsEqual(hostName, aHostName))
         {
-            std::string hostFullName = TranslateDomain(resolvedHostName, domain);
-
-            otDnssdQueryHandleDiscoveredHost(mHost.GetInstance(), hostFullName.c_str(), &hostInfo);
+            AnswerHost(aHostName, hostInfo, domain, CapTtl(hostInfo.mTtl));
         }
     }
 
@@ -317,6 +314,118 @@ exit:
     return;
 }
 
+void DiscoveryProxy::AnswerServiceInstance(const std::string            &aType,
+                                           const DiscoveredInstanceInfo &aInstanceInfo,
+                                           const std::string            &aDomain,
+                                           uint32_t                      aTtl)
+{
+    otDnssdServiceInstanceInfo instanceInfo;
+    std::string                serviceFullName    = aType + "." + aDomain;
+    std::string                translatedHostName = TranslateDomain(aInstanceInfo.mHostName, aDomain);
+    std::string                instanceFullName;
+
+    instanceFullName = DnsUtils::UnescapeInstanceName(aInstanceInfo.mName) + "." + serviceFullName;
+
+    instanceInfo.mFullName   = instanceFullName.c_str();
+    instanceInfo.mHostName   = translatedHostName.c_str();
+    instanceInfo.mAddressNum = aInstanceInfo.mAddresses.size();
+
+    if (!aInstanceInfo.mAddresses.empty())
+    {
+        instanceInfo.mAddresses = reinterpret_cast<const otIp6Address *>(&aInstanceInfo.mAddresses[0]);
+    }
+    else
+    {
+        instanceInfo.mAddresses = nullptr;
+    }
+
+    instanceInfo.mPort      = aInstanceInfo.mPort;
+    instanceInfo.mPriority  = aInstanceInfo.mPriority;
+    instanceInfo.mWeight    = aInstanceInfo.mWeight;
+    instanceInfo.mTxtLength = static_cast<uint16_t>(aInstanceInfo.mTxtData.size());
+    instanceInfo.mTxtData   = aInstanceInfo.mTxtData.data();
+    instanceInfo.mTtl       = aTtl;
+
+    otDnssdQueryHandleDiscoveredServiceInstance(mHost.GetInstance(), serviceFullName.c_str(), &instanceInfo);
+}
+
+void DiscoveryProxy::AnswerHost(const std::string        &aHostName,
+                                const DiscoveredHostInfo &aHostInfo,
+                                const std::string        &aDomain,
+                                uint32_t                  aTtl)
+{
+    otDnssdHostInfo hostInfo;
+    std::string     resolvedHostName = aHostInfo.mHostName;
+    std::string     hostFullName;
+
+    if (resolvedHostName.empty())
+    {
+        resolvedHostName = aHostName + ".local.";
+    }
+
+    hostFullName = TranslateDomain(resolvedHostName, aDomain);
+
+    hostInfo.mAddressNum = aHostInfo.mAddresses.size();
+    hostInfo.mAddresses  = reinterpret_cast<const otIp6Address *>(&aHostInfo.mAddresses[0]);
+    hostInfo.mTtl        = aTtl;
+
+    otDnssdQueryHandleDiscoveredHost(mHost.GetInstance(), hostFullName.c_str(), &hostInfo);
+}
+
+bool DiscoveryProxy::AnswerFromCache(const DnsUtils::DnsNameInfo &aNameInfo)
+{
+    Timepoint                                   now = Clock::now();
+    std::vector<DiscoveryCache::CachedInstance> instances;
+    DiscoveryCache::CachedHost                  host;
+
+    // The answers are posted rather than handled in place, as the Thread stack is still processing the query which
+    // triggered this subscription. Queries which go away in the meantime simply do not match any more.
+    if (!aNameInfo.mHostName.empty())
+    {
+        VerifyOrExit(mCache.FindHost(aNameInfo.mHostName, now, host));
+
+        mTaskRunner.Post([this, aNameInfo, host]() {
+            uint32_t ttl = DiscoveryCache::GetRemainingTtl(host.mExpireTime, Clock::now());
+
+            VerifyOrExit(IsEnabled() && ttl > 0);
+            AnswerHost(aNameInfo.mHostName, host.mInfo, aNameInfo.mDomain, CapTtl(ttl));
+
+        exit:
+            return;
+        });
+    }
+    else
+    {
+        VerifyOrExit(mCache.FindInstances(aNameInfo, now, instances));
+
+        mTaskRunner.Post([this, aNameInfo, instances]() {
+            Timepoint taskNow = Clock::now();
+
+            VerifyOrExit(IsEnabled());
+
+            for (const DiscoveryCache::CachedInstance &instance : instances)
+            {
+                uint32_t ttl = DiscoveryCache::GetRemainingTtl(instance.mExpireTime, taskNow);
+
+                if (ttl > 0)
+                {
+                    AnswerServiceInstance(aNameInfo.mServiceName, instance.mInfo, aNameInfo.mDomain, CapTtl(ttl));
+                }
+            }
+
+        exit:
+            return;
+        });
+    }
+
+    otbrLogInfo("Answer cache hit: %s%s%s", aNameInfo.mInstanceName.c_str(), aNameInfo.mServiceName.c_str(),
+                aNameInfo.mHostName.c_str());
+    return true;
+
+exit:
+    return false;
+}
+
 std::string DiscoveryProxy::TranslateDomain(const std::string &aName, const std::string &aTargetDomain)
 {
     std::string targetName;
@@ -333,27 +442,6 @@ exit:
     return targetName;
 }
 
-int DiscoveryProxy::GetServiceSubscriptionCount(const DnsUtils::DnsNameInfo &aNameInfo) const
-{
-    const otDnssdQuery *query = nullptr;
-    int                 count = 0;
-
-    while ((query = otDnssdGetNextQuery(mHost.GetInstance(), query)) != nullptr)
-    {
-        char                  queryName[OT_DNS_MAX_NAME_SIZE];
-        DnsUtils::DnsNameInfo queryInfo;
-
-        otDnssdGetQueryTypeAndName(query, &queryName);
-        queryInfo = DnsUtils::SplitFullDnsName(queryName);
-
-        count += (DnsLabelsEqual(aNameInfo.mInstanceName, queryInfo.mInstanceName) &&
-                  DnsLabelsEqual(aNameInfo.mServiceName, queryInfo.mServiceName) &&
-                  DnsLabelsEqual(aNameInfo.mHostName, queryInfo.mHostName));
-    }
-
-    return count;
-}
-
 uint32_t DiscoveryProxy::CapTtl(uint32_t aTtl)
 {
     return std::min(aTtl, static_cast<uint32_t>(kServiceTtlCapLimit));
@@ -38,16 +38,22 @@
 
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
 
+#include <map>
 #include <set>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <stdint.h>
 
 #include <openthread/dnssd_server.h>
 #include <openthread/instance.h>
 
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
 #include "host/rcp_host.hpp"
 #include "mdns/mdns.hpp"
+#include "sdp_proxy/discovery_cache.hpp"
 #include "utils/dns_utils.hpp"
 
 namespace otbr {
@@ -55,6 +61,10 @@ namespace Dnssd {
 
 /**
  * This class implements the DNS-SD Discovery Proxy.
+ *
+ * Discovered service instances and hosts are kept in an answer cache until their mDNS TTL expires, so that queries
+ * for the same name from many Thread devices share a single mDNS subscription and are answered without waiting for
+ * the mDNS publisher.
  */
 class DiscoveryProxy : public Mdns::StateObserver, private NonCopyable
 {
@@ -88,7 +98,9 @@ public:
     }
 
 private:
-    using AddressList = Mdns::Publisher::AddressList;
+    using AddressList            = Mdns::Publisher::AddressList;
+    using DiscoveredInstanceInfo = Mdns::Publisher::DiscoveredInstanceInfo;
+    using DiscoveredHostInfo     = Mdns::Publisher::DiscoveredHostInfo;
 
     enum : uint32_t
     {
@@ -99,12 +111,20 @@ private:
     void               OnDiscoveryProxySubscribe(const char *aSubscription);
     static void        OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFullName);
     void               OnDiscoveryProxyUnsubscribe(const char *aSubscription);
-    int                GetServiceSubscriptionCount(const DnsUtils::DnsNameInfo &aNameInfo) const;
     static std::string TranslateDomain(const std::string &aName, const std::string &aTargetDomain);
-    void               OnServiceDiscovered(const std::string                             &aSubscription,
-                                           const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo);
-    void OnHostDiscovered(const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aHostInfo);
-    static uint32_t CapTtl(uint32_t aTtl);
+    void               OnServiceDiscovered(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo);
+    void               OnServiceRemoved(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo);
+    void               OnHostDiscovered(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo);
+    void               AnswerServiceInstance(const std::string            &aType,
+                                             const DiscoveredInstanceInfo &aInstanceInfo,
+                                             const std::string            &aDomain,
+                                             uint32_t                      aTtl);
+    void               AnswerHost(const std::string        &aHostName,
+                                  const DiscoveredHostInfo &aHostInfo,
+                                  const std::string        &aDomain,
+                                  uint32_t                  aTtl);
+    bool               AnswerFromCache(const DnsUtils::DnsNameInfo &aNameInfo);
+    static uint32_t    CapTtl(uint32_t aTtl);
 
     static void FilterLinkLocalAddresses(const AddressList &aAddrList, AddressList &aFilteredList);
 
@@ -116,6 +136,8 @@ private:
     Mdns::Publisher &mMdnsPublisher;
     bool             mIsEnabled;
     uint64_t         mSubscriberId = 0;
+    TaskRunner       mTaskRunner;
+    DiscoveryCache   mCache;
 };
 
 } // namespace Dnssd
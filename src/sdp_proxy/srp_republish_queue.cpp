@@ -0,0 +1,146 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the queue of SRP hosts republished by the Advertising Proxy.
+ */
+
+#include "sdp_proxy/srp_republish_queue.hpp"
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+
+#include <algorithm>
+#include <utility>
+
+namespace otbr {
+
+constexpr uint32_t SrpRepublishQueue::kDeletedHostOrderKey;
+
+SrpRepublishQueue::SrpRepublishQueue(uint32_t aBatchSize, uint32_t aMaxInFlight)
+    : mBatchSize(aBatchSize)
+    , mMaxInFlight(aMaxInFlight)
+    , mInFlight(0)
+    , mRegistrations(0)
+    , mHostsInvalidated(false)
+{
+}
+
+uint32_t SrpRepublishQueue::GetOrderKey(uint32_t aLease, uint32_t aRemainingLease, bool aIsDeleted)
+{
+    // A deleted host has no remaining lease, which would otherwise rank it as the most recently renewed.
+    return aIsDeleted ? kDeletedHostOrderKey : aLease - std::min(aLease, aRemainingLease);
+}
+
+void SrpRepublishQueue::Add(const otSrpServerHost *aHost, std::string aFullName, uint32_t aOrderKey)
+{
+    mHosts.push_back({aHost, std::move(aFullName), aOrderKey});
+}
+
+void SrpRepublishQueue::Sort(void)
+{
+    std::stable_sort(mHosts.begin(), mHosts.end(),
+                     [](const Entry &aLhs, const Entry &aRhs) { return aLhs.mOrderKey < aRhs.mOrderKey; });
+}
+
+void SrpRepublishQueue::Clear(void)
+{
+    mHosts.clear();
+    mInFlight         = 0;
+    mHostsInvalidated = false;
+}
+
+uint32_t SrpRepublishQueue::PublishBatch(const PublishHandler &aPublishHandler, const LookUpHandler &aLookUpHandler)
+{
+    uint32_t budget = mBatchSize;
+    uint32_t count  = 0;
+
+    while (!mHosts.empty() && budget > 0 && !IsWindowFull())
+    {
+        uint32_t registrations = mRegistrations;
+
+        if (mHostsInvalidated)
+        {
+            LookUpHosts(aLookUpHandler);
+        }
+
+        // The host may have been removed since the republish started.
+        if (mHosts.front().mHost != nullptr)
+        {
+            aPublishHandler(mHosts.front().mHost);
+        }
+
+        // Popped only now, so that results reported synchronously don't finish the republish early.
+        mHosts.pop_front();
+        ++count;
+
+        registrations = mRegistrations - registrations;
+        budget -= std::min(budget, std::max<uint32_t>(registrations, 1));
+    }
+
+    return count;
+}
+
+void SrpRepublishQueue::HandleRegistration(void)
+{
+    ++mInFlight;
+    ++mRegistrations;
+}
+
+bool SrpRepublishQueue::HandleResult(void)
+{
+    bool resume = false;
+
+    VerifyOrExit(mInFlight > 0);
+
+    --mInFlight;
+    resume = (mInFlight == mMaxInFlight / 2);
+
+exit:
+    return resume;
+}
+
+void SrpRepublishQueue::LookUpHosts(const LookUpHandler &aLookUpHandler)
+{
+    HostMap hosts;
+
+    aLookUpHandler(hosts);
+
+    for (Entry &entry : mHosts)
+    {
+        auto host = hosts.find(entry.mFullName);
+
+        entry.mHost = (host != hosts.end()) ? host->second : nullptr;
+    }
+
+    mHostsInvalidated = false;
+}
+
+} // namespace otbr
+
+#endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
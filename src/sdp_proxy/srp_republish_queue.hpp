@@ -0,0 +1,193 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the queue of SRP hosts republished by the Advertising Proxy.
+ */
+
+#ifndef OTBR_SRP_REPUBLISH_QUEUE_HPP_
+#define OTBR_SRP_REPUBLISH_QUEUE_HPP_
+
+#include "openthread-br/config.h"
+
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+
+#include <stdint.h>
+
+#include <deque>
+#include <functional>
+#include <string>
+#include <unordered_map>
+
+#include <openthread/srp_server.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+/**
+ * This class orders and paces the SRP hosts to republish when all hosts and services are published again.
+ *
+ * Hosts are published in batches limited by the number of mDNS registrations they issue, and no batch is started
+ * while too many registrations are waiting for their result. The hosts are kept as `otSrpServerHost` pointers in
+ * publishing order. Once the SRP server may have removed hosts, the remaining pointers are looked up again by name
+ * with a single pass over the registered hosts.
+ */
+class SrpRepublishQueue : private NonCopyable
+{
+public:
+    /**
+     * The order key of a deleted host, which is published after all the other hosts.
+     */
+    static constexpr uint32_t kDeletedHostOrderKey = UINT32_MAX;
+
+    using HostMap        = std::unordered_map<std::string, const otSrpServerHost *>;
+    using PublishHandler = std::function<void(const otSrpServerHost *aHost)>;
+    using LookUpHandler  = std::function<void(HostMap &aHosts)>;
+
+    /**
+     * This constructor initializes the queue.
+     *
+     * @param[in] aBatchSize    The maximum number of mDNS registrations issued by one batch.
+     * @param[in] aMaxInFlight  The maximum number of mDNS registrations which may wait for their result.
+     */
+    SrpRepublishQueue(uint32_t aBatchSize, uint32_t aMaxInFlight);
+
+    /**
+     * This method returns the order key of a host, hosts with a lower key are published first.
+     *
+     * @param[in] aLease           The lease of the host, in seconds.
+     * @param[in] aRemainingLease  The remaining lease of the host, in seconds.
+     * @param[in] aIsDeleted       Whether the host is deleted.
+     *
+     * @returns The time since the host last renewed its lease, or `kDeletedHostOrderKey` for a deleted host.
+     */
+    static uint32_t GetOrderKey(uint32_t aLease, uint32_t aRemainingLease, bool aIsDeleted);
+
+    /**
+     * This method adds a host to republish.
+     *
+     * `Sort()` must be called once all hosts have been added.
+     *
+     * @param[in] aHost      A pointer to the host.
+     * @param[in] aFullName  The full name of the host.
+     * @param[in] aOrderKey  The order key of the host.
+     */
+    void Add(const otSrpServerHost *aHost, std::string aFullName, uint32_t aOrderKey);
+
+    /**
+     * This method sorts the hosts by their order key, hosts with the same key keep the order they were added in.
+     */
+    void Sort(void);
+
+    /**
+     * This method drops all hosts and forgets the registrations waiting for their result.
+     */
+    void Clear(void);
+
+    /**
+     * This method indicates whether there are hosts left to republish.
+     *
+     * @retval TRUE   No host is left to republish.
+     * @retval FALSE  There are hosts left to republish.
+     */
+    bool IsEmpty(void) const { return mHosts.empty(); }
+
+    /**
+     * This method indicates whether as many registrations as allowed are waiting for their result.
+     *
+     * @retval TRUE   No batch may be published until registrations complete.
+     * @retval FALSE  A batch may be published.
+     */
+    bool IsWindowFull(void) const { return mInFlight >= mMaxInFlight; }
+
+    /**
+     * This method returns the number of registrations waiting for their result.
+     *
+     * @returns The number of registrations in flight.
+     */
+    uint32_t GetInFlight(void) const { return mInFlight; }
+
+    /**
+     * This method marks the host pointers as possibly dangling.
+     *
+     * It must be called whenever the SRP server may add or remove a host, the next published host then looks up
+     * the remaining hosts again.
+     */
+    void InvalidateHosts(void) { mHostsInvalidated = !mHosts.empty(); }
+
+    /**
+     * This method publishes the next batch of hosts.
+     *
+     * @p aPublishHandler must call `HandleRegistration()` for every registration it issues. Hosts which were removed
+     * from the SRP server are skipped.
+     *
+     * @param[in] aPublishHandler  The handler to publish a host.
+     * @param[in] aLookUpHandler   The handler to collect the hosts of the SRP server by full name.
+     *
+     * @returns The number of hosts taken off the queue.
+     */
+    uint32_t PublishBatch(const PublishHandler &aPublishHandler, const LookUpHandler &aLookUpHandler);
+
+    /**
+     * This method records that a registration has been issued.
+     */
+    void HandleRegistration(void);
+
+    /**
+     * This method records that a registration has completed.
+     *
+     * @retval TRUE   Enough registrations have completed to publish the next batch deferred by a full window.
+     * @retval FALSE  Otherwise.
+     */
+    bool HandleResult(void);
+
+private:
+    struct Entry
+    {
+        const otSrpServerHost *mHost;
+        std::string            mFullName;
+        uint32_t               mOrderKey;
+    };
+
+    void LookUpHosts(const LookUpHandler &aLookUpHandler);
+
+    const uint32_t    mBatchSize;
+    const uint32_t    mMaxInFlight;
+    std::deque<Entry> mHosts;
+    uint32_t          mInFlight;
+    uint32_t          mRegistrations;
+    bool              mHostsInvalidated;
+};
+
+} // namespace otbr
+
+#endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
+
+#endif // OTBR_SRP_REPUBLISH_QUEUE_HPP_
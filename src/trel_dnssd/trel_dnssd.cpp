@@ -84,6 +84,7 @@ namespace TrelDnssd {
 TrelDnssd::TrelDnssd(Host::RcpHost &aHost, Mdns::Publisher &aPublisher)
     : mPublisher(aPublisher)
     , mHost(aHost)
+    , mPeers(kPeerCacheSize)
 {
     sTrelDnssd = this;
 }
@@ -113,11 +114,11 @@ void TrelDnssd::StartBrowse(void)
     otbrLogDebug("Start browsing %s services ...", kTrelServiceName);
 
     assert(mSubscriberId == 0);
-    mSubscriberId = mPublisher.AddSubscriptionCallbacks(
+    mSubscriberId = mPublisher.AddServiceSubscriptionCallback(
+        kTrelServiceName,
         [this](const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo) {
             OnTrelServiceInstanceResolved(aType, aInstanceInfo);
-        },
-        /* aHostCallback */ nullptr);
+        });
 
     if (IsReady())
     {
@@ -285,9 +286,9 @@ void TrelDnssd::HandleUnpublishTrelServiceError(otbrError aError)
 
 void TrelDnssd::OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo)
 {
-    std::string        instanceName = StringUtils::ToLowercase(aInstanceInfo.mName);
-    Ip6Address         selectedAddress;
-    otPlatTrelPeerInfo peerInfo;
+    std::string     instanceName = StringUtils::ToLowercase(aInstanceInfo.mName);
+    Ip6Address      selectedAddress;
+    PeerTable::Peer peer;
 
     // Remove any existing TREL service instance before adding
     OnTrelServiceInstanceRemoved(instanceName);
@@ -320,22 +321,16 @@ void TrelDnssd::OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInst
         ExitNow();
     }
 
-    peerInfo.mRemoved = false;
-    memcpy(&peerInfo.mSockAddr.mAddress, &selectedAddress, sizeof(peerInfo.mSockAddr.mAddress));
-    peerInfo.mSockAddr.mPort = aInstanceInfo.mPort;
-    peerInfo.mTxtData        = aInstanceInfo.mTxtData.data();
-    peerInfo.mTxtLength      = aInstanceInfo.mTxtData.size();
+    VerifyOrExit(ReadExtAddrFromTxtData(aInstanceInfo.mTxtData, peer.mExtAddr),
+                 otbrLogWarning("Peer %s is invalid", aInstanceInfo.mName.c_str()));
 
-    {
-        Peer peer(aInstanceInfo.mTxtData, peerInfo.mSockAddr);
-
-        VerifyOrExit(peer.mValid, otbrLogWarning("Peer %s is invalid", aInstanceInfo.mName.c_str()));
-
-        otPlatTrelHandleDiscoveredPeerInfo(mHost.GetInstance(), &peerInfo);
+    memset(&peer.mSockAddr, 0, sizeof(peer.mSockAddr));
+    memcpy(&peer.mSockAddr.mAddress, &selectedAddress, sizeof(peer.mSockAddr.mAddress));
+    peer.mSockAddr.mPort = aInstanceInfo.mPort;
+    peer.mTxtData        = aInstanceInfo.mTxtData;
 
-        mPeers.emplace(instanceName, peer);
-        CheckPeersNumLimit();
-    }
+    mPeers.Add(instanceName, std::move(peer));
+    SchedulePeerNotifications();
 
 exit:
     return;
@@ -344,65 +339,51 @@ exit:
 void TrelDnssd::OnTrelServiceInstanceRemoved(const std::string &aInstanceName)
 {
     std::string instanceName = StringUtils::ToLowercase(aInstanceName);
-    auto        it           = mPeers.find(instanceName);
 
-    VerifyOrExit(it != mPeers.end());
+    VerifyOrExit(mPeers.Find(instanceName) != nullptr);
 
     otbrLogDebug("Peer removed: %s", instanceName.c_str());
 
-    // Remove the peer only when all instances are removed because one peer can have multiple instances if expired
-    // instances were not properly removed by mDNS.
-    if (CountDuplicatePeers(it->second) == 0)
-    {
-        NotifyRemovePeer(it->second);
-    }
-
-    mPeers.erase(it);
+    mPeers.Remove(instanceName);
+    SchedulePeerNotifications();
 
 exit:
     return;
 }
 
-void TrelDnssd::CheckPeersNumLimit(void)
+void TrelDnssd::RemoveAllPeers(void)
 {
-    const PeerMap::value_type *oldestPeer = nullptr;
-
-    VerifyOrExit(mPeers.size() >= kPeerCacheSize);
+    mPeers.Clear();
+    SchedulePeerNotifications();
+}
 
-    for (const auto &entry : mPeers)
-    {
-        if (oldestPeer == nullptr || entry.second.mDiscoverTime < oldestPeer->second.mDiscoverTime)
-        {
-            oldestPeer = &entry;
-        }
-    }
+void TrelDnssd::SchedulePeerNotifications(void)
+{
+    VerifyOrExit(!mPeerNotificationsScheduled && mPeers.HasPendingNotifications());
 
-    OnTrelServiceInstanceRemoved(oldestPeer->first);
+    // Peer changes are reported once per main loop iteration, so that an mDNS storm adding and removing the same
+    // peers results in a single notification for each of them.
+    mPeerNotificationsScheduled = true;
+    mTaskRunner.Post([this]() { FlushPeerNotifications(); });
 
 exit:
     return;
 }
 
-void TrelDnssd::NotifyRemovePeer(const Peer &aPeer)
+void TrelDnssd::FlushPeerNotifications(void)
 {
-    otPlatTrelPeerInfo peerInfo;
+    mPeerNotificationsScheduled = false;
 
-    peerInfo.mRemoved   = true;
-    peerInfo.mTxtData   = aPeer.mTxtData.data();
-    peerInfo.mTxtLength = aPeer.mTxtData.size();
-    peerInfo.mSockAddr  = aPeer.mSockAddr;
+    mPeers.FlushNotifications([this](const PeerTable::Peer &aPeer, bool aRemoved) {
+        otPlatTrelPeerInfo peerInfo;
 
-    otPlatTrelHandleDiscoveredPeerInfo(mHost.GetInstance(), &peerInfo);
-}
+        peerInfo.mRemoved   = aRemoved;
+        peerInfo.mTxtData   = aPeer.mTxtData.data();
+        peerInfo.mTxtLength = aPeer.mTxtData.size();
+        peerInfo.mSockAddr  = aPeer.mSockAddr;
 
-void TrelDnssd::RemoveAllPeers(void)
-{
-    for (const auto &entry : mPeers)
-    {
-        NotifyRemovePeer(entry.second);
-    }
-
-    mPeers.clear();
+        otPlatTrelHandleDiscoveredPeerInfo(mHost.GetInstance(), &peerInfo);
+    });
 }
 
 void TrelDnssd::CheckTrelNetifReady(void)
@@ -455,27 +436,6 @@ void TrelDnssd::OnBecomeReady(void)
     }
 }
 
-uint16_t TrelDnssd::CountDuplicatePeers(const TrelDnssd::Peer &aPeer)
-{
-    uint16_t count = 0;
-
-    for (const auto &entry : mPeers)
-    {
-        if (&entry.second == &aPeer)
-        {
-            continue;
-        }
-
-        if (!memcmp(&entry.second.mSockAddr, &aPeer.mSockAddr, sizeof(otSockAddr)) &&
-            !memcmp(&entry.second.mExtAddr, &aPeer.mExtAddr, sizeof(otExtAddress)))
-        {
-            count++;
-        }
-    }
-
-    return count;
-}
-
 void TrelDnssd::RegisterInfo::Assign(uint16_t aPort, const uint8_t *aTxtData, uint8_t aTxtLength)
 {
     assert(!IsPublished());
@@ -493,41 +453,29 @@ void TrelDnssd::RegisterInfo::Clear(void)
     mTxtData.clear();
 }
 
-const char TrelDnssd::Peer::kTxtRecordExtAddressKey[] = "xa";
+const char TrelDnssd::kTxtRecordExtAddressKey[] = "xa";
 
-void TrelDnssd::Peer::ReadExtAddrFromTxtData(void)
+bool TrelDnssd::ReadExtAddrFromTxtData(const Mdns::Publisher::TxtData &aTxtData, otExtAddress &aExtAddr)
 {
-    std::vector<Mdns::Publisher::TxtEntry> txtEntries;
+    Mdns::Publisher::TxtEntryView txtEntry;
+    bool                          found = false;
 
-    memset(&mExtAddr, 0, sizeof(mExtAddr));
+    memset(&aExtAddr, 0, sizeof(aExtAddr));
 
-    SuccessOrExit(Mdns::Publisher::DecodeTxtData(txtEntries, mTxtData.data(), mTxtData.size()));
+    SuccessOrExit(Mdns::Publisher::FindTxtEntry(aTxtData.data(), aTxtData.size(), kTxtRecordExtAddressKey, txtEntry));
+    VerifyOrExit(!txtEntry.mIsBooleanAttribute && txtEntry.mValueLength == sizeof(aExtAddr));
 
-    for (const auto &txtEntry : txtEntries)
-    {
-        if (txtEntry.mIsBooleanAttribute)
-        {
-            continue;
-        }
-
-        if (StringUtils::EqualCaseInsensitive(txtEntry.mKey, kTxtRecordExtAddressKey))
-        {
-            VerifyOrExit(txtEntry.mValue.size() == sizeof(mExtAddr));
-
-            memcpy(mExtAddr.m8, txtEntry.mValue.data(), sizeof(mExtAddr));
-            mValid = true;
-            break;
-        }
-    }
+    memcpy(aExtAddr.m8, txtEntry.mValue, sizeof(aExtAddr));
+    found = true;
 
 exit:
 
-    if (!mValid)
+    if (!found)
     {
         otbrLogInfo("Failed to dissect ExtAddr from peer TXT data");
     }
 
-    return;
+    return found;
 }
 
 } // namespace TrelDnssd
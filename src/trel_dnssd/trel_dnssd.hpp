@@ -46,6 +46,7 @@
 #include "common/types.hpp"
 #include "host/rcp_host.hpp"
 #include "mdns/mdns.hpp"
+#include "trel_dnssd/trel_peer_table.hpp"
 
 namespace otbr {
 
@@ -110,8 +111,9 @@ public:
     void HandleMdnsState(Mdns::Publisher::State aState) override;
 
 private:
-    static constexpr size_t   kPeerCacheSize             = 256;
+    static constexpr size_t   kPeerCacheSize             = OTBR_CONFIG_TREL_PEER_TABLE_SIZE;
     static constexpr uint16_t kCheckNetifReadyIntervalMs = 5000;
+    static const char         kTxtRecordExtAddressKey[];
 
     struct RegisterInfo
     {
@@ -125,31 +127,6 @@ private:
         void Clear(void);
     };
 
-    using Clock = std::chrono::system_clock;
-
-    struct Peer
-    {
-        static const char kTxtRecordExtAddressKey[];
-
-        explicit Peer(std::vector<uint8_t> aTxtData, const otSockAddr &aSockAddr)
-            : mDiscoverTime(Clock::now())
-            , mTxtData(std::move(aTxtData))
-            , mSockAddr(aSockAddr)
-        {
-            ReadExtAddrFromTxtData();
-        }
-
-        void ReadExtAddrFromTxtData(void);
-
-        Clock::time_point    mDiscoverTime;
-        std::vector<uint8_t> mTxtData;
-        otSockAddr           mSockAddr;
-        otExtAddress         mExtAddr;
-        bool                 mValid = false;
-    };
-
-    using PeerMap = std::map<std::string, Peer>;
-
     bool        IsInitialized(void) const { return !mTrelNetif.empty(); }
     bool        IsReady(void) const;
     void        OnBecomeReady(void);
@@ -164,10 +141,10 @@ private:
     void        OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo);
     void        OnTrelServiceInstanceRemoved(const std::string &aInstanceName);
 
-    void     NotifyRemovePeer(const Peer &aPeer);
-    void     CheckPeersNumLimit(void);
-    void     RemoveAllPeers(void);
-    uint16_t CountDuplicatePeers(const Peer &aPeer);
+    void        RemoveAllPeers(void);
+    void        SchedulePeerNotifications(void);
+    void        FlushPeerNotifications(void);
+    static bool ReadExtAddrFromTxtData(const Mdns::Publisher::TxtData &aTxtData, otExtAddress &aExtAddr);
 
     Mdns::Publisher &mPublisher;
     Host::RcpHost   &mHost;
@@ -176,8 +153,9 @@ private:
     uint32_t         mTrelNetifIndex = 0;
     uint64_t         mSubscriberId   = 0;
     RegisterInfo     mRegisterInfo;
-    PeerMap          mPeers;
-    bool             mMdnsPublisherReady = false;
+    PeerTable        mPeers;
+    bool             mMdnsPublisherReady         = false;
+    bool             mPeerNotificationsScheduled = false;
 };
 
 /**
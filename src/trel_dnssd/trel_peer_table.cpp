@@ -0,0 +1,190 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes implementation of the table of discovered TREL peers.
+ */
+
+#include "trel_dnssd/trel_peer_table.hpp"
+
+#include <assert.h>
+
+namespace otbr {
+
+namespace TrelDnssd {
+
+PeerTable::PeerTable(size_t aCapacity)
+    : mCapacity(aCapacity)
+{
+    assert(aCapacity > 0);
+}
+
+void PeerTable::Add(const std::string &aInstanceName, Peer aPeer)
+{
+    std::string        addressKey = GetAddressKey(aPeer);
+    EntryMap::iterator it;
+
+    Remove(aInstanceName);
+
+    if (mEntries.size() >= mCapacity)
+    {
+        Erase(mEntries.find(*mOldest->mInstanceName));
+    }
+
+    QueueNotification(addressKey, aPeer, /* aRemoved */ false);
+    mAddressRefs[addressKey]++;
+
+    it                       = mEntries.emplace(aInstanceName, Entry()).first;
+    it->second.mPeer         = std::move(aPeer);
+    it->second.mAddressKey   = std::move(addressKey);
+    it->second.mInstanceName = &it->first;
+    Link(it->second);
+}
+
+void PeerTable::Remove(const std::string &aInstanceName)
+{
+    auto it = mEntries.find(aInstanceName);
+
+    VerifyOrExit(it != mEntries.end());
+    Erase(it);
+
+exit:
+    return;
+}
+
+void PeerTable::Clear(void)
+{
+    while (mOldest != nullptr)
+    {
+        Erase(mEntries.find(*mOldest->mInstanceName));
+    }
+}
+
+const PeerTable::Peer *PeerTable::Find(const std::string &aInstanceName) const
+{
+    auto it = mEntries.find(aInstanceName);
+
+    return it != mEntries.end() ? &it->second.mPeer : nullptr;
+}
+
+void PeerTable::FlushNotifications(const NotifyCallback &aCallback)
+{
+    std::vector<Notification> notifications;
+
+    // Swap out the queue first, the callback may change the table.
+    notifications.swap(mNotifications);
+    mNotificationIndex.clear();
+
+    for (const Notification &notification : notifications)
+    {
+        if (notification.mRemoved && !notification.mWasVisible)
+        {
+            continue;
+        }
+
+        aCallback(notification.mPeer, notification.mRemoved);
+    }
+}
+
+std::string PeerTable::GetAddressKey(const Peer &aPeer)
+{
+    std::string key(reinterpret_cast<const char *>(aPeer.mSockAddr.mAddress.mFields.m8),
+                    sizeof(aPeer.mSockAddr.mAddress.mFields.m8));
+
+    key.append(reinterpret_cast<const char *>(&aPeer.mSockAddr.mPort), sizeof(aPeer.mSockAddr.mPort));
+    key.append(reinterpret_cast<const char *>(aPeer.mExtAddr.m8), sizeof(aPeer.mExtAddr.m8));
+
+    return key;
+}
+
+void PeerTable::Link(Entry &aEntry)
+{
+    aEntry.mPrev = mNewest;
+    aEntry.mNext = nullptr;
+
+    if (mNewest != nullptr)
+    {
+        mNewest->mNext = &aEntry;
+    }
+    else
+    {
+        mOldest = &aEntry;
+    }
+
+    mNewest = &aEntry;
+}
+
+void PeerTable::Unlink(Entry &aEntry)
+{
+    (aEntry.mPrev != nullptr ? aEntry.mPrev->mNext : mOldest) = aEntry.mNext;
+    (aEntry.mNext != nullptr ? aEntry.mNext->mPrev : mNewest) = aEntry.mPrev;
+}
+
+void PeerTable::Erase(EntryMap::iterator aIt)
+{
+    Entry &entry = aIt->second;
+    auto   refIt = mAddressRefs.find(entry.mAddressKey);
+
+    assert(refIt != mAddressRefs.end());
+
+    if (--refIt->second == 0)
+    {
+        QueueNotification(entry.mAddressKey, entry.mPeer, /* aRemoved */ true);
+        mAddressRefs.erase(refIt);
+    }
+
+    Unlink(entry);
+    mEntries.erase(aIt);
+}
+
+void PeerTable::QueueNotification(const std::string &aAddressKey, const Peer &aPeer, bool aRemoved)
+{
+    auto it = mNotificationIndex.find(aAddressKey);
+
+    if (it != mNotificationIndex.end())
+    {
+        // Only the latest change of a peer within a batch matters.
+        Notification &notification = mNotifications[it->second];
+
+        notification.mPeer    = aPeer;
+        notification.mRemoved = aRemoved;
+    }
+    else
+    {
+        // All earlier changes were delivered, so the peer was reported as added if any instance still refers to it.
+        bool wasVisible = (mAddressRefs.find(aAddressKey) != mAddressRefs.end());
+
+        mNotificationIndex.emplace(aAddressKey, mNotifications.size());
+        mNotifications.push_back({aPeer, aRemoved, wasVisible});
+    }
+}
+
+} // namespace TrelDnssd
+
+} // namespace otbr
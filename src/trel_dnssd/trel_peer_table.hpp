@@ -0,0 +1,198 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the table of discovered TREL peers.
+ */
+
+#ifndef OTBR_AGENT_TREL_PEER_TABLE_HPP_
+#define OTBR_AGENT_TREL_PEER_TABLE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <openthread/ip6.h>
+#include <openthread/platform/radio.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+namespace TrelDnssd {
+
+/**
+ * @addtogroup border-router-trel-dnssd
+ *
+ * @{
+ */
+
+/**
+ * This class implements the table of discovered TREL peers.
+ *
+ * Peers are indexed by their service instance name and linked in the order they were discovered, so that lookups
+ * take O(log n) and the least recently discovered peer is evicted in O(1) once the table is full.
+ *
+ * Changes of the peers are not reported right away. They are queued, coalesced per peer address, and delivered in
+ * one batch by `FlushNotifications()`. A peer which is added and removed again within one batch is not reported.
+ */
+class PeerTable : private NonCopyable
+{
+public:
+    /**
+     * This structure represents a TREL peer.
+     */
+    struct Peer
+    {
+        std::vector<uint8_t> mTxtData;  ///< The TXT data of the peer's TREL service.
+        otSockAddr           mSockAddr; ///< The socket address of the peer.
+        otExtAddress         mExtAddr;  ///< The Extended Address of the peer.
+    };
+
+    /**
+     * This function is called for each queued peer change.
+     *
+     * @param[in] aPeer     The peer.
+     * @param[in] aRemoved  Whether the peer was removed.
+     */
+    using NotifyCallback = std::function<void(const Peer &aPeer, bool aRemoved)>;
+
+    /**
+     * This constructor initializes the peer table.
+     *
+     * @param[in] aCapacity  The maximum number of service instances kept in the table.
+     */
+    explicit PeerTable(size_t aCapacity);
+
+    /**
+     * This method adds a service instance to the table, replacing any existing one with the same name.
+     *
+     * The least recently discovered instance is evicted if the table is full.
+     *
+     * @param[in] aInstanceName  The service instance name.
+     * @param[in] aPeer          The peer.
+     */
+    void Add(const std::string &aInstanceName, Peer aPeer);
+
+    /**
+     * This method removes a service instance from the table.
+     *
+     * The peer is reported as removed only when no other instance refers to the same peer, as one peer can have
+     * multiple instances if expired instances were not properly removed by mDNS.
+     *
+     * @param[in] aInstanceName  The service instance name.
+     */
+    void Remove(const std::string &aInstanceName);
+
+    /**
+     * This method removes all service instances from the table.
+     */
+    void Clear(void);
+
+    /**
+     * This method finds the peer of a service instance.
+     *
+     * @param[in] aInstanceName  The service instance name.
+     *
+     * @returns A pointer to the peer, or `nullptr` if the instance is not in the table.
+     */
+    const Peer *Find(const std::string &aInstanceName) const;
+
+    /**
+     * This method returns the number of service instances in the table.
+     *
+     * @returns The number of service instances.
+     */
+    size_t GetSize(void) const { return mEntries.size(); }
+
+    /**
+     * This method indicates whether there are queued peer changes.
+     *
+     * @retval TRUE   There are queued peer changes.
+     * @retval FALSE  There are no queued peer changes.
+     */
+    bool HasPendingNotifications(void) const { return !mNotifications.empty(); }
+
+    /**
+     * This method delivers and clears the queued peer changes.
+     *
+     * @param[in] aCallback  The callback to invoke for each changed peer.
+     */
+    void FlushNotifications(const NotifyCallback &aCallback);
+
+private:
+    struct Entry
+    {
+        Peer               mPeer;
+        std::string        mAddressKey;
+        const std::string *mInstanceName = nullptr; // Points to the key of this entry in `mEntries`.
+        Entry             *mPrev         = nullptr;
+        Entry             *mNext         = nullptr;
+    };
+
+    struct Notification
+    {
+        Peer mPeer;
+        bool mRemoved;
+        bool mWasVisible; // Whether the peer was reported as added before this batch.
+    };
+
+    using EntryMap = std::map<std::string, Entry>;
+
+    static std::string GetAddressKey(const Peer &aPeer);
+
+    void Link(Entry &aEntry);
+    void Unlink(Entry &aEntry);
+    void Erase(EntryMap::iterator aIt);
+    void QueueNotification(const std::string &aAddressKey, const Peer &aPeer, bool aRemoved);
+
+    size_t                        mCapacity;
+    EntryMap                      mEntries;
+    Entry                        *mOldest = nullptr;
+    Entry                        *mNewest = nullptr;
+    std::map<std::string, size_t> mAddressRefs;       // Number of instances per peer address.
+    std::vector<Notification>     mNotifications;     // Queued peer changes in order of their first change.
+    std::map<std::string, size_t> mNotificationIndex; // Index into `mNotifications` per peer address.
+};
+
+/**
+ * @}
+ */
+
+} // namespace TrelDnssd
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_TREL_PEER_TABLE_HPP_
@@ -44,8 +44,14 @@ int SocketWithCloseExec(int aDomain, int aType, int aProtocol, SocketBlockOption
     VerifyOrExit((fd = socket(aDomain, aType, aProtocol)) != -1, perror("socket(SOCK_CLOEXEC)"));
 
     VerifyOrExit((rval = fcntl(fd, F_GETFD, 0)) != -1, perror("fcntl(F_GETFD)"));
-    rval |= aBlockOption == kSocketNonBlock ? O_NONBLOCK | FD_CLOEXEC : FD_CLOEXEC;
-    VerifyOrExit((rval = fcntl(fd, F_SETFD, rval)) != -1, perror("fcntl(F_SETFD)"));
+    VerifyOrExit((rval = fcntl(fd, F_SETFD, rval | FD_CLOEXEC)) != -1, perror("fcntl(F_SETFD)"));
+
+    if (aBlockOption == kSocketNonBlock)
+    {
+        // O_NONBLOCK is a file status flag, which is only set by F_SETFL.
+        VerifyOrExit((rval = fcntl(fd, F_GETFL, 0)) != -1, perror("fcntl(F_GETFL)"));
+        VerifyOrExit((rval = fcntl(fd, F_SETFL, rval | O_NONBLOCK)) != -1, perror("fcntl(F_SETFL)"));
+    }
 #else
     aType |= aBlockOption == kSocketNonBlock ? SOCK_CLOEXEC | SOCK_NONBLOCK : SOCK_CLOEXEC;
     VerifyOrExit((fd = socket(aDomain, aType, aProtocol)) != -1, perror("socket(SOCK_CLOEXEC)"));
@@ -229,12 +229,16 @@ void CheckMdnsInfo(ThreadApiDBus *aApi)
 {
     OTBR_UNUSED_VARIABLE(aApi);
 #if !OTBR_ENABLE_MDNS_OPENTHREAD
-    otbr::MdnsTelemetryInfo mdnsInfo;
+    otbr::MdnsTelemetryInfo     mdnsInfo;
+    otbr::MdnsLatencyHistograms latencyHistograms;
 
     TEST_ASSERT(aApi->GetMdnsTelemetryInfo(mdnsInfo) == OTBR_ERROR_NONE);
 
     TEST_ASSERT(mdnsInfo.mServiceRegistrations.mSuccess > 0);
     TEST_ASSERT(mdnsInfo.mServiceRegistrationEmaLatency > 0);
+
+    TEST_ASSERT(aApi->GetMdnsLatencyHistograms(latencyHistograms) == OTBR_ERROR_NONE);
+    TEST_ASSERT(latencyHistograms.mServiceRegistration.GetCount() > 0);
 #endif
 }
 
@@ -43,10 +43,16 @@ public:
         : DBusObject(aConnection, "/io/openthread/testobj")
         , mEnded(false)
         , mCount(0)
+        , mName("none")
+        , mNameReads(0)
     {
         RegisterMethod("io.openthread", "Ping", std::bind(&TestObject::PingHandler, this, _1));
         RegisterGetPropertyHandler("io.openthread", "Count", std::bind(&TestObject::CountGetHandler, this, _1));
         RegisterSetPropertyHandler("io.openthread", "Count", std::bind(&TestObject::CountSetHandler, this, _1));
+        RegisterCachedGetPropertyHandler("io.openthread", "Name", std::bind(&TestObject::NameGetHandler, this, _1),
+                                         /* aInvalidatingFlags */ 0);
+        RegisterSetPropertyHandler("io.openthread", "Name", std::bind(&TestObject::NameSetHandler, this, _1));
+        RegisterGetPropertyHandler("io.openthread", "NameReads", std::bind(&TestObject::NameReadsGetHandler, this, _1));
     }
 
     bool IsEnded(void) const { return mEnded; }
@@ -68,6 +74,25 @@ private:
         return OT_ERROR_NONE;
     }
 
+    otError NameGetHandler(DBusMessageIter &aIter)
+    {
+        mNameReads++;
+        DBusMessageEncodeToVariant(&aIter, mName);
+        return OT_ERROR_NONE;
+    }
+
+    otError NameSetHandler(DBusMessageIter &aIter)
+    {
+        DBusMessageExtractFromVariant(&aIter, mName);
+        return OT_ERROR_NONE;
+    }
+
+    otError NameReadsGetHandler(DBusMessageIter &aIter)
+    {
+        DBusMessageEncodeToVariant(&aIter, mNameReads);
+        return OT_ERROR_NONE;
+    }
+
     void PingHandler(DBusRequest &aRequest)
     {
         uint32_t    id;
@@ -85,8 +110,10 @@ private:
         }
     }
 
-    bool    mEnded;
-    int32_t mCount;
+    bool        mEnded;
+    int32_t     mCount;
+    std::string mName;
+    uint32_t    mNameReads;
 };
 
 int main()
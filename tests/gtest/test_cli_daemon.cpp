@@ -319,4 +319,153 @@ TEST(CliDaemon, HandleCommandOutputTruncatedCorrectly_AfterReceivingOnSessionSoc
     cliDaemon.Deinit();
 }
 
+class CliDaemonTestEcho : public otbr::CliDaemon::Dependencies
+{
+public:
+    CliDaemon *mCliDaemonInstance = nullptr;
+
+    otbrError InputCommandLine(const char *aLine) override
+    {
+        std::string output = std::string("echo:") + aLine + "\r\n";
+
+        mCliDaemonInstance->HandleCommandOutput(output.c_str());
+        mCliDaemonInstance->HandleCommandOutput("Done\r\n");
+        return OTBR_ERROR_NONE;
+    }
+};
+
+static int ConnectCliClient(const char *aSocketFile)
+{
+    int                clientSocket = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    struct sockaddr_un serverAddr;
+
+    memset(&serverAddr, 0, sizeof(serverAddr));
+    serverAddr.sun_family = AF_UNIX;
+    strncpy(serverAddr.sun_path, aSocketFile, sizeof(serverAddr.sun_path) - 1);
+    EXPECT_EQ(connect(clientSocket, (struct sockaddr *)&serverAddr, sizeof(serverAddr)), 0);
+
+    return clientSocket;
+}
+
+static void RunCliDaemonOnce(CliDaemon &aCliDaemon)
+{
+    otbr::MainloopContext context;
+
+    context.mMaxFd   = -1;
+    context.mTimeout = {0, 10000};
+    FD_ZERO(&context.mReadFdSet);
+    FD_ZERO(&context.mWriteFdSet);
+    FD_ZERO(&context.mErrorFdSet);
+
+    aCliDaemon.UpdateFdSet(context);
+    ASSERT_GE(select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                     &context.mTimeout),
+              0);
+    aCliDaemon.Process(context);
+}
+
+static void ReadCliClient(int aClientSocket, std::string &aReceived)
+{
+    char    buf[kCliMaxLineLength];
+    ssize_t rval;
+
+    while ((rval = read(aClientSocket, buf, sizeof(buf))) > 0)
+    {
+        aReceived.append(buf, static_cast<size_t>(rval));
+    }
+}
+
+TEST(CliDaemon, ConcurrentSessions_OutputRoutedToIssuingSession)
+{
+    const char *socketFile = "/run/openthread-tun0.sock";
+
+    CliDaemonTestEcho cliDependency;
+    CliDaemon         cliDaemon(cliDependency);
+    cliDependency.mCliDaemonInstance = &cliDaemon;
+
+    ASSERT_EQ(cliDaemon.Init("tun0"), OTBR_ERROR_NONE);
+
+    int         clientA = ConnectCliClient(socketFile);
+    int         clientB = ConnectCliClient(socketFile);
+    std::string receivedA;
+    std::string receivedB;
+
+    while (cliDaemon.GetSessionCount() < 2)
+    {
+        RunCliDaemonOnce(cliDaemon);
+    }
+
+    ASSERT_GT(send(clientA, "command a", strlen("command a"), 0), 0);
+    ASSERT_GT(send(clientB, "command b", strlen("command b"), 0), 0);
+
+    for (int i = 0; i < 100; i++)
+    {
+        if (receivedA.find("Done") != std::string::npos && receivedB.find("Done") != std::string::npos)
+        {
+            break;
+        }
+
+        RunCliDaemonOnce(cliDaemon);
+        ReadCliClient(clientA, receivedA);
+        ReadCliClient(clientB, receivedB);
+    }
+
+    EXPECT_EQ(receivedA, "echo:command a\r\nDone\r\n");
+    EXPECT_EQ(receivedB, "echo:command b\r\nDone\r\n");
+    EXPECT_EQ(cliDaemon.GetSessionCount(), 2u);
+
+    close(clientA);
+    close(clientB);
+    cliDaemon.Deinit();
+}
+
+TEST(CliDaemon, SlowSession_BacklogIsBoundedAndOthersAreServed)
+{
+    const char *socketFile = "/run/openthread-tun0.sock";
+
+    CliDaemonTestEcho cliDependency;
+    CliDaemon         cliDaemon(cliDependency);
+    cliDependency.mCliDaemonInstance = &cliDaemon;
+
+    ASSERT_EQ(cliDaemon.Init("tun0"), OTBR_ERROR_NONE);
+
+    int         slowClient = ConnectCliClient(socketFile);
+    std::string unsolicited(kCliMaxLineLength - 1, 'U');
+
+    while (cliDaemon.GetSessionCount() < 1)
+    {
+        RunCliDaemonOnce(cliDaemon);
+    }
+
+    // The slow client never reads, so its socket buffer fills up and the daemon must buffer, then drop, the output.
+    for (size_t i = 0; i < 4 * OTBR_CONFIG_CLI_SESSION_MAX_BACKLOG / unsolicited.size(); i++)
+    {
+        cliDaemon.HandleCommandOutput(unsolicited.c_str());
+        RunCliDaemonOnce(cliDaemon);
+    }
+
+    int         client = ConnectCliClient(socketFile);
+    std::string received;
+
+    while (cliDaemon.GetSessionCount() < 2)
+    {
+        RunCliDaemonOnce(cliDaemon);
+    }
+
+    ASSERT_GT(send(client, "command", strlen("command"), 0), 0);
+
+    for (int i = 0; i < 100 && received.find("Done") == std::string::npos; i++)
+    {
+        RunCliDaemonOnce(cliDaemon);
+        ReadCliClient(client, received);
+    }
+
+    EXPECT_EQ(received, "echo:command\r\nDone\r\n");
+    EXPECT_EQ(cliDaemon.GetSessionCount(), 2u);
+
+    close(slowClient);
+    close(client);
+    cliDaemon.Deinit();
+}
+
 #endif // __linux__
@@ -101,3 +101,55 @@ TEST(Ip6Prefix, EqualityOperator)
 //-------------------------------------------------------------
 // Test for MacAddress
 // TODO: Add MacAddress tests
+
+//-------------------------------------------------------------
+// Test for LatencyHistogram
+
+TEST(LatencyHistogram, EmptyHistogramReportsZero)
+{
+    otbr::LatencyHistogram histogram{};
+
+    EXPECT_EQ(histogram.GetCount(), 0u);
+    EXPECT_EQ(histogram.GetPercentile(50), 0u);
+    EXPECT_EQ(histogram.GetPercentile(99), 0u);
+}
+
+TEST(LatencyHistogram, RecordFillsBucketsByUpperBound)
+{
+    otbr::LatencyHistogram histogram{};
+
+    histogram.Record(0);
+    histogram.Record(1);
+    histogram.Record(2);
+    histogram.Record(3);
+    histogram.Record(60000);
+    histogram.Record(60001);
+
+    EXPECT_EQ(histogram.GetCount(), 6u);
+    EXPECT_EQ(histogram.mBucketCounts[0], 2u);
+    EXPECT_EQ(histogram.mBucketCounts[1], 1u);
+    EXPECT_EQ(histogram.mBucketCounts[2], 1u);
+    EXPECT_EQ(histogram.mBucketCounts[otbr::LatencyHistogram::kNumBuckets - 2], 1u);
+    EXPECT_EQ(histogram.mBucketCounts[otbr::LatencyHistogram::kNumBuckets - 1], 1u);
+}
+
+TEST(LatencyHistogram, PercentilesReportBucketUpperBounds)
+{
+    otbr::LatencyHistogram histogram{};
+
+    for (uint32_t i = 0; i < 89; i++)
+    {
+        histogram.Record(15);
+    }
+    histogram.Record(150);
+    for (uint32_t i = 0; i < 9; i++)
+    {
+        histogram.Record(400);
+    }
+    histogram.Record(100000);
+
+    EXPECT_EQ(histogram.GetPercentile(50), 20u);
+    EXPECT_EQ(histogram.GetPercentile(90), 200u);
+    EXPECT_EQ(histogram.GetPercentile(99), 500u);
+    EXPECT_EQ(histogram.GetPercentile(100), otbr::LatencyHistogram::kOverflowLatency);
+}
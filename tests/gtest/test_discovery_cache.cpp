@@ -0,0 +1,220 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "common/time.hpp"
+#include "common/types.hpp"
+#include "sdp_proxy/discovery_cache.hpp"
+#include "utils/dns_utils.hpp"
+
+using otbr::Clock;
+using otbr::Ip6Address;
+using otbr::Seconds;
+using otbr::Timepoint;
+using otbr::Dnssd::DiscoveryCache;
+using otbr::DnsUtils::DnsNameInfo;
+using otbr::DnsUtils::SplitFullDnsName;
+
+namespace {
+
+DiscoveryCache::DiscoveredInstanceInfo MakeInstance(const std::string &aName, uint32_t aTtl)
+{
+    DiscoveryCache::DiscoveredInstanceInfo instance;
+
+    instance.mName     = aName;
+    instance.mHostName = "host.local.";
+    instance.mPort     = 1234;
+    instance.mTtl      = aTtl;
+    instance.mAddresses.push_back(Ip6Address("fd00::1"));
+
+    return instance;
+}
+
+DiscoveryCache::DiscoveredHostInfo MakeHost(uint32_t aTtl)
+{
+    DiscoveryCache::DiscoveredHostInfo host;
+
+    host.mHostName = "host.local.";
+    host.mTtl      = aTtl;
+    host.mAddresses.push_back(Ip6Address("fd00::1"));
+
+    return host;
+}
+
+} // namespace
+
+TEST(DiscoveryCache, SubscriptionsAreReferenceCounted)
+{
+    DiscoveryCache cache;
+    DnsNameInfo    browse = SplitFullDnsName("_srv._udp.default.service.arpa.");
+    DnsNameInfo    upper  = SplitFullDnsName("_SRV._udp.default.service.arpa.");
+    DnsNameInfo    host   = SplitFullDnsName("host.default.service.arpa.");
+    DnsNameInfo    subscribedName;
+
+    EXPECT_TRUE(cache.AddSubscription(browse));
+    EXPECT_FALSE(cache.AddSubscription(upper));
+    EXPECT_TRUE(cache.AddSubscription(host));
+    EXPECT_EQ(2u, cache.GetSubscriptionRefCount(browse));
+    EXPECT_EQ(2u, cache.GetSubscriptions().size());
+
+    EXPECT_FALSE(cache.RemoveSubscription(upper, subscribedName));
+    EXPECT_EQ(1u, cache.GetSubscriptionRefCount(browse));
+
+    // The mDNS subscription is stopped with the name it was started with.
+    EXPECT_TRUE(cache.RemoveSubscription(upper, subscribedName));
+    EXPECT_EQ("_srv._udp", subscribedName.mServiceName);
+    EXPECT_EQ(0u, cache.GetSubscriptionRefCount(browse));
+    EXPECT_FALSE(cache.RemoveSubscription(browse, subscribedName));
+
+    EXPECT_TRUE(cache.RemoveSubscription(host, subscribedName));
+    EXPECT_TRUE(cache.GetSubscriptions().empty());
+}
+
+TEST(DiscoveryCache, ResolveIsAnsweredFromCache)
+{
+    DiscoveryCache                              cache;
+    Timepoint                                   now     = Clock::now();
+    DnsNameInfo                                 resolve = SplitFullDnsName("ins1._srv._udp.default.service.arpa.");
+    DnsNameInfo                                 other   = SplitFullDnsName("ins2._srv._udp.default.service.arpa.");
+    std::vector<DiscoveryCache::CachedInstance> instances;
+
+    EXPECT_FALSE(cache.FindInstances(resolve, now, instances));
+
+    cache.UpdateInstance("_srv._udp", MakeInstance("INS1", 120), now);
+
+    ASSERT_TRUE(cache.FindInstances(resolve, now, instances));
+    ASSERT_EQ(1u, instances.size());
+    EXPECT_EQ("INS1", instances[0].mInfo.mName);
+    EXPECT_EQ(60u, DiscoveryCache::GetRemainingTtl(instances[0].mExpireTime, now + Seconds(60)));
+    EXPECT_FALSE(cache.FindInstances(other, now, instances));
+
+    // Expired and removed instances are misses.
+    EXPECT_FALSE(cache.FindInstances(resolve, now + Seconds(120), instances));
+    cache.RemoveInstance("_srv._udp", "INS1");
+    EXPECT_FALSE(cache.FindInstances(resolve, now, instances));
+}
+
+TEST(DiscoveryCache, BrowseIsOnlyAnsweredWhileBrowsing)
+{
+    DiscoveryCache                              cache;
+    Timepoint                                   now     = Clock::now();
+    DnsNameInfo                                 browse  = SplitFullDnsName("_srv._udp.default.service.arpa.");
+    DnsNameInfo                                 resolve = SplitFullDnsName("ins1._srv._udp.default.service.arpa.");
+    DnsNameInfo                                 subscribedName;
+    std::vector<DiscoveryCache::CachedInstance> instances;
+
+    // An instance cached by a resolve is only a part of the browse result.
+    cache.AddSubscription(resolve);
+    cache.UpdateInstance("_srv._udp", MakeInstance("ins1", 120), now);
+    EXPECT_FALSE(cache.FindInstances(browse, now, instances));
+
+    // Once a browse runs, the cache holds everything it reported.
+    cache.AddSubscription(browse);
+    cache.UpdateInstance("_srv._udp", MakeInstance("ins2", 120), now);
+    ASSERT_TRUE(cache.FindInstances(browse, now, instances));
+    EXPECT_EQ(2u, instances.size());
+
+    // Without the browse, removals are no longer reported.
+    cache.RemoveSubscription(browse, subscribedName);
+    EXPECT_FALSE(cache.FindInstances(browse, now, instances));
+    EXPECT_TRUE(cache.FindInstances(resolve, now, instances));
+}
+
+TEST(DiscoveryCache, HostIsAnsweredFromCache)
+{
+    DiscoveryCache             cache;
+    Timepoint                  now = Clock::now();
+    DiscoveryCache::CachedHost host;
+
+    EXPECT_FALSE(cache.FindHost("host", now, host));
+
+    cache.UpdateHost("Host", MakeHost(120), now);
+    ASSERT_TRUE(cache.FindHost("host", now, host));
+    EXPECT_EQ(1u, host.mInfo.mAddresses.size());
+    EXPECT_FALSE(cache.FindHost("host", now + Seconds(120), host));
+
+    // A host without any address to answer is evicted.
+    cache.UpdateHost("host", DiscoveryCache::DiscoveredHostInfo(), now);
+    EXPECT_FALSE(cache.FindHost("host", now, host));
+}
+
+TEST(DiscoveryCache, ExpiredEntriesArePurged)
+{
+    DiscoveryCache                              cache;
+    Timepoint                                   now     = Clock::now();
+    DnsNameInfo                                 resolve = SplitFullDnsName("ins1._srv._udp.default.service.arpa.");
+    std::vector<DiscoveryCache::CachedInstance> instances;
+    DiscoveryCache::CachedHost                  host;
+
+    cache.UpdateInstance("_srv._udp", MakeInstance("ins1", 10), now);
+    cache.UpdateHost("host", MakeHost(10), now);
+
+    // Caching a new name later purges what expired, including instances of the service type being updated.
+    cache.UpdateInstance("_srv._udp", MakeInstance("ins2", 10), now + Seconds(20));
+
+    EXPECT_FALSE(cache.FindInstances(resolve, now, instances));
+    EXPECT_FALSE(cache.FindHost("host", now, host));
+
+    cache.Clear();
+    EXPECT_FALSE(cache.FindInstances(SplitFullDnsName("ins2._srv._udp.default.service.arpa."), now, instances));
+}
+
+TEST(DiscoveryCache, RefreshedEntriesAreNotPurged)
+{
+    DiscoveryCache                              cache;
+    Timepoint                                   now     = Clock::now();
+    DnsNameInfo                                 resolve = SplitFullDnsName("ins1._srv._udp.default.service.arpa.");
+    std::vector<DiscoveryCache::CachedInstance> instances;
+    DiscoveryCache::CachedHost                  host;
+
+    cache.UpdateInstance("_srv._udp", MakeInstance("ins1", 10), now);
+    cache.UpdateHost("host", MakeHost(10), now);
+
+    // Refreshing the TTL moves the entries after the time the next insertion purges at.
+    cache.UpdateInstance("_srv._udp", MakeInstance("ins1", 100), now + Seconds(5));
+    cache.UpdateHost("host", MakeHost(100), now + Seconds(5));
+    cache.UpdateInstance("_srv._udp", MakeInstance("ins2", 10), now + Seconds(20));
+
+    ASSERT_TRUE(cache.FindInstances(resolve, now + Seconds(20), instances));
+    EXPECT_EQ(DiscoveryCache::GetRemainingTtl(instances[0].mExpireTime, now + Seconds(20)), 85u);
+    EXPECT_TRUE(cache.FindHost("host", now + Seconds(20), host));
+
+    // Entries removed before they expire leave nothing behind to purge.
+    cache.RemoveInstance("_srv._udp", "ins1");
+    cache.UpdateHost("host", DiscoveryCache::DiscoveredHostInfo(), now + Seconds(20));
+    cache.UpdateInstance("_srv._udp", MakeInstance("ins3", 10), now + Seconds(200));
+
+    EXPECT_FALSE(cache.FindInstances(resolve, now + Seconds(200), instances));
+    EXPECT_FALSE(cache.FindHost("host", now + Seconds(200), host));
+    EXPECT_TRUE(
+        cache.FindInstances(SplitFullDnsName("ins3._srv._udp.default.service.arpa."), now + Seconds(200), instances));
+}
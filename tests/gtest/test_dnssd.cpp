@@ -29,7 +29,14 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+
 #include "common/code_utils.hpp"
+#include "common/logging.hpp"
 #include "host/posix/dnssd.hpp"
 #include "mdns/mdns.hpp"
 
@@ -264,4 +271,85 @@ TEST_F(DnssdTest, TestServiceResolverStoppedInCallbackOfStartWorksCorrectly)
     EXPECT_FALSE(invoked);
 }
 
+TEST_F(DnssdTest, BenchmarkServiceResolverChurn)
+{
+    constexpr uint8_t  kInfraIfIndex = 1;
+    constexpr uint32_t kNumInstances = 500;
+    constexpr uint32_t kNumCallbacks = 4;
+    constexpr uint32_t kNumRounds    = 20;
+
+    const char                                   *serviceType = "_plant._tcp";
+    std::vector<std::string>                      instanceNames;
+    otbr::DnssdPlatform::SrvResolver              resolver;
+    otbr::Mdns::Publisher::DiscoveredInstanceInfo instanceInfo;
+    uint32_t                                      numResults = 0;
+    otbrLogLevel                                  logLevel   = otbrLogGetLevel();
+    std::chrono::steady_clock::time_point         start;
+    double                                        duration;
+
+    // Keep the per-event logs out of the measurement.
+    otbrLogSetLevel(OTBR_LOG_WARNING);
+
+    for (uint32_t i = 0; i < kNumInstances; i++)
+    {
+        instanceNames.push_back("ZGMF-X" + std::to_string(i) + "A #1");
+    }
+
+    resolver.mServiceType  = serviceType;
+    resolver.mInfraIfIndex = kInfraIfIndex;
+    resolver.mCallback     = nullptr;
+
+    instanceInfo.mRemoved    = false;
+    instanceInfo.mNetifIndex = kInfraIfIndex;
+    instanceInfo.mHostName   = "Eternal.local.";
+    instanceInfo.mTtl        = 10;
+    instanceInfo.mPort       = 11;
+
+    // Each instance is subscribed once per round, however many callbacks resolve it.
+    EXPECT_CALL(*mPublisher, SubscribeService(StrEq(serviceType), _)).Times(kNumInstances * kNumRounds);
+    EXPECT_CALL(*mPublisher, UnsubscribeService(StrEq(serviceType), _)).Times(kNumInstances * kNumRounds);
+
+    start = std::chrono::steady_clock::now();
+
+    for (uint32_t round = 0; round < kNumRounds; round++)
+    {
+        for (const std::string &name : instanceNames)
+        {
+            resolver.mServiceInstance = name.c_str();
+
+            for (uint64_t id = 1; id <= kNumCallbacks; id++)
+            {
+                mDnssdPlatform->StartServiceResolver(
+                    resolver, std::make_unique<otbr::DnssdPlatform::StdSrvCallback>(
+                                  [&numResults](const otbr::DnssdPlatform::SrvResult &) { numResults++; }, id));
+            }
+        }
+
+        for (const std::string &name : instanceNames)
+        {
+            instanceInfo.mName = name;
+            mPublisher->TestOnServiceResolved(serviceType, instanceInfo);
+        }
+
+        for (const std::string &name : instanceNames)
+        {
+            resolver.mServiceInstance = name.c_str();
+
+            for (uint64_t id = 1; id <= kNumCallbacks; id++)
+            {
+                mDnssdPlatform->StopServiceResolver(resolver, otbr::DnssdPlatform::StdSrvCallback(nullptr, id));
+            }
+        }
+    }
+
+    duration = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    otbrLogSetLevel(logLevel);
+
+    EXPECT_EQ(numResults, kNumInstances * kNumCallbacks * kNumRounds);
+
+    printf("%u resolver starts and stops, %u results: %.0f operations/s\n",
+           2 * kNumInstances * kNumCallbacks * kNumRounds, numResults,
+           (2 * kNumCallbacks + 1) * kNumInstances * kNumRounds / duration * 1e6);
+}
+
 #endif // OTBR_ENABLE_DNSSD_PLAT
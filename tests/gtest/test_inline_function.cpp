@@ -0,0 +1,98 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "common/inline_function.hpp"
+
+TEST(InlineFunction, EmptyFunction)
+{
+    otbr::InlineFunction<void(void)> empty;
+    otbr::InlineFunction<void(void)> null = nullptr;
+    std::function<void(void)>        emptyStdFunction;
+    void (*nullFunctionPointer)(void) = nullptr;
+
+    EXPECT_TRUE(empty == nullptr);
+    EXPECT_TRUE(null == nullptr);
+    EXPECT_TRUE(otbr::InlineFunction<void(void)>(emptyStdFunction) == nullptr);
+    EXPECT_TRUE(otbr::InlineFunction<void(void)>(nullFunctionPointer) == nullptr);
+}
+
+TEST(InlineFunction, InvokeAndMove)
+{
+    std::string                    suffix = "!";
+    otbr::InlineFunction<int(int)> square = [](int x) { return x * x; };
+    otbr::InlineFunction<std::string(const std::string &)> append = [suffix](const std::string &aStr) {
+        return aStr + suffix;
+    };
+    otbr::InlineFunction<std::string(const std::string &)> moved = std::move(append);
+
+    EXPECT_EQ(25, square(5));
+    EXPECT_TRUE(append == nullptr);
+    EXPECT_EQ("hi!", moved("hi"));
+
+    moved = nullptr;
+    EXPECT_FALSE(moved);
+}
+
+TEST(InlineFunction, MoveOnlyCallable)
+{
+    std::unique_ptr<int>           value(new int(42));
+    otbr::InlineFunction<int(void)> getValue = [captured = std::move(value)]() { return *captured; };
+    otbr::InlineFunction<int(void)> moved    = std::move(getValue);
+
+    EXPECT_EQ(42, moved());
+}
+
+TEST(InlineFunction, LargeCallableFallsBackToHeap)
+{
+    struct Large
+    {
+        char mData[OTBR_CONFIG_INLINE_FUNCTION_SIZE + 1];
+    };
+
+    std::shared_ptr<int> counter = std::make_shared<int>(0);
+    Large                large   = {};
+
+    {
+        otbr::InlineFunction<void(void)> func = [counter, large]() { *counter += large.mData[0] + 1; };
+        otbr::InlineFunction<void(void)> moved = std::move(func);
+
+        EXPECT_FALSE(otbr::InlineFunction<void(void)>::IsStoredInline<Large>());
+        moved();
+        EXPECT_EQ(2, counter.use_count());
+    }
+
+    // The heap-allocated callable is released with its function.
+    EXPECT_EQ(1, *counter);
+    EXPECT_EQ(1, counter.use_count());
+}
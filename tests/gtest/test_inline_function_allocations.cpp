@@ -0,0 +1,222 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file counts heap allocations by replacing the global allocation functions,
+ *   so it is built as a separate test executable which does not affect other tests.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <new>
+#include <string>
+
+#include <stdlib.h>
+#include <sys/select.h>
+
+#include <gtest/gtest.h>
+
+#include "common/inline_function.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/task_runner.hpp"
+
+static std::atomic<size_t> sAllocationCount{0};
+
+static void *CountedAllocate(size_t aSize)
+{
+    ++sAllocationCount;
+
+    return malloc(aSize == 0 ? 1 : aSize);
+}
+
+void *operator new(size_t aSize)
+{
+    void *ptr = CountedAllocate(aSize);
+
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+void *operator new[](size_t aSize)
+{
+    return operator new(aSize);
+}
+
+void *operator new(size_t aSize, const std::nothrow_t &) noexcept
+{
+    return CountedAllocate(aSize);
+}
+
+void *operator new[](size_t aSize, const std::nothrow_t &) noexcept
+{
+    return CountedAllocate(aSize);
+}
+
+void operator delete(void *aPtr) noexcept
+{
+    free(aPtr);
+}
+
+void operator delete[](void *aPtr) noexcept
+{
+    free(aPtr);
+}
+
+void operator delete(void *aPtr, size_t) noexcept
+{
+    free(aPtr);
+}
+
+void operator delete[](void *aPtr, size_t) noexcept
+{
+    free(aPtr);
+}
+
+void operator delete(void *aPtr, const std::nothrow_t &) noexcept
+{
+    free(aPtr);
+}
+
+void operator delete[](void *aPtr, const std::nothrow_t &) noexcept
+{
+    free(aPtr);
+}
+
+#if __cpp_aligned_new
+void *operator new(size_t aSize, std::align_val_t aAlignment)
+{
+    void  *ptr       = nullptr;
+    size_t alignment = std::max(static_cast<size_t>(aAlignment), sizeof(void *));
+
+    ++sAllocationCount;
+
+    if (posix_memalign(&ptr, alignment, aSize == 0 ? 1 : aSize) != 0)
+    {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+void *operator new[](size_t aSize, std::align_val_t aAlignment)
+{
+    return operator new(aSize, aAlignment);
+}
+
+void operator delete(void *aPtr, std::align_val_t) noexcept
+{
+    free(aPtr);
+}
+
+void operator delete[](void *aPtr, std::align_val_t) noexcept
+{
+    free(aPtr);
+}
+
+void operator delete(void *aPtr, size_t, std::align_val_t) noexcept
+{
+    free(aPtr);
+}
+
+void operator delete[](void *aPtr, size_t, std::align_val_t) noexcept
+{
+    free(aPtr);
+}
+#endif // __cpp_aligned_new
+
+template <typename FunctionType> static size_t CountAllocations(size_t aNumTasks)
+{
+    std::function<void(otbrError, const std::string &)> receiver = [](otbrError, const std::string &) {};
+    std::string                                          errorMsg = "Failed to set the operational dataset";
+    size_t                                               before;
+    size_t                                               after;
+
+    before = sAllocationCount.load();
+
+    for (size_t i = 0; i < aNumTasks; i++)
+    {
+        otbrError    error = OTBR_ERROR_NONE;
+        FunctionType task  = [receiver, error, errorMsg](void) { receiver(error, errorMsg); };
+
+        task();
+    }
+
+    after = sAllocationCount.load();
+
+    return after - before;
+}
+
+TEST(InlineFunction, BenchmarkAllocations)
+{
+    static constexpr size_t kNumTasks = 10000;
+
+    size_t stdFunctionAllocations    = CountAllocations<std::function<void(void)>>(kNumTasks);
+    size_t inlineFunctionAllocations = CountAllocations<otbr::InlineFunction<void(void)>>(kNumTasks);
+
+    // Copying the captured std::string allocates for both types, but std::function
+    // also allocates its own storage for the lambda.
+    EXPECT_LT(inlineFunctionAllocations, stdFunctionAllocations);
+    EXPECT_EQ(kNumTasks, stdFunctionAllocations - inlineFunctionAllocations);
+}
+
+TEST(InlineFunction, TaskRunnerPostDoesNotAllocate)
+{
+    otbr::TaskRunner      taskRunner;
+    otbr::MainloopContext mainloop;
+    int                   counter = 0;
+    size_t                before;
+    size_t                after;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {1, 0};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    // Warm up the task runner queues.
+    taskRunner.Post([&counter]() { ++counter; });
+    otbr::MainloopManager::GetInstance().Update(mainloop);
+    ASSERT_EQ(1, select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                        &mainloop.mTimeout));
+    otbr::MainloopManager::GetInstance().Process(mainloop);
+    ASSERT_EQ(1, counter);
+
+    before = sAllocationCount.load();
+    taskRunner.Post([&counter]() { ++counter; });
+    after = sAllocationCount.load();
+
+    // Neither the callable nor the queue node is allocated.
+    EXPECT_EQ(0u, after - before);
+}
@@ -29,9 +29,13 @@
 #define OTBR_LOG_TAG "TEST"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <unistd.h>
 
+#include <string>
+
 #include <gtest/gtest.h>
 
 #include "common/logging.hpp"
@@ -128,3 +132,247 @@ TEST(Logging, TestLoggingDump)
     snprintf(cmd, sizeof(cmd), "grep '%s.*: foobar: 0020: 6f 66 20 74 65 78 74 00' /var/log/syslog", ident);
     EXPECT_EQ(system(cmd), 0);
 }
+
+TEST(Logging, TestLoggingFlushNoSyslog)
+{
+    std::string output;
+
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, false, true);
+    testing::internal::CaptureStdout();
+    otbrLog(OTBR_LOG_INFO, OTBR_LOG_TAG, "cool-flush");
+    otbrLogFlush();
+    output = testing::internal::GetCapturedStdout();
+    otbrLogDeinit();
+
+    EXPECT_NE(output.find("[INFO]-TEST----: cool-flush\n"), std::string::npos);
+}
+
+TEST(Logging, TestLoggingCriticalIsNotDeferred)
+{
+    std::string output;
+
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, false, true);
+    testing::internal::CaptureStdout();
+    otbrLog(OTBR_LOG_INFO, OTBR_LOG_TAG, "cool-before");
+    otbrLog(OTBR_LOG_CRIT, OTBR_LOG_TAG, "cool-critical");
+    fflush(stdout);
+    output = testing::internal::GetCapturedStdout();
+    otbrLogDeinit();
+
+    ASSERT_NE(output.find("cool-before"), std::string::npos);
+    ASSERT_NE(output.find("cool-critical"), std::string::npos);
+    EXPECT_LT(output.find("cool-before"), output.find("cool-critical"));
+}
+
+TEST(Logging, TestLoggingBurstIsEmittedOrCounted)
+{
+    const uint32_t kNumLogs     = 4096;
+    uint32_t       droppedCount = otbrLogGetDroppedCount();
+    uint32_t       numEmitted   = 0;
+    std::string    output;
+
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, false, true);
+    testing::internal::CaptureStdout();
+    for (uint32_t i = 0; i < kNumLogs; i++)
+    {
+        otbrLog(OTBR_LOG_INFO, OTBR_LOG_TAG, "cool-burst %u", i);
+    }
+    otbrLogFlush();
+    output = testing::internal::GetCapturedStdout();
+    otbrLogDeinit();
+
+    for (size_t pos = output.find("cool-burst "); pos != std::string::npos; pos = output.find("cool-burst ", pos + 1))
+    {
+        numEmitted++;
+    }
+
+    droppedCount = otbrLogGetDroppedCount() - droppedCount;
+    EXPECT_EQ(numEmitted + droppedCount, kNumLogs);
+    EXPECT_EQ(droppedCount > 0, output.find("Dropped") != std::string::npos);
+}
+
+TEST(Logging, TestLoggingTagLevel)
+{
+    std::string output;
+
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, false, true);
+    ASSERT_EQ(otbrLogSetTagLevel("TAGGED", OTBR_LOG_DEBUG), OTBR_ERROR_NONE);
+    EXPECT_EQ(otbrLogGetTagLevel("TAGGED"), OTBR_LOG_DEBUG);
+    EXPECT_EQ(otbrLogGetTagLevel(OTBR_LOG_TAG), OTBR_LOG_INFO);
+
+    testing::internal::CaptureStdout();
+    otbrLog(OTBR_LOG_DEBUG, "TAGGED", "cool-tagged");
+    otbrLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG, "cool-untagged");
+    otbrLogFlush();
+    output = testing::internal::GetCapturedStdout();
+
+    otbrLogClearTagLevels();
+    EXPECT_EQ(otbrLogGetTagLevel("TAGGED"), OTBR_LOG_INFO);
+    otbrLogDeinit();
+
+    EXPECT_NE(output.find("cool-tagged"), std::string::npos);
+    EXPECT_EQ(output.find("cool-untagged"), std::string::npos);
+}
+
+static std::string DecodeBinaryLog(const char *aPath)
+{
+    char  *buffer = nullptr;
+    size_t size   = 0;
+    FILE  *stream = open_memstream(&buffer, &size);
+
+    EXPECT_EQ(otbrLogBinaryDecode(aPath, stream), OTBR_ERROR_NONE);
+    fclose(stream);
+
+    std::string output(buffer, size);
+    free(buffer);
+
+    return output;
+}
+
+TEST(Logging, TestLoggingBinaryLog)
+{
+    char        path[] = "/tmp/otbr-test-binary-log-XXXXXX";
+    int         fd     = mkstemp(path);
+    std::string output;
+
+    ASSERT_GE(fd, 0);
+    close(fd);
+
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, false, true);
+    ASSERT_EQ(otbrLogBinaryInit(path, OTBR_LOG_DEBUG), OTBR_ERROR_NONE);
+
+    otbrLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG, "cool-binary %d %s %llu %5.2f %-4x| %.*s %c %%", -3, "string",
+            1ULL << 40, 3.14159, 0xabu, 3, "precision", 'z');
+    otbrLogDeinit();
+
+    output = DecodeBinaryLog(path);
+    unlink(path);
+
+    EXPECT_NE(output.find("[DEBG]-TEST----: cool-binary -3 string 1099511627776  3.14 ab  | pre z %\n"),
+              std::string::npos);
+}
+
+TEST(Logging, TestLoggingBinaryLogWraps)
+{
+    const uint32_t kNumLogs = 200000;
+    char           path[]   = "/tmp/otbr-test-binary-log-XXXXXX";
+    int            fd       = mkstemp(path);
+    std::string    output;
+    size_t         pos;
+    uint32_t       previous;
+    uint32_t       numDecoded = 0;
+
+    ASSERT_GE(fd, 0);
+    close(fd);
+
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, false, true);
+    ASSERT_EQ(otbrLogBinaryInit(path, OTBR_LOG_DEBUG), OTBR_ERROR_NONE);
+    for (uint32_t i = 0; i < kNumLogs; i++)
+    {
+        otbrLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG, "cool-wrap %u %s", i, "padding-padding-padding");
+    }
+    otbrLogDeinit();
+
+    output = DecodeBinaryLog(path);
+    unlink(path);
+
+    // The oldest records are overwritten, the remaining ones are decoded in order up to the last one.
+    pos = output.find("cool-wrap ");
+    ASSERT_NE(pos, std::string::npos);
+    previous = static_cast<uint32_t>(strtoul(&output[pos + strlen("cool-wrap ")], nullptr, 10));
+    EXPECT_GT(previous, 0u);
+
+    for (pos = output.find("cool-wrap ", pos + 1); pos != std::string::npos; pos = output.find("cool-wrap ", pos + 1))
+    {
+        uint32_t index = static_cast<uint32_t>(strtoul(&output[pos + strlen("cool-wrap ")], nullptr, 10));
+
+        EXPECT_EQ(index, previous + 1);
+        previous = index;
+        numDecoded++;
+    }
+
+    EXPECT_EQ(previous, kNumLogs - 1);
+    EXPECT_GT(numDecoded, 0u);
+}
+
+TEST(Logging, TestLoggingBinaryLogRejectsInvalidFormatOffset)
+{
+    const long    kFormatOffsetPosition = 64 + 24; // The file header, then the record header up to its format offset.
+    const int64_t kInvalidOffset        = INT64_C(1) << 40;
+    char          path[]                = "/tmp/otbr-test-binary-log-XXXXXX";
+    int           fd                    = mkstemp(path);
+    FILE         *file;
+    FILE         *output;
+
+    ASSERT_GE(fd, 0);
+    close(fd);
+
+    otbrLogInit("otbr-test", OTBR_LOG_INFO, false, true);
+    ASSERT_EQ(otbrLogBinaryInit(path, OTBR_LOG_DEBUG), OTBR_ERROR_NONE);
+    otbrLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG, "cool-offset %d", 1);
+    otbrLogDeinit();
+
+    file = fopen(path, "r+b");
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(fseek(file, kFormatOffsetPosition, SEEK_SET), 0);
+    ASSERT_EQ(fwrite(&kInvalidOffset, sizeof(kInvalidOffset), 1, file), 1u);
+    fclose(file);
+
+    output = fopen("/dev/null", "w");
+    ASSERT_NE(output, nullptr);
+    EXPECT_EQ(otbrLogBinaryDecode(path, output), OTBR_ERROR_PARSE);
+    fclose(output);
+    unlink(path);
+}
+
+TEST(Logging, TestLoggingBinaryLogResyncSkipsFakeRecords)
+{
+    const uint32_t kNumLogs = 60000;
+    // Integer arguments which look like a record header with a valid format offset, but not like the next record.
+    const unsigned long long kFakeMagicAndLength = 0xb10cULL | (40ULL << 16);
+    const unsigned long long kFakeSequence       = 0xdeadbeefULL;
+
+    // The records cycle through three lengths, one of the rounds leaves a fake record after the write offset.
+    for (uint32_t round = 0; round < 3; round++)
+    {
+        char        path[] = "/tmp/otbr-test-binary-log-XXXXXX";
+        int         fd     = mkstemp(path);
+        std::string output;
+        size_t      pos;
+        uint32_t    previous;
+
+        ASSERT_GE(fd, 0);
+        close(fd);
+
+        otbrLogInit("otbr-test", OTBR_LOG_INFO, false, true);
+        ASSERT_EQ(otbrLogBinaryInit(path, OTBR_LOG_DEBUG), OTBR_ERROR_NONE);
+        for (uint32_t i = 0; i < kNumLogs + round; i++)
+        {
+            otbrLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG, "cool-fake %u %llu %llu %llu %llu %llu %llu %llu %llu %llu %llu %s",
+                    i, kFakeMagicAndLength, kFakeSequence, 0ULL, 0ULL, 0ULL, kFakeMagicAndLength, kFakeSequence, 0ULL,
+                    0ULL, 0ULL, &"padding-padding-"[(i % 3) * 8]);
+        }
+        otbrLogDeinit();
+
+        output = DecodeBinaryLog(path);
+        unlink(path);
+
+        EXPECT_EQ(output.find("otbr-binary-log"), std::string::npos);
+
+        pos = output.find("cool-fake ");
+        ASSERT_NE(pos, std::string::npos);
+        previous = static_cast<uint32_t>(strtoul(&output[pos + strlen("cool-fake ")], nullptr, 10));
+        EXPECT_GT(previous, 0u);
+
+        for (pos = output.find("cool-fake ", pos + 1); pos != std::string::npos;
+             pos = output.find("cool-fake ", pos + 1))
+        {
+            uint32_t index = static_cast<uint32_t>(strtoul(&output[pos + strlen("cool-fake ")], nullptr, 10));
+
+            EXPECT_EQ(index, previous + 1);
+            previous = index;
+        }
+
+        EXPECT_EQ(previous, kNumLogs + round - 1);
+    }
+}
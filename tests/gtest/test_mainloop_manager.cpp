@@ -0,0 +1,369 @@
+/*
+ *    Copyright (c) 2026, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
+
+namespace {
+
+constexpr timeval kPollTimeout = {0, 50 * 1000};
+
+class RegisteredFdProcessor : public otbr::MainloopProcessor
+{
+public:
+    RegisteredFdProcessor(void)
+        : otbr::MainloopProcessor(Registration::kPersistent)
+    {
+    }
+
+    void Register(int aFd) { RegisterFd(aFd, kEventReadable); }
+    void Unregister(int aFd) { UnregisterFd(aFd); }
+
+    otbr::Timepoint GetDeadline(void) const override { return mDeadline; }
+
+    void HandleFdEvent(int aFd, uint8_t aEvents) override
+    {
+        char buf[16];
+
+        mReadyFd = aFd;
+        mEvents  = aEvents;
+        mEventCount++;
+
+        while (read(aFd, buf, sizeof(buf)) > 0)
+        {
+        }
+    }
+
+    void HandleTimeout(void) override
+    {
+        mDeadline = otbr::Timepoint::max();
+        mTimeoutCount++;
+    }
+
+    otbr::Timepoint mDeadline     = otbr::Timepoint::max();
+    int             mReadyFd      = -1;
+    uint8_t         mEvents       = 0;
+    int             mEventCount   = 0;
+    int             mTimeoutCount = 0;
+};
+
+class Pipe
+{
+public:
+    Pipe(void)
+    {
+        EXPECT_EQ(0, pipe2(mFds, O_NONBLOCK | O_CLOEXEC));
+    }
+
+    ~Pipe(void)
+    {
+        Close();
+    }
+
+    void Close(void)
+    {
+        for (int &fd : mFds)
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+                fd = -1;
+            }
+        }
+    }
+
+    void Write(void) { EXPECT_EQ(1, write(mFds[1], "x", 1)); }
+
+    int mFds[2];
+};
+
+int RunSelectOnce(void)
+{
+    otbr::MainloopContext mainloop;
+    int                   rval;
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = kPollTimeout;
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    otbr::MainloopManager::GetInstance().Update(mainloop);
+    rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                  &mainloop.mTimeout);
+
+    if (rval >= 0)
+    {
+        otbr::MainloopManager::GetInstance().Process(mainloop);
+    }
+
+    return rval;
+}
+
+} // namespace
+
+TEST(MainloopManager, SelectHandlesRegisteredFds)
+{
+    Pipe                  pipeA;
+    Pipe                  pipeB;
+    RegisteredFdProcessor processor;
+
+    processor.Register(pipeA.mFds[0]);
+    processor.Register(pipeB.mFds[0]);
+    pipeB.Write();
+
+    EXPECT_EQ(1, RunSelectOnce());
+    EXPECT_EQ(1, processor.mEventCount);
+    EXPECT_EQ(pipeB.mFds[0], processor.mReadyFd);
+    EXPECT_EQ(otbr::MainloopProcessor::kEventReadable, processor.mEvents);
+
+    processor.Unregister(pipeB.mFds[0]);
+    pipeB.Write();
+
+    EXPECT_EQ(0, RunSelectOnce());
+    EXPECT_EQ(1, processor.mEventCount);
+
+    processor.mDeadline = otbr::Clock::now() + otbr::Milliseconds(10);
+
+    EXPECT_EQ(0, RunSelectOnce());
+    EXPECT_EQ(1, processor.mTimeoutCount);
+}
+
+#if OTBR_ENABLE_EPOLL
+
+namespace {
+
+class FdProcessor : public otbr::MainloopProcessor
+{
+public:
+    explicit FdProcessor(int aFd)
+        : mFd(aFd)
+    {
+    }
+
+    void Update(otbr::MainloopContext &aMainloop) override
+    {
+        mUpdateCount++;
+
+        if (mFd >= 0)
+        {
+            aMainloop.AddFdToReadSet(mFd);
+        }
+
+        if (mTimeoutMs >= 0)
+        {
+            aMainloop.mTimeout = {0, mTimeoutMs * 1000};
+        }
+    }
+
+    void Process(const otbr::MainloopContext &aMainloop) override
+    {
+        mProcessCount++;
+        mReadable = (mFd >= 0 && FD_ISSET(mFd, &aMainloop.mReadFdSet));
+
+        if (mReadable)
+        {
+            char buf[16];
+
+            while (read(mFd, buf, sizeof(buf)) > 0)
+            {
+            }
+        }
+    }
+
+    int  mFd;
+    int  mTimeoutMs    = -1;
+    int  mUpdateCount  = 0;
+    int  mProcessCount = 0;
+    bool mReadable     = false;
+};
+
+} // namespace
+
+TEST(MainloopManager, EpollProcessesOnlyReadyProcessors)
+{
+    Pipe        pipeA;
+    Pipe        pipeB;
+    FdProcessor processorA(pipeA.mFds[0]);
+    FdProcessor processorB(pipeB.mFds[0]);
+
+    pipeA.Write();
+
+    EXPECT_EQ(1, otbr::MainloopManager::GetInstance().Poll(kPollTimeout));
+    EXPECT_EQ(1, processorA.mProcessCount);
+    EXPECT_TRUE(processorA.mReadable);
+    EXPECT_EQ(0, processorB.mProcessCount);
+
+    pipeB.Write();
+
+    EXPECT_EQ(1, otbr::MainloopManager::GetInstance().Poll(kPollTimeout));
+    EXPECT_EQ(1, processorA.mProcessCount);
+    EXPECT_EQ(1, processorB.mProcessCount);
+    EXPECT_TRUE(processorB.mReadable);
+    EXPECT_EQ(2, processorA.mUpdateCount);
+}
+
+TEST(MainloopManager, EpollProcessesExpiredTimeout)
+{
+    FdProcessor idle(-1);
+    FdProcessor timed(-1);
+
+    timed.mTimeoutMs = 10;
+
+    EXPECT_EQ(0, otbr::MainloopManager::GetInstance().Poll(kPollTimeout));
+    EXPECT_EQ(1, timed.mProcessCount);
+    EXPECT_FALSE(timed.mReadable);
+    EXPECT_EQ(0, idle.mProcessCount);
+}
+
+TEST(MainloopManager, EpollStopsReportingRemovedInterest)
+{
+    Pipe        pipe;
+    FdProcessor processor(pipe.mFds[0]);
+
+    EXPECT_EQ(0, otbr::MainloopManager::GetInstance().Poll(kPollTimeout));
+    EXPECT_FALSE(processor.mReadable);
+
+    processor.mFd = -1;
+    pipe.Write();
+
+    // The processor is still processed when the poll timeout expires, but
+    // the fd it is no longer interested in must not be reported.
+    EXPECT_EQ(0, otbr::MainloopManager::GetInstance().Poll(kPollTimeout));
+    EXPECT_FALSE(processor.mReadable);
+
+    processor.mFd = pipe.mFds[0];
+
+    EXPECT_EQ(1, otbr::MainloopManager::GetInstance().Poll(kPollTimeout));
+    EXPECT_TRUE(processor.mReadable);
+}
+
+TEST(MainloopManager, EpollReRegistersReusedFd)
+{
+    Pipe        oldPipe;
+    FdProcessor processor(oldPipe.mFds[0]);
+    int         fd = oldPipe.mFds[0];
+
+    EXPECT_EQ(0, otbr::MainloopManager::GetInstance().Poll(kPollTimeout));
+
+    // Closing the fd silently drops its epoll registration, the same fd
+    // number is then reused by a new pipe. The interest of the processor does
+    // not change, so the fd is only registered again by the periodic resync.
+    oldPipe.Close();
+
+    {
+        Pipe newPipe;
+
+        ASSERT_EQ(fd, dup2(newPipe.mFds[0], fd));
+        newPipe.Write();
+
+        for (int i = 0; i < 50 && !processor.mReadable; i++)
+        {
+            otbr::MainloopManager::GetInstance().Poll(kPollTimeout);
+        }
+
+        EXPECT_TRUE(processor.mReadable);
+    }
+
+    close(fd);
+}
+
+TEST(MainloopManager, EpollHandlesOnlyReadyRegisteredFds)
+{
+    Pipe                  pipeA;
+    Pipe                  pipeB;
+    RegisteredFdProcessor processorA;
+    RegisteredFdProcessor processorB;
+    FdProcessor           legacy(-1);
+
+    processorA.Register(pipeA.mFds[0]);
+    processorB.Register(pipeB.mFds[0]);
+    pipeA.Write();
+
+    EXPECT_EQ(1, otbr::MainloopManager::GetInstance().Poll(kPollTimeout));
+    EXPECT_EQ(1, processorA.mEventCount);
+    EXPECT_EQ(pipeA.mFds[0], processorA.mReadyFd);
+    EXPECT_EQ(0, processorB.mEventCount);
+    EXPECT_EQ(1, legacy.mUpdateCount);
+
+    processorB.Unregister(pipeB.mFds[0]);
+    pipeB.Write();
+
+    EXPECT_EQ(0, otbr::MainloopManager::GetInstance().Poll(kPollTimeout));
+    EXPECT_EQ(1, processorA.mEventCount);
+    EXPECT_EQ(0, processorB.mEventCount);
+}
+
+TEST(MainloopManager, EpollHandlesRegisteredDeadline)
+{
+    RegisteredFdProcessor idle;
+    RegisteredFdProcessor timed;
+    otbr::Timepoint       start = otbr::Clock::now();
+
+    timed.mDeadline = start + otbr::Milliseconds(10);
+
+    EXPECT_EQ(0, otbr::MainloopManager::GetInstance().Poll(kPollTimeout));
+    EXPECT_EQ(1, timed.mTimeoutCount);
+    EXPECT_EQ(0, idle.mTimeoutCount);
+    EXPECT_LT(otbr::Clock::now() - start, otbr::Milliseconds(50));
+}
+
+TEST(MainloopManager, EpollHandlesRegisteredFdBeyondFdSetSize)
+{
+    struct rlimit         limit;
+    Pipe                  pipe;
+    RegisteredFdProcessor processor;
+    int                   fd = FD_SETSIZE + 16;
+
+    ASSERT_EQ(0, getrlimit(RLIMIT_NOFILE, &limit));
+
+    if (limit.rlim_cur <= static_cast<rlim_t>(fd))
+    {
+        GTEST_SKIP() << "RLIMIT_NOFILE is too small";
+    }
+
+    ASSERT_EQ(fd, dup2(pipe.mFds[0], fd));
+    processor.Register(fd);
+    pipe.Write();
+
+    EXPECT_EQ(1, otbr::MainloopManager::GetInstance().Poll(kPollTimeout));
+    EXPECT_EQ(1, processor.mEventCount);
+    EXPECT_EQ(fd, processor.mReadyFd);
+
+    processor.Unregister(fd);
+    close(fd);
+}
+
+#endif // OTBR_ENABLE_EPOLL
@@ -0,0 +1,241 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "mdns/mdns.hpp"
+
+using otbr::Mdns::Publisher;
+
+class FakePublisher : public Publisher
+{
+public:
+    using Publisher::OnHostResolved;
+    using Publisher::OnServiceResolved;
+
+    void UnpublishService(const std::string &, const std::string &, ResultCallback &&) override {}
+    void UnpublishHost(const std::string &, ResultCallback &&) override {}
+    void UnpublishKey(const std::string &, ResultCallback &&) override {}
+    void SubscribeService(const std::string &, const std::string &) override {}
+    void UnsubscribeService(const std::string &, const std::string &) override {}
+    void SubscribeHost(const std::string &) override {}
+    void UnsubscribeHost(const std::string &) override {}
+
+    otbrError Start(void) override { return OTBR_ERROR_NONE; }
+    void      Stop(void) override {}
+    bool      IsStarted(void) const override { return true; }
+
+protected:
+    otbrError PublishServiceImpl(const std::string &,
+                                 const std::string &,
+                                 const std::string &,
+                                 const SubTypeList &,
+                                 uint16_t,
+                                 const TxtData &,
+                                 ResultCallback &&) override
+    {
+        return OTBR_ERROR_NONE;
+    }
+    otbrError PublishHostImpl(const std::string &, const AddressList &, ResultCallback &&) override
+    {
+        return OTBR_ERROR_NONE;
+    }
+    otbrError PublishKeyImpl(const std::string &, const KeyData &, ResultCallback &&) override
+    {
+        return OTBR_ERROR_NONE;
+    }
+    void      OnServiceResolveFailedImpl(const std::string &, const std::string &, int32_t) override {}
+    void      OnHostResolveFailedImpl(const std::string &, int32_t) override {}
+    otbrError DnsErrorToOtbrError(int32_t) override { return OTBR_ERROR_NONE; }
+};
+
+static Publisher::DiscoveredInstanceInfo MakeInstanceInfo(const std::string &aName)
+{
+    Publisher::DiscoveredInstanceInfo instanceInfo;
+
+    instanceInfo.mRemoved    = true;
+    instanceInfo.mNetifIndex = 1;
+    instanceInfo.mName       = aName;
+
+    return instanceInfo;
+}
+
+TEST(MdnsSubscriber, ServiceCallbackOnlyReceivesItsServiceType)
+{
+    FakePublisher            publisher;
+    std::vector<std::string> allEvents;
+    std::vector<std::string> trelEvents;
+
+    publisher.AddSubscriptionCallbacks(
+        [&allEvents](const std::string &aType, const Publisher::DiscoveredInstanceInfo &) {
+            allEvents.push_back(aType);
+        },
+        nullptr);
+    publisher.AddServiceSubscriptionCallback(
+        "_trel._udp", [&trelEvents](const std::string &aType, const Publisher::DiscoveredInstanceInfo &) {
+            trelEvents.push_back(aType);
+        });
+
+    publisher.OnServiceResolved("_meshcop._udp", MakeInstanceInfo("br"));
+    publisher.OnServiceResolved("_trel._udp", MakeInstanceInfo("peer1"));
+    publisher.OnServiceResolved("_TREL._udp", MakeInstanceInfo("peer2"));
+
+    EXPECT_EQ(allEvents, (std::vector<std::string>{"_meshcop._udp", "_trel._udp", "_TREL._udp"}));
+    EXPECT_EQ(trelEvents, (std::vector<std::string>{"_trel._udp", "_TREL._udp"}));
+}
+
+TEST(MdnsSubscriber, HostCallbackOnlyReceivesItsHost)
+{
+    FakePublisher                 publisher;
+    std::vector<std::string>      hostEvents;
+    Publisher::DiscoveredHostInfo hostInfo;
+
+    publisher.AddHostSubscriptionCallback(
+        "host1", [&hostEvents](const std::string &aHostName, const Publisher::DiscoveredHostInfo &) {
+            hostEvents.push_back(aHostName);
+        });
+    publisher.AddServiceSubscriptionCallback(
+        "host1", [](const std::string &aType, const Publisher::DiscoveredInstanceInfo &) { FAIL() << aType; });
+
+    publisher.OnHostResolved("host2", hostInfo);
+    publisher.OnHostResolved("Host1", hostInfo);
+
+    EXPECT_EQ(hostEvents, (std::vector<std::string>{"Host1"}));
+}
+
+TEST(MdnsSubscriber, SubscribersChangedInCallbackAreHandledSafely)
+{
+    FakePublisher         publisher;
+    std::vector<uint64_t> invoked;
+    uint64_t              ids[4];
+    uint64_t              lateId = 0;
+
+    ids[0] = publisher.AddServiceSubscriptionCallback(
+        "_srv._udp", [&](const std::string &, const Publisher::DiscoveredInstanceInfo &) {
+            invoked.push_back(ids[0]);
+            if (lateId == 0)
+            {
+                // Removes a subscriber which hasn't been invoked yet, and adds a new one.
+                publisher.RemoveSubscriptionCallbacks(ids[2]);
+                lateId = publisher.AddServiceSubscriptionCallback(
+                    "_srv._udp", [&](const std::string &, const Publisher::DiscoveredInstanceInfo &) {
+                        invoked.push_back(lateId);
+                    });
+            }
+        });
+    for (int i = 1; i < 4; i++)
+    {
+        ids[i] = publisher.AddSubscriptionCallbacks(
+            [&invoked, &ids, i](const std::string &, const Publisher::DiscoveredInstanceInfo &) {
+                invoked.push_back(ids[i]);
+            },
+            nullptr);
+    }
+
+    publisher.OnServiceResolved("_srv._udp", MakeInstanceInfo("first"));
+    EXPECT_EQ(invoked, (std::vector<uint64_t>{ids[0], ids[1], ids[3]}));
+
+    invoked.clear();
+    publisher.OnServiceResolved("_srv._udp", MakeInstanceInfo("second"));
+    EXPECT_EQ(invoked, (std::vector<uint64_t>{ids[0], ids[1], ids[3], lateId}));
+}
+
+TEST(MdnsSubscriber, BenchmarkDispatchWithManySubscribers)
+{
+    constexpr uint32_t kNumSubscribers = 100;
+    constexpr uint32_t kNumEvents      = 10000;
+
+    std::vector<std::string> types;
+    std::vector<uint32_t>    counts(kNumSubscribers);
+    otbrLogLevel             logLevel = otbrLogGetLevel();
+
+    // Keep the per-event logs out of the measurement.
+    otbrLogSetLevel(OTBR_LOG_WARNING);
+
+    for (uint32_t i = 0; i < kNumSubscribers; i++)
+    {
+        types.push_back("_srv" + std::to_string(i) + "._udp");
+    }
+
+    auto run = [&](bool aKeyed) {
+        FakePublisher                     publisher;
+        Publisher::DiscoveredInstanceInfo instanceInfo = MakeInstanceInfo("instance");
+        auto                              start        = std::chrono::steady_clock::now();
+
+        std::fill(counts.begin(), counts.end(), 0);
+
+        for (uint32_t i = 0; i < kNumSubscribers; i++)
+        {
+            auto callback = [&counts, &types, i](const std::string &aType, const Publisher::DiscoveredInstanceInfo &) {
+                // Subscribers for all types filter on their own, as they did before the index.
+                if (aType == types[i])
+                {
+                    counts[i]++;
+                }
+            };
+
+            if (aKeyed)
+            {
+                publisher.AddServiceSubscriptionCallback(types[i], callback);
+            }
+            else
+            {
+                publisher.AddSubscriptionCallbacks(callback, nullptr);
+            }
+        }
+
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < kNumEvents; i++)
+        {
+            publisher.OnServiceResolved(types[i % kNumSubscribers], instanceInfo);
+        }
+
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    double allDuration   = run(/* aKeyed */ false);
+    double keyedDuration = run(/* aKeyed */ true);
+
+    otbrLogSetLevel(logLevel);
+
+    for (uint32_t count : counts)
+    {
+        EXPECT_EQ(count, kNumEvents / kNumSubscribers);
+    }
+
+    printf("%u events to %u subscribers: all types %.0f events/s, by type %.0f events/s\n", kNumEvents,
+           kNumSubscribers, kNumEvents / allDuration * 1e6, kNumEvents / keyedDuration * 1e6);
+}
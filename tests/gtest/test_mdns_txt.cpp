@@ -0,0 +1,182 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "mdns/mdns.hpp"
+
+using otbr::Mdns::Publisher;
+
+static std::string KeyOf(const Publisher::TxtEntryView &aEntry)
+{
+    return std::string(aEntry.mKey, aEntry.mKeyLength);
+}
+
+static std::string ValueOf(const Publisher::TxtEntryView &aEntry)
+{
+    return std::string(reinterpret_cast<const char *>(aEntry.mValue), aEntry.mValueLength);
+}
+
+TEST(MdnsTxt, IteratesEntriesInPlace)
+{
+    const uint8_t           txtData[] = {5, 'k', '1', '=', 'v', '1', 0, 2, 'b', '1', 1, '=', 3, 'k', '2', '='};
+    Publisher::TxtIterator  iterator(txtData, sizeof(txtData));
+    Publisher::TxtEntryView entry;
+
+    ASSERT_EQ(iterator.GetNextEntry(entry), OTBR_ERROR_NONE);
+    EXPECT_EQ(KeyOf(entry), "k1");
+    EXPECT_EQ(ValueOf(entry), "v1");
+    EXPECT_FALSE(entry.mIsBooleanAttribute);
+    EXPECT_EQ(entry.GetEntryLength(), 5);
+    EXPECT_EQ(reinterpret_cast<const uint8_t *>(entry.mKey), &txtData[1]);
+
+    // The empty entry is skipped.
+    ASSERT_EQ(iterator.GetNextEntry(entry), OTBR_ERROR_NONE);
+    EXPECT_EQ(KeyOf(entry), "b1");
+    EXPECT_TRUE(entry.mIsBooleanAttribute);
+    EXPECT_EQ(entry.mValue, nullptr);
+    EXPECT_EQ(entry.GetEntryLength(), 2);
+
+    ASSERT_EQ(iterator.GetNextEntry(entry), OTBR_ERROR_NONE);
+    EXPECT_EQ(KeyOf(entry), "");
+    EXPECT_EQ(ValueOf(entry), "");
+    EXPECT_FALSE(entry.mIsBooleanAttribute);
+
+    ASSERT_EQ(iterator.GetNextEntry(entry), OTBR_ERROR_NONE);
+    EXPECT_EQ(KeyOf(entry), "k2");
+    EXPECT_EQ(ValueOf(entry), "");
+    EXPECT_FALSE(entry.mIsBooleanAttribute);
+
+    EXPECT_EQ(iterator.GetNextEntry(entry), OTBR_ERROR_NOT_FOUND);
+    EXPECT_EQ(iterator.GetNextEntry(entry), OTBR_ERROR_NOT_FOUND);
+}
+
+TEST(MdnsTxt, RejectsTruncatedEntry)
+{
+    const uint8_t           txtData[] = {2, 'b', '1', 4, 'k', '='};
+    Publisher::TxtIterator  iterator(txtData, sizeof(txtData));
+    Publisher::TxtEntryView entry;
+    Publisher::TxtList      txtList;
+
+    ASSERT_EQ(iterator.GetNextEntry(entry), OTBR_ERROR_NONE);
+    EXPECT_EQ(iterator.GetNextEntry(entry), OTBR_ERROR_PARSE);
+    EXPECT_EQ(iterator.GetNextEntry(entry), OTBR_ERROR_NOT_FOUND);
+
+    EXPECT_EQ(Publisher::DecodeTxtData(txtList, txtData, sizeof(txtData)), OTBR_ERROR_PARSE);
+    EXPECT_EQ(Publisher::FindTxtEntry(txtData, sizeof(txtData), "k", entry), OTBR_ERROR_PARSE);
+}
+
+TEST(MdnsTxt, FindsEntryByKeyCaseInsensitively)
+{
+    Publisher::TxtList      txtList{{"vn", "vendor"}, {"b1"}, {"XA", "\x01\x02"}};
+    Publisher::TxtData      txtData;
+    Publisher::TxtEntryView entry;
+
+    ASSERT_EQ(Publisher::EncodeTxtData(txtList, txtData), OTBR_ERROR_NONE);
+
+    ASSERT_EQ(Publisher::FindTxtEntry(txtData.data(), txtData.size(), "xa", entry), OTBR_ERROR_NONE);
+    EXPECT_EQ(ValueOf(entry), "\x01\x02");
+    ASSERT_EQ(Publisher::FindTxtEntry(txtData.data(), txtData.size(), "B1", entry), OTBR_ERROR_NONE);
+    EXPECT_TRUE(entry.mIsBooleanAttribute);
+    EXPECT_EQ(Publisher::FindTxtEntry(txtData.data(), txtData.size(), "v", entry), OTBR_ERROR_NOT_FOUND);
+    EXPECT_EQ(Publisher::FindTxtEntry(txtData.data(), txtData.size(), "vnx", entry), OTBR_ERROR_NOT_FOUND);
+}
+
+TEST(MdnsTxt, EncodesIntoCallerBuffer)
+{
+    Publisher::TxtList txtList{{"k1", "v1"}, {"b1"}};
+    Publisher::TxtData txtData;
+    uint8_t            buffer[32];
+    size_t             txtLength;
+
+    ASSERT_EQ(Publisher::EncodeTxtData(txtList, txtData), OTBR_ERROR_NONE);
+    ASSERT_EQ(Publisher::EncodeTxtData(txtList, buffer, sizeof(buffer), txtLength), OTBR_ERROR_NONE);
+    ASSERT_EQ(txtLength, txtData.size());
+    EXPECT_EQ(memcmp(buffer, txtData.data(), txtLength), 0);
+
+    EXPECT_EQ(Publisher::EncodeTxtData(txtList, buffer, txtLength - 1, txtLength), OTBR_ERROR_INVALID_ARGS);
+
+    // An empty list is encoded as a single empty entry.
+    txtList.clear();
+    ASSERT_EQ(Publisher::EncodeTxtData(txtList, buffer, sizeof(buffer), txtLength), OTBR_ERROR_NONE);
+    ASSERT_EQ(txtLength, 1u);
+    EXPECT_EQ(buffer[0], 0);
+    EXPECT_EQ(Publisher::EncodeTxtData(txtList, buffer, 0, txtLength), OTBR_ERROR_INVALID_ARGS);
+
+    txtList.emplace_back(std::string(255, 'k').c_str());
+    ASSERT_EQ(Publisher::EncodeTxtData(txtList, txtData), OTBR_ERROR_NONE);
+    txtList.emplace_back(std::string(256, 'k').c_str());
+    EXPECT_EQ(Publisher::EncodeTxtData(txtList, txtData), OTBR_ERROR_INVALID_ARGS);
+}
+
+TEST(MdnsTxt, BenchmarkDecodeVersusFind)
+{
+    constexpr int      kNumRounds = 100000;
+    Publisher::TxtList txtList{{"rv", "1"}, {"tv", "1.4.0"}, {"sb", "\x01\x02\x03\x31"}, {"nn", "OpenThread"},
+                               {"xp", "\xde\xad\x01\xbe\xef\x02\xca\xfe"}, {"dn", "DefaultDomain"},
+                               {"xa", "\x11\x22\x33\x44\x55\x66\x77\x88"}};
+    Publisher::TxtData txtData;
+    size_t             found = 0;
+
+    ASSERT_EQ(Publisher::EncodeTxtData(txtList, txtData), OTBR_ERROR_NONE);
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < kNumRounds; i++)
+    {
+        Publisher::TxtList decoded;
+
+        ASSERT_EQ(Publisher::DecodeTxtData(decoded, txtData.data(), txtData.size()), OTBR_ERROR_NONE);
+        found += decoded.size();
+    }
+
+    auto decodeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < kNumRounds; i++)
+    {
+        Publisher::TxtEntryView entry;
+
+        ASSERT_EQ(Publisher::FindTxtEntry(txtData.data(), txtData.size(), "xa", entry), OTBR_ERROR_NONE);
+        found += entry.mValueLength;
+    }
+
+    auto findNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    EXPECT_EQ(found, kNumRounds * (txtList.size() + 8));
+    printf("TXT lookup of the last entry: decode %lld ns, find %lld ns\n",
+           static_cast<long long>(decodeNs.count() / kNumRounds), static_cast<long long>(findNs.count() / kNumRounds));
+}
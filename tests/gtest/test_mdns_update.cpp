@@ -0,0 +1,269 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <sys/select.h>
+
+#include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/mainloop_manager.hpp"
+#include "common/types.hpp"
+#include "mdns/mdns.hpp"
+
+using otbr::Ip6Address;
+using otbr::MainloopContext;
+using otbr::MainloopManager;
+using otbr::Milliseconds;
+using otbr::Mdns::Publisher;
+
+class FakeUpdatePublisher : public Publisher
+{
+public:
+    class FakeServiceRegistration : public ServiceRegistration
+    {
+    public:
+        using ServiceRegistration::ServiceRegistration;
+
+        otbrError UpdateTxtData(const TxtData &aTxtData) override
+        {
+            ++static_cast<FakeUpdatePublisher *>(mPublisher)->mTxtUpdateCount;
+            mTxtData = aTxtData;
+            return OTBR_ERROR_NONE;
+        }
+    };
+
+    class FakeHostRegistration : public HostRegistration
+    {
+    public:
+        using HostRegistration::HostRegistration;
+
+        otbrError UpdateAddresses(const AddressList &aAddresses) override
+        {
+            ++static_cast<FakeUpdatePublisher *>(mPublisher)->mAddressUpdateCount;
+            mAddresses = aAddresses;
+            return OTBR_ERROR_NONE;
+        }
+    };
+
+    void UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) override
+    {
+        CancelPendingServiceUpdate(aName, aType);
+        RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
+        std::move(aCallback)(OTBR_ERROR_NONE);
+    }
+    void UnpublishHost(const std::string &, ResultCallback &&) override {}
+    void UnpublishKey(const std::string &, ResultCallback &&) override {}
+    void SubscribeService(const std::string &, const std::string &) override {}
+    void UnsubscribeService(const std::string &, const std::string &) override {}
+    void SubscribeHost(const std::string &) override {}
+    void UnsubscribeHost(const std::string &) override {}
+
+    otbrError Start(void) override { return OTBR_ERROR_NONE; }
+    void      Stop(void) override { CancelPendingUpdates(); }
+    bool      IsStarted(void) const override { return true; }
+
+    // Pretends that all registrations were made long enough ago to not be debounced.
+    void AgeRegistrations(void)
+    {
+        for (auto &kv : mServiceRegistrations)
+        {
+            kv.second->mUpdateTime -= kUpdateDebounceInterval;
+        }
+        for (auto &kv : mHostRegistrations)
+        {
+            kv.second->mUpdateTime -= kUpdateDebounceInterval;
+        }
+    }
+
+    void RunTasks(Milliseconds aDuration)
+    {
+        otbr::Timepoint deadline = otbr::Clock::now() + aDuration;
+
+        while (otbr::Clock::now() < deadline)
+        {
+            MainloopContext mainloop;
+
+            mainloop.mMaxFd   = -1;
+            mainloop.mTimeout = {0, 10000};
+            FD_ZERO(&mainloop.mReadFdSet);
+            FD_ZERO(&mainloop.mWriteFdSet);
+            FD_ZERO(&mainloop.mErrorFdSet);
+
+            MainloopManager::GetInstance().Update(mainloop);
+            select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                   &mainloop.mTimeout);
+            MainloopManager::GetInstance().Process(mainloop);
+        }
+    }
+
+    const ServiceRegistration *GetServiceRegistration(const std::string &aName, const std::string &aType)
+    {
+        return FindServiceRegistration(aName, aType);
+    }
+
+    const HostRegistration *GetHostRegistration(const std::string &aName) { return FindHostRegistration(aName); }
+
+    int mServiceRegistrationCount = 0;
+    int mHostRegistrationCount    = 0;
+    int mTxtUpdateCount           = 0;
+    int mAddressUpdateCount       = 0;
+
+protected:
+    otbrError PublishServiceImpl(const std::string &aHostName,
+                                 const std::string &aName,
+                                 const std::string &aType,
+                                 const SubTypeList &aSubTypeList,
+                                 uint16_t           aPort,
+                                 const TxtData     &aTxtData,
+                                 ResultCallback   &&aCallback) override
+    {
+        SubTypeList sortedSubTypeList = SortSubTypeList(aSubTypeList);
+
+        aCallback = HandleDuplicateServiceRegistration(aHostName, aName, aType, sortedSubTypeList, aPort, aTxtData,
+                                                       std::move(aCallback));
+        VerifyOrExit(!aCallback.IsNull());
+
+        ++mServiceRegistrationCount;
+        AddServiceRegistration(std::make_shared<FakeServiceRegistration>(
+            aHostName, aName, aType, sortedSubTypeList, aPort, aTxtData, std::move(aCallback), this));
+        FindServiceRegistration(aName, aType)->Complete(OTBR_ERROR_NONE);
+
+    exit:
+        return OTBR_ERROR_NONE;
+    }
+    otbrError PublishHostImpl(const std::string &aName,
+                              const AddressList &aAddresses,
+                              ResultCallback   &&aCallback) override
+    {
+        aCallback = HandleDuplicateHostRegistration(aName, aAddresses, std::move(aCallback));
+        VerifyOrExit(!aCallback.IsNull());
+
+        ++mHostRegistrationCount;
+        AddHostRegistration(std::make_shared<FakeHostRegistration>(aName, aAddresses, std::move(aCallback), this));
+        FindHostRegistration(aName)->Complete(OTBR_ERROR_NONE);
+
+    exit:
+        return OTBR_ERROR_NONE;
+    }
+    otbrError PublishKeyImpl(const std::string &, const KeyData &, ResultCallback &&) override
+    {
+        return OTBR_ERROR_NONE;
+    }
+    void      OnServiceResolveFailedImpl(const std::string &, const std::string &, int32_t) override {}
+    void      OnHostResolveFailedImpl(const std::string &, int32_t) override {}
+    otbrError DnsErrorToOtbrError(int32_t) override { return OTBR_ERROR_NONE; }
+};
+
+static Publisher::ResultCallback RecordResult(std::vector<otbrError> &aResults)
+{
+    return [&aResults](otbrError aError) { aResults.push_back(aError); };
+}
+
+TEST(MdnsUpdate, TxtDataChangeIsUpdatedInPlace)
+{
+    FakeUpdatePublisher    publisher;
+    std::vector<otbrError> results;
+
+    publisher.PublishService("host", "svc", "_test._udp", {}, 1234, {1, 'a'}, RecordResult(results));
+    publisher.AgeRegistrations();
+    publisher.PublishService("host", "svc", "_test._udp", {}, 1234, {1, 'b'}, RecordResult(results));
+
+    EXPECT_EQ(results, (std::vector<otbrError>{OTBR_ERROR_NONE, OTBR_ERROR_NONE}));
+    EXPECT_EQ(publisher.mServiceRegistrationCount, 1);
+    EXPECT_EQ(publisher.mTxtUpdateCount, 1);
+    EXPECT_EQ(publisher.GetServiceRegistration("svc", "_test._udp")->mTxtData, (Publisher::TxtData{1, 'b'}));
+}
+
+TEST(MdnsUpdate, PortChangeReregistersService)
+{
+    FakeUpdatePublisher    publisher;
+    std::vector<otbrError> results;
+
+    publisher.PublishService("host", "svc", "_test._udp", {}, 1234, {1, 'a'}, RecordResult(results));
+    publisher.AgeRegistrations();
+    publisher.PublishService("host", "svc", "_test._udp", {}, 4321, {1, 'b'}, RecordResult(results));
+
+    EXPECT_EQ(results, (std::vector<otbrError>{OTBR_ERROR_NONE, OTBR_ERROR_NONE}));
+    EXPECT_EQ(publisher.mServiceRegistrationCount, 2);
+    EXPECT_EQ(publisher.mTxtUpdateCount, 0);
+}
+
+TEST(MdnsUpdate, HostAddressChangeIsUpdatedInPlace)
+{
+    FakeUpdatePublisher    publisher;
+    std::vector<otbrError> results;
+
+    publisher.PublishHost("host", {Ip6Address("fd00::1")}, RecordResult(results));
+    publisher.AgeRegistrations();
+    publisher.PublishHost("host", {Ip6Address("fd00::2"), Ip6Address("fd00::1")}, RecordResult(results));
+
+    EXPECT_EQ(results, (std::vector<otbrError>{OTBR_ERROR_NONE, OTBR_ERROR_NONE}));
+    EXPECT_EQ(publisher.mHostRegistrationCount, 1);
+    EXPECT_EQ(publisher.mAddressUpdateCount, 1);
+    EXPECT_EQ(publisher.GetHostRegistration("host")->mAddresses.size(), 2u);
+}
+
+TEST(MdnsUpdate, RapidUpdatesAreCoalesced)
+{
+    FakeUpdatePublisher    publisher;
+    std::vector<otbrError> results;
+
+    publisher.PublishService("host", "svc", "_test._udp", {}, 1000, {1, 'a'}, RecordResult(results));
+    publisher.PublishService("host", "svc", "_test._udp", {}, 1001, {1, 'a'}, RecordResult(results));
+    publisher.PublishService("host", "svc", "_test._udp", {}, 1002, {1, 'a'}, RecordResult(results));
+    publisher.PublishService("host", "svc", "_test._udp", {}, 1003, {1, 'b'}, RecordResult(results));
+
+    EXPECT_EQ(results.size(), 1u);
+    EXPECT_EQ(publisher.mServiceRegistrationCount, 1);
+
+    publisher.RunTasks(Milliseconds(OTBR_CONFIG_MDNS_UPDATE_DEBOUNCE_INTERVAL + 100));
+
+    EXPECT_EQ(results, (std::vector<otbrError>(4, OTBR_ERROR_NONE)));
+    EXPECT_EQ(publisher.mServiceRegistrationCount, 2);
+    EXPECT_EQ(publisher.GetServiceRegistration("svc", "_test._udp")->mPort, 1003);
+    EXPECT_EQ(publisher.GetServiceRegistration("svc", "_test._udp")->mTxtData, (Publisher::TxtData{1, 'b'}));
+}
+
+TEST(MdnsUpdate, UnpublishAbortsDeferredUpdate)
+{
+    FakeUpdatePublisher    publisher;
+    std::vector<otbrError> results;
+
+    publisher.PublishService("host", "svc", "_test._udp", {}, 1000, {}, RecordResult(results));
+    publisher.PublishService("host", "svc", "_test._udp", {}, 1001, {}, RecordResult(results));
+    publisher.UnpublishService("svc", "_test._udp", RecordResult(results));
+    publisher.RunTasks(Milliseconds(OTBR_CONFIG_MDNS_UPDATE_DEBOUNCE_INTERVAL + 100));
+
+    EXPECT_EQ(results, (std::vector<otbrError>{OTBR_ERROR_NONE, OTBR_ERROR_ABORTED, OTBR_ERROR_NONE}));
+    EXPECT_EQ(publisher.mServiceRegistrationCount, 1);
+    EXPECT_EQ(publisher.GetServiceRegistration("svc", "_test._udp"), nullptr);
+}
@@ -650,6 +650,133 @@ TEST(Netif, WpanIfSendIp6PacketCorrectly_AfterReceivingOnIf)
     netif.Deinit();
 }
 
+class NetifDependencyTestIp6SendCount : public otbr::Netif::Dependencies
+{
+public:
+    explicit NetifDependencyTestIp6SendCount(bool aProvideSendBuffer = false)
+        : mProvideSendBuffer(aProvideSendBuffer)
+    {
+    }
+
+    uint8_t *Ip6GetSendBuffer(uint16_t &aCapacity) override
+    {
+        aCapacity = mProvideSendBuffer ? sizeof(mSendBuffer) : 0;
+
+        return mProvideSendBuffer ? mSendBuffer : nullptr;
+    }
+
+    otbrError Ip6Send(const uint8_t *aData, uint16_t aLength) override
+    {
+        const ip6_hdr *ipv6_header = reinterpret_cast<const ip6_hdr *>(aData);
+
+        OTBR_UNUSED_VARIABLE(aLength);
+
+        if (ipv6_header->ip6_nxt == IPPROTO_UDP)
+        {
+            mUdpPacketCount++;
+            mInPlaceCount += (aData == mSendBuffer);
+        }
+
+        return OTBR_ERROR_NONE;
+    }
+
+    bool     mProvideSendBuffer;
+    uint8_t  mSendBuffer[1280];
+    uint32_t mUdpPacketCount = 0;
+    uint32_t mInPlaceCount   = 0;
+};
+
+static void SendUdpBurstAndProcess(otbr::Netif &aNetif, NetifDependencyTestIp6SendCount &aDependency, uint32_t aCount)
+{
+    const char *hello = "Hello Otbr Netif!";
+
+    // OMR Prefix: fd76:a5d1:fcb0:1707::/64
+    const otIp6Address kOmr = {
+        {0xfd, 0x76, 0xa5, 0xd1, 0xfc, 0xb0, 0x17, 0x07, 0xf3, 0xc7, 0xd8, 0x8c, 0xef, 0xd1, 0x24, 0xa9}};
+    std::vector<otbr::Ip6AddressInfo> addrs = {
+        {kOmr, 64, 0, 1, 0},
+    };
+    aNetif.UpdateIp6UnicastAddresses(addrs);
+    aNetif.SetNetifState(true);
+
+    // Queue a burst of UDP packets on the TUN device before running the mainloop.
+    {
+        int                 sockFd;
+        const uint16_t      destPort = 12345;
+        struct sockaddr_in6 destAddr;
+        const char         *destIp = "fd76:a5d1:fcb0:1707:3f1:47ce:85d3:77f";
+
+        sockFd = socket(AF_INET6, SOCK_DGRAM, 0);
+        ASSERT_GE(sockFd, 0) << "socket creation failed";
+
+        memset(&destAddr, 0, sizeof(destAddr));
+        destAddr.sin6_family = AF_INET6;
+        destAddr.sin6_port   = htons(destPort);
+        inet_pton(AF_INET6, destIp, &(destAddr.sin6_addr));
+
+        for (uint32_t i = 0; i < aCount; i++)
+        {
+            ASSERT_GE(sendto(sockFd, hello, strlen(hello), 0, (const struct sockaddr *)&destAddr, sizeof(destAddr)),
+                      0)
+                << "Failed to send UDP packet through WPAN interface";
+        }
+        close(sockFd);
+    }
+
+    otbr::MainloopContext context;
+    while (aDependency.mUdpPacketCount < aCount)
+    {
+        context.mMaxFd   = -1;
+        context.mTimeout = {100, 0};
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+
+        otbr::MainloopManager::GetInstance().Update(context);
+        int rval = select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+                          &context.mTimeout);
+        ASSERT_GE(rval, 0) << "select failed";
+        otbr::MainloopManager::GetInstance().Process(context);
+    }
+}
+
+TEST(Netif, WpanIfDrainsBurstOfIp6PacketsInBatches)
+{
+    static constexpr uint32_t       kBurstSize = 3 * OTBR_CONFIG_NETIF_MAX_PACKETS_PER_WAKEUP;
+    NetifDependencyTestIp6SendCount netifDependency;
+
+    otbr::Netif netif("wpan0", netifDependency);
+    EXPECT_EQ(netif.Init(), OT_ERROR_NONE);
+
+    SendUdpBurstAndProcess(netif, netifDependency, kBurstSize);
+
+    const otbr::Netif::TunCounters &counters = netif.GetTunCounters();
+
+    EXPECT_EQ(netifDependency.mInPlaceCount, 0u);
+    EXPECT_GE(counters.mPacketsRead, kBurstSize);
+    EXPECT_LT(counters.mReadWakeups, counters.mPacketsRead);
+    EXPECT_EQ(counters.mMaxPacketsPerWakeup, OTBR_CONFIG_NETIF_MAX_PACKETS_PER_WAKEUP);
+    EXPECT_GT(counters.mFullBatches, 0u);
+
+    netif.Deinit();
+}
+
+TEST(Netif, WpanIfReadsIp6PacketsIntoDependencySendBuffer)
+{
+    static constexpr uint32_t       kBurstSize = 2 * OTBR_CONFIG_NETIF_MAX_PACKETS_PER_WAKEUP;
+    NetifDependencyTestIp6SendCount netifDependency(/* aProvideSendBuffer */ true);
+
+    otbr::Netif netif("wpan0", netifDependency);
+    EXPECT_EQ(netif.Init(), OT_ERROR_NONE);
+
+    SendUdpBurstAndProcess(netif, netifDependency, kBurstSize);
+
+    EXPECT_EQ(netifDependency.mInPlaceCount, netifDependency.mUdpPacketCount);
+    EXPECT_GE(netif.GetTunCounters().mPacketsRead, kBurstSize);
+
+    netif.Deinit();
+}
+
 class NetifDependencyTestMulSub : public otbr::Netif::Dependencies
 {
 public:
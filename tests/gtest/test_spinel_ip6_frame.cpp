@@ -0,0 +1,266 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <vector>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "lib/spinel/spinel.h"
+#include "lib/spinel/spinel_buffer.hpp"
+#include "lib/spinel/spinel_encoder.hpp"
+
+#include "common/code_utils.hpp"
+#include "host/spinel_ip6_frame.hpp"
+
+using otbr::Host::SpinelIp6Frame;
+
+namespace {
+
+constexpr uint8_t  kSpinelHeader = SPINEL_HEADER_FLAG | SPINEL_HEADER_IID(0) | 1;
+constexpr uint16_t kPacketLength = SpinelIp6Frame::kMaxPayloadLength;
+
+/**
+ * A fake spinel driver which only accounts for the frames that would be sent to the NCP.
+ */
+class FakeSpinelDriver
+{
+public:
+    otError SendFrame(const uint8_t *aFrame, uint16_t aLength)
+    {
+        mFrameCount++;
+        mByteCount += aLength;
+        mChecksum += aFrame[aLength - 1];
+
+        return OT_ERROR_NONE;
+    }
+
+    uint32_t mFrameCount = 0;
+    uint64_t mByteCount  = 0;
+    uint32_t mChecksum   = 0;
+};
+
+/**
+ * Builds the frame the way `NcpSpinel` did before `SpinelIp6Frame`: encode into a spinel buffer, then read it out.
+ */
+class EncoderIp6Sender
+{
+public:
+    EncoderIp6Sender(void)
+        : mNcpBuffer(mTxBuffer, sizeof(mTxBuffer))
+        , mEncoder(mNcpBuffer)
+    {
+    }
+
+    otError Send(const uint8_t *aData, uint16_t aLength, FakeSpinelDriver &aDriver)
+    {
+        otError  error = OT_ERROR_NONE;
+        uint8_t  frame[sizeof(mTxBuffer)];
+        uint16_t frameLength;
+
+        SuccessOrExit(error = mEncoder.BeginFrame(kSpinelHeader, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_STREAM_NET));
+        SuccessOrExit(error = mEncoder.WriteDataWithLen(aData, aLength));
+        SuccessOrExit(error = mEncoder.EndFrame());
+
+        SuccessOrExit(error = mNcpBuffer.OutFrameBegin());
+        frameLength = mNcpBuffer.OutFrameGetLength();
+        VerifyOrExit(mNcpBuffer.OutFrameRead(frameLength, frame) == frameLength, error = OT_ERROR_FAILED);
+        error = aDriver.SendFrame(frame, frameLength);
+
+    exit:
+        mNcpBuffer.OutFrameRemove();
+        return error;
+    }
+
+private:
+    uint8_t             mTxBuffer[2048];
+    ot::Spinel::Buffer  mNcpBuffer;
+    ot::Spinel::Encoder mEncoder;
+};
+
+void FillPacket(uint8_t *aPacket, uint16_t aLength)
+{
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aPacket[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+}
+
+} // namespace
+
+TEST(SpinelIp6Frame, FinalizeMatchesSpinelEncoder)
+{
+    static constexpr uint16_t kLengths[] = {0, 1, 40, 127, 128, 1279, kPacketLength};
+
+    for (uint16_t length : kLengths)
+    {
+        SpinelIp6Frame   frame;
+        EncoderIp6Sender encoderSender;
+        FakeSpinelDriver driver;
+        uint8_t          packet[kPacketLength];
+        const uint8_t   *frameData;
+        uint16_t         frameLength;
+        uint8_t          expected[2048];
+        uint16_t         expectedLength;
+
+        FillPacket(packet, length);
+
+        // Capture the frame produced by the spinel encoder.
+        {
+            uint8_t             txBuffer[2048];
+            ot::Spinel::Buffer  ncpBuffer(txBuffer, sizeof(txBuffer));
+            ot::Spinel::Encoder encoder(ncpBuffer);
+
+            ASSERT_EQ(encoder.BeginFrame(kSpinelHeader, SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_STREAM_NET),
+                      OT_ERROR_NONE);
+            ASSERT_EQ(encoder.WriteDataWithLen(packet, length), OT_ERROR_NONE);
+            ASSERT_EQ(encoder.EndFrame(), OT_ERROR_NONE);
+            ASSERT_EQ(ncpBuffer.OutFrameBegin(), OT_ERROR_NONE);
+            expectedLength = ncpBuffer.OutFrameGetLength();
+            ASSERT_EQ(ncpBuffer.OutFrameRead(expectedLength, expected), expectedLength);
+        }
+
+        ASSERT_EQ(frame.SetPayload(packet, length), OT_ERROR_NONE);
+        ASSERT_EQ(frame.Finalize(kSpinelHeader, length, frameData, frameLength), OT_ERROR_NONE);
+
+        ASSERT_EQ(frameLength, expectedLength);
+        EXPECT_EQ(memcmp(frameData, expected, frameLength), 0);
+        EXPECT_EQ(encoderSender.Send(packet, length, driver), OT_ERROR_NONE);
+    }
+}
+
+TEST(SpinelIp6Frame, SetPayloadSkipsCopyWhenInPlace)
+{
+    SpinelIp6Frame frame;
+    uint8_t        packet[kPacketLength];
+    const uint8_t *frameData;
+    uint16_t       frameLength;
+
+    FillPacket(frame.GetPayload(), 100);
+    EXPECT_TRUE(frame.IsPayload(frame.GetPayload()));
+    EXPECT_EQ(frame.SetPayload(frame.GetPayload(), 100), OT_ERROR_NONE);
+    ASSERT_EQ(frame.Finalize(kSpinelHeader, 100, frameData, frameLength), OT_ERROR_NONE);
+    EXPECT_EQ(frameData + frameLength, frame.GetPayload() + 100);
+
+    FillPacket(packet, sizeof(packet));
+    EXPECT_FALSE(frame.IsPayload(packet));
+    EXPECT_EQ(frame.SetPayload(packet, sizeof(packet)), OT_ERROR_NONE);
+    EXPECT_EQ(memcmp(frame.GetPayload(), packet, sizeof(packet)), 0);
+
+    EXPECT_EQ(frame.SetPayload(packet, kPacketLength + 1), OT_ERROR_INVALID_ARGS);
+    EXPECT_EQ(frame.Finalize(kSpinelHeader, kPacketLength + 1, frameData, frameLength), OT_ERROR_INVALID_ARGS);
+}
+
+/**
+ * Sends `aCount` packets through a datagram socket pair standing in for the TUN device, and
+ * returns how long it takes to hand all of them to the fake spinel driver.
+ */
+template <typename SendFunc>
+static std::chrono::nanoseconds BenchmarkIp6Send(uint32_t aCount, FakeSpinelDriver &aDriver, SendFunc &&aSend)
+{
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr uint32_t kBurst = 16;
+
+    int                      fds[2];
+    uint8_t                  packet[kPacketLength];
+    Clock::time_point        start;
+    std::chrono::nanoseconds elapsed{0};
+
+    EXPECT_EQ(socketpair(AF_UNIX, SOCK_SEQPACKET, 0, fds), 0);
+    EXPECT_EQ(fcntl(fds[1], F_SETFL, O_NONBLOCK), 0);
+    FillPacket(packet, sizeof(packet));
+
+    for (uint32_t sent = 0; sent < aCount; sent += kBurst)
+    {
+        for (uint32_t i = 0; i < kBurst; i++)
+        {
+            EXPECT_EQ(write(fds[0], packet, sizeof(packet)), static_cast<ssize_t>(sizeof(packet)));
+        }
+
+        start = Clock::now();
+        for (uint32_t i = 0; i < kBurst; i++)
+        {
+            EXPECT_EQ(aSend(fds[1], aDriver), OT_ERROR_NONE);
+        }
+        elapsed += Clock::now() - start;
+    }
+
+    close(fds[0]);
+    close(fds[1]);
+
+    return elapsed;
+}
+
+TEST(SpinelIp6Frame, BenchmarkEncoderVsInPlace)
+{
+    static constexpr uint32_t kNumPackets = 50000;
+
+    EncoderIp6Sender encoderSender;
+    SpinelIp6Frame   frame;
+    FakeSpinelDriver encoderDriver;
+    FakeSpinelDriver inPlaceDriver;
+
+    auto encoderDuration =
+        BenchmarkIp6Send(kNumPackets, encoderDriver, [&encoderSender](int aFd, FakeSpinelDriver &aDriver) {
+            uint8_t packet[kPacketLength];
+            ssize_t rval = read(aFd, packet, sizeof(packet));
+
+            return rval > 0 ? encoderSender.Send(packet, static_cast<uint16_t>(rval), aDriver) : OT_ERROR_FAILED;
+        });
+
+    auto inPlaceDuration = BenchmarkIp6Send(kNumPackets, inPlaceDriver, [&frame](int aFd, FakeSpinelDriver &aDriver) {
+        otError        error = OT_ERROR_FAILED;
+        ssize_t        rval  = read(aFd, frame.GetPayload(), kPacketLength);
+        const uint8_t *frameData;
+        uint16_t       frameLength;
+
+        if (rval > 0 && frame.SetPayload(frame.GetPayload(), static_cast<uint16_t>(rval)) == OT_ERROR_NONE &&
+            frame.Finalize(kSpinelHeader, static_cast<uint16_t>(rval), frameData, frameLength) == OT_ERROR_NONE)
+        {
+            error = aDriver.SendFrame(frameData, frameLength);
+        }
+
+        return error;
+    });
+
+    EXPECT_EQ(encoderDriver.mFrameCount, kNumPackets);
+    EXPECT_EQ(inPlaceDriver.mFrameCount, kNumPackets);
+    EXPECT_EQ(encoderDriver.mByteCount, inPlaceDriver.mByteCount);
+    EXPECT_EQ(encoderDriver.mChecksum, inPlaceDriver.mChecksum);
+
+    printf("%u packets of %u bytes: encoder %.1f MB/s, in place %.1f MB/s\n", kNumPackets, kPacketLength,
+           inPlaceDriver.mByteCount / std::chrono::duration<double, std::micro>(encoderDuration).count(),
+           inPlaceDriver.mByteCount / std::chrono::duration<double, std::micro>(inPlaceDuration).count());
+}
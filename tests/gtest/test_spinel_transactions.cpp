@@ -0,0 +1,215 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "lib/spinel/spinel.h"
+
+#include "host/spinel_transactions.hpp"
+
+using otbr::Host::SpinelTransactions;
+
+namespace {
+
+struct SentFrame
+{
+    spinel_tid_t         mTid;
+    std::vector<uint8_t> mPayload;
+};
+
+struct FailedCommand
+{
+    spinel_command_t  mCmd;
+    spinel_prop_key_t mKey;
+    otError           mError;
+};
+
+class SpinelTransactionsTest : public ::testing::Test
+{
+protected:
+    SpinelTransactionsTest(void)
+    {
+        mTransactions.SetSendFrameHandler([this](const uint8_t *aFrame, uint16_t aLength) {
+            otError error = mSendError;
+
+            if (error == OT_ERROR_NONE)
+            {
+                mSent.push_back({static_cast<spinel_tid_t>(aFrame[0] & SPINEL_HEADER_TID_MASK),
+                                 std::vector<uint8_t>(aFrame + 1, aFrame + aLength)});
+            }
+
+            return error;
+        });
+        mTransactions.SetFailureHandler([this](spinel_command_t aCmd, spinel_prop_key_t aKey, otError aError) {
+            mFailed.push_back({aCmd, aKey, aError});
+        });
+    }
+
+    void UseAllTids(void)
+    {
+        for (uint8_t i = 1; i < SpinelTransactions::kMaxTids; i++)
+        {
+            spinel_tid_t tid = mTransactions.AllocateTid();
+
+            ASSERT_NE(0u, tid);
+            mTransactions.HandleSent(tid, SPINEL_CMD_PROP_VALUE_GET, SPINEL_PROP_LAST_STATUS);
+        }
+    }
+
+    otError Enqueue(spinel_command_t aCmd, spinel_prop_key_t aKey, uint8_t aValue)
+    {
+        const uint8_t frame[] = {SPINEL_HEADER_FLAG, aValue};
+
+        return mTransactions.Enqueue(aCmd, aKey, frame, sizeof(frame));
+    }
+
+    SpinelTransactions         mTransactions;
+    otError                    mSendError = OT_ERROR_NONE;
+    std::vector<SentFrame>     mSent;
+    std::vector<FailedCommand> mFailed;
+};
+
+} // namespace
+
+TEST_F(SpinelTransactionsTest, AllocateTidUntilExhausted)
+{
+    UseAllTids();
+
+    EXPECT_EQ(0u, mTransactions.AllocateTid());
+    EXPECT_EQ(0u, mTransactions.AllocateTidInOrder());
+
+    mTransactions.HandleResponse(3);
+    EXPECT_EQ(3u, mTransactions.AllocateTid());
+    EXPECT_EQ(1u, mTransactions.GetMetrics().mCompleted);
+}
+
+TEST_F(SpinelTransactionsTest, QueuedCommandsAreSentInOrderWhenTidsAreReleased)
+{
+    UseAllTids();
+
+    EXPECT_EQ(OT_ERROR_NONE, Enqueue(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_NET_IF_UP, 1));
+    EXPECT_EQ(OT_ERROR_NONE, Enqueue(SPINEL_CMD_PROP_VALUE_INSERT, SPINEL_PROP_LAST_STATUS, 2));
+    EXPECT_EQ(2u, mTransactions.GetPendingCount());
+
+    // A new command must not overtake the queued ones even if a TID was free.
+    mTransactions.HandleResponse(5);
+    ASSERT_EQ(1u, mSent.size());
+    EXPECT_EQ(5u, mSent[0].mTid);
+    EXPECT_EQ(std::vector<uint8_t>{1}, mSent[0].mPayload);
+    EXPECT_EQ(SPINEL_CMD_PROP_VALUE_SET, mTransactions.GetCommand(5));
+    EXPECT_EQ(SPINEL_PROP_NET_IF_UP, mTransactions.GetKey(5));
+    EXPECT_EQ(0u, mTransactions.AllocateTidInOrder());
+
+    // Releasing a TID without a response also sends the next queued command.
+    mTransactions.Release(9);
+    ASSERT_EQ(2u, mSent.size());
+    EXPECT_EQ(9u, mSent[1].mTid);
+    EXPECT_EQ(std::vector<uint8_t>{2}, mSent[1].mPayload);
+    EXPECT_EQ(0u, mTransactions.GetPendingCount());
+    EXPECT_EQ(2u, mTransactions.GetMetrics().mQueued);
+    EXPECT_EQ(2u, mTransactions.GetMetrics().mMaxQueueDepth);
+}
+
+TEST_F(SpinelTransactionsTest, QueuedStatePropertySetsAreCoalesced)
+{
+    UseAllTids();
+
+    EXPECT_EQ(OT_ERROR_NONE, Enqueue(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_SRP_SERVER_ENABLED, 1));
+    EXPECT_EQ(OT_ERROR_NONE, Enqueue(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_SRP_SERVER_ENABLED, 0));
+    EXPECT_EQ(1u, mTransactions.GetPendingCount());
+    EXPECT_EQ(1u, mTransactions.GetMetrics().mCoalesced);
+
+    mTransactions.HandleResponse(1);
+    ASSERT_EQ(1u, mSent.size());
+    EXPECT_EQ(std::vector<uint8_t>{0}, mSent[0].mPayload);
+}
+
+TEST_F(SpinelTransactionsTest, QueueIsBounded)
+{
+    UseAllTids();
+
+    for (uint16_t i = 0; i < SpinelTransactions::kMaxPendingCommands; i++)
+    {
+        ASSERT_EQ(OT_ERROR_NONE, Enqueue(SPINEL_CMD_PROP_VALUE_INSERT, SPINEL_PROP_LAST_STATUS, 0));
+    }
+
+    EXPECT_EQ(OT_ERROR_NO_BUFS, Enqueue(SPINEL_CMD_PROP_VALUE_INSERT, SPINEL_PROP_LAST_STATUS, 0));
+    EXPECT_EQ(1u, mTransactions.GetMetrics().mDropped);
+}
+
+TEST_F(SpinelTransactionsTest, FailedQueuedCommandIsReportedAndTidReused)
+{
+    UseAllTids();
+
+    EXPECT_EQ(OT_ERROR_NONE, Enqueue(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_NET_IF_UP, 1));
+    EXPECT_EQ(OT_ERROR_NONE, Enqueue(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_INFRA_IF_STATE, 2));
+
+    mSendError = OT_ERROR_FAILED;
+    mTransactions.HandleResponse(4);
+
+    // Both commands fail, their TID is released and their requesters are completed with the error.
+    ASSERT_EQ(2u, mFailed.size());
+    EXPECT_EQ(SPINEL_PROP_NET_IF_UP, mFailed[0].mKey);
+    EXPECT_EQ(OT_ERROR_FAILED, mFailed[0].mError);
+    EXPECT_EQ(SPINEL_PROP_INFRA_IF_STATE, mFailed[1].mKey);
+    EXPECT_EQ(0u, mTransactions.GetPendingCount());
+    EXPECT_EQ(2u, mTransactions.GetMetrics().mFailed);
+    EXPECT_EQ(SPINEL_CMD_NOOP, mTransactions.GetCommand(4));
+    EXPECT_EQ(4u, mTransactions.AllocateTid());
+}
+
+TEST_F(SpinelTransactionsTest, FailureHandlerMayQueueNewCommands)
+{
+    UseAllTids();
+
+    EXPECT_EQ(OT_ERROR_NONE, Enqueue(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_NET_IF_UP, 1));
+    mTransactions.SetFailureHandler([this](spinel_command_t, spinel_prop_key_t, otError) {
+        mSendError = OT_ERROR_NONE;
+        EXPECT_EQ(OT_ERROR_NONE, Enqueue(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_DNSSD_STATE, 7));
+    });
+
+    mSendError = OT_ERROR_FAILED;
+    mTransactions.HandleResponse(2);
+
+    ASSERT_EQ(1u, mSent.size());
+    EXPECT_EQ(2u, mSent[0].mTid);
+    EXPECT_EQ(std::vector<uint8_t>{7}, mSent[0].mPayload);
+}
+
+TEST_F(SpinelTransactionsTest, ClearDropsQueuedCommandsAndReleasesTids)
+{
+    UseAllTids();
+    EXPECT_EQ(OT_ERROR_NONE, Enqueue(SPINEL_CMD_PROP_VALUE_SET, SPINEL_PROP_NET_IF_UP, 1));
+
+    mTransactions.Clear();
+
+    EXPECT_EQ(0u, mTransactions.GetPendingCount());
+    EXPECT_TRUE(mSent.empty());
+    EXPECT_NE(0u, mTransactions.AllocateTidInOrder());
+}
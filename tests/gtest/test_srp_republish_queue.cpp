@@ -0,0 +1,188 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "sdp_proxy/srp_republish_queue.hpp"
+
+using otbr::SrpRepublishQueue;
+
+namespace {
+
+char sHostStorage[4];
+
+const otSrpServerHost *GetHost(size_t aIndex)
+{
+    return reinterpret_cast<const otSrpServerHost *>(&sHostStorage[aIndex]);
+}
+
+void LookUpNoHosts(SrpRepublishQueue::HostMap &aHosts)
+{
+    OTBR_UNUSED_VARIABLE(aHosts);
+    FAIL() << "Hosts are looked up only after they were invalidated";
+}
+
+} // namespace
+
+TEST(SrpRepublishQueue, OrderKey)
+{
+    EXPECT_EQ(0u, SrpRepublishQueue::GetOrderKey(7200, 7200, false));
+    EXPECT_EQ(100u, SrpRepublishQueue::GetOrderKey(7200, 7100, false));
+    EXPECT_EQ(7200u, SrpRepublishQueue::GetOrderKey(7200, 0, false));
+
+    // A deleted host has no remaining lease but must not rank as recently renewed.
+    EXPECT_EQ(SrpRepublishQueue::kDeletedHostOrderKey, SrpRepublishQueue::GetOrderKey(7200, 0, true));
+    EXPECT_EQ(SrpRepublishQueue::kDeletedHostOrderKey, SrpRepublishQueue::GetOrderKey(0, 0, true));
+}
+
+TEST(SrpRepublishQueue, PublishesRecentlyRenewedHostsFirstAndDeletedHostsLast)
+{
+    SrpRepublishQueue                    queue(32, 128);
+    std::vector<const otSrpServerHost *> published;
+
+    queue.Add(GetHost(0), "deleted.default.service.arpa.", SrpRepublishQueue::GetOrderKey(0, 0, true));
+    queue.Add(GetHost(1), "old.default.service.arpa.", SrpRepublishQueue::GetOrderKey(7200, 100, false));
+    queue.Add(GetHost(2), "recent.default.service.arpa.", SrpRepublishQueue::GetOrderKey(7200, 7190, false));
+    queue.Add(GetHost(3), "also-old.default.service.arpa.", SrpRepublishQueue::GetOrderKey(7200, 100, false));
+    queue.Sort();
+
+    EXPECT_EQ(4u, queue.PublishBatch(
+                      [&published](const otSrpServerHost *aHost) { published.push_back(aHost); }, LookUpNoHosts));
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_EQ((std::vector<const otSrpServerHost *>{GetHost(2), GetHost(1), GetHost(3), GetHost(0)}), published);
+}
+
+TEST(SrpRepublishQueue, BatchesAreLimitedByRegistrationsAndWindow)
+{
+    SrpRepublishQueue queue(4, 8);
+    uint32_t          publishCount = 0;
+
+    // Each host issues three registrations.
+    auto publish = [&queue, &publishCount](const otSrpServerHost *) {
+        ++publishCount;
+        queue.HandleRegistration();
+        queue.HandleRegistration();
+        queue.HandleRegistration();
+    };
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        queue.Add(GetHost(i), "host" + std::to_string(i), 0);
+    }
+    queue.Sort();
+
+    // The second host exceeds the batch budget of four registrations.
+    EXPECT_EQ(2u, queue.PublishBatch(publish, LookUpNoHosts));
+    EXPECT_EQ(6u, queue.GetInFlight());
+    EXPECT_FALSE(queue.IsWindowFull());
+
+    // The window of eight registrations is full after one more host.
+    EXPECT_EQ(1u, queue.PublishBatch(publish, LookUpNoHosts));
+    EXPECT_EQ(9u, queue.GetInFlight());
+    EXPECT_TRUE(queue.IsWindowFull());
+    EXPECT_EQ(0u, queue.PublishBatch(publish, LookUpNoHosts));
+    EXPECT_EQ(3u, publishCount);
+
+    // Publishing resumes once half of the window has completed.
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        EXPECT_FALSE(queue.HandleResult());
+    }
+    EXPECT_TRUE(queue.HandleResult());
+    EXPECT_FALSE(queue.IsWindowFull());
+
+    EXPECT_EQ(1u, queue.PublishBatch(publish, LookUpNoHosts));
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_EQ(7u, queue.GetInFlight());
+}
+
+TEST(SrpRepublishQueue, HostsWithoutRegistrationsUseOneBudgetUnit)
+{
+    SrpRepublishQueue queue(2, 8);
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        queue.Add(GetHost(i), "host" + std::to_string(i), 0);
+    }
+
+    EXPECT_EQ(2u, queue.PublishBatch([](const otSrpServerHost *) {}, LookUpNoHosts));
+    EXPECT_EQ(1u, queue.PublishBatch([](const otSrpServerHost *) {}, LookUpNoHosts));
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+TEST(SrpRepublishQueue, InvalidatedHostsAreLookedUpOnceByName)
+{
+    SrpRepublishQueue                    queue(1, 8);
+    std::vector<const otSrpServerHost *> published;
+    uint32_t                             lookUpCount = 0;
+
+    auto publish = [&published](const otSrpServerHost *aHost) { published.push_back(aHost); };
+    auto lookUp  = [&lookUpCount](SrpRepublishQueue::HostMap &aHosts) {
+        // `host1` was removed and `host2` was registered again.
+        ++lookUpCount;
+        aHosts["host0"] = GetHost(0);
+        aHosts["host2"] = GetHost(3);
+    };
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        queue.Add(GetHost(i), "host" + std::to_string(i), 0);
+    }
+
+    EXPECT_EQ(1u, queue.PublishBatch(publish, lookUp));
+    EXPECT_EQ(0u, lookUpCount);
+
+    queue.InvalidateHosts();
+    EXPECT_EQ(1u, queue.PublishBatch(publish, lookUp));
+    EXPECT_EQ(1u, queue.PublishBatch(publish, lookUp));
+    EXPECT_EQ(1u, lookUpCount);
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_EQ((std::vector<const otSrpServerHost *>{GetHost(0), GetHost(3)}), published);
+}
+
+TEST(SrpRepublishQueue, ClearForgetsHostsAndRegistrations)
+{
+    SrpRepublishQueue queue(4, 2);
+
+    queue.Add(GetHost(0), "host0", 0);
+    queue.Add(GetHost(1), "host1", 0);
+    queue.HandleRegistration();
+    queue.HandleRegistration();
+    EXPECT_TRUE(queue.IsWindowFull());
+
+    queue.Clear();
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_EQ(0u, queue.GetInFlight());
+
+    // Late results of the cleared registrations are ignored.
+    EXPECT_FALSE(queue.HandleResult());
+    EXPECT_EQ(0u, queue.GetInFlight());
+}
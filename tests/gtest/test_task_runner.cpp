@@ -33,6 +33,7 @@
 #include <gtest/gtest.h>
 #include <unistd.h>
 
+#include "common/mainloop_manager.hpp"
 #include "common/task_runner.hpp"
 
 TEST(TaskRunner, TestSingleThread)
@@ -58,12 +59,12 @@ TEST(TaskRunner, TestSingleThread)
         });
     });
 
-    taskRunner.Update(mainloop);
+    otbr::MainloopManager::GetInstance().Update(mainloop);
     rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
                   &mainloop.mTimeout);
     EXPECT_EQ(1, rval);
 
-    taskRunner.Process(mainloop);
+    otbr::MainloopManager::GetInstance().Process(mainloop);
     EXPECT_EQ(3, counter);
 }
 
@@ -85,12 +86,12 @@ TEST(TaskRunner, TestTasksOrder)
     FD_ZERO(&mainloop.mWriteFdSet);
     FD_ZERO(&mainloop.mErrorFdSet);
 
-    taskRunner.Update(mainloop);
+    otbr::MainloopManager::GetInstance().Update(mainloop);
     rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
                   &mainloop.mTimeout);
     EXPECT_EQ(rval, 1);
 
-    taskRunner.Process(mainloop);
+    otbr::MainloopManager::GetInstance().Process(mainloop);
 
     // Make sure the tasks are executed in the order of posting.
     EXPECT_STREQ("abc", str.c_str());
@@ -120,12 +121,12 @@ TEST(TaskRunner, TestMultipleThreads)
         FD_ZERO(&mainloop.mWriteFdSet);
         FD_ZERO(&mainloop.mErrorFdSet);
 
-        taskRunner.Update(mainloop);
+        otbr::MainloopManager::GetInstance().Update(mainloop);
         rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
                       &mainloop.mTimeout);
         EXPECT_EQ(1, rval);
 
-        taskRunner.Process(mainloop);
+        otbr::MainloopManager::GetInstance().Process(mainloop);
     }
 
     for (auto &th : threads)
@@ -161,12 +162,12 @@ TEST(TaskRunner, TestPostAndWait)
         FD_ZERO(&mainloop.mWriteFdSet);
         FD_ZERO(&mainloop.mErrorFdSet);
 
-        taskRunner.Update(mainloop);
+        otbr::MainloopManager::GetInstance().Update(mainloop);
         rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
                       &mainloop.mTimeout);
         EXPECT_EQ(1, rval);
 
-        taskRunner.Process(mainloop);
+        otbr::MainloopManager::GetInstance().Process(mainloop);
     }
 
     for (auto &th : threads)
@@ -202,12 +203,12 @@ TEST(TaskRunner, TestDelayedTasks)
         FD_ZERO(&mainloop.mWriteFdSet);
         FD_ZERO(&mainloop.mErrorFdSet);
 
-        taskRunner.Update(mainloop);
+        otbr::MainloopManager::GetInstance().Update(mainloop);
         rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
                       &mainloop.mTimeout);
         EXPECT_TRUE(rval >= 0 || errno == EINTR);
 
-        taskRunner.Process(mainloop);
+        otbr::MainloopManager::GetInstance().Process(mainloop);
     }
 
     for (auto &th : threads)
@@ -239,18 +240,52 @@ TEST(TaskRunner, TestDelayedTasksOrder)
         FD_ZERO(&mainloop.mWriteFdSet);
         FD_ZERO(&mainloop.mErrorFdSet);
 
-        taskRunner.Update(mainloop);
+        otbr::MainloopManager::GetInstance().Update(mainloop);
         rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
                       &mainloop.mTimeout);
         EXPECT_TRUE(rval >= 0 || errno == EINTR);
 
-        taskRunner.Process(mainloop);
+        otbr::MainloopManager::GetInstance().Process(mainloop);
     }
 
     // Make sure that tasks with smaller delay are executed earlier.
     EXPECT_STREQ("bac", str.c_str());
 }
 
+TEST(TaskRunner, TestMixedPostsOrder)
+{
+    std::string      str;
+    otbr::TaskRunner taskRunner;
+
+    // Expired delayed tasks and tasks posted without delay run in the order of posting.
+    taskRunner.Post(std::chrono::milliseconds(0), [&]() { str.push_back('a'); });
+    taskRunner.Post([&]() { str.push_back('b'); });
+    taskRunner.Post(std::chrono::milliseconds(0), [&]() { str.push_back('c'); });
+    taskRunner.Post([&]() { str.push_back('d'); });
+
+    while (str.size() < 4)
+    {
+        int                   rval;
+        otbr::MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {2, 0};
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        otbr::MainloopManager::GetInstance().Update(mainloop);
+        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                      &mainloop.mTimeout);
+        EXPECT_TRUE(rval >= 0 || errno == EINTR);
+
+        otbr::MainloopManager::GetInstance().Process(mainloop);
+    }
+
+    EXPECT_STREQ("abcd", str.c_str());
+}
+
 TEST(TaskRunner, TestCancelDelayedTasks)
 {
     std::string              str;
@@ -289,12 +324,12 @@ TEST(TaskRunner, TestCancelDelayedTasks)
         FD_ZERO(&mainloop.mWriteFdSet);
         FD_ZERO(&mainloop.mErrorFdSet);
 
-        taskRunner.Update(mainloop);
+        otbr::MainloopManager::GetInstance().Update(mainloop);
         rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
                       &mainloop.mTimeout);
         EXPECT_TRUE(rval >= 0 || errno == EINTR);
 
-        taskRunner.Process(mainloop);
+        otbr::MainloopManager::GetInstance().Process(mainloop);
     }
 
     // Make sure the delayed task was not executed.
@@ -332,12 +367,12 @@ TEST(TaskRunner, TestAllAPIs)
         FD_ZERO(&mainloop.mWriteFdSet);
         FD_ZERO(&mainloop.mErrorFdSet);
 
-        taskRunner.Update(mainloop);
+        otbr::MainloopManager::GetInstance().Update(mainloop);
         rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
                       &mainloop.mTimeout);
         EXPECT_TRUE(rval >= 0 || errno == EINTR);
 
-        taskRunner.Process(mainloop);
+        otbr::MainloopManager::GetInstance().Process(mainloop);
     }
 
     for (auto &th : threads)
@@ -347,3 +382,178 @@ TEST(TaskRunner, TestAllAPIs)
 
     EXPECT_EQ(30, counter.load());
 }
+
+TEST(TaskRunner, TestPostStressFromMultipleThreads)
+{
+    static constexpr int kNumThreads        = 8;
+    static constexpr int kNumTasksPerThread = 20000;
+
+    otbr::TaskRunner         taskRunner;
+    std::vector<std::thread> threads;
+    std::vector<int>         lastSeq(kNumThreads, -1);
+    std::atomic<int>         counter{0};
+    bool                     inOrder = true;
+
+    for (int i = 0; i < kNumThreads; ++i)
+    {
+        threads.emplace_back([&, i]() {
+            for (int seq = 0; seq < kNumTasksPerThread; ++seq)
+            {
+                taskRunner.Post([&, i, seq]() {
+                    // Tasks from the same thread must be executed in the order of posting.
+                    inOrder = inOrder && (lastSeq[i] + 1 == seq);
+                    lastSeq[i] = seq;
+                    ++counter;
+                });
+            }
+        });
+    }
+
+    while (counter.load() < kNumThreads * kNumTasksPerThread)
+    {
+        int                   rval;
+        otbr::MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {2, 0};
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        otbr::MainloopManager::GetInstance().Update(mainloop);
+        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                      &mainloop.mTimeout);
+        ASSERT_TRUE(rval > 0 || (rval == -1 && errno == EINTR));
+
+        otbr::MainloopManager::GetInstance().Process(mainloop);
+    }
+
+    for (auto &th : threads)
+    {
+        th.join();
+    }
+
+    EXPECT_TRUE(inOrder);
+    EXPECT_EQ(kNumThreads * kNumTasksPerThread, counter.load());
+}
+
+TEST(TaskRunner, TestPostRacingWithProcessIsNotLost)
+{
+    static constexpr int kNumThreads        = 4;
+    static constexpr int kNumTasksPerThread = 5000;
+
+    otbr::TaskRunner         taskRunner;
+    std::vector<std::thread> threads;
+    std::atomic<int>         executed[kNumThreads];
+    std::atomic<int>         counter{0};
+
+    for (std::atomic<int> &count : executed)
+    {
+        count = 0;
+    }
+
+    // Each thread posts its next task as soon as the previous one has run, so that posts keep racing
+    // with the mainloop clearing the pending wakeup and draining the queue.
+    for (int i = 0; i < kNumThreads; ++i)
+    {
+        threads.emplace_back([&, i]() {
+            for (int seq = 0; seq < kNumTasksPerThread; ++seq)
+            {
+                taskRunner.Post([&, i]() {
+                    ++executed[i];
+                    ++counter;
+                });
+
+                while (executed[i].load() <= seq)
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    while (counter.load() < kNumThreads * kNumTasksPerThread)
+    {
+        int                   rval;
+        otbr::MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {2, 0};
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        otbr::MainloopManager::GetInstance().Update(mainloop);
+        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                      &mainloop.mTimeout);
+
+        // A timeout means a posted task was left in the queue without waking up the mainloop.
+        ASSERT_TRUE(rval > 0 || (rval == -1 && errno == EINTR));
+
+        otbr::MainloopManager::GetInstance().Process(mainloop);
+    }
+
+    for (auto &th : threads)
+    {
+        th.join();
+    }
+
+    EXPECT_EQ(kNumThreads * kNumTasksPerThread, counter.load());
+}
+
+TEST(TaskRunner, BenchmarkPostFromForeignThreads)
+{
+    static constexpr int kNumThreads        = 4;
+    static constexpr int kNumTasksPerThread = 50000;
+
+    otbr::TaskRunner         taskRunner;
+    std::vector<std::thread> threads;
+    std::atomic<int>         counter{0};
+    int                      wakeups = 0;
+    otbr::Timepoint          start   = otbr::Clock::now();
+
+    for (int i = 0; i < kNumThreads; ++i)
+    {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < kNumTasksPerThread; ++j)
+            {
+                taskRunner.Post([&]() { ++counter; });
+            }
+        });
+    }
+
+    while (counter.load() < kNumThreads * kNumTasksPerThread)
+    {
+        otbr::MainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {2, 0};
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        otbr::MainloopManager::GetInstance().Update(mainloop);
+        if (select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                   &mainloop.mTimeout) > 0)
+        {
+            ++wakeups;
+        }
+
+        otbr::MainloopManager::GetInstance().Process(mainloop);
+    }
+
+    for (auto &th : threads)
+    {
+        th.join();
+    }
+
+    printf("%d tasks posted from %d threads in %lld us with %d wakeups\n", kNumThreads * kNumTasksPerThread,
+           kNumThreads,
+           static_cast<long long>(
+               std::chrono::duration_cast<otbr::Microseconds>(otbr::Clock::now() - start).count()),
+           wakeups);
+    EXPECT_EQ(kNumThreads * kNumTasksPerThread, counter.load());
+}
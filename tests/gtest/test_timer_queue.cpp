@@ -0,0 +1,233 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/timer_queue.hpp"
+
+using otbr::Clock;
+using otbr::Milliseconds;
+using otbr::TimerId;
+using otbr::TimerTask;
+using otbr::Timepoint;
+
+template <typename QueueType> class TimerQueueTest : public testing::Test
+{
+protected:
+    std::string RunExpired(Timepoint aNow)
+    {
+        TimerTask task;
+
+        while (mQueue.PopExpired(aNow, task))
+        {
+            task();
+        }
+
+        return mTrace;
+    }
+
+    TimerTask Append(char aChar)
+    {
+        return [this, aChar]() { mTrace.push_back(aChar); };
+    }
+
+    QueueType   mQueue;
+    std::string mTrace;
+};
+
+typedef testing::Types<otbr::TimerHeap, otbr::TimerWheel> TimerQueueTypes;
+TYPED_TEST_SUITE(TimerQueueTest, TimerQueueTypes);
+
+TYPED_TEST(TimerQueueTest, TestExpireInDeadlineOrder)
+{
+    Timepoint now = Clock::now();
+
+    this->mQueue.Add(now + Milliseconds(10), this->Append('a'));
+    this->mQueue.Add(now + Milliseconds(9), this->Append('b'));
+    this->mQueue.Add(now + Milliseconds(10), this->Append('c'));
+    this->mQueue.Add(now, this->Append('d'));
+
+    EXPECT_FALSE(this->mQueue.IsEmpty());
+    EXPECT_EQ(now, this->mQueue.GetNextDeadline());
+
+    EXPECT_EQ("d", this->RunExpired(now));
+    EXPECT_EQ(now + Milliseconds(9), this->mQueue.GetNextDeadline());
+    EXPECT_EQ("dbac", this->RunExpired(now + Milliseconds(20)));
+    EXPECT_TRUE(this->mQueue.IsEmpty());
+}
+
+TYPED_TEST(TimerQueueTest, TestRemove)
+{
+    Timepoint now = Clock::now();
+    TimerId   a   = this->mQueue.Add(now + Milliseconds(10), this->Append('a'));
+    TimerId   b   = this->mQueue.Add(now + Milliseconds(20), this->Append('b'));
+
+    this->mQueue.Add(now + Milliseconds(30), this->Append('c'));
+
+    EXPECT_NE(0u, a);
+    EXPECT_NE(a, b);
+
+    this->mQueue.Remove(b);
+    EXPECT_EQ("ac", this->RunExpired(now + Milliseconds(40)));
+
+    // Removing expired or unknown timers is harmless.
+    this->mQueue.Remove(a);
+    this->mQueue.Remove(0);
+    this->mQueue.Remove(100);
+    EXPECT_TRUE(this->mQueue.IsEmpty());
+}
+
+TYPED_TEST(TimerQueueTest, TestLongDelays)
+{
+    Timepoint now = Clock::now();
+
+    // Deadlines which wrap around the wheel more than once.
+    this->mQueue.Add(now + Milliseconds(1000), this->Append('a'));
+    this->mQueue.Add(now + Milliseconds(256 + 5), this->Append('b'));
+    this->mQueue.Add(now + Milliseconds(5), this->Append('c'));
+
+    EXPECT_EQ(now + Milliseconds(5), this->mQueue.GetNextDeadline());
+    EXPECT_EQ("c", this->RunExpired(now + Milliseconds(100)));
+    EXPECT_EQ(now + Milliseconds(256 + 5), this->mQueue.GetNextDeadline());
+    EXPECT_EQ("cb", this->RunExpired(now + Milliseconds(500)));
+    EXPECT_EQ("cba", this->RunExpired(now + Milliseconds(1000)));
+    EXPECT_TRUE(this->mQueue.IsEmpty());
+}
+
+TYPED_TEST(TimerQueueTest, TestNextDeadlineAfterRemove)
+{
+    Timepoint now = Clock::now();
+    TimerId   a   = this->mQueue.Add(now + Milliseconds(5), this->Append('a'));
+
+    this->mQueue.Add(now + Milliseconds(300), this->Append('b'));
+    EXPECT_EQ(now + Milliseconds(5), this->mQueue.GetNextDeadline());
+
+    this->mQueue.Add(now + Milliseconds(2), this->Append('c'));
+    EXPECT_EQ(now + Milliseconds(2), this->mQueue.GetNextDeadline());
+
+    EXPECT_EQ("c", this->RunExpired(now + Milliseconds(3)));
+    EXPECT_EQ(now + Milliseconds(5), this->mQueue.GetNextDeadline());
+
+    this->mQueue.Remove(a);
+    EXPECT_EQ("cb", this->RunExpired(now + Milliseconds(300)));
+}
+
+TEST(TimerWheel, TestRemoveReleasesEntry)
+{
+    otbr::TimerWheel wheel;
+    TimerId          timerId;
+
+    timerId = wheel.Add(Clock::now() + Milliseconds(1000), []() {});
+    EXPECT_FALSE(wheel.IsEmpty());
+
+    wheel.Remove(timerId);
+    EXPECT_TRUE(wheel.IsEmpty());
+}
+
+TEST(TimerWheel, TestStaleIdAfterRecycle)
+{
+    otbr::TimerWheel wheel;
+    Timepoint        now = Clock::now();
+    TimerId          oldId;
+    TimerId          newId;
+
+    oldId = wheel.Add(now + Milliseconds(10), []() {});
+    wheel.Remove(oldId);
+
+    // The entry is recycled, removing it through the stale ID must be a no-op.
+    newId = wheel.Add(now + Milliseconds(10), []() {});
+    EXPECT_NE(oldId, newId);
+
+    wheel.Remove(oldId);
+    EXPECT_FALSE(wheel.IsEmpty());
+
+    wheel.Remove(newId);
+    EXPECT_TRUE(wheel.IsEmpty());
+}
+
+template <typename QueueType> static std::chrono::nanoseconds BenchmarkTimerQueue(size_t aNumTimers)
+{
+    QueueType            queue;
+    std::mt19937         random(1);
+    Timepoint            start = Clock::now();
+    Timepoint            now   = start;
+    TimerTask            task;
+    std::vector<TimerId> ids;
+    size_t               fired = 0;
+
+    // Simulate short protocol timers: most of them are cancelled
+    // before expiring and the rest expire within a few seconds.
+    for (size_t i = 1; i <= aNumTimers; i++)
+    {
+        ids.push_back(queue.Add(now + Milliseconds(random() % 5000), [&fired]() { ++fired; }));
+
+        if (i % 4 != 0)
+        {
+            queue.Remove(ids[random() % ids.size()]);
+        }
+
+        if (i % 16 == 0)
+        {
+            now += Milliseconds(1);
+
+            while (queue.PopExpired(now, task))
+            {
+                task();
+            }
+        }
+    }
+
+    while (!queue.IsEmpty())
+    {
+        now += Milliseconds(1);
+
+        while (queue.PopExpired(now, task))
+        {
+            task();
+        }
+    }
+
+    return Clock::now() - start;
+}
+
+TEST(TimerQueue, BenchmarkHeapVsWheel)
+{
+    static constexpr size_t kNumTimers = 100000;
+
+    auto heapDuration  = BenchmarkTimerQueue<otbr::TimerHeap>(kNumTimers);
+    auto wheelDuration = BenchmarkTimerQueue<otbr::TimerWheel>(kNumTimers);
+
+    printf("%zu timers: heap %lld us, wheel %lld us\n", kNumTimers,
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(heapDuration).count()),
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(wheelDuration).count()));
+}
@@ -0,0 +1,273 @@
+/*
+ *    Copyright (c) 2025, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "trel_dnssd/trel_peer_table.hpp"
+
+using otbr::TrelDnssd::PeerTable;
+
+struct PeerChange
+{
+    uint16_t mPort;
+    uint8_t  mTxtByte;
+    bool     mRemoved;
+};
+
+static PeerTable::Peer MakePeer(uint16_t aPort, uint8_t aTxtByte = 0)
+{
+    PeerTable::Peer peer;
+
+    memset(&peer.mSockAddr, 0, sizeof(peer.mSockAddr));
+    memset(&peer.mExtAddr, 0, sizeof(peer.mExtAddr));
+    peer.mSockAddr.mAddress.mFields.m8[0]  = 0xfe;
+    peer.mSockAddr.mAddress.mFields.m8[1]  = 0x80;
+    peer.mSockAddr.mAddress.mFields.m8[15] = static_cast<uint8_t>(aPort);
+    peer.mSockAddr.mPort                   = aPort;
+    peer.mExtAddr.m8[0]                    = static_cast<uint8_t>(aPort >> 8);
+    peer.mExtAddr.m8[1]                    = static_cast<uint8_t>(aPort);
+    peer.mTxtData                          = {aTxtByte};
+
+    return peer;
+}
+
+static std::vector<PeerChange> Flush(PeerTable &aTable)
+{
+    std::vector<PeerChange> changes;
+
+    aTable.FlushNotifications([&changes](const PeerTable::Peer &aPeer, bool aRemoved) {
+        changes.push_back({aPeer.mSockAddr.mPort, aPeer.mTxtData[0], aRemoved});
+    });
+
+    return changes;
+}
+
+TEST(TrelPeerTable, AddAndRemoveArePeerChanges)
+{
+    PeerTable               table(8);
+    std::vector<PeerChange> changes;
+
+    table.Add("peer1", MakePeer(1000));
+    ASSERT_NE(table.Find("peer1"), nullptr);
+    EXPECT_TRUE(table.HasPendingNotifications());
+
+    changes = Flush(table);
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_EQ(changes[0].mPort, 1000);
+    EXPECT_FALSE(changes[0].mRemoved);
+    EXPECT_FALSE(table.HasPendingNotifications());
+
+    table.Remove("peer1");
+    EXPECT_EQ(table.Find("peer1"), nullptr);
+
+    changes = Flush(table);
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_EQ(changes[0].mPort, 1000);
+    EXPECT_TRUE(changes[0].mRemoved);
+}
+
+TEST(TrelPeerTable, PeerIsRemovedWithItsLastInstance)
+{
+    PeerTable               table(8);
+    std::vector<PeerChange> changes;
+
+    table.Add("stale", MakePeer(1000));
+    table.Add("fresh", MakePeer(1000));
+    Flush(table);
+
+    table.Remove("stale");
+    EXPECT_TRUE(Flush(table).empty());
+
+    table.Remove("fresh");
+    changes = Flush(table);
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_TRUE(changes[0].mRemoved);
+    EXPECT_EQ(table.GetSize(), 0u);
+}
+
+TEST(TrelPeerTable, OldestInstanceIsEvictedWhenFull)
+{
+    PeerTable               table(3);
+    std::vector<PeerChange> changes;
+
+    table.Add("peer1", MakePeer(1001));
+    table.Add("peer2", MakePeer(1002));
+    table.Add("peer3", MakePeer(1003));
+    Flush(table);
+
+    // Re-adding an instance makes it the most recently discovered one.
+    table.Add("peer1", MakePeer(1001, 1));
+    table.Add("peer4", MakePeer(1004));
+
+    EXPECT_EQ(table.GetSize(), 3u);
+    EXPECT_NE(table.Find("peer1"), nullptr);
+    EXPECT_EQ(table.Find("peer2"), nullptr);
+    EXPECT_NE(table.Find("peer3"), nullptr);
+    EXPECT_NE(table.Find("peer4"), nullptr);
+
+    changes = Flush(table);
+    ASSERT_EQ(changes.size(), 3u);
+    EXPECT_EQ(changes[0].mPort, 1001);
+    EXPECT_EQ(changes[0].mTxtByte, 1);
+    EXPECT_FALSE(changes[0].mRemoved);
+    EXPECT_EQ(changes[1].mPort, 1002);
+    EXPECT_TRUE(changes[1].mRemoved);
+    EXPECT_EQ(changes[2].mPort, 1004);
+    EXPECT_FALSE(changes[2].mRemoved);
+}
+
+TEST(TrelPeerTable, ChangesAreCoalescedPerPeer)
+{
+    PeerTable               table(8);
+    std::vector<PeerChange> changes;
+
+    table.Add("peer1", MakePeer(1001));
+    table.Add("peer2", MakePeer(1002));
+    table.Add("peer1", MakePeer(1001, 1));
+    table.Add("peer1", MakePeer(1001, 2));
+    table.Remove("peer2");
+
+    // `peer2` came and went within the batch, so it is not reported at all.
+    changes = Flush(table);
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_EQ(changes[0].mPort, 1001);
+    EXPECT_EQ(changes[0].mTxtByte, 2);
+    EXPECT_FALSE(changes[0].mRemoved);
+
+    table.Add("peer2", MakePeer(1002));
+    Flush(table);
+    table.Remove("peer2");
+    table.Add("peer2", MakePeer(1002, 1));
+
+    changes = Flush(table);
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_EQ(changes[0].mPort, 1002);
+    EXPECT_EQ(changes[0].mTxtByte, 1);
+    EXPECT_FALSE(changes[0].mRemoved);
+
+    table.Clear();
+    changes = Flush(table);
+    ASSERT_EQ(changes.size(), 2u);
+    EXPECT_TRUE(changes[0].mRemoved);
+    EXPECT_TRUE(changes[1].mRemoved);
+}
+
+TEST(TrelPeerTable, BenchmarkInstanceChurn)
+{
+    constexpr uint32_t kCapacity      = OTBR_CONFIG_TREL_PEER_TABLE_SIZE;
+    constexpr uint32_t kNumInstances  = 2 * kCapacity;
+    constexpr uint32_t kNumEvents     = 20000;
+    constexpr uint32_t kEventsPerTurn = 200;
+
+    std::vector<std::string> names;
+
+    for (uint32_t i = 0; i < kNumInstances; i++)
+    {
+        names.push_back("peer" + std::to_string(i));
+    }
+
+    auto run = [&names](uint32_t aEventsPerTurn, uint32_t &aNumChanges) {
+        PeerTable                table(kCapacity);
+        std::map<uint16_t, bool> visiblePeers;
+        uint32_t                 seed  = 1;
+        auto                     start = std::chrono::steady_clock::now();
+        double                   duration;
+
+        auto apply = [&visiblePeers, &aNumChanges](const PeerTable::Peer &aPeer, bool aRemoved) {
+            aNumChanges++;
+
+            if (aRemoved)
+            {
+                // Only peers reported as added can be reported as removed.
+                EXPECT_EQ(visiblePeers.erase(aPeer.mSockAddr.mPort), 1u);
+            }
+            else
+            {
+                visiblePeers[aPeer.mSockAddr.mPort] = true;
+            }
+        };
+
+        aNumChanges = 0;
+
+        for (uint32_t i = 0; i < kNumEvents; i++)
+        {
+            uint32_t instance;
+
+            seed = seed * 1103515245 + 12345;
+
+            // Most of an mDNS storm hits a small set of flapping instances.
+            instance = (seed >> 8) % ((seed >> 20) % 4 == 0 ? kNumInstances : kNumInstances / 64);
+
+            if ((seed >> 4) % 2 == 0)
+            {
+                table.Add(names[instance], MakePeer(static_cast<uint16_t>(instance + 1)));
+            }
+            else
+            {
+                table.Remove(names[instance]);
+            }
+
+            EXPECT_LE(table.GetSize(), size_t{kCapacity});
+
+            if ((i + 1) % aEventsPerTurn == 0)
+            {
+                table.FlushNotifications(apply);
+            }
+        }
+
+        table.FlushNotifications(apply);
+        duration = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        EXPECT_EQ(visiblePeers.size(), table.GetSize());
+
+        table.Clear();
+        table.FlushNotifications(apply);
+        EXPECT_TRUE(visiblePeers.empty());
+
+        return duration;
+    };
+
+    uint32_t eachChanges;
+    uint32_t batchedChanges;
+    double   eachDuration    = run(/* aEventsPerTurn */ 1, eachChanges);
+    double   batchedDuration = run(kEventsPerTurn, batchedChanges);
+
+    EXPECT_LT(batchedChanges, eachChanges);
+
+    printf("%u TREL instance events: %.0f events/s with %u peer changes, %.0f events/s with %u batched changes\n",
+           kNumEvents, kNumEvents / eachDuration * 1e6, eachChanges, kNumEvents / batchedDuration * 1e6,
+           batchedChanges);
+}
@@ -29,7 +29,10 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
+
 #include <arpa/inet.h>
+#include <poll.h>
 #include <sys/socket.h>
 #include <unistd.h>
 
@@ -46,6 +49,7 @@ class UdpProxyTest : public otbr::UdpProxy::Dependencies
 public:
     UdpProxyTest(void)
         : mForwarded(false)
+        , mNumForwarded(0)
     {
     }
 
@@ -56,6 +60,7 @@ public:
                          const otbr::UdpProxy &aUdpProxy) override
     {
         mForwarded = true;
+        mNumForwarded++;
         assert(aLength < kMaxUdpSize);
 
         memcpy(mPayload, aUdpPayload, aLength);
@@ -68,6 +73,7 @@ public:
     }
 
     bool         mForwarded;
+    uint32_t     mNumForwarded;
     uint8_t      mPayload[kMaxUdpSize];
     uint16_t     mLength;
     otIp6Address mRemoteAddress;
@@ -75,6 +81,26 @@ public:
     uint16_t     mLocalPort;
 };
 
+static void RunMainloopOnce(suseconds_t aTimeoutUs = 100000)
+{
+    otbr::MainloopContext context;
+
+    context.mMaxFd   = -1;
+    context.mTimeout = {0, aTimeoutUs};
+    FD_ZERO(&context.mReadFdSet);
+    FD_ZERO(&context.mWriteFdSet);
+    FD_ZERO(&context.mErrorFdSet);
+
+    otbr::MainloopManager::GetInstance().Update(context);
+    if (select(context.mMaxFd + 1, &context.mReadFdSet, &context.mWriteFdSet, &context.mErrorFdSet,
+               &context.mTimeout) < 0)
+    {
+        perror("select failed");
+        exit(EXIT_FAILURE);
+    }
+    otbr::MainloopManager::GetInstance().Process(context);
+}
+
 TEST(UdpProxy, UdpProxyForwardCorrectlyWhenActive)
 {
     UdpProxyTest   tester;
@@ -170,6 +196,9 @@ TEST(UdpProxy, UdpProxySendToPeerCorrectlyWhenActive)
         {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x01}};
     udpProxy.SendToPeer(reinterpret_cast<const uint8_t *>(kHello.c_str()), kHello.size(), peerAddress, port);
 
+    // The datagrams queued by SendToPeer() are sent before the main loop waits.
+    RunMainloopOnce();
+
     // Receive the UDP packet
     socklen_t   len = sizeof(listenAddr);
     int         n   = recvfrom(sockFd, (char *)recvBuf, kMaxUdpSize, MSG_WAITALL, (struct sockaddr *)&listenAddr, &len);
@@ -180,3 +209,91 @@ TEST(UdpProxy, UdpProxySendToPeerCorrectlyWhenActive)
 
     udpProxy.Stop();
 }
+
+TEST(UdpProxy, BenchmarkLoopbackThroughput)
+{
+    constexpr uint32_t kNumPackets = 20480;
+    constexpr uint32_t kChunkSize  = 64;
+    constexpr uint16_t kPeerPort   = 12346;
+
+    UdpProxyTest       tester;
+    otbr::UdpProxy     udpProxy(tester);
+    int                sockFd = socket(AF_INET, SOCK_DGRAM, 0);
+    struct sockaddr_in proxyAddr;
+    struct sockaddr_in peerAddr;
+    uint8_t            payload[100];
+    uint32_t           numReceived = 0;
+    otIp6Address       peerAddress = {
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x01}};
+
+    ASSERT_GE(sockFd, 0);
+    memset(payload, 0xa5, sizeof(payload));
+
+    memset(&peerAddr, 0, sizeof(peerAddr));
+    peerAddr.sin_family      = AF_INET;
+    peerAddr.sin_port        = htons(kPeerPort);
+    peerAddr.sin_addr.s_addr = inet_addr("127.0.0.1");
+    ASSERT_EQ(bind(sockFd, reinterpret_cast<const struct sockaddr *>(&peerAddr), sizeof(peerAddr)), 0);
+
+    udpProxy.Start(kTestThreadBaPort);
+    ASSERT_NE(udpProxy.GetHostPort(), 0);
+
+    memset(&proxyAddr, 0, sizeof(proxyAddr));
+    proxyAddr.sin_family      = AF_INET;
+    proxyAddr.sin_port        = htons(udpProxy.GetHostPort());
+    proxyAddr.sin_addr.s_addr = inet_addr("127.0.0.1");
+
+    // From peers to the Thread network, in chunks small enough for the socket buffer.
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t sent = 0; sent < kNumPackets; sent += kChunkSize)
+    {
+        for (uint32_t i = 0; i < kChunkSize; i++)
+        {
+            ASSERT_EQ(sendto(sockFd, payload, sizeof(payload), 0, reinterpret_cast<const struct sockaddr *>(&proxyAddr),
+                             sizeof(proxyAddr)),
+                      static_cast<ssize_t>(sizeof(payload)));
+        }
+
+        while (tester.mNumForwarded < sent + kChunkSize)
+        {
+            RunMainloopOnce();
+        }
+    }
+
+    double forwardDuration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_EQ(tester.mNumForwarded, kNumPackets);
+
+    // From the Thread network to peers.
+    start = std::chrono::steady_clock::now();
+
+    for (uint32_t sent = 0; sent < kNumPackets; sent += kChunkSize)
+    {
+        for (uint32_t i = 0; i < kChunkSize; i++)
+        {
+            udpProxy.SendToPeer(payload, sizeof(payload), peerAddress, kPeerPort);
+        }
+
+        RunMainloopOnce(/* aTimeoutUs */ 0);
+
+        while (numReceived < sent + kChunkSize)
+        {
+            struct pollfd pollFd = {sockFd, POLLIN, 0};
+
+            ASSERT_EQ(poll(&pollFd, 1, 1000), 1);
+            ASSERT_EQ(recv(sockFd, payload, sizeof(payload), 0), static_cast<ssize_t>(sizeof(payload)));
+            numReceived++;
+        }
+    }
+
+    double sendDuration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_EQ(numReceived, kNumPackets);
+
+    printf("%u datagrams: forwarded %.0f datagrams/s, sent to peers %.0f datagrams/s\n", kNumPackets,
+           kNumPackets / forwardDuration, kNumPackets / sendDuration);
+
+    close(sockFd);
+    udpProxy.Stop();
+}
@@ -32,6 +32,7 @@ import urllib.error
 import ipaddress
 import json
 import re
+import time
 from threading import Thread
 
 rest_api_addr = "http://127.0.0.1:8081"
@@ -448,6 +449,42 @@ def diagnostics_test(thread_num):
         thread_num, has_content, valid))
 
 
+def diagnostics_since_test():
+    url = rest_api_addr + "/diagnostics"
+
+    response = urllib.request.urlopen(urllib.request.Request(url))
+    data = json.loads(response.read())
+    sequence = int(response.headers["X-Diagnostic-Sequence"])
+    assert diagnostics_check(data) in (1, 2)
+
+    # Only the nodes which changed since the first response are returned.
+    response = urllib.request.urlopen(
+        urllib.request.Request(url + "?since={}".format(sequence)))
+    delta = json.loads(response.read())
+    assert diagnostics_check(delta) in (1, 2)
+    assert int(response.headers["X-Diagnostic-Sequence"]) >= sequence
+
+    print(" /diagnostics?since={} : all {}, changed {} ".format(
+        sequence, len(data), len(delta)))
+
+
+def diagnostics_stream_test():
+    url = rest_api_addr + "/diagnostics"
+
+    request = urllib.request.Request(url,
+                                     headers={"Accept": "text/event-stream"})
+    response = urllib.request.urlopen(request)
+    assert response.headers["Content-Type"].startswith("text/event-stream")
+
+    events = 0
+    for line in response.read().decode().splitlines():
+        if line.startswith("data: "):
+            diagnostics_check([json.loads(line[len("data: "):])])
+            events += 1
+
+    print(" /diagnostics stream : events {} ".format(events))
+
+
 def error_test(thread_num):
     url = rest_api_addr + "/hello"
 
@@ -460,6 +497,35 @@ def error_test(thread_num):
     print(" /v1/hello : all {}, valid {} ".format(thread_num, valid))
 
 
+def node_benchmark(thread_num, request_num):
+    url = rest_api_addr + "/node"
+
+    latencies = [None] * thread_num
+
+    def run_client(url, result, index):
+        result[index] = []
+        for _ in range(request_num):
+            start = time.monotonic()
+            data = json.loads(
+                urllib.request.urlopen(urllib.request.Request(url)).read())
+            result[index].append(time.monotonic() - start)
+            assert node_check(data)
+
+    start = time.monotonic()
+    create_multi_thread(run_client, url, thread_num, latencies)
+    elapsed = time.monotonic() - start
+
+    latencies = sorted(latency for client in latencies for latency in client)
+    total = len(latencies)
+
+    print(" /node benchmark : {} clients x {} requests, {:.0f} req/s, "
+          "p50 {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms".format(
+              thread_num, request_num, total / elapsed,
+              latencies[total // 2] * 1000,
+              latencies[min(total - 1, total * 99 // 100)] * 1000,
+              latencies[-1] * 1000))
+
+
 def main():
     node_test(200)
     node_rloc_test(200)
@@ -472,7 +538,10 @@ def main():
     node_ext_panid_test(200)
     node_coprocessor_version_test(200)
     diagnostics_test(20)
+    diagnostics_since_test()
+    diagnostics_stream_test()
     error_test(10)
+    node_benchmark(20, 50)
 
     return 0
 